@@ -3623,6 +3623,14 @@ Cube<eT>::save(const std::string name, const file_type type, const bool print_st
     case arma_binary:
       save_okay = diskio::save_arma_binary(*this, name);
       break;
+      
+    case arma_compressed:
+      save_okay = diskio::save_arma_compressed(*this, name);
+      break;
+    
+    case npy_binary:
+      save_okay = diskio::save_npy_binary(*this, name);
+      break;
     
     case ppm_binary:
       save_okay = diskio::save_ppm_binary(*this, name);
@@ -3632,6 +3640,10 @@ Cube<eT>::save(const std::string name, const file_type type, const bool print_st
       save_okay = diskio::save_hdf5_binary(*this, name);
       break;
     
+    case hdf5_binary_compressed:
+      save_okay = diskio::save_hdf5_binary(*this, name, true);
+      break;
+    
     case hdf5_binary_trans:
       {
       Cube<eT> tmp;
@@ -3681,6 +3693,14 @@ Cube<eT>::save(std::ostream& os, const file_type type, const bool print_status)
     case arma_binary:
       save_okay = diskio::save_arma_binary(*this, os);
       break;
+      
+    case arma_compressed:
+      save_okay = diskio::save_arma_compressed(*this, os);
+      break;
+    
+    case npy_binary:
+      save_okay = diskio::save_npy_binary(*this, os);
+      break;
     
     case ppm_binary:
       save_okay = diskio::save_ppm_binary(*this, os);
@@ -3730,12 +3750,21 @@ Cube<eT>::load(const std::string name, const file_type type, const bool print_st
     case arma_binary:
       load_okay = diskio::load_arma_binary(*this, name, err_msg);
       break;
+      
+    case arma_compressed:
+      load_okay = diskio::load_arma_compressed(*this, name, err_msg);
+      break;
+    
+    case npy_binary:
+      load_okay = diskio::load_npy_binary(*this, name, err_msg);
+      break;
     
     case ppm_binary:
       load_okay = diskio::load_ppm_binary(*this, name, err_msg);
       break;
 
     case hdf5_binary:
+    case hdf5_binary_compressed:
       load_okay = diskio::load_hdf5_binary(*this, name, err_msg);
       break;
     
@@ -3808,6 +3837,14 @@ Cube<eT>::load(std::istream& is, const file_type type, const bool print_status)
     case arma_binary:
       load_okay = diskio::load_arma_binary(*this, is, err_msg);
       break;
+      
+    case arma_compressed:
+      load_okay = diskio::load_arma_compressed(*this, is, err_msg);
+      break;
+    
+    case npy_binary:
+      load_okay = diskio::load_npy_binary(*this, is, err_msg);
+      break;
     
     case ppm_binary:
       load_okay = diskio::load_ppm_binary(*this, is, err_msg);
@@ -3841,6 +3878,41 @@ Cube<eT>::load(std::istream& is, const file_type type, const bool print_status)
 
 
 
+//! load a range of slices of a cube from a file;
+//! only arma_binary, arma_compressed and hdf5_binary files are supported
+template<typename eT>
+inline
+bool
+Cube<eT>::load(const std::string name, const span& slice_span, const file_type type, const bool print_status)
+  {
+  arma_extra_debug_sigprint();
+  
+  std::string err_msg;
+  
+  const bool load_okay = diskio::load_slices(*this, name, slice_span, type, err_msg);
+  
+  if( (print_status == true) && (load_okay == false) )
+    {
+    if(err_msg.length() > 0)
+      {
+      arma_debug_warn("Cube::load(): ", err_msg, name);
+      }
+    else
+      {
+      arma_debug_warn("Cube::load(): couldn't read ", name);
+      }
+    }
+  
+  if(load_okay == false)
+    {
+    (*this).reset();
+    }
+  
+  return load_okay;
+  }
+
+
+
 //! save the cube to a file, without printing any error messages
 template<typename eT>
 inline
@@ -3893,6 +3965,103 @@ Cube<eT>::quiet_load(std::istream& is, const file_type type)
 
 
 
+//! number of bytes required by serialise()
+template<typename eT>
+inline
+uword
+Cube<eT>::serialised_size() const
+  {
+  arma_extra_debug_sigprint();
+  
+  return diskio::serialise(*this, 0, 0);
+  }
+
+
+
+//! write the cube into buf using the arma_binary format (as per save() into a stream), without going through iostreams;
+//! returns the number of bytes used, or zero if buf is too small
+template<typename eT>
+inline
+uword
+Cube<eT>::serialise(void* buf, const uword buf_n_bytes) const
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword n_bytes = (*this).serialised_size();
+  
+  if( (buf == 0) || (n_bytes > buf_n_bytes) )  { return 0; }
+  
+  diskio::serialise(*this, static_cast<char*>(buf), 0);
+  
+  return n_bytes;
+  }
+
+
+
+//! read the cube from buf, which holds data written by serialise() or save() using the arma_binary format;
+//! the data is always copied, as buf is read-only;
+//! returns false if buf doesn't hold a valid cube, in which case the cube is reset
+template<typename eT>
+inline
+bool
+Cube<eT>::deserialise(const void* buf, const uword buf_n_bytes)
+  {
+  arma_extra_debug_sigprint();
+  
+  uword pos = 0;
+  
+  const bool load_okay = (buf != 0) && diskio::deserialise(*this, static_cast<const char*>(buf), buf_n_bytes, pos, (char*) NULL);
+  
+  if(load_okay == false)  { (*this).reset(); }
+  
+  return load_okay;
+  }
+
+
+
+//! as per deserialise(const void*, const uword), but if copy_aux_mem is false,
+//! the cube uses the memory of buf directly (as per the advanced constructors), if the data is suitably aligned;
+//! buf must then remain valid and must not be modified by other means while the cube uses it
+template<typename eT>
+inline
+bool
+Cube<eT>::deserialise(void* buf, const uword buf_n_bytes, const bool copy_aux_mem)
+  {
+  arma_extra_debug_sigprint();
+  
+  uword pos = 0;
+  
+  char* buf_rw = (copy_aux_mem) ? (char*) NULL : static_cast<char*>(buf);
+  
+  const bool load_okay = (buf != 0) && diskio::deserialise(*this, static_cast<const char*>(buf), buf_n_bytes, pos, buf_rw);
+  
+  if(load_okay == false)  { (*this).reset(); }
+  
+  return load_okay;
+  }
+
+
+
+#if defined(ARMA_USE_CXX11)
+
+//! save the cube to a file on a background thread;
+//! the cube is copied before the function returns, and the file is written via a temporary file followed by renaming;
+//! if sync is true, the contents of the file are flushed to the storage device before renaming
+template<typename eT>
+arma_warn_unused
+inline
+std::future<bool>
+Cube<eT>::save_async(const std::string name, const file_type type, const bool sync) const
+  {
+  arma_extra_debug_sigprint();
+  
+  return async_save< Cube<eT> >::apply(*this, name, type, sync);
+  }
+
+#endif
+
+
+
 template<typename eT>
 inline
 typename Cube<eT>::iterator
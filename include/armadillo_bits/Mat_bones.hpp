@@ -490,12 +490,24 @@ class Mat : public Base< eT, Mat<eT> >
   inline bool load(const std::string   name, const file_type type = auto_detect, const bool print_status = true);
   inline bool load(      std::istream& is,   const file_type type = auto_detect, const bool print_status = true);
   
+  inline bool load(const std::string   name, const span& col_span, const file_type type = auto_detect, const bool print_status = true);
+  inline bool load(const std::string   name, const span& row_span, const span& col_span, const file_type type = auto_detect, const bool print_status = true);
+  
   inline bool quiet_save(const std::string   name, const file_type type = arma_binary) const;
   inline bool quiet_save(      std::ostream& os,   const file_type type = arma_binary) const;
   
   inline bool quiet_load(const std::string   name, const file_type type = auto_detect);
   inline bool quiet_load(      std::istream& is,   const file_type type = auto_detect);
   
+  inline uword serialised_size() const;
+  inline uword serialise(void* buf, const uword buf_n_bytes) const;
+  inline bool  deserialise(const void* buf, const uword buf_n_bytes);
+  inline bool  deserialise(      void* buf, const uword buf_n_bytes, const bool copy_aux_mem = true);
+  
+  #if defined(ARMA_USE_CXX11)
+  inline arma_warn_unused std::future<bool> save_async(const std::string name, const file_type type = arma_binary, const bool sync = false) const;
+  #endif
+  
   
   // for container-like functionality
   
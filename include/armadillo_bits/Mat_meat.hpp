@@ -6911,14 +6911,26 @@ Mat<eT>::save(const std::string name, const file_type type, const bool print_sta
       save_okay = diskio::save_arma_binary(*this, name);
       break;
       
+    case arma_compressed:
+      save_okay = diskio::save_arma_compressed(*this, name);
+      break;
+    
     case pgm_binary:
       save_okay = diskio::save_pgm_binary(*this, name);
       break;
     
+    case npy_binary:
+      save_okay = diskio::save_npy_binary(*this, name);
+      break;
+    
     case hdf5_binary:
       save_okay = diskio::save_hdf5_binary(*this, name);
       break;
     
+    case hdf5_binary_compressed:
+      save_okay = diskio::save_hdf5_binary(*this, name, true);
+      break;
+    
     case hdf5_binary_trans:
       {
       Mat<eT> tmp;
@@ -6973,10 +6985,18 @@ Mat<eT>::save(std::ostream& os, const file_type type, const bool print_status) c
       save_okay = diskio::save_arma_binary(*this, os);
       break;
       
+    case arma_compressed:
+      save_okay = diskio::save_arma_compressed(*this, os);
+      break;
+    
     case pgm_binary:
       save_okay = diskio::save_pgm_binary(*this, os);
       break;
     
+    case npy_binary:
+      save_okay = diskio::save_npy_binary(*this, os);
+      break;
+    
     default:
       if(print_status)  { arma_debug_warn("Mat::save(): unsupported file type"); }
       save_okay = false;
@@ -7025,12 +7045,21 @@ Mat<eT>::load(const std::string name, const file_type type, const bool print_sta
     case arma_binary:
       load_okay = diskio::load_arma_binary(*this, name, err_msg);
       break;
+    
+    case arma_compressed:
+      load_okay = diskio::load_arma_compressed(*this, name, err_msg);
+      break;
       
     case pgm_binary:
       load_okay = diskio::load_pgm_binary(*this, name, err_msg);
       break;
     
+    case npy_binary:
+      load_okay = diskio::load_npy_binary(*this, name, err_msg);
+      break;
+    
     case hdf5_binary:
+    case hdf5_binary_compressed:
       load_okay = diskio::load_hdf5_binary(*this, name, err_msg);
       break;
 
@@ -7108,10 +7137,18 @@ Mat<eT>::load(std::istream& is, const file_type type, const bool print_status)
       load_okay = diskio::load_arma_binary(*this, is, err_msg);
       break;
       
+    case arma_compressed:
+      load_okay = diskio::load_arma_compressed(*this, is, err_msg);
+      break;
+    
     case pgm_binary:
       load_okay = diskio::load_pgm_binary(*this, is, err_msg);
       break;
     
+    case npy_binary:
+      load_okay = diskio::load_npy_binary(*this, is, err_msg);
+      break;
+    
     default:
       if(print_status)  { arma_debug_warn("Mat::load(): unsupported file type"); }
       load_okay = false;
@@ -7130,6 +7167,76 @@ Mat<eT>::load(std::istream& is, const file_type type, const bool print_status)
       }
     }
   
+  if(load_okay == false)
+    {
+    (*this).reset();
+    }
+  
+  return load_okay;
+  }
+
+
+
+//! load a range of columns of a matrix from a file;
+//! only arma_binary, arma_compressed and hdf5_binary files are supported
+template<typename eT>
+inline
+bool
+Mat<eT>::load(const std::string name, const span& col_span, const file_type type, const bool print_status)
+  {
+  arma_extra_debug_sigprint();
+  
+  std::string err_msg;
+  
+  const bool load_okay = diskio::load_submat(*this, name, span::all, col_span, type, err_msg);
+  
+  if( (print_status == true) && (load_okay == false) )
+    {
+    if(err_msg.length() > 0)
+      {
+      arma_debug_warn("Mat::load(): ", err_msg, name);
+      }
+    else
+      {
+      arma_debug_warn("Mat::load(): couldn't read ", name);
+      }
+    }
+  
+  if(load_okay == false)
+    {
+    (*this).reset();
+    }
+  
+  return load_okay;
+  }
+
+
+
+//! load a submatrix (range of rows and columns) of a matrix from a file;
+//! only arma_binary, arma_compressed and hdf5_binary files are supported
+template<typename eT>
+inline
+bool
+Mat<eT>::load(const std::string name, const span& row_span, const span& col_span, const file_type type, const bool print_status)
+  {
+  arma_extra_debug_sigprint();
+  
+  std::string err_msg;
+  
+  const bool load_okay = diskio::load_submat(*this, name, row_span, col_span, type, err_msg);
+  
+  if( (print_status == true) && (load_okay == false) )
+    {
+    if(err_msg.length() > 0)
+      {
+      arma_debug_warn("Mat::load(): ", err_msg, name);
+      }
+    else
+      {
+      arma_debug_warn("Mat::load(): couldn't read ", name);
+      }
+    }
+  
   if(load_okay == false)
     {
     (*this).reset();
@@ -7192,6 +7299,103 @@ Mat<eT>::quiet_load(std::istream& is, const file_type type)
 
 
 
+//! number of bytes required by serialise()
+template<typename eT>
+inline
+uword
+Mat<eT>::serialised_size() const
+  {
+  arma_extra_debug_sigprint();
+  
+  return diskio::serialise(*this, 0, 0);
+  }
+
+
+
+//! write the matrix into buf using the arma_binary format (as per save() into a stream), without going through iostreams;
+//! returns the number of bytes used, or zero if buf is too small
+template<typename eT>
+inline
+uword
+Mat<eT>::serialise(void* buf, const uword buf_n_bytes) const
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword n_bytes = (*this).serialised_size();
+  
+  if( (buf == 0) || (n_bytes > buf_n_bytes) )  { return 0; }
+  
+  diskio::serialise(*this, static_cast<char*>(buf), 0);
+  
+  return n_bytes;
+  }
+
+
+
+//! read the matrix from buf, which holds data written by serialise() or save() using the arma_binary format;
+//! the data is always copied, as buf is read-only;
+//! returns false if buf doesn't hold a valid matrix, in which case the matrix is reset
+template<typename eT>
+inline
+bool
+Mat<eT>::deserialise(const void* buf, const uword buf_n_bytes)
+  {
+  arma_extra_debug_sigprint();
+  
+  uword pos = 0;
+  
+  const bool load_okay = (buf != 0) && diskio::deserialise(*this, static_cast<const char*>(buf), buf_n_bytes, pos, (char*) NULL);
+  
+  if(load_okay == false)  { (*this).reset(); }
+  
+  return load_okay;
+  }
+
+
+
+//! as per deserialise(const void*, const uword), but if copy_aux_mem is false,
+//! the matrix uses the memory of buf directly (as per the advanced constructors), if the data is suitably aligned;
+//! buf must then remain valid and must not be modified by other means while the matrix uses it
+template<typename eT>
+inline
+bool
+Mat<eT>::deserialise(void* buf, const uword buf_n_bytes, const bool copy_aux_mem)
+  {
+  arma_extra_debug_sigprint();
+  
+  uword pos = 0;
+  
+  char* buf_rw = (copy_aux_mem) ? (char*) NULL : static_cast<char*>(buf);
+  
+  const bool load_okay = (buf != 0) && diskio::deserialise(*this, static_cast<const char*>(buf), buf_n_bytes, pos, buf_rw);
+  
+  if(load_okay == false)  { (*this).reset(); }
+  
+  return load_okay;
+  }
+
+
+
+#if defined(ARMA_USE_CXX11)
+
+//! save the matrix to a file on a background thread;
+//! the matrix is copied before the function returns, and the file is written via a temporary file followed by renaming;
+//! if sync is true, the contents of the file are flushed to the storage device before renaming
+template<typename eT>
+arma_warn_unused
+inline
+std::future<bool>
+Mat<eT>::save_async(const std::string name, const file_type type, const bool sync) const
+  {
+  arma_extra_debug_sigprint();
+  
+  return async_save< Mat<eT> >::apply(*this, name, type, sync);
+  }
+
+#endif
+
+
+
 template<typename eT>
 inline
 Mat<eT>::row_iterator::row_iterator(Mat<eT>& in_M, const uword in_row)
@@ -330,6 +330,15 @@ class SpMat : public SpBase< eT, SpMat<eT> >
   inline bool quiet_load(const std::string   name, const file_type type = arma_binary);
   inline bool quiet_load(      std::istream& is,   const file_type type = arma_binary);
   
+  inline uword serialised_size() const;
+  inline uword serialise(void* buf, const uword buf_n_bytes) const;
+  inline bool  deserialise(const void* buf, const uword buf_n_bytes);
+  inline bool  deserialise(      void* buf, const uword buf_n_bytes, const bool copy_aux_mem = true);
+  
+  #if defined(ARMA_USE_CXX11)
+  inline arma_warn_unused std::future<bool> save_async(const std::string name, const file_type type = arma_binary, const bool sync = false) const;
+  #endif
+  
   // TODO: speed up loading of sparse matrices stored as text files (ie. raw_ascii and coord_ascii)
   // TODO: implement auto_detect for sparse matrices
   // TODO: modify docs to specify which formats are not applicable to sparse matrices
@@ -3672,11 +3672,19 @@ SpMat<eT>::save(const std::string name, const file_type type, const bool print_s
     case arma_binary:
       save_okay = diskio::save_arma_binary(*this, name);
       break;
+      
+    case arma_compressed:
+      save_okay = diskio::save_arma_compressed(*this, name);
+      break;
     
     case coord_ascii:
       save_okay = diskio::save_coord_ascii(*this, name);
       break;
     
+    case mtx_ascii:
+      save_okay = diskio::save_mtx_ascii(*this, name);
+      break;
+    
     default:
       if(print_status)  { arma_debug_warn("SpMat::save(): unsupported file type"); }
       save_okay = false;
@@ -3712,11 +3720,19 @@ SpMat<eT>::save(std::ostream& os, const file_type type, const bool print_status)
     case arma_binary:
       save_okay = diskio::save_arma_binary(*this, os);
       break;
+      
+    case arma_compressed:
+      save_okay = diskio::save_arma_compressed(*this, os);
+      break;
     
     case coord_ascii:
       save_okay = diskio::save_coord_ascii(*this, os);
       break;
     
+    case mtx_ascii:
+      save_okay = diskio::save_mtx_ascii(*this, os);
+      break;
+    
     default:
       if(print_status)  { arma_debug_warn("SpMat::save(): unsupported file type"); }
       save_okay = false;
@@ -3757,11 +3773,19 @@ SpMat<eT>::load(const std::string name, const file_type type, const bool print_s
     case arma_binary:
       load_okay = diskio::load_arma_binary(*this, name, err_msg);
       break;
+      
+    case arma_compressed:
+      load_okay = diskio::load_arma_compressed(*this, name, err_msg);
+      break;
     
     case coord_ascii:
       load_okay = diskio::load_coord_ascii(*this, name, err_msg);
       break;
     
+    case mtx_ascii:
+      load_okay = diskio::load_mtx_ascii(*this, name, err_msg);
+      break;
+    
     default:
       if(print_status)  { arma_debug_warn("SpMat::load(): unsupported file type"); }
       load_okay = false;
@@ -3817,11 +3841,19 @@ SpMat<eT>::load(std::istream& is, const file_type type, const bool print_status)
     case arma_binary:
       load_okay = diskio::load_arma_binary(*this, is, err_msg);
       break;
+      
+    case arma_compressed:
+      load_okay = diskio::load_arma_compressed(*this, is, err_msg);
+      break;
     
     case coord_ascii:
       load_okay = diskio::load_coord_ascii(*this, is, err_msg);
       break;
     
+    case mtx_ascii:
+      load_okay = diskio::load_mtx_ascii(*this, is, err_msg);
+      break;
+    
     default:
       if(print_status)  { arma_debug_warn("SpMat::load(): unsupported file type"); }
       load_okay = false;
@@ -3901,6 +3933,93 @@ SpMat<eT>::quiet_load(std::istream& is, const file_type type)
 
 
 
+//! number of bytes required by serialise()
+template<typename eT>
+inline
+uword
+SpMat<eT>::serialised_size() const
+  {
+  arma_extra_debug_sigprint();
+  
+  return diskio::serialise(*this, 0, 0);
+  }
+
+
+
+//! write the matrix into buf using the arma_binary format (as per save() into a stream), without going through iostreams;
+//! returns the number of bytes used, or zero if buf is too small
+template<typename eT>
+inline
+uword
+SpMat<eT>::serialise(void* buf, const uword buf_n_bytes) const
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword n_bytes = (*this).serialised_size();
+  
+  if( (buf == 0) || (n_bytes > buf_n_bytes) )  { return 0; }
+  
+  diskio::serialise(*this, static_cast<char*>(buf), 0);
+  
+  return n_bytes;
+  }
+
+
+
+//! read the matrix from buf, which holds data written by serialise() or save() using the arma_binary format;
+//! returns false if buf doesn't hold a valid matrix, in which case the matrix is reset
+template<typename eT>
+inline
+bool
+SpMat<eT>::deserialise(const void* buf, const uword buf_n_bytes)
+  {
+  arma_extra_debug_sigprint();
+  
+  uword pos = 0;
+  
+  const bool load_okay = (buf != 0) && diskio::deserialise(*this, static_cast<const char*>(buf), buf_n_bytes, pos, (char*) NULL);
+  
+  if(load_okay == false)  { (*this).reset(); }
+  
+  return load_okay;
+  }
+
+
+
+//! as per deserialise(const void*, const uword); sparse matrices always copy the data, so copy_aux_mem is ignored
+template<typename eT>
+inline
+bool
+SpMat<eT>::deserialise(void* buf, const uword buf_n_bytes, const bool copy_aux_mem)
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(copy_aux_mem);
+  
+  return (*this).deserialise(static_cast<const void*>(buf), buf_n_bytes);
+  }
+
+
+
+#if defined(ARMA_USE_CXX11)
+
+//! save the matrix to a file on a background thread;
+//! the matrix is copied before the function returns, and the file is written via a temporary file followed by renaming;
+//! if sync is true, the contents of the file are flushed to the storage device before renaming
+template<typename eT>
+arma_warn_unused
+inline
+std::future<bool>
+SpMat<eT>::save_async(const std::string name, const file_type type, const bool sync) const
+  {
+  arma_extra_debug_sigprint();
+  
+  return async_save< SpMat<eT> >::apply(*this, name, type, sync);
+  }
+
+#endif
+
+
+
 /**
  * Initialize the matrix to the specified size.  Data is not preserved, so the matrix is assumed to be entirely sparse (empty).
  */
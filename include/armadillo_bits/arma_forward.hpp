@@ -145,6 +145,9 @@ class glue_hist_default;
 class glue_histc;
 class glue_histc_default;
 
+class glue_quantile;
+class glue_quantile_default;
+
 class op_cx_scalar_times;
 class op_cx_scalar_plus;
 class op_cx_scalar_minus_pre;
@@ -252,7 +255,11 @@ enum file_type
   ppm_binary,         //!< Portable Pixel Map (colour image), used by the field and cube classes
   hdf5_binary,        //!< Open binary format, not specific to Armadillo, which can store arbitrary data
   hdf5_binary_trans,  //!< as per hdf5_binary, but save/load the data with columns transposed to rows
-  coord_ascii         //!< simple co-ordinate format for sparse matrices
+  coord_ascii,        //!< simple co-ordinate format for sparse matrices
+  arma_compressed,    //!< as per arma_binary, but with the data stored as independently compressed blocks
+  mtx_ascii,          //!< Matrix Market coordinate format for sparse matrices
+  hdf5_binary_compressed, //!< as per hdf5_binary, but with a chunked layout and compression (shuffle and deflate filters)
+  npy_binary              //!< NumPy .npy format
   };
 
 
@@ -28,6 +28,11 @@
 #endif
 
 
+#if !defined(ARMA_RNG_ALT) && !defined(ARMA_DONT_USE_PHILOX_RNG)
+  #define ARMA_USE_PHILOX_RNG
+#endif
+
+
 class arma_rng
   {
   public:
@@ -54,6 +59,11 @@ class arma_rng
   template<typename eT> struct randi;
   template<typename eT> struct randu;
   template<typename eT> struct randn;
+  template<typename eT> struct randg;
+  
+  #if defined(ARMA_USE_PHILOX_RNG)
+    inline static void philox_key(u32& k0, u32& k1);
+  #endif
   };
 
 
@@ -219,7 +229,15 @@ struct arma_rng::randi
   void
   fill(eT* mem, const uword N, const int a, const int b)
     {
-    #if   defined(ARMA_RNG_ALT)
+    #if   defined(ARMA_USE_PHILOX_RNG)
+      {
+      u32 k0, k1;
+      
+      arma_rng::philox_key(k0, k1);
+      
+      arma_rng_philox::fill(mem, N, arma_rng_philox::kind_randi, double(a), double(b), k0, k1);
+      }
+    #elif defined(ARMA_RNG_ALT)
       {
       return arma_rng_alt::randi_fill(mem, N, a, b);
       }
@@ -237,6 +255,27 @@ struct arma_rng::randi
 
 
 
+#if defined(ARMA_USE_PHILOX_RNG)
+
+//! key for arma_rng_philox, drawn from the sequential generator;
+//! this makes the values reproducible via set_seed()
+inline
+void
+arma_rng::philox_key(u32& k0, u32& k1)
+  {
+  const u32 r0 = u32( int(arma_rng::randi<int>()) );
+  const u32 r1 = u32( int(arma_rng::randi<int>()) );
+  const u32 r2 = u32( int(arma_rng::randi<int>()) );
+  const u32 r3 = u32( int(arma_rng::randi<int>()) );
+  
+  k0 = r0 ^ (r1 << 16);
+  k1 = r2 ^ (r3 << 16);
+  }
+
+#endif
+
+
+
 template<typename eT>
 struct arma_rng::randu
   {
@@ -264,21 +303,33 @@ struct arma_rng::randu
   void
   fill(eT* mem, const uword N)
     {
-    uword i,j;
-    
-    for(i=0, j=1; j < N; i+=2, j+=2)
+    #if defined(ARMA_USE_PHILOX_RNG)
       {
-      const eT tmp_i = eT( arma_rng::randu<eT>() );
-      const eT tmp_j = eT( arma_rng::randu<eT>() );
+      u32 k0, k1;
       
-      mem[i] = tmp_i;
-      mem[j] = tmp_j;
+      arma_rng::philox_key(k0, k1);
+      
+      arma_rng_philox::fill(mem, N, arma_rng_philox::kind_randu, double(0), double(1), k0, k1);
       }
-    
-    if(i < N)
+    #else
       {
-      mem[i] = eT( arma_rng::randu<eT>() );
+      uword i,j;
+      
+      for(i=0, j=1; j < N; i+=2, j+=2)
+        {
+        const eT tmp_i = eT( arma_rng::randu<eT>() );
+        const eT tmp_j = eT( arma_rng::randu<eT>() );
+        
+        mem[i] = tmp_i;
+        mem[j] = tmp_j;
+        }
+      
+      if(i < N)
+        {
+        mem[i] = eT( arma_rng::randu<eT>() );
+        }
       }
+    #endif
     }
   };
 
@@ -302,13 +353,21 @@ struct arma_rng::randu< std::complex<T> >
   void
   fill(std::complex<T>* mem, const uword N)
     {
-    for(uword i=0; i < N; ++i)
+    #if defined(ARMA_USE_PHILOX_RNG)
       {
-      const T a = T( arma_rng::randu<T>() );
-      const T b = T( arma_rng::randu<T>() );
-      
-      mem[i] = std::complex<T>(a, b);
+      arma_rng::randu<T>::fill( reinterpret_cast<T*>(mem), 2*N );
+      }
+    #else
+      {
+      for(uword i=0; i < N; ++i)
+        {
+        const T a = T( arma_rng::randu<T>() );
+        const T b = T( arma_rng::randu<T>() );
+        
+        mem[i] = std::complex<T>(a, b);
+        }
       }
+    #endif
     }
   };
 
@@ -362,17 +421,29 @@ struct arma_rng::randn
   void
   fill(eT* mem, const uword N)
     {
-    uword i, j;
-    
-    for(i=0, j=1; j < N; i+=2, j+=2)
+    #if defined(ARMA_USE_PHILOX_RNG)
       {
-      arma_rng::randn<eT>::dual_val( mem[i], mem[j] );
+      u32 k0, k1;
+      
+      arma_rng::philox_key(k0, k1);
+      
+      arma_rng_philox::fill(mem, N, arma_rng_philox::kind_randn, double(0), double(1), k0, k1);
       }
-    
-    if(i < N)
+    #else
       {
-      mem[i] = eT( arma_rng::randn<eT>() );
+      uword i, j;
+      
+      for(i=0, j=1; j < N; i+=2, j+=2)
+        {
+        arma_rng::randn<eT>::dual_val( mem[i], mem[j] );
+        }
+      
+      if(i < N)
+        {
+        mem[i] = eT( arma_rng::randn<eT>() );
+        }
       }
+    #endif
     }
   
   };
@@ -398,14 +469,66 @@ struct arma_rng::randn< std::complex<T> >
   void
   fill(std::complex<T>* mem, const uword N)
     {
-    for(uword i=0; i < N; ++i)
+    #if defined(ARMA_USE_PHILOX_RNG)
+      {
+      arma_rng::randn<T>::fill( reinterpret_cast<T*>(mem), 2*N );
+      }
+    #else
       {
-      mem[i] = std::complex<T>( arma_rng::randn< std::complex<T> >() );
+      for(uword i=0; i < N; ++i)
+        {
+        mem[i] = std::complex<T>( arma_rng::randn< std::complex<T> >() );
+        }
       }
+    #endif
     }
   
   };
 
 
 
+template<typename eT>
+struct arma_rng::randg
+  {
+  inline
+  static
+  void
+  fill(eT* mem, const uword N, const double a, const double b)
+    {
+    #if   defined(ARMA_USE_PHILOX_RNG)
+      {
+      u32 k0, k1;
+      
+      arma_rng::philox_key(k0, k1);
+      
+      arma_rng_philox::fill(mem, N, arma_rng_philox::kind_randg, a, b, k0, k1);
+      }
+    #elif defined(ARMA_USE_EXTERN_CXX11_RNG)
+      {
+      arma_rng_cxx11_instance.randg_fill(mem, N, a, b);
+      }
+    #elif defined(ARMA_USE_CXX11)
+      {
+      arma_rng_cxx11 local_arma_rng_cxx11_instance;
+      
+      typedef typename arma_rng_cxx11::seed_type seed_type;
+      
+      local_arma_rng_cxx11_instance.set_seed( seed_type(arma_rng::randi<seed_type>()) );
+      
+      local_arma_rng_cxx11_instance.randg_fill(mem, N, a, b);
+      }
+    #else
+      {
+      // not available; randg() reports the error
+      arma_ignore(mem);
+      arma_ignore(N);
+      arma_ignore(a);
+      arma_ignore(b);
+      }
+    #endif
+    }
+  };
+
+
+
 //! @}
@@ -0,0 +1,398 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+
+//! \addtogroup arma_rng_philox
+//! @{
+
+
+
+//! Counter-based random number generator (Philox4x32-10) used for filling objects with random values.
+//! Each block of 4 random words is a pure function of a 128 bit counter and a 64 bit key,
+//! so any part of an object can be generated independently of the other parts.
+//! The key is obtained from the sequential generator, which preserves the semantics of arma_rng::set_seed().
+//! The generated values are the same regardless of the number of threads.
+//! For internal use only!
+class arma_rng_philox
+  {
+  public:
+  
+  static const uword n_lanes         = 16;      //!< number of blocks generated at once
+  static const uword parallel_n_elem = 131072;  //!< minimum number of elements to use OpenMP
+  
+  static const uword kind_randu = 0;
+  static const uword kind_randn = 1;
+  static const uword kind_randi = 2;
+  static const uword kind_randg = 3;
+  
+  inline static void rounds(u32* x0, u32* x1, u32* x2, u32* x3, const uword n, u32 k0, u32 k1);
+  
+  template<typename eT> inline static void fill(eT* mem, const uword N, const uword kind, const double a, const double b, const u32 k0, const u32 k1);
+  
+  
+  private:
+  
+  arma_inline static void mulhilo(const u32 a, const u32 b, u32& hi, u32& lo);
+  
+  arma_inline static double res53(const u32 a, const u32 b);
+  arma_inline static double res32(const u32 a);
+  
+  template<typename eT> arma_inline static eT unit_val(const u32 a, const u32 b);
+  
+  template<typename eT> inline static void fill_range(eT* mem, const uword start, const uword end, const uword kind, const double a, const double b, const u32 k0, const u32 k1);
+  
+  template<typename eT> inline static void randg_range(eT* mem, const uword start, const uword end, const double a, const double b, const u32 k0, const u32 k1);
+  };
+
+
+
+//! apply the 10 rounds of Philox4x32 to n counters, in place;
+//! the rounds are done on all counters at once, so that the loops can be vectorised by the compiler
+inline
+void
+arma_rng_philox::rounds(u32* x0, u32* x1, u32* x2, u32* x3, const uword n, u32 k0, u32 k1)
+  {
+  const u32 M0 = u32(0xD2511F53UL);
+  const u32 M1 = u32(0xCD9E8D57UL);
+  const u32 W0 = u32(0x9E3779B9UL);
+  const u32 W1 = u32(0xBB67AE85UL);
+  
+  for(uword r=0; r < 10; ++r)
+    {
+    if(r > 0)  { k0 += W0;  k1 += W1; }
+    
+    for(uword j=0; j < n; ++j)
+      {
+      u32 hi0, lo0, hi1, lo1;
+      
+      mulhilo(M0, x0[j], hi0, lo0);
+      mulhilo(M1, x2[j], hi1, lo1);
+      
+      const u32 y0 = hi1 ^ x1[j] ^ k0;
+      const u32 y2 = hi0 ^ x3[j] ^ k1;
+      
+      x0[j] = y0;
+      x1[j] = lo1;
+      x2[j] = y2;
+      x3[j] = lo0;
+      }
+    }
+  }
+
+
+
+//! fill mem with N random values;
+//! for kind_randi the values are in the [a,b] interval;
+//! for kind_randg a and b are the shape and scale
+template<typename eT>
+inline
+void
+arma_rng_philox::fill(eT* mem, const uword N, const uword kind, const double a, const double b, const u32 k0, const u32 k1)
+  {
+  #if defined(_OPENMP)
+    {
+    const uword n_threads = uword( (std::max)(int(1), omp_get_max_threads()) );
+    
+    if( (N >= parallel_n_elem) && (n_threads > 1) && (omp_in_parallel() == 0) )
+      {
+      // each part starts at a multiple of the number of values made by one call to rounds(),
+      // so the values don't depend on how the object is split
+      
+      const uword chunk = 2*n_lanes;
+      const uword part  = chunk * ( ((N + chunk - 1)/chunk + n_threads - 1) / n_threads );
+      
+      #pragma omp parallel for schedule(static,1)
+      for(uword t=0; t < n_threads; ++t)
+        {
+        const uword start = (std::min)(t*part,     N);
+        const uword end   = (std::min)(start+part, N);
+        
+        if(start < end)  { arma_rng_philox::fill_range(mem, start, end, kind, a, b, k0, k1); }
+        }
+      
+      return;
+      }
+    }
+  #endif
+  
+  arma_rng_philox::fill_range(mem, uword(0), N, kind, a, b, k0, k1);
+  }
+
+
+
+arma_inline
+void
+arma_rng_philox::mulhilo(const u32 a, const u32 b, u32& hi, u32& lo)
+  {
+  #if defined(ARMA_USE_U64S64)
+    {
+    const u64 p = u64(a) * u64(b);
+    
+    hi = u32(p >> 32);
+    lo = u32(p);
+    }
+  #else
+    {
+    const u32 a_lo = a & 0xFFFF;  const u32 a_hi = a >> 16;
+    const u32 b_lo = b & 0xFFFF;  const u32 b_hi = b >> 16;
+    
+    const u32 ll = a_lo * b_lo;
+    const u32 lh = a_lo * b_hi;
+    const u32 hl = a_hi * b_lo;
+    const u32 hh = a_hi * b_hi;
+    
+    const u32 mid = (ll >> 16) + (lh & 0xFFFF) + (hl & 0xFFFF);
+    
+    hi = hh + (lh >> 16) + (hl >> 16) + (mid >> 16);
+    lo = (mid << 16) | (ll & 0xFFFF);
+    }
+  #endif
+  }
+
+
+
+//! uniform value in the [0,1) interval with 53 bits of resolution
+arma_inline
+double
+arma_rng_philox::res53(const u32 a, const u32 b)
+  {
+  return ( double(a >> 5) * double(67108864.0) + double(b >> 6) ) * double(1.0 / 9007199254740992.0);
+  }
+
+
+
+//! uniform value in the (0,1) interval with 32 bits of resolution
+arma_inline
+double
+arma_rng_philox::res32(const u32 a)
+  {
+  return ( double(a) + double(0.5) ) * double(1.0 / 4294967296.0);
+  }
+
+
+
+template<typename eT>
+arma_inline
+eT
+arma_rng_philox::unit_val(const u32 a, const u32 b)
+  {
+  // converting a 53 bit value to float can round it up to 1
+  
+  return (is_same_type<eT,float>::value) ? eT( float(a >> 8) * float(1.0 / 16777216.0) ) : eT( res53(a,b) );
+  }
+
+
+
+template<typename eT>
+inline
+void
+arma_rng_philox::fill_range(eT* mem, const uword start, const uword end, const uword kind, const double a, const double b, const u32 k0, const u32 k1)
+  {
+  if(kind == kind_randg)  { arma_rng_philox::randg_range(mem, start, end, a, b, k0, k1); return; }
+  
+  // element i is made from block i/2;
+  // each block provides two values (two uniforms, two normals, or two integers)
+  
+  arma_aligned u32 x0[n_lanes];
+  arma_aligned u32 x1[n_lanes];
+  arma_aligned u32 x2[n_lanes];
+  arma_aligned u32 x3[n_lanes];
+  
+  arma_aligned eT v0[n_lanes];
+  arma_aligned eT v1[n_lanes];
+  
+  const double two_pi = double(2) * Datum<double>::pi;
+  const double range  = b - a + double(1);
+  
+  uword i = start - (start % 2);
+  
+  while(i < end)
+    {
+    const uword blk_start = i/2;
+    
+    for(uword j=0; j < n_lanes; ++j)
+      {
+      const uword blk = blk_start + j;
+      
+      x0[j] = u32(blk);
+      x1[j] = u32( (blk >> 16) >> 16 );
+      x2[j] = u32(kind);
+      x3[j] = u32(0);
+      }
+    
+    // near the end only the needed blocks are generated
+    
+    const uword n = (std::min)( uword(n_lanes), (end - i + 1)/2 );
+    
+    if(n == n_lanes)  { arma_rng_philox::rounds(x0, x1, x2, x3, n_lanes, k0, k1); }
+    else              { arma_rng_philox::rounds(x0, x1, x2, x3, n,       k0, k1); }
+    
+    if(kind == kind_randu)
+      {
+      for(uword j=0; j < n_lanes; ++j)
+        {
+        v0[j] = unit_val<eT>(x0[j], x1[j]);
+        v1[j] = unit_val<eT>(x2[j], x3[j]);
+        }
+      }
+    else
+    if(kind == kind_randn)
+      {
+      // Box-Muller transform
+      
+      for(uword j=0; j < n_lanes; ++j)
+        {
+        const double u1 = double(1) - res53(x0[j], x1[j]);
+        const double u2 = two_pi    * res53(x2[j], x3[j]);
+        
+        const double r = std::sqrt( double(-2) * std::log(u1) );
+        
+        v0[j] = eT( r * std::cos(u2) );
+        v1[j] = eT( r * std::sin(u2) );
+        }
+      }
+    else
+      {
+      for(uword j=0; j < n_lanes; ++j)
+        {
+        v0[j] = eT( (std::min)( b, a + std::floor(res53(x0[j], x1[j]) * range) ) );
+        v1[j] = eT( (std::min)( b, a + std::floor(res53(x2[j], x3[j]) * range) ) );
+        }
+      }
+    
+    for(uword j=0; (j < n) && (i < end); ++j, i+=2)
+      {
+      if(i     >= start)  { mem[i]   = v0[j]; }
+      if((i+1) <  end  )  { mem[i+1] = v1[j]; }
+      }
+    }
+  }
+
+
+
+//! gamma distribution via the method by Marsaglia and Tsang;
+//! the first attempt for elements i and i+1 uses block i/2 (two normals and two uniforms);
+//! further attempts for element i use the counter (i, attempt), so that rejections don't affect other elements
+template<typename eT>
+inline
+void
+arma_rng_philox::randg_range(eT* mem, const uword start, const uword end, const double a, const double b, const u32 k0, const u32 k1)
+  {
+  const bool   boost = (a < double(1));
+  const double d     = (boost ? (a + double(1)) : a) - double(1)/double(3);
+  const double c     = double(1) / std::sqrt(double(9) * d);
+  
+  const double two_pi = double(2) * Datum<double>::pi;
+  
+  arma_aligned u32 x0[n_lanes];
+  arma_aligned u32 x1[n_lanes];
+  arma_aligned u32 x2[n_lanes];
+  arma_aligned u32 x3[n_lanes];
+  
+  arma_aligned double z[2*n_lanes];
+  arma_aligned double u[2*n_lanes];
+  arma_aligned double w[2*n_lanes];
+  
+  uword i = start - (start % 2);
+  
+  while(i < end)
+    {
+    const uword blk_start = i/2;
+    const uword n         = (std::min)( uword(n_lanes), (end - i + 1)/2 );
+    
+    for(uword j=0; j < n; ++j)
+      {
+      const uword blk = blk_start + j;
+      
+      x0[j] = u32(blk);
+      x1[j] = u32( (blk >> 16) >> 16 );
+      x2[j] = u32(0);
+      x3[j] = u32(kind_randg);
+      }
+    
+    arma_rng_philox::rounds(x0, x1, x2, x3, n, k0, k1);
+    
+    for(uword j=0; j < n; ++j)
+      {
+      const double r = std::sqrt( double(-2) * std::log(res32(x0[j])) );
+      const double t = two_pi * res32(x1[j]);
+      
+      z[2*j  ] = r * std::cos(t);
+      z[2*j+1] = r * std::sin(t);
+      
+      u[2*j  ] = res32(x2[j]);
+      u[2*j+1] = res32(x3[j]);
+      }
+    
+    if(boost)
+      {
+      // uniforms for shape parameters less than 1 come from separate blocks
+      
+      for(uword j=0; j < n; ++j)
+        {
+        const uword blk = blk_start + j;
+        
+        x0[j] = u32(blk);
+        x1[j] = u32( (blk >> 16) >> 16 );
+        x2[j] = u32(0);
+        x3[j] = u32(kind_randg + 1);
+        }
+      
+      arma_rng_philox::rounds(x0, x1, x2, x3, n, k0, k1);
+      
+      for(uword j=0; j < n; ++j)
+        {
+        w[2*j  ] = res32(x0[j]);
+        w[2*j+1] = res32(x1[j]);
+        }
+      }
+    
+    for(uword j=0; (j < 2*n) && (i < end); ++j, ++i)
+      {
+      if(i < start)  { continue; }
+      
+      double zz = z[j];
+      double uu = u[j];
+      double val;
+      
+      for(u32 attempt=1; ; ++attempt)
+        {
+        const double v = double(1) + c*zz;
+        
+        if(v > double(0))
+          {
+          const double v3 = v*v*v;
+          const double z2 = zz*zz;
+          
+          // the squeeze test avoids the logarithms in most cases
+          if( (uu < (double(1) - double(0.0331)*z2*z2)) || (std::log(uu) < (double(0.5)*z2 + d - d*v3 + d*std::log(v3))) )  { val = d*v3; break; }
+          }
+        
+        u32 y0 = u32(i);
+        u32 y1 = u32( (i >> 16) >> 16 );
+        u32 y2 = attempt;
+        u32 y3 = u32(kind_randg);
+        
+        arma_rng_philox::rounds(&y0, &y1, &y2, &y3, uword(1), k0, k1);
+        
+        zz = std::sqrt( double(-2) * std::log(res32(y0)) ) * std::cos( two_pi * res32(y1) );
+        uu = res32(y2);
+        }
+      
+      if(boost)  { val *= std::pow(w[j], double(1)/a); }
+      
+      mem[i] = eT(val * b);
+      }
+    }
+  }
+
+
+
+//! @}
@@ -0,0 +1,35 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+//! \addtogroup async_save
+//! @{
+
+
+#if defined(ARMA_USE_CXX11)
+
+//! Saving of objects on a background thread, as used by .save_async(). For internal use only!
+//! The object is copied before apply() returns, so it can be modified or destroyed while the file is being written.
+template<typename T1>
+class async_save
+  {
+  public:
+  
+  inline static std::future<bool> apply(const T1& x, const std::string& name, const file_type type, const bool sync);
+  
+  
+  private:
+  
+  inline static bool worker(const T1& x, const std::string& name, const file_type type, const bool sync);
+  };
+
+#endif
+
+
+//! @}
@@ -0,0 +1,72 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+//! \addtogroup async_save
+//! @{
+
+
+#if defined(ARMA_USE_CXX11)
+
+template<typename T1>
+inline
+std::future<bool>
+async_save<T1>::apply(const T1& x, const std::string& name, const file_type type, const bool sync)
+  {
+  arma_extra_debug_sigprint();
+  
+  // std::async() stores a copy of x (the snapshot) before starting the thread
+  
+  try
+    {
+    return std::async(std::launch::async, &async_save<T1>::worker, x, name, type, sync);
+    }
+  catch(...)
+    {
+    arma_extra_debug_print("async_save: couldn't start thread; saving synchronously");
+    }
+  
+  std::promise<bool> result;
+  
+  result.set_value( async_save<T1>::worker(x, name, type, sync) );
+  
+  return result.get_future();
+  }
+
+
+
+//! Write the object to a temporary file in the same directory, optionally flush it to the storage device,
+//! and then rename it to the final name. Readers of the final file see either the old or the new contents.
+//! If sync is true, the directory is also flushed after renaming, so that the rename survives a crash.
+template<typename T1>
+inline
+bool
+async_save<T1>::worker(const T1& x, const std::string& name, const file_type type, const bool sync)
+  {
+  arma_extra_debug_sigprint();
+  
+  const std::string tmp_name = diskio::gen_tmp_name(name);
+  
+  bool save_okay = x.save(tmp_name, type, false);
+  
+  if( save_okay && sync )  { save_okay = diskio::sync_file(tmp_name); }
+  
+  if(save_okay)  { save_okay = diskio::safe_rename(tmp_name, name); }
+  
+  if(save_okay == false)  { std::remove(tmp_name.c_str()); }
+  
+  if( save_okay && sync )  { save_okay = diskio::sync_dir(name); }
+  
+  return save_okay;
+  }
+
+#endif
+
+
+//! @}
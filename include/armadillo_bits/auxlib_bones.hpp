@@ -237,6 +237,50 @@ class auxlib
   inline static bool solve_tri(Mat<typename T1::elem_type>& out, const Mat<typename T1::elem_type>& A, const Base<typename T1::elem_type,T1>& B_expr, const uword layout);
   
   
+  //
+  // solve systems with structured matrices (diagonal, tridiagonal, band, symmetric positive definite)
+  
+  template<typename T1>
+  inline static bool solve_diag(Mat<typename T1::elem_type>& out, typename T1::pod_type& out_rcond, const Mat<typename T1::elem_type>& A, const Base<typename T1::elem_type,T1>& B_expr);
+  
+  template<typename T1>
+  inline static bool solve_tridiag_fast(Mat<typename T1::elem_type>& out, const Mat<typename T1::elem_type>& A, const Base<typename T1::elem_type,T1>& B_expr);
+  
+  template<typename T1>
+  inline static bool solve_band_fast(Mat<typename T1::elem_type>& out, const Mat<typename T1::elem_type>& A, const uword KL, const uword KU, const Base<typename T1::elem_type,T1>& B_expr);
+  
+  template<typename T1>
+  inline static bool solve_band_rcond(Mat<typename T1::elem_type>& out, typename T1::pod_type& out_rcond, const Mat<typename T1::elem_type>& A, const uword KL, const uword KU, const Base<typename T1::elem_type,T1>& B_expr);
+  
+  template<typename T1>
+  inline static bool solve_sympd_fast(Mat<typename T1::elem_type>& out, Mat<typename T1::elem_type>& A, const Base<typename T1::elem_type,T1>& B_expr);
+  
+  template<typename T1>
+  inline static bool solve_sympd_rcond(Mat<typename T1::elem_type>& out, typename T1::pod_type& out_rcond, Mat<typename T1::elem_type>& A, const Base<typename T1::elem_type,T1>& B_expr);
+  
+  template<typename T1>
+  inline static bool solve_tri_rcond(Mat<typename T1::elem_type>& out, typename T1::pod_type& out_rcond, const Mat<typename T1::elem_type>& A, const Base<typename T1::elem_type,T1>& B_expr, const uword layout);
+  
+  
+  //
+  // factorisations kept for repeated solves (lu_factor, chol_factor, qr_factor)
+  
+  template<typename eT>
+  inline static bool lu_fact(Mat<eT>& LU, podarray<blas_int>& ipiv);
+  
+  template<typename eT>
+  inline static bool lu_fact_solve(Mat<eT>& X, const Mat<eT>& LU, const podarray<blas_int>& ipiv);
+  
+  template<typename eT>
+  inline static bool chol_fact_solve(Mat<eT>& X, const Mat<eT>& R);
+  
+  template<typename eT>
+  inline static bool qr_fact(Mat<eT>& QR, podarray<eT>& tau);
+  
+  template<typename eT>
+  inline static bool qr_fact_solve(Mat<eT>& X, const Mat<eT>& QR, const podarray<eT>& tau);
+  
+  
   //
   // Schur decomposition
   
@@ -274,6 +318,24 @@ class auxlib
   
   template<typename T1>
   inline static typename T1::pod_type rcond(const Base<std::complex<typename T1::pod_type>,T1>& A_expr);
+  
+  template<typename T>
+  inline static T rcond_trimat(const Mat<T>& A, const uword layout);
+  
+  template<typename T>
+  inline static T rcond_trimat(const Mat< std::complex<T> >& A, const uword layout);
+  
+  template<typename T>
+  inline static T rcond_sympd(Mat<T>& A, const T norm_val);
+  
+  template<typename T>
+  inline static T rcond_sympd(Mat< std::complex<T> >& A, const T norm_val);
+  
+  template<typename T>
+  inline static T rcond_band(Mat<T>& AB, const uword KL, const uword KU, podarray<blas_int>& ipiv, const T norm_val);
+  
+  template<typename T>
+  inline static T rcond_band(Mat< std::complex<T> >& AB, const uword KL, const uword KU, podarray<blas_int>& ipiv, const T norm_val);
   };
 
 
@@ -257,20 +257,27 @@ auxlib::inv_inplace_lapack(Mat<eT>& out)
     
     if(n_rows > 16)
       {
-      eT        work_query[2];
-      blas_int lwork_query = -1;
-      
-      arma_extra_debug_print("lapack::getri()");
-      lapack::getri(&n_rows, out.memptr(), &n_rows, ipiv.memptr(), &work_query[0], &lwork_query, &info);
-      
-      if(info != 0)  { return false; }
+      blas_int lwork_proposed = 0;
       
-      blas_int lwork_proposed = static_cast<blas_int>( access::tmp_real(work_query[0]) );
+      if(lapack_work<eT>::get_lwork(lwork_proposed, lapack_work_id::getri, n_rows, n_rows) == false)
+        {
+        eT        work_query[2];
+        blas_int lwork_query = -1;
+        
+        arma_extra_debug_print("lapack::getri()");
+        lapack::getri(&n_rows, out.memptr(), &n_rows, ipiv.memptr(), &work_query[0], &lwork_query, &info);
+        
+        if(info != 0)  { return false; }
+        
+        lwork_proposed = static_cast<blas_int>( access::tmp_real(work_query[0]) );
+        
+        lapack_work<eT>::set_lwork(lwork_proposed, lapack_work_id::getri, n_rows, n_rows);
+        }
       
       lwork = (std::max)(lwork_proposed, lwork);
       }
     
-    podarray<eT> work( static_cast<uword>(lwork) );
+    lapack_work<eT> work( static_cast<uword>(lwork) );
     
     arma_extra_debug_print("lapack::getrf()");
     lapack::getrf(&n_rows, &n_rows, out.memptr(), &n_rows, ipiv.memptr(), &info);
@@ -366,8 +373,7 @@ auxlib::inv_sym(Mat<eT>& out, const Base<eT,T1>& X, const uword layout)
     podarray<blas_int> ipiv;
     ipiv.set_size(out.n_rows);
     
-    podarray<eT> work;
-    work.set_size( uword(lwork) );
+    lapack_work<eT> work( static_cast<uword>(lwork) );
     
     arma_extra_debug_print("lapack::sytrf()");
     lapack::sytrf(&uplo, &n, out.memptr(), &n, ipiv.memptr(), work.memptr(), &lwork, &info);
@@ -1038,7 +1044,7 @@ auxlib::eig_gen
     blas_int lwork = (vecs_on) ? (3 * ((std::max)(blas_int(1), 4*N)) ) : (3 * ((std::max)(blas_int(1), 3*N)) );
     blas_int info  = 0;
     
-    podarray<T> work( static_cast<uword>(lwork) );
+    lapack_work<T> work( static_cast<uword>(lwork) );
     
     podarray<T> vals_real(X.n_rows);
     podarray<T> vals_imag(X.n_rows);
@@ -1145,8 +1151,8 @@ auxlib::eig_gen
     blas_int lwork = 3 * ((std::max)(blas_int(1), 2*N));
     blas_int info  = 0;
     
-    podarray<eT>  work( static_cast<uword>(lwork) );
-    podarray< T> rwork( static_cast<uword>(2*N)   );
+    lapack_work<eT>  work( static_cast<uword>(lwork) );
+    podarray< T>    rwork( static_cast<uword>(2*N)   );
     
     arma_extra_debug_print("lapack::cx_geev() -- START");
     lapack::cx_geev(&jobvl, &jobvr, &N, X.memptr(), &N, vals.memptr(), vl, &ldvl, vr, &ldvr, work.memptr(), &lwork, rwork.memptr(), &info);
@@ -1233,7 +1239,7 @@ auxlib::eig_pair
     podarray<T> alphai(A.n_rows);
     podarray<T>   beta(A.n_rows);
     
-    podarray<T> work( static_cast<uword>(lwork) );
+    lapack_work<T> work( static_cast<uword>(lwork) );
     
     arma_extra_debug_print("lapack::ggev()");
     lapack::ggev(&jobvl, &jobvr, &N, A.memptr(), &N,  B.memptr(), &N, alphar.memptr(), alphai.memptr(), beta.memptr(), vl, &ldvl, vr, &ldvr, work.memptr(), &lwork, &info);
@@ -1379,8 +1385,8 @@ auxlib::eig_pair
     podarray<eT> alpha(A.n_rows);
     podarray<eT>  beta(A.n_rows);
     
-    podarray<eT>  work( static_cast<uword>(lwork) );
-    podarray<T>  rwork( static_cast<uword>(8*N)   );
+    lapack_work<eT>  work( static_cast<uword>(lwork) );
+    podarray<T>     rwork( static_cast<uword>(8*N)   );
     
     arma_extra_debug_print("lapack::cx_ggev()");
     lapack::cx_ggev(&jobvl, &jobvr, &N, A.memptr(), &N, B.memptr(), &N, alpha.memptr(), beta.memptr(), vl, &ldvl, vr, &ldvr, work.memptr(), &lwork, rwork.memptr(), &info);
@@ -1454,7 +1460,7 @@ auxlib::eig_sym(Col<eT>& eigval, const Base<eT,T1>& X)
     blas_int lwork = 3 * ( (std::max)(blas_int(1), 3*N-1) );
     blas_int info  = 0;
     
-    podarray<eT> work( static_cast<uword>(lwork) );
+    lapack_work<eT> work( static_cast<uword>(lwork) );
     
     arma_extra_debug_print("lapack::syev()");
     lapack::syev(&jobz, &uplo, &N, A.memptr(), &N, eigval.memptr(), work.memptr(), &lwork, &info);
@@ -1506,8 +1512,8 @@ auxlib::eig_sym(Col<T>& eigval, const Base<std::complex<T>,T1>& X)
     blas_int lwork = 3 * ( (std::max)(blas_int(1), 2*N-1) );
     blas_int info  = 0;
     
-    podarray<eT>  work( static_cast<uword>(lwork) );
-    podarray<T>  rwork( static_cast<uword>( (std::max)(blas_int(1), 3*N-2) ) );
+    lapack_work<eT>  work( static_cast<uword>(lwork) );
+    podarray<T>     rwork( static_cast<uword>( (std::max)(blas_int(1), 3*N-2) ) );
     
     arma_extra_debug_print("lapack::heev()");
     lapack::heev(&jobz, &uplo, &N, A.memptr(), &N, eigval.memptr(), work.memptr(), &lwork, rwork.memptr(), &info);
@@ -1558,7 +1564,7 @@ auxlib::eig_sym(Col<eT>& eigval, Mat<eT>& eigvec, const Base<eT,T1>& X)
     blas_int lwork = 3 * ( (std::max)(blas_int(1), 3*N-1) );
     blas_int info  = 0;
     
-    podarray<eT> work( static_cast<uword>(lwork) );
+    lapack_work<eT> work( static_cast<uword>(lwork) );
     
     arma_extra_debug_print("lapack::syev()");
     lapack::syev(&jobz, &uplo, &N, eigvec.memptr(), &N, eigval.memptr(), work.memptr(), &lwork, &info);
@@ -1612,8 +1618,8 @@ auxlib::eig_sym(Col<T>& eigval, Mat< std::complex<T> >& eigvec, const Base<std::
     blas_int lwork = 3 * ( (std::max)(blas_int(1), 2*N-1) );
     blas_int info  = 0;
     
-    podarray<eT>  work( static_cast<uword>(lwork) );
-    podarray<T>  rwork( static_cast<uword>((std::max)(blas_int(1), 3*N-2)) );
+    lapack_work<eT>  work( static_cast<uword>(lwork) );
+    podarray<T>     rwork( static_cast<uword>((std::max)(blas_int(1), 3*N-2)) );
     
     arma_extra_debug_print("lapack::heev()");
     lapack::heev(&jobz, &uplo, &N, eigvec.memptr(), &N, eigval.memptr(), work.memptr(), &lwork, rwork.memptr(), &info);
@@ -1666,7 +1672,7 @@ auxlib::eig_sym_dc(Col<eT>& eigval, Mat<eT>& eigvec, const Base<eT,T1>& X)
     blas_int liwork = 3 * (3 + 5*N);
     blas_int info   = 0;
     
-    podarray<eT>        work( static_cast<uword>( lwork) );
+    lapack_work<eT>     work( static_cast<uword>( lwork) );
     podarray<blas_int> iwork( static_cast<uword>(liwork) ); 
     
     arma_extra_debug_print("lapack::syevd()");
@@ -1723,7 +1729,7 @@ auxlib::eig_sym_dc(Col<T>& eigval, Mat< std::complex<T> >& eigvec, const Base<st
     blas_int liwork = 3 * (3 + 5*N);
     blas_int info   = 0;
     
-    podarray<eT>        work( static_cast<uword>(lwork)  );
+    lapack_work<eT>     work( static_cast<uword>(lwork)  );
     podarray<T>        rwork( static_cast<uword>(lrwork) );
     podarray<blas_int> iwork( static_cast<uword>(liwork) ); 
     
@@ -1837,19 +1843,26 @@ auxlib::qr(Mat<eT>& Q, Mat<eT>& R, const Base<eT,T1>& X)
     
     podarray<eT> tau( static_cast<uword>(k) );
     
-    eT        work_query[2];
-    blas_int lwork_query = -1;
-    
-    arma_extra_debug_print("lapack::geqrf()");
-    lapack::geqrf(&m, &n, R.memptr(), &m, tau.memptr(), &work_query[0], &lwork_query, &info);
-    
-    if(info != 0)  { return false; }
+    blas_int lwork_proposed = 0;
     
-    blas_int lwork_proposed = static_cast<blas_int>( access::tmp_real(work_query[0]) );
+    if(lapack_work<eT>::get_lwork(lwork_proposed, lapack_work_id::geqrf, m, n) == false)
+      {
+      eT        work_query[2];
+      blas_int lwork_query = -1;
+      
+      arma_extra_debug_print("lapack::geqrf()");
+      lapack::geqrf(&m, &n, R.memptr(), &m, tau.memptr(), &work_query[0], &lwork_query, &info);
+      
+      if(info != 0)  { return false; }
+      
+      lwork_proposed = static_cast<blas_int>( access::tmp_real(work_query[0]) );
+      
+      lapack_work<eT>::set_lwork(lwork_proposed, lapack_work_id::geqrf, m, n);
+      }
     
     lwork = (std::max)(lwork_proposed, lwork_min);
     
-    podarray<eT> work( static_cast<uword>(lwork) );
+    lapack_work<eT> work( static_cast<uword>(lwork) );
     
     arma_extra_debug_print("lapack::geqrf()");
     lapack::geqrf(&m, &n, R.memptr(), &m, tau.memptr(), work.memptr(), &lwork, &info);
@@ -1947,19 +1960,26 @@ auxlib::qr_econ(Mat<eT>& Q, Mat<eT>& R, const Base<eT,T1>& X)
     
     podarray<eT> tau( static_cast<uword>(k) );
     
-    eT        work_query[2];
-    blas_int lwork_query = -1;
+    blas_int lwork_proposed = 0;
     
-    arma_extra_debug_print("lapack::geqrf()");
-    lapack::geqrf(&m, &n, Q.memptr(), &m, tau.memptr(), &work_query[0], &lwork_query, &info);
-    
-    if(info != 0)  { return false; }
-    
-    blas_int lwork_proposed = static_cast<blas_int>( access::tmp_real(work_query[0]) );
+    if(lapack_work<eT>::get_lwork(lwork_proposed, lapack_work_id::geqrf, m, n) == false)
+      {
+      eT        work_query[2];
+      blas_int lwork_query = -1;
+      
+      arma_extra_debug_print("lapack::geqrf()");
+      lapack::geqrf(&m, &n, Q.memptr(), &m, tau.memptr(), &work_query[0], &lwork_query, &info);
+      
+      if(info != 0)  { return false; }
+      
+      lwork_proposed = static_cast<blas_int>( access::tmp_real(work_query[0]) );
+      
+      lapack_work<eT>::set_lwork(lwork_proposed, lapack_work_id::geqrf, m, n);
+      }
     
     lwork = (std::max)(lwork_proposed, lwork_min);
     
-    podarray<eT> work( static_cast<uword>(lwork) );
+    lapack_work<eT> work( static_cast<uword>(lwork) );
     
     arma_extra_debug_print("lapack::geqrf()");
     lapack::geqrf(&m, &n, Q.memptr(), &m, tau.memptr(), work.memptr(), &lwork, &info);
@@ -2051,19 +2071,26 @@ auxlib::svd(Col<eT>& S, const Base<eT,T1>& X, uword& X_n_rows, uword& X_n_cols)
     
     S.set_size( static_cast<uword>(min_mn) );
     
-    eT        work_query[2];
-    blas_int lwork_query = -1;
-    
-    arma_extra_debug_print("lapack::gesvd()");
-    lapack::gesvd<eT>(&jobu, &jobvt, &m, &n, A.memptr(), &lda, S.memptr(), U.memptr(), &ldu, V.memptr(), &ldvt, &work_query[0], &lwork_query, &info);
-    
-    if(info != 0)  { return false; }
+    blas_int lwork_proposed = 0;
     
-    blas_int lwork_proposed = static_cast<blas_int>( work_query[0] );
+    if(lapack_work<eT>::get_lwork(lwork_proposed, lapack_work_id::gesvd_s, m, n) == false)
+      {
+      eT        work_query[2];
+      blas_int lwork_query = -1;
+      
+      arma_extra_debug_print("lapack::gesvd()");
+      lapack::gesvd<eT>(&jobu, &jobvt, &m, &n, A.memptr(), &lda, S.memptr(), U.memptr(), &ldu, V.memptr(), &ldvt, &work_query[0], &lwork_query, &info);
+      
+      if(info != 0)  { return false; }
+      
+      lwork_proposed = static_cast<blas_int>( work_query[0] );
+      
+      lapack_work<eT>::set_lwork(lwork_proposed, lapack_work_id::gesvd_s, m, n);
+      }
     
     lwork = (std::max)(lwork_proposed, lwork_min);
     
-    podarray<eT> work( static_cast<uword>(lwork) );
+    lapack_work<eT> work( static_cast<uword>(lwork) );
     
     arma_extra_debug_print("lapack::gesvd()");
     lapack::gesvd<eT>(&jobu, &jobvt, &m, &n, A.memptr(), &lda, S.memptr(), U.memptr(), &ldu, V.memptr(), &ldvt, work.memptr(), &lwork, &info);
@@ -2125,22 +2152,29 @@ auxlib::svd(Col<T>& S, const Base<std::complex<T>, T1>& X, uword& X_n_rows, uwor
     
     S.set_size( static_cast<uword>(min_mn) );
     
-    podarray<eT>   work( static_cast<uword>(lwork   ) );
-    podarray< T>  rwork( static_cast<uword>(5*min_mn) );
-    
-    blas_int lwork_tmp = -1;  // let gesvd_() calculate the optimum size of the workspace
-    
-    arma_extra_debug_print("lapack::cx_gesvd()");
-    lapack::cx_gesvd<T>(&jobu, &jobvt, &m, &n, A.memptr(), &lda, S.memptr(), U.memptr(), &ldu, V.memptr(), &ldvt, work.memptr(), &lwork_tmp, rwork.memptr(), &info);
+    lapack_work<eT>   work( static_cast<uword>(lwork   ) );
+    podarray< T>     rwork( static_cast<uword>(5*min_mn) );
     
-    if(info != 0)  { return false; }
+    blas_int proposed_lwork = 0;
     
-    blas_int proposed_lwork = static_cast<blas_int>(real(work[0]));
+    if(lapack_work<eT>::get_lwork(proposed_lwork, lapack_work_id::cx_gesvd_s, m, n) == false)
+      {
+      blas_int lwork_tmp = -1;  // let gesvd_() calculate the optimum size of the workspace
+      
+      arma_extra_debug_print("lapack::cx_gesvd()");
+      lapack::cx_gesvd<T>(&jobu, &jobvt, &m, &n, A.memptr(), &lda, S.memptr(), U.memptr(), &ldu, V.memptr(), &ldvt, work.memptr(), &lwork_tmp, rwork.memptr(), &info);
+      
+      if(info != 0)  { return false; }
+      
+      proposed_lwork = static_cast<blas_int>(real(work[0]));
+      
+      lapack_work<eT>::set_lwork(proposed_lwork, lapack_work_id::cx_gesvd_s, m, n);
+      }
     
     if(proposed_lwork > lwork)
       {
       lwork = proposed_lwork;
-      work.set_size( static_cast<uword>(lwork) );
+      work.set_min_size( static_cast<uword>(lwork) );
       }
     
     arma_extra_debug_print("lapack::cx_gesvd()");
@@ -2229,19 +2263,26 @@ auxlib::svd(Mat<eT>& U, Col<eT>& S, Mat<eT>& V, const Base<eT,T1>& X)
     S.set_size( static_cast<uword>(min_mn) );
     
     // let gesvd_() calculate the optimum size of the workspace
-    eT        work_query[2];
-    blas_int lwork_query = -1;
-    
-    arma_extra_debug_print("lapack::gesvd()");
-    lapack::gesvd<eT>(&jobu, &jobvt, &m, &n, A.memptr(), &lda, S.memptr(), U.memptr(), &ldu, V.memptr(), &ldvt, &work_query[0], &lwork_query, &info);
-    
-    if(info != 0)  { return false; }
+    blas_int lwork_proposed = 0;
     
-    blas_int lwork_proposed = static_cast<blas_int>( work_query[0] );
+    if(lapack_work<eT>::get_lwork(lwork_proposed, lapack_work_id::gesvd_usv, m, n) == false)
+      {
+      eT        work_query[2];
+      blas_int lwork_query = -1;
+      
+      arma_extra_debug_print("lapack::gesvd()");
+      lapack::gesvd<eT>(&jobu, &jobvt, &m, &n, A.memptr(), &lda, S.memptr(), U.memptr(), &ldu, V.memptr(), &ldvt, &work_query[0], &lwork_query, &info);
+      
+      if(info != 0)  { return false; }
+      
+      lwork_proposed = static_cast<blas_int>( work_query[0] );
+      
+      lapack_work<eT>::set_lwork(lwork_proposed, lapack_work_id::gesvd_usv, m, n);
+      }
     
     lwork = (std::max)(lwork_proposed, lwork_min);
     
-    podarray<eT> work( static_cast<uword>(lwork) );
+    lapack_work<eT> work( static_cast<uword>(lwork) );
     
     arma_extra_debug_print("lapack::gesvd()");
     lapack::gesvd<eT>(&jobu, &jobvt, &m, &n, A.memptr(), &lda, S.memptr(), U.memptr(), &ldu, V.memptr(), &ldvt, work.memptr(), &lwork, &info);
@@ -2304,22 +2345,29 @@ auxlib::svd(Mat< std::complex<T> >& U, Col<T>& S, Mat< std::complex<T> >& V, con
     
     S.set_size( static_cast<uword>(min_mn) );
     
-    podarray<eT>  work( static_cast<uword>(lwork   ) );
-    podarray<T>  rwork( static_cast<uword>(5*min_mn) );
+    lapack_work<eT>  work( static_cast<uword>(lwork   ) );
+    podarray<T>     rwork( static_cast<uword>(5*min_mn) );
     
-    blas_int lwork_tmp = -1;  // let gesvd_() calculate the optimum size of the workspace
-    
-    arma_extra_debug_print("lapack::cx_gesvd()");
-    lapack::cx_gesvd<T>(&jobu, &jobvt, &m, &n, A.memptr(), &lda, S.memptr(), U.memptr(), &ldu, V.memptr(), &ldvt, work.memptr(), &lwork_tmp, rwork.memptr(), &info);
+    blas_int proposed_lwork = 0;
     
-    if(info != 0)  { return false; }
-
-    blas_int proposed_lwork = static_cast<blas_int>(real(work[0]));
+    if(lapack_work<eT>::get_lwork(proposed_lwork, lapack_work_id::cx_gesvd_usv, m, n) == false)
+      {
+      blas_int lwork_tmp = -1;  // let gesvd_() calculate the optimum size of the workspace
+      
+      arma_extra_debug_print("lapack::cx_gesvd()");
+      lapack::cx_gesvd<T>(&jobu, &jobvt, &m, &n, A.memptr(), &lda, S.memptr(), U.memptr(), &ldu, V.memptr(), &ldvt, work.memptr(), &lwork_tmp, rwork.memptr(), &info);
+      
+      if(info != 0)  { return false; }
+      
+      proposed_lwork = static_cast<blas_int>(real(work[0]));
+      
+      lapack_work<eT>::set_lwork(proposed_lwork, lapack_work_id::cx_gesvd_usv, m, n);
+      }
     
     if(proposed_lwork > lwork)
       {
       lwork = proposed_lwork;
-      work.set_size( static_cast<uword>(lwork) );
+      work.set_min_size( static_cast<uword>(lwork) );
       }
     
     arma_extra_debug_print("lapack::cx_gesvd()");
@@ -2418,21 +2466,28 @@ auxlib::svd_econ(Mat<eT>& U, Col<eT>& S, Mat<eT>& V, const Base<eT,T1>& X, const
     blas_int info  = 0;
     
     
-    podarray<eT> work( static_cast<uword>(lwork) );
-    
-    blas_int lwork_tmp = -1;  // let gesvd_() calculate the optimum size of the workspace
-    
-    arma_extra_debug_print("lapack::gesvd()");
-    lapack::gesvd<eT>(&jobu, &jobvt, &m, &n, A.memptr(), &lda, S.memptr(), U.memptr(), &ldu, V.memptr(), &ldvt, work.memptr(), &lwork_tmp, &info);
+    lapack_work<eT> work( static_cast<uword>(lwork) );
     
-    if(info != 0)  { return false; }
+    blas_int proposed_lwork = 0;
     
-    blas_int proposed_lwork = static_cast<blas_int>(work[0]);
+    if(lapack_work<eT>::get_lwork(proposed_lwork, lapack_work_id::gesvd_econ, m, n, blas_int(mode)) == false)
+      {
+      blas_int lwork_tmp = -1;  // let gesvd_() calculate the optimum size of the workspace
+      
+      arma_extra_debug_print("lapack::gesvd()");
+      lapack::gesvd<eT>(&jobu, &jobvt, &m, &n, A.memptr(), &lda, S.memptr(), U.memptr(), &ldu, V.memptr(), &ldvt, work.memptr(), &lwork_tmp, &info);
+      
+      if(info != 0)  { return false; }
+      
+      proposed_lwork = static_cast<blas_int>(work[0]);
+      
+      lapack_work<eT>::set_lwork(proposed_lwork, lapack_work_id::gesvd_econ, m, n, blas_int(mode));
+      }
     
     if(proposed_lwork > lwork)
       {
       lwork = proposed_lwork;
-      work.set_size( static_cast<uword>(lwork) );
+      work.set_min_size( static_cast<uword>(lwork) );
       }
     
     arma_extra_debug_print("lapack::gesvd()");
@@ -2533,22 +2588,29 @@ auxlib::svd_econ(Mat< std::complex<T> >& U, Col<T>& S, Mat< std::complex<T> >& V
     blas_int info  = 0;
     
     
-    podarray<eT>  work( static_cast<uword>(lwork   ) );
-    podarray<T>  rwork( static_cast<uword>(5*min_mn) );
+    lapack_work<eT>  work( static_cast<uword>(lwork   ) );
+    podarray<T>     rwork( static_cast<uword>(5*min_mn) );
     
-    blas_int lwork_tmp = -1;  // let gesvd_() calculate the optimum size of the workspace
+    blas_int proposed_lwork = 0;
     
-    arma_extra_debug_print("lapack::cx_gesvd()");
-    lapack::cx_gesvd<T>(&jobu, &jobvt, &m, &n, A.memptr(), &lda, S.memptr(), U.memptr(), &ldu, V.memptr(), &ldvt, work.memptr(), &lwork_tmp, rwork.memptr(), &info);
-    
-    if(info != 0)  { return false; }
-    
-    blas_int proposed_lwork = static_cast<blas_int>(real(work[0]));
+    if(lapack_work<eT>::get_lwork(proposed_lwork, lapack_work_id::cx_gesvd_econ, m, n, blas_int(mode)) == false)
+      {
+      blas_int lwork_tmp = -1;  // let gesvd_() calculate the optimum size of the workspace
+      
+      arma_extra_debug_print("lapack::cx_gesvd()");
+      lapack::cx_gesvd<T>(&jobu, &jobvt, &m, &n, A.memptr(), &lda, S.memptr(), U.memptr(), &ldu, V.memptr(), &ldvt, work.memptr(), &lwork_tmp, rwork.memptr(), &info);
+      
+      if(info != 0)  { return false; }
+      
+      proposed_lwork = static_cast<blas_int>(real(work[0]));
+      
+      lapack_work<eT>::set_lwork(proposed_lwork, lapack_work_id::cx_gesvd_econ, m, n, blas_int(mode));
+      }
     
     if(proposed_lwork > lwork)
       {
       lwork = proposed_lwork;
-      work.set_size( static_cast<uword>(lwork) );
+      work.set_min_size( static_cast<uword>(lwork) );
       }
     
     arma_extra_debug_print("lapack::cx_gesvd()");
@@ -2611,7 +2673,7 @@ auxlib::svd_dc(Col<eT>& S, const Base<eT,T1>& X, uword& X_n_rows, uword& X_n_col
     
     S.set_size( static_cast<uword>(min_mn) );
     
-    podarray<eT>        work( static_cast<uword>(lwork   ) );
+    lapack_work<eT>     work( static_cast<uword>(lwork   ) );
     podarray<blas_int> iwork( static_cast<uword>(8*min_mn) );
     
     arma_extra_debug_print("lapack::gesdd()");
@@ -2679,7 +2741,7 @@ auxlib::svd_dc(Col<T>& S, const Base<std::complex<T>, T1>& X, uword& X_n_rows, u
     
     S.set_size( static_cast<uword>(min_mn) );
     
-    podarray<eT>        work( static_cast<uword>(lwork   ) );
+    lapack_work<eT>     work( static_cast<uword>(lwork   ) );
     podarray<T>        rwork( static_cast<uword>(7*min_mn) );  // LAPACK 3.4.2 docs state 5*min(m,n), while zgesdd() seems to write past the end 
     podarray<blas_int> iwork( static_cast<uword>(8*min_mn) );
     
@@ -2768,7 +2830,7 @@ auxlib::svd_dc(Mat<eT>& U, Col<eT>& S, Mat<eT>& V, const Base<eT,T1>& X)
     
     S.set_size( static_cast<uword>(min_mn) );
     
-    podarray<eT>        work( static_cast<uword>(lwork   ) );
+    lapack_work<eT>     work( static_cast<uword>(lwork   ) );
     podarray<blas_int> iwork( static_cast<uword>(8*min_mn) );
     
     arma_extra_debug_print("lapack::gesdd()");
@@ -2841,7 +2903,7 @@ auxlib::svd_dc(Mat< std::complex<T> >& U, Col<T>& S, Mat< std::complex<T> >& V,
     
     S.set_size( static_cast<uword>(min_mn) );
     
-    podarray<eT>        work( static_cast<uword>(lwork   ) );
+    lapack_work<eT>     work( static_cast<uword>(lwork   ) );
     podarray<T>        rwork( static_cast<uword>(lrwork  ) );
     podarray<blas_int> iwork( static_cast<uword>(8*min_mn) );
     
@@ -2907,7 +2969,7 @@ auxlib::svd_dc_econ(Mat<eT>& U, Col<eT>& S, Mat<eT>& V, const Base<eT,T1>& X)
     
     V.set_size( static_cast<uword>(min_mn), static_cast<uword>(n) );
     
-    podarray<eT>        work( static_cast<uword>(lwork   ) );
+    lapack_work<eT>     work( static_cast<uword>(lwork   ) );
     podarray<blas_int> iwork( static_cast<uword>(8*min_mn) );
     
     arma_extra_debug_print("lapack::gesdd()");
@@ -2981,7 +3043,7 @@ auxlib::svd_dc_econ(Mat< std::complex<T> >& U, Col<T>& S, Mat< std::complex<T> >
     
     V.set_size( static_cast<uword>(min_mn), static_cast<uword>(n) );
     
-    podarray<eT>        work( static_cast<uword>(lwork   ) );
+    lapack_work<eT>     work( static_cast<uword>(lwork   ) );
     podarray<T>        rwork( static_cast<uword>(lrwork  ) );
     podarray<blas_int> iwork( static_cast<uword>(8*min_mn) );
     
@@ -3351,7 +3413,7 @@ auxlib::solve_approx_fast(Mat<typename T1::elem_type>& out, Mat<typename T1::ele
     blas_int  lwork = 3 * ( (std::max)(blas_int(1), mn + (std::max)(mn, nrhs)) );
     blas_int  info  = 0;
     
-    podarray<eT> work( static_cast<uword>(lwork) );
+    lapack_work<eT> work( static_cast<uword>(lwork) );
     
     arma_extra_debug_print("lapack::gels()");
     lapack::gels<eT>( &trans, &m, &n, &nrhs, A.memptr(), &lda, tmp.memptr(), &ldb, work.memptr(), &lwork, &info );
@@ -3453,17 +3515,24 @@ auxlib::solve_approx_svd(Mat<typename T1::pod_type>& out, Mat<typename T1::pod_t
     
     podarray<blas_int> iwork( static_cast<uword>(liwork) );
     
-    eT        work_query[2];
-    blas_int lwork_query = blas_int(-1);
-    
-    arma_extra_debug_print("lapack::gelsd()");
-    lapack::gelsd(&m, &n, &nrhs, A.memptr(), &lda, tmp.memptr(), &ldb, S.memptr(), &rcond, &rank, &work_query[0], &lwork_query, iwork.memptr(), &info);
-    
-    if(info != 0)  { return false; }
+    blas_int lwork = 0;
     
-    blas_int lwork = static_cast<blas_int>( access::tmp_real(work_query[0]) );
+    if(lapack_work<eT>::get_lwork(lwork, lapack_work_id::gelsd, m, n, nrhs) == false)
+      {
+      eT        work_query[2];
+      blas_int lwork_query = blas_int(-1);
+      
+      arma_extra_debug_print("lapack::gelsd()");
+      lapack::gelsd(&m, &n, &nrhs, A.memptr(), &lda, tmp.memptr(), &ldb, S.memptr(), &rcond, &rank, &work_query[0], &lwork_query, iwork.memptr(), &info);
+      
+      if(info != 0)  { return false; }
+      
+      lwork = static_cast<blas_int>( access::tmp_real(work_query[0]) );
+      
+      lapack_work<eT>::set_lwork(lwork, lapack_work_id::gelsd, m, n, nrhs);
+      }
     
-    podarray<eT> work( static_cast<uword>(lwork) );
+    lapack_work<eT> work( static_cast<uword>(lwork) );
     
     arma_extra_debug_print("lapack::gelsd()");
     lapack::gelsd(&m, &n, &nrhs, A.memptr(), &lda, tmp.memptr(), &ldb, S.memptr(), &rcond, &rank, work.memptr(), &lwork, iwork.memptr(), &info);
@@ -3579,17 +3648,24 @@ auxlib::solve_approx_svd(Mat< std::complex<typename T1::pod_type> >& out, Mat< s
     podarray<T>        rwork( static_cast<uword>(lrwork) );
     podarray<blas_int> iwork( static_cast<uword>(liwork) );
     
-    eT        work_query[2];
-    blas_int lwork_query = blas_int(-1);
-    
-    arma_extra_debug_print("lapack::cx_gelsd()");
-    lapack::cx_gelsd(&m, &n, &nrhs, A.memptr(), &lda, tmp.memptr(), &ldb, S.memptr(), &rcond, &rank, &work_query[0], &lwork_query, rwork.memptr(), iwork.memptr(), &info);
-    
-    if(info != 0)  { return false; }
+    blas_int lwork = 0;
     
-    blas_int lwork  = static_cast<blas_int>( access::tmp_real( work_query[0]) );
+    if(lapack_work<eT>::get_lwork(lwork, lapack_work_id::cx_gelsd, m, n, nrhs) == false)
+      {
+      eT        work_query[2];
+      blas_int lwork_query = blas_int(-1);
+      
+      arma_extra_debug_print("lapack::cx_gelsd()");
+      lapack::cx_gelsd(&m, &n, &nrhs, A.memptr(), &lda, tmp.memptr(), &ldb, S.memptr(), &rcond, &rank, &work_query[0], &lwork_query, rwork.memptr(), iwork.memptr(), &info);
+      
+      if(info != 0)  { return false; }
+      
+      lwork = static_cast<blas_int>( access::tmp_real( work_query[0]) );
+      
+      lapack_work<eT>::set_lwork(lwork, lapack_work_id::cx_gelsd, m, n, nrhs);
+      }
     
-    podarray<eT> work( static_cast<uword>(lwork) );
+    lapack_work<eT> work( static_cast<uword>(lwork) );
     
     arma_extra_debug_print("lapack::cx_gelsd()");
     lapack::cx_gelsd(&m, &n, &nrhs, A.memptr(), &lda, tmp.memptr(), &ldb, S.memptr(), &rcond, &rank, work.memptr(), &lwork, rwork.memptr(), iwork.memptr(), &info);
@@ -3671,60 +3747,119 @@ auxlib::solve_tri(Mat<typename T1::elem_type>& out, const Mat<typename T1::elem_
 
 
 //
-// Schur decomposition
+// solve systems with structured matrices (diagonal, tridiagonal, band, symmetric positive definite)
 
-template<typename eT, typename T1>
+template<typename T1>
 inline
 bool
-auxlib::schur(Mat<eT>& U, Mat<eT>& S, const Base<eT,T1>& X, const bool calc_U)
+auxlib::solve_diag(Mat<typename T1::elem_type>& out, typename T1::pod_type& out_rcond, const Mat<typename T1::elem_type>& A, const Base<typename T1::elem_type,T1>& B_expr)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  typedef typename T1::pod_type   T;
+  
+  out_rcond = T(0);
+  
+  out = B_expr.get_ref();
+  
+  const uword B_n_rows = out.n_rows;
+  const uword B_n_cols = out.n_cols;
+  
+  arma_debug_check( (A.n_rows != B_n_rows), "solve(): number of rows in the given matrices must be the same" );
+  
+  if(A.is_empty() || out.is_empty())
+    {
+    out.zeros(A.n_cols, B_n_cols);
+    return true;
+    }
+  
+  const uword N = A.n_rows;
+  
+  T abs_min = std::abs(A.at(0,0));
+  T abs_max = abs_min;
+  
+  for(uword i=1; i < N; ++i)
+    {
+    const T abs_val = std::abs(A.at(i,i));
+    
+    abs_min = (std::min)(abs_min, abs_val);
+    abs_max = (std::max)(abs_max, abs_val);
+    }
+  
+  if(abs_min == T(0))  { return false; }
+  
+  for(uword col=0; col < B_n_cols; ++col)
+    {
+    eT* out_colmem = out.colptr(col);
+    
+    for(uword i=0; i < N; ++i)  { out_colmem[i] /= A.at(i,i); }
+    }
+  
+  // the 1-norm condition number of a diagonal matrix is the ratio of its largest and smallest absolute elements
+  out_rcond = abs_min / abs_max;
+  
+  return true;
+  }
+
+
+
+template<typename T1>
+inline
+bool
+auxlib::solve_tridiag_fast(Mat<typename T1::elem_type>& out, const Mat<typename T1::elem_type>& A, const Base<typename T1::elem_type,T1>& B_expr)
   {
   arma_extra_debug_sigprint();
   
   #if defined(ARMA_USE_LAPACK)
     {
-    S = X.get_ref();
+    typedef typename T1::elem_type eT;
     
-    arma_debug_check( (S.is_square() == false), "schur(): given matrix must be square sized" );
+    out = B_expr.get_ref();
     
-    if(S.is_empty())
+    const uword B_n_rows = out.n_rows;
+    const uword B_n_cols = out.n_cols;
+    
+    arma_debug_check( (A.n_rows != B_n_rows), "solve(): number of rows in the given matrices must be the same" );
+    
+    if(A.is_empty() || out.is_empty())
       {
-      U.reset();
-      S.reset();
+      out.zeros(A.n_cols, B_n_cols);
       return true;
       }
     
-    arma_debug_assert_blas_size(S);
+    arma_debug_assert_blas_size(A,out);
     
-    const uword S_n_rows = S.n_rows;
+    const uword N = A.n_rows;
     
-    if(calc_U) { U.set_size(S_n_rows, S_n_rows); } else { U.set_size(1,1); }
+    // gtsv() overwrites the diagonals
     
-    char      jobvs  = calc_U ? 'V' : 'N';
-    char      sort   = 'N';
-    void*     select = 0;
-    blas_int  n      = blas_int(S_n_rows);
-    blas_int  sdim   = 0;
-    blas_int  ldvs   = calc_U ? n : blas_int(1);
-    blas_int  lwork  = 3 * ((std::max)(blas_int(1), 3*n));
-    blas_int  info   = 0;
+    podarray<eT> DL(N);
+    podarray<eT> DD(N);
+    podarray<eT> DU(N);
     
-    podarray<eT> wr(S_n_rows);
-    podarray<eT> wi(S_n_rows);
+    for(uword i=0; i < N; ++i)
+      {
+      DD[i] = A.at(i,i);
+      
+      if(i > 0)  { DL[i-1] = A.at(i,i-1); DU[i-1] = A.at(i-1,i); }
+      }
     
-    podarray<eT>        work( static_cast<uword>(lwork) );
-    podarray<blas_int> bwork(S_n_rows);
+    blas_int n    = blas_int(N);
+    blas_int nrhs = blas_int(B_n_cols);
+    blas_int info = blas_int(0);
     
-    arma_extra_debug_print("lapack::gees()");
-    lapack::gees(&jobvs, &sort, select, &n, S.memptr(), &n, &sdim, wr.memptr(), wi.memptr(), U.memptr(), &ldvs, work.memptr(), &lwork, bwork.memptr(), &info);
+    arma_extra_debug_print("lapack::gtsv()");
+    lapack::gtsv(&n, &nrhs, DL.memptr(), DD.memptr(), DU.memptr(), out.memptr(), &n, &info);
     
     return (info == 0);
     }
   #else
     {
-    arma_ignore(U);
-    arma_ignore(S);
-    arma_ignore(X);
-    arma_stop_logic_error("schur(): use of LAPACK must be enabled");
+    arma_ignore(out);
+    arma_ignore(A);
+    arma_ignore(B_expr);
+    arma_stop_logic_error("solve(): use of LAPACK must be enabled");
     return false;
     }
   #endif
@@ -3732,47 +3867,680 @@ auxlib::schur(Mat<eT>& U, Mat<eT>& S, const Base<eT,T1>& X, const bool calc_U)
 
 
 
-template<typename T, typename T1>
-inline
-bool
-auxlib::schur(Mat<std::complex<T> >& U, Mat<std::complex<T> >& S, const Base<std::complex<T>,T1>& X, const bool calc_U)
-  {
-  arma_extra_debug_sigprint();
-  
-  S = X.get_ref();
-  
-  arma_debug_check( (S.is_square() == false), "schur(): given matrix must be square sized" );
-  
-  return auxlib::schur(U,S,calc_U);
-  }
-
-
-
-template<typename T>
+template<typename T1>
 inline
 bool
-auxlib::schur(Mat<std::complex<T> >& U, Mat<std::complex<T> >& S, const bool calc_U)
+auxlib::solve_band_fast(Mat<typename T1::elem_type>& out, const Mat<typename T1::elem_type>& A, const uword KL, const uword KU, const Base<typename T1::elem_type,T1>& B_expr)
   {
   arma_extra_debug_sigprint();
   
-  #if (defined(ARMA_USE_LAPACK) && defined(ARMA_CRIPPLED_LAPACK))
-    {
-    arma_ignore(U);
-    arma_ignore(S);
-    arma_ignore(calc_U);
-    arma_stop_logic_error("schur() for complex matrices not available due to crippled LAPACK");
-    return false;
-    }
-  #elif defined(ARMA_USE_LAPACK)
+  #if defined(ARMA_USE_LAPACK)
     {
-    typedef std::complex<T> eT;
+    typedef typename T1::elem_type eT;
     
-    if(S.is_empty())
-      {
-      U.reset();
-      S.reset();
-      return true;
-      }
+    out = B_expr.get_ref();
+    
+    const uword B_n_rows = out.n_rows;
+    const uword B_n_cols = out.n_cols;
+    
+    arma_debug_check( (A.n_rows != B_n_rows), "solve(): number of rows in the given matrices must be the same" );
+    
+    if(A.is_empty() || out.is_empty())
+      {
+      out.zeros(A.n_cols, B_n_cols);
+      return true;
+      }
+    
+    Mat<eT> AB;
+    
+    band_helper::compress(AB, A, KL, KU);
+    
+    arma_debug_assert_blas_size(AB,out);
+    
+    blas_int n    = blas_int(A.n_rows);
+    blas_int kl   = blas_int(KL);
+    blas_int ku   = blas_int(KU);
+    blas_int nrhs = blas_int(B_n_cols);
+    blas_int ldab = blas_int(AB.n_rows);
+    blas_int info = blas_int(0);
+    
+    podarray<blas_int> ipiv(A.n_rows + 2);  // +2 for paranoia
+    
+    arma_extra_debug_print("lapack::gbsv()");
+    lapack::gbsv(&n, &kl, &ku, &nrhs, AB.memptr(), &ldab, ipiv.memptr(), out.memptr(), &n, &info);
+    
+    return (info == 0);
+    }
+  #else
+    {
+    arma_ignore(out);
+    arma_ignore(A);
+    arma_ignore(KL);
+    arma_ignore(KU);
+    arma_ignore(B_expr);
+    arma_stop_logic_error("solve(): use of LAPACK must be enabled");
+    return false;
+    }
+  #endif
+  }
+
+
+
+template<typename T1>
+inline
+bool
+auxlib::solve_band_rcond(Mat<typename T1::elem_type>& out, typename T1::pod_type& out_rcond, const Mat<typename T1::elem_type>& A, const uword KL, const uword KU, const Base<typename T1::elem_type,T1>& B_expr)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    typedef typename T1::elem_type eT;
+    typedef typename T1::pod_type   T;
+    
+    out_rcond = T(0);
+    
+    out = B_expr.get_ref();
+    
+    const uword B_n_rows = out.n_rows;
+    const uword B_n_cols = out.n_cols;
+    
+    arma_debug_check( (A.n_rows != B_n_rows), "solve(): number of rows in the given matrices must be the same" );
+    
+    if(A.is_empty() || out.is_empty())
+      {
+      out.zeros(A.n_cols, B_n_cols);
+      return true;
+      }
+    
+    Mat<eT> AB;
+    
+    band_helper::compress(AB, A, KL, KU);
+    
+    arma_debug_assert_blas_size(AB,out);
+    
+    // 1-norm of the band; the top KL rows of AB are used as workspace by gbsv()
+    
+    T norm_val = T(0);
+    
+    for(uword col=0; col < AB.n_cols; ++col)
+      {
+      const eT* AB_colmem = AB.colptr(col);
+      
+      T acc = T(0);
+      
+      for(uword row=KL; row < AB.n_rows; ++row)  { acc += std::abs(AB_colmem[row]); }
+      
+      norm_val = (std::max)(norm_val, acc);
+      }
+    
+    blas_int n    = blas_int(A.n_rows);
+    blas_int kl   = blas_int(KL);
+    blas_int ku   = blas_int(KU);
+    blas_int nrhs = blas_int(B_n_cols);
+    blas_int ldab = blas_int(AB.n_rows);
+    blas_int info = blas_int(0);
+    
+    podarray<blas_int> ipiv(A.n_rows + 2);  // +2 for paranoia
+    
+    arma_extra_debug_print("lapack::gbsv()");
+    lapack::gbsv(&n, &kl, &ku, &nrhs, AB.memptr(), &ldab, ipiv.memptr(), out.memptr(), &n, &info);
+    
+    if(info != 0)  { return false; }
+    
+    out_rcond = auxlib::rcond_band(AB, KL, KU, ipiv, norm_val);
+    
+    return true;
+    }
+  #else
+    {
+    arma_ignore(out);
+    arma_ignore(out_rcond);
+    arma_ignore(A);
+    arma_ignore(KL);
+    arma_ignore(KU);
+    arma_ignore(B_expr);
+    arma_stop_logic_error("solve(): use of LAPACK must be enabled");
+    return false;
+    }
+  #endif
+  }
+
+
+
+//! A is overwritten by its Cholesky decomposition
+template<typename T1>
+inline
+bool
+auxlib::solve_sympd_fast(Mat<typename T1::elem_type>& out, Mat<typename T1::elem_type>& A, const Base<typename T1::elem_type,T1>& B_expr)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    out = B_expr.get_ref();
+    
+    const uword B_n_rows = out.n_rows;
+    const uword B_n_cols = out.n_cols;
+    
+    arma_debug_check( (A.n_rows != B_n_rows), "solve(): number of rows in the given matrices must be the same" );
+    
+    if(A.is_empty() || out.is_empty())
+      {
+      out.zeros(A.n_cols, B_n_cols);
+      return true;
+      }
+    
+    arma_debug_assert_blas_size(A,out);
+    
+    char     uplo = 'U';
+    blas_int n    = blas_int(A.n_rows);
+    blas_int nrhs = blas_int(B_n_cols);
+    blas_int info = blas_int(0);
+    
+    arma_extra_debug_print("lapack::posv()");
+    lapack::posv(&uplo, &n, &nrhs, A.memptr(), &n, out.memptr(), &n, &info);
+    
+    return (info == 0);
+    }
+  #else
+    {
+    arma_ignore(out);
+    arma_ignore(A);
+    arma_ignore(B_expr);
+    arma_stop_logic_error("solve(): use of LAPACK must be enabled");
+    return false;
+    }
+  #endif
+  }
+
+
+
+//! A is overwritten by its Cholesky decomposition
+template<typename T1>
+inline
+bool
+auxlib::solve_sympd_rcond(Mat<typename T1::elem_type>& out, typename T1::pod_type& out_rcond, Mat<typename T1::elem_type>& A, const Base<typename T1::elem_type,T1>& B_expr)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    typedef typename T1::pod_type T;
+    
+    out_rcond = T(0);
+    
+    out = B_expr.get_ref();
+    
+    const uword B_n_rows = out.n_rows;
+    const uword B_n_cols = out.n_cols;
+    
+    arma_debug_check( (A.n_rows != B_n_rows), "solve(): number of rows in the given matrices must be the same" );
+    
+    if(A.is_empty() || out.is_empty())
+      {
+      out.zeros(A.n_cols, B_n_cols);
+      return true;
+      }
+    
+    arma_debug_assert_blas_size(A,out);
+    
+    char     norm_id  = '1';
+    char     uplo     = 'U';
+    blas_int n        = blas_int(A.n_rows);
+    blas_int nrhs     = blas_int(B_n_cols);
+    blas_int info     = blas_int(0);
+    T        norm_val = T(0);
+    
+    podarray<T> junk(1);
+    
+    norm_val = lapack::lange(&norm_id, &n, &n, A.memptr(), &n, junk.memptr());
+    
+    arma_extra_debug_print("lapack::posv()");
+    lapack::posv(&uplo, &n, &nrhs, A.memptr(), &n, out.memptr(), &n, &info);
+    
+    if(info != 0)  { return false; }
+    
+    out_rcond = auxlib::rcond_sympd(A, norm_val);
+    
+    return true;
+    }
+  #else
+    {
+    arma_ignore(out);
+    arma_ignore(out_rcond);
+    arma_ignore(A);
+    arma_ignore(B_expr);
+    arma_stop_logic_error("solve(): use of LAPACK must be enabled");
+    return false;
+    }
+  #endif
+  }
+
+
+
+template<typename T1>
+inline
+bool
+auxlib::solve_tri_rcond(Mat<typename T1::elem_type>& out, typename T1::pod_type& out_rcond, const Mat<typename T1::elem_type>& A, const Base<typename T1::elem_type,T1>& B_expr, const uword layout)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename T1::pod_type T;
+  
+  out_rcond = T(0);
+  
+  const bool status = auxlib::solve_tri(out, A, B_expr, layout);
+  
+  if(status == false)  { return false; }
+  
+  if(A.is_empty() == false)  { out_rcond = auxlib::rcond_trimat(A, layout); }
+  
+  return true;
+  }
+
+
+
+//
+// factorisations kept for repeated solves (lu_factor, chol_factor, qr_factor)
+
+//! in-place LU factorisation of a square matrix, with partial pivoting
+template<typename eT>
+inline
+bool
+auxlib::lu_fact(Mat<eT>& LU, podarray<blas_int>& ipiv)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    ipiv.reset();
+    
+    if(LU.is_empty())  { return true; }
+    
+    arma_debug_assert_blas_size(LU);
+    
+    blas_int n    = blas_int(LU.n_rows);
+    blas_int info = 0;
+    
+    ipiv.set_size(LU.n_rows);
+    
+    arma_extra_debug_print("lapack::getrf()");
+    lapack::getrf(&n, &n, LU.memptr(), &n, ipiv.memptr(), &info);
+    
+    return (info == 0);
+    }
+  #else
+    {
+    arma_ignore(LU);
+    arma_ignore(ipiv);
+    arma_stop_logic_error("lu_factor(): use of LAPACK must be enabled");
+    return false;
+    }
+  #endif
+  }
+
+
+
+//! solve A*X = B using the output of lu_fact(); X holds B on input
+template<typename eT>
+inline
+bool
+auxlib::lu_fact_solve(Mat<eT>& X, const Mat<eT>& LU, const podarray<blas_int>& ipiv)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    if(LU.is_empty() || X.is_empty())
+      {
+      X.zeros(LU.n_cols, X.n_cols);
+      return true;
+      }
+    
+    arma_debug_assert_blas_size(LU,X);
+    
+    char     trans = 'N';
+    blas_int n     = blas_int(LU.n_rows);
+    blas_int nrhs  = blas_int(X.n_cols);
+    blas_int info  = 0;
+    
+    arma_extra_debug_print("lapack::getrs()");
+    lapack::getrs(&trans, &n, &nrhs, const_cast<eT*>(LU.memptr()), &n, const_cast<blas_int*>(ipiv.memptr()), X.memptr(), &n, &info);
+    
+    return (info == 0);
+    }
+  #else
+    {
+    arma_ignore(X);
+    arma_ignore(LU);
+    arma_ignore(ipiv);
+    arma_stop_logic_error("lu_factor::solve(): use of LAPACK must be enabled");
+    return false;
+    }
+  #endif
+  }
+
+
+
+//! solve A*X = B, where A = R'*R and R is upper triangular; X holds B on input
+template<typename eT>
+inline
+bool
+auxlib::chol_fact_solve(Mat<eT>& X, const Mat<eT>& R)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    if(R.is_empty() || X.is_empty())
+      {
+      X.zeros(R.n_cols, X.n_cols);
+      return true;
+      }
+    
+    arma_debug_assert_blas_size(R,X);
+    
+    char     uplo = 'U';
+    blas_int n    = blas_int(R.n_rows);
+    blas_int nrhs = blas_int(X.n_cols);
+    blas_int info = 0;
+    
+    arma_extra_debug_print("lapack::potrs()");
+    lapack::potrs(&uplo, &n, &nrhs, const_cast<eT*>(R.memptr()), &n, X.memptr(), &n, &info);
+    
+    return (info == 0);
+    }
+  #else
+    {
+    arma_ignore(X);
+    arma_ignore(R);
+    arma_stop_logic_error("chol_factor::solve(): use of LAPACK must be enabled");
+    return false;
+    }
+  #endif
+  }
+
+
+
+//! in-place QR factorisation; Q is kept in compact form (Householder reflectors below the diagonal of QR, and tau)
+template<typename eT>
+inline
+bool
+auxlib::qr_fact(Mat<eT>& QR, podarray<eT>& tau)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    tau.reset();
+    
+    if(QR.is_empty())  { return true; }
+    
+    arma_debug_assert_blas_size(QR);
+    
+    blas_int m         = static_cast<blas_int>(QR.n_rows);
+    blas_int n         = static_cast<blas_int>(QR.n_cols);
+    blas_int lwork     = 0;
+    blas_int lwork_min = (std::max)(blas_int(1), n);
+    blas_int k         = (std::min)(m,n);
+    blas_int info      = 0;
+    
+    tau.set_size( static_cast<uword>(k) );
+    
+    blas_int lwork_proposed = 0;
+    
+    if(lapack_work<eT>::get_lwork(lwork_proposed, lapack_work_id::geqrf, m, n) == false)
+      {
+      eT        work_query[2];
+      blas_int lwork_query = -1;
+      
+      arma_extra_debug_print("lapack::geqrf()");
+      lapack::geqrf(&m, &n, QR.memptr(), &m, tau.memptr(), &work_query[0], &lwork_query, &info);
+      
+      if(info != 0)  { return false; }
+      
+      lwork_proposed = static_cast<blas_int>( access::tmp_real(work_query[0]) );
+      
+      lapack_work<eT>::set_lwork(lwork_proposed, lapack_work_id::geqrf, m, n);
+      }
+    
+    lwork = (std::max)(lwork_proposed, lwork_min);
+    
+    lapack_work<eT> work( static_cast<uword>(lwork) );
+    
+    arma_extra_debug_print("lapack::geqrf()");
+    lapack::geqrf(&m, &n, QR.memptr(), &m, tau.memptr(), work.memptr(), &lwork, &info);
+    
+    return (info == 0);
+    }
+  #else
+    {
+    arma_ignore(QR);
+    arma_ignore(tau);
+    arma_stop_logic_error("qr_factor(): use of LAPACK must be enabled");
+    return false;
+    }
+  #endif
+  }
+
+
+
+//! least-squares solution of A*X = B using the output of qr_fact(), for A with n_rows >= n_cols;
+//! X holds B on input and the solution on output
+template<typename eT>
+inline
+bool
+auxlib::qr_fact_solve(Mat<eT>& X, const Mat<eT>& QR, const podarray<eT>& tau)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    const uword QR_n_rows = QR.n_rows;
+    const uword QR_n_cols = QR.n_cols;
+    
+    if(QR.is_empty() || X.is_empty())
+      {
+      X.zeros(QR_n_cols, X.n_cols);
+      return true;
+      }
+    
+    arma_debug_assert_blas_size(QR,X);
+    
+    blas_int m         = static_cast<blas_int>(QR_n_rows);
+    blas_int n         = static_cast<blas_int>(X.n_cols);
+    blas_int k         = static_cast<blas_int>(QR_n_cols);
+    blas_int lwork     = 0;
+    blas_int lwork_min = (std::max)(blas_int(1), n);
+    blas_int info      = 0;
+    
+    const bool is_real = (is_float<eT>::value) || (is_double<eT>::value);
+    
+    char side  = 'L';
+    char trans = (is_real) ? 'T' : 'C';
+    
+    eT* QR_mem  = const_cast<eT*>(QR.memptr());
+    eT* tau_mem = const_cast<eT*>(tau.memptr());
+    
+    const blas_int routine = (is_real) ? lapack_work_id::ormqr : lapack_work_id::unmqr;
+    
+    blas_int lwork_proposed = 0;
+    
+    if(lapack_work<eT>::get_lwork(lwork_proposed, routine, m, n, k) == false)
+      {
+      eT        work_query[2];
+      blas_int lwork_query = -1;
+      
+      if(is_real)
+        {
+        arma_extra_debug_print("lapack::ormqr()");
+        lapack::ormqr(&side, &trans, &m, &n, &k, QR_mem, &m, tau_mem, X.memptr(), &m, &work_query[0], &lwork_query, &info);
+        }
+      else
+        {
+        arma_extra_debug_print("lapack::unmqr()");
+        lapack::unmqr(&side, &trans, &m, &n, &k, QR_mem, &m, tau_mem, X.memptr(), &m, &work_query[0], &lwork_query, &info);
+        }
+      
+      if(info != 0)  { return false; }
+      
+      lwork_proposed = static_cast<blas_int>( access::tmp_real(work_query[0]) );
+      
+      lapack_work<eT>::set_lwork(lwork_proposed, routine, m, n, k);
+      }
+    
+    lwork = (std::max)(lwork_proposed, lwork_min);
+    
+    lapack_work<eT> work( static_cast<uword>(lwork) );
+    
+    // X = Q' * B
+    
+    if(is_real)
+      {
+      arma_extra_debug_print("lapack::ormqr()");
+      lapack::ormqr(&side, &trans, &m, &n, &k, QR_mem, &m, tau_mem, X.memptr(), &m, work.memptr(), &lwork, &info);
+      }
+    else
+      {
+      arma_extra_debug_print("lapack::unmqr()");
+      lapack::unmqr(&side, &trans, &m, &n, &k, QR_mem, &m, tau_mem, X.memptr(), &m, work.memptr(), &lwork, &info);
+      }
+    
+    if(info != 0)  { return false; }
+    
+    // solve R * X = Q' * B, using the top k rows of X
+    
+    char     uplo    = 'U';
+    char     trans_R = 'N';
+    char     diag    = 'N';
+    blas_int nrhs    = n;
+    
+    arma_extra_debug_print("lapack::trtrs()");
+    lapack::trtrs(&uplo, &trans_R, &diag, &k, &nrhs, QR_mem, &m, X.memptr(), &m, &info);
+    
+    if(info != 0)  { return false; }
+    
+    if(QR_n_rows > QR_n_cols)  { X.shed_rows(QR_n_cols, QR_n_rows-1); }
+    
+    return true;
+    }
+  #else
+    {
+    arma_ignore(X);
+    arma_ignore(QR);
+    arma_ignore(tau);
+    arma_stop_logic_error("qr_factor::solve(): use of LAPACK must be enabled");
+    return false;
+    }
+  #endif
+  }
+
+
+
+//
+// Schur decomposition
+
+template<typename eT, typename T1>
+inline
+bool
+auxlib::schur(Mat<eT>& U, Mat<eT>& S, const Base<eT,T1>& X, const bool calc_U)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    S = X.get_ref();
+    
+    arma_debug_check( (S.is_square() == false), "schur(): given matrix must be square sized" );
+    
+    if(S.is_empty())
+      {
+      U.reset();
+      S.reset();
+      return true;
+      }
+    
+    arma_debug_assert_blas_size(S);
+    
+    const uword S_n_rows = S.n_rows;
+    
+    if(calc_U) { U.set_size(S_n_rows, S_n_rows); } else { U.set_size(1,1); }
+    
+    char      jobvs  = calc_U ? 'V' : 'N';
+    char      sort   = 'N';
+    void*     select = 0;
+    blas_int  n      = blas_int(S_n_rows);
+    blas_int  sdim   = 0;
+    blas_int  ldvs   = calc_U ? n : blas_int(1);
+    blas_int  lwork  = 3 * ((std::max)(blas_int(1), 3*n));
+    blas_int  info   = 0;
+    
+    podarray<eT> wr(S_n_rows);
+    podarray<eT> wi(S_n_rows);
+    
+    lapack_work<eT>     work( static_cast<uword>(lwork) );
+    podarray<blas_int> bwork(S_n_rows);
+    
+    arma_extra_debug_print("lapack::gees()");
+    lapack::gees(&jobvs, &sort, select, &n, S.memptr(), &n, &sdim, wr.memptr(), wi.memptr(), U.memptr(), &ldvs, work.memptr(), &lwork, bwork.memptr(), &info);
+    
+    return (info == 0);
+    }
+  #else
+    {
+    arma_ignore(U);
+    arma_ignore(S);
+    arma_ignore(X);
+    arma_stop_logic_error("schur(): use of LAPACK must be enabled");
+    return false;
+    }
+  #endif
+  }
+
+
+
+template<typename T, typename T1>
+inline
+bool
+auxlib::schur(Mat<std::complex<T> >& U, Mat<std::complex<T> >& S, const Base<std::complex<T>,T1>& X, const bool calc_U)
+  {
+  arma_extra_debug_sigprint();
+  
+  S = X.get_ref();
+  
+  arma_debug_check( (S.is_square() == false), "schur(): given matrix must be square sized" );
+  
+  return auxlib::schur(U,S,calc_U);
+  }
+
+
+
+template<typename T>
+inline
+bool
+auxlib::schur(Mat<std::complex<T> >& U, Mat<std::complex<T> >& S, const bool calc_U)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if (defined(ARMA_USE_LAPACK) && defined(ARMA_CRIPPLED_LAPACK))
+    {
+    arma_ignore(U);
+    arma_ignore(S);
+    arma_ignore(calc_U);
+    arma_stop_logic_error("schur() for complex matrices not available due to crippled LAPACK");
+    return false;
+    }
+  #elif defined(ARMA_USE_LAPACK)
+    {
+    typedef std::complex<T> eT;
+    
+    if(S.is_empty())
+      {
+      U.reset();
+      S.reset();
+      return true;
+      }
     
     arma_debug_assert_blas_size(S);
     
@@ -3790,7 +4558,7 @@ auxlib::schur(Mat<std::complex<T> >& U, Mat<std::complex<T> >& S, const bool cal
     blas_int  info   = 0;
     
     podarray<eT>           w(S_n_rows);
-    podarray<eT>        work( static_cast<uword>(lwork) );
+    lapack_work<eT>     work( static_cast<uword>(lwork) );
     podarray< T>       rwork(S_n_rows);
     podarray<blas_int> bwork(S_n_rows);
     
@@ -3925,8 +4693,8 @@ auxlib::qz(Mat<T>& A, Mat<T>& B, Mat<T>& vsl, Mat<T>& vsr, const Base<T,T1>& X_e
     podarray<T> alphai(A.n_rows);
     podarray<T>   beta(A.n_rows);
     
-    podarray<T>   work( static_cast<uword>(lwork) );
-    podarray<T>  bwork( static_cast<uword>(N)     );
+    lapack_work<T>   work( static_cast<uword>(lwork) );
+    podarray<T>     bwork( static_cast<uword>(N)     );
     
     arma_extra_debug_print("lapack::gges()");
     
@@ -4018,9 +4786,9 @@ auxlib::qz(Mat< std::complex<T> >& A, Mat< std::complex<T> >& B, Mat< std::compl
     podarray<eT> alpha(A.n_rows);
     podarray<eT>  beta(A.n_rows);
     
-    podarray<eT>  work( static_cast<uword>(lwork) );
-    podarray< T> rwork( static_cast<uword>(8*N)   );
-    podarray< T> bwork( static_cast<uword>(N)     );
+    lapack_work<eT>  work( static_cast<uword>(lwork) );
+    podarray< T>    rwork( static_cast<uword>(8*N)   );
+    podarray< T>    bwork( static_cast<uword>(N)     );
     
     arma_extra_debug_print("lapack::cx_gges()");
     
@@ -4081,7 +4849,7 @@ auxlib::rcond(const Base<typename T1::pod_type,T1>& A_expr)
     T        rcond    = T(0);
     blas_int info     = blas_int(0);
     
-    podarray<eT>        work(4*A.n_rows);
+    lapack_work<eT>     work(4*A.n_rows);
     podarray<blas_int> iwork(A.n_rows);
     podarray<blas_int> ipiv( (std::min)(A.n_rows, A.n_cols) );
     
@@ -4137,7 +4905,7 @@ auxlib::rcond(const Base<std::complex<typename T1::pod_type>,T1>& A_expr)
     blas_int info     = blas_int(0);
     
     podarray< T>       junk(1);
-    podarray<eT>        work(2*A.n_rows);
+    lapack_work<eT>     work(2*A.n_rows);
     podarray< T>       rwork(2*A.n_rows);
     podarray<blas_int> iwork(A.n_rows);
     podarray<blas_int> ipiv( (std::min)(A.n_rows, A.n_cols) );
@@ -4166,4 +4934,269 @@ auxlib::rcond(const Base<std::complex<typename T1::pod_type>,T1>& A_expr)
 
 
 
+//! reciprocal of the 1-norm condition number of a triangular matrix
+template<typename T>
+inline
+T
+auxlib::rcond_trimat(const Mat<T>& A, const uword layout)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    arma_debug_assert_blas_size(A);
+    
+    char     norm_id = '1';
+    char     uplo    = (layout == 0) ? 'U' : 'L';
+    char     diag    = 'N';
+    blas_int n       = blas_int(A.n_rows);
+    T        rcond   = T(0);
+    blas_int info    = blas_int(0);
+    
+    podarray<T>        work(3*A.n_rows);
+    podarray<blas_int> iwork(A.n_rows);
+    
+    arma_extra_debug_print("lapack::trcon()");
+    lapack::trcon(&norm_id, &uplo, &diag, &n, const_cast<T*>(A.memptr()), &n, &rcond, work.memptr(), iwork.memptr(), &info);
+    
+    if(info != blas_int(0))  { return T(0); }
+    
+    return rcond;
+    }
+  #else
+    {
+    arma_ignore(A);
+    arma_ignore(layout);
+    arma_stop_logic_error("rcond(): use of LAPACK must be enabled");
+    }
+  #endif
+  
+  return T(0);
+  }
+
+
+
+template<typename T>
+inline
+T
+auxlib::rcond_trimat(const Mat< std::complex<T> >& A, const uword layout)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    typedef typename std::complex<T> eT;
+    
+    arma_debug_assert_blas_size(A);
+    
+    char     norm_id = '1';
+    char     uplo    = (layout == 0) ? 'U' : 'L';
+    char     diag    = 'N';
+    blas_int n       = blas_int(A.n_rows);
+    T        rcond   = T(0);
+    blas_int info    = blas_int(0);
+    
+    podarray<eT> work(2*A.n_rows);
+    podarray< T> rwork(A.n_rows);
+    
+    arma_extra_debug_print("lapack::cx_trcon()");
+    lapack::cx_trcon(&norm_id, &uplo, &diag, &n, const_cast<eT*>(A.memptr()), &n, &rcond, work.memptr(), rwork.memptr(), &info);
+    
+    if(info != blas_int(0))  { return T(0); }
+    
+    return rcond;
+    }
+  #else
+    {
+    arma_ignore(A);
+    arma_ignore(layout);
+    arma_stop_logic_error("rcond(): use of LAPACK must be enabled");
+    }
+  #endif
+  
+  return T(0);
+  }
+
+
+
+//! reciprocal of the 1-norm condition number of a symmetric positive definite matrix;
+//! A holds the upper triangular Cholesky factor, and norm_val is the 1-norm of the original matrix
+template<typename T>
+inline
+T
+auxlib::rcond_sympd(Mat<T>& A, const T norm_val)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    arma_debug_assert_blas_size(A);
+    
+    char     uplo   = 'U';
+    blas_int n      = blas_int(A.n_rows);
+    T        anorm  = norm_val;
+    T        rcond  = T(0);
+    blas_int info   = blas_int(0);
+    
+    podarray<T>        work(3*A.n_rows);
+    podarray<blas_int> iwork(A.n_rows);
+    
+    arma_extra_debug_print("lapack::pocon()");
+    lapack::pocon(&uplo, &n, A.memptr(), &n, &anorm, &rcond, work.memptr(), iwork.memptr(), &info);
+    
+    if(info != blas_int(0))  { return T(0); }
+    
+    return rcond;
+    }
+  #else
+    {
+    arma_ignore(A);
+    arma_ignore(norm_val);
+    arma_stop_logic_error("rcond(): use of LAPACK must be enabled");
+    }
+  #endif
+  
+  return T(0);
+  }
+
+
+
+template<typename T>
+inline
+T
+auxlib::rcond_sympd(Mat< std::complex<T> >& A, const T norm_val)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    typedef typename std::complex<T> eT;
+    
+    arma_debug_assert_blas_size(A);
+    
+    char     uplo   = 'U';
+    blas_int n      = blas_int(A.n_rows);
+    T        anorm  = norm_val;
+    T        rcond  = T(0);
+    blas_int info   = blas_int(0);
+    
+    podarray<eT> work(2*A.n_rows);
+    podarray< T> rwork(A.n_rows);
+    
+    arma_extra_debug_print("lapack::cx_pocon()");
+    lapack::cx_pocon(&uplo, &n, A.memptr(), &n, &anorm, &rcond, work.memptr(), rwork.memptr(), &info);
+    
+    if(info != blas_int(0))  { return T(0); }
+    
+    return rcond;
+    }
+  #else
+    {
+    arma_ignore(A);
+    arma_ignore(norm_val);
+    arma_stop_logic_error("rcond(): use of LAPACK must be enabled");
+    }
+  #endif
+  
+  return T(0);
+  }
+
+
+
+//! reciprocal of the 1-norm condition number of a band matrix;
+//! AB and ipiv hold the band LU decomposition as produced by gbsv(), and norm_val is the 1-norm of the original matrix
+template<typename T>
+inline
+T
+auxlib::rcond_band(Mat<T>& AB, const uword KL, const uword KU, podarray<blas_int>& ipiv, const T norm_val)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    arma_debug_assert_blas_size(AB);
+    
+    char     norm_id = '1';
+    blas_int n       = blas_int(AB.n_cols);
+    blas_int kl      = blas_int(KL);
+    blas_int ku      = blas_int(KU);
+    blas_int ldab    = blas_int(AB.n_rows);
+    T        anorm   = norm_val;
+    T        rcond   = T(0);
+    blas_int info    = blas_int(0);
+    
+    podarray<T>        work(3*AB.n_cols);
+    podarray<blas_int> iwork(AB.n_cols);
+    
+    arma_extra_debug_print("lapack::gbcon()");
+    lapack::gbcon(&norm_id, &n, &kl, &ku, AB.memptr(), &ldab, ipiv.memptr(), &anorm, &rcond, work.memptr(), iwork.memptr(), &info);
+    
+    if(info != blas_int(0))  { return T(0); }
+    
+    return rcond;
+    }
+  #else
+    {
+    arma_ignore(AB);
+    arma_ignore(KL);
+    arma_ignore(KU);
+    arma_ignore(ipiv);
+    arma_ignore(norm_val);
+    arma_stop_logic_error("rcond(): use of LAPACK must be enabled");
+    }
+  #endif
+  
+  return T(0);
+  }
+
+
+
+template<typename T>
+inline
+T
+auxlib::rcond_band(Mat< std::complex<T> >& AB, const uword KL, const uword KU, podarray<blas_int>& ipiv, const T norm_val)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    typedef typename std::complex<T> eT;
+    
+    arma_debug_assert_blas_size(AB);
+    
+    char     norm_id = '1';
+    blas_int n       = blas_int(AB.n_cols);
+    blas_int kl      = blas_int(KL);
+    blas_int ku      = blas_int(KU);
+    blas_int ldab    = blas_int(AB.n_rows);
+    T        anorm   = norm_val;
+    T        rcond   = T(0);
+    blas_int info    = blas_int(0);
+    
+    podarray<eT> work(2*AB.n_cols);
+    podarray< T> rwork(AB.n_cols);
+    
+    arma_extra_debug_print("lapack::cx_gbcon()");
+    lapack::cx_gbcon(&norm_id, &n, &kl, &ku, AB.memptr(), &ldab, ipiv.memptr(), &anorm, &rcond, work.memptr(), rwork.memptr(), &info);
+    
+    if(info != blas_int(0))  { return T(0); }
+    
+    return rcond;
+    }
+  #else
+    {
+    arma_ignore(AB);
+    arma_ignore(KL);
+    arma_ignore(KU);
+    arma_ignore(ipiv);
+    arma_ignore(norm_val);
+    arma_stop_logic_error("rcond(): use of LAPACK must be enabled");
+    }
+  #endif
+  
+  return T(0);
+  }
+
+
+
 //! @}
@@ -0,0 +1,133 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+//! \addtogroup band_helper
+//! @{
+
+
+namespace band_helper
+{
+
+
+
+//! find the lower (KL) and upper (KU) bandwidths of square matrix A;
+//! returns false as soon as KL + KU exceeds max_width
+template<typename eT>
+inline
+bool
+find_band(uword& out_KL, uword& out_KU, const Mat<eT>& A, const uword max_width)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword N = A.n_rows;
+  
+  uword KL = 0;
+  uword KU = 0;
+  
+  for(uword col=0; col < N; ++col)
+    {
+    const eT* colmem = A.colptr(col);
+    
+    // elements above the diagonal; search from the top
+    
+    uword row = 0;
+    
+    while( (row < col) && (colmem[row] == eT(0)) )  { ++row; }
+    
+    KU = (std::max)(KU, col - row);
+    
+    // elements below the diagonal; search from the bottom
+    
+    uword row_last = N-1;
+    
+    while( (row_last > col) && (colmem[row_last] == eT(0)) )  { --row_last; }
+    
+    KL = (std::max)(KL, row_last - col);
+    
+    if( (KL + KU) > max_width )  { return false; }
+    }
+  
+  out_KL = KL;
+  out_KU = KU;
+  
+  return true;
+  }
+
+
+
+//! find the lower (KL) and upper (KU) bandwidths of square matrix A.
+//! returns false if A has less than N_min rows, or if the band is too wide for band storage to be worthwhile.
+//! only elements outside of the band need to be read, so dense matrices are rejected after a few reads.
+template<typename eT>
+inline
+bool
+is_band(uword& out_KL, uword& out_KU, const Mat<eT>& A, const uword N_min)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword N = A.n_rows;
+  
+  if( (N < N_min) || (N < 4) )  { return false; }
+  
+  // quick check of the bottom-left and top-right corners
+  
+  const eT* A_col0 = A.colptr(0);
+  const eT* A_col1 = A.colptr(1);
+  
+  const eT* A_colNm2 = A.colptr(N-2);
+  const eT* A_colNm1 = A.colptr(N-1);
+  
+  if( (A_col0[N-2]   != eT(0)) || (A_col0[N-1]   != eT(0)) || (A_col1[N-1]   != eT(0)) )  { return false; }
+  if( (A_colNm2[0]   != eT(0)) || (A_colNm1[0]   != eT(0)) || (A_colNm1[1]   != eT(0)) )  { return false; }
+  
+  // band storage requires (2*KL + KU + 1) rows; the solver requires O(N*KL*(KL+KU)) operations
+  
+  return band_helper::find_band(out_KL, out_KU, A, N/4);
+  }
+
+
+
+//! store the band of A in the format required by LAPACK's gbsv() and gbtrf(),
+//! with an extra KL rows at the top for use by the factorisation
+template<typename eT>
+inline
+void
+compress(Mat<eT>& AB, const Mat<eT>& A, const uword KL, const uword KU)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword N = A.n_rows;
+  
+  const uword AB_n_rows = 2*KL + KU + 1;
+  
+  AB.zeros(AB_n_rows, N);
+  
+  if(A.is_empty())  { return; }
+  
+  for(uword col=0; col < N; ++col)
+    {
+    const uword A_row_start = (col > KU) ? (col - KU) : uword(0);
+    const uword A_row_endp1 = (std::min)(N, col + KL + 1);
+    
+    const uword length = A_row_endp1 - A_row_start;
+    
+    const uword AB_row_start = KL + KU + A_row_start - col;
+    
+    arrayops::copy( &(AB.at(AB_row_start, col)), &(A.at(A_row_start, col)), length );
+    }
+  }
+
+
+
+}  // namespace band_helper
+
+
+
+//! @}
@@ -0,0 +1,56 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+//! \addtogroup chol_factor
+//! @{
+
+
+
+//! Cholesky factorisation of a symmetric (or hermitian) positive definite matrix X = R.t()*R,
+//! kept for solving several systems with the same matrix.
+//! The factor can be modified via rank-1 updates and downdates,
+//! which is considerably cheaper than factorising the modified matrix from scratch.
+template<typename eT>
+class chol_factor
+  {
+  public:
+  
+  typedef eT                                elem_type;
+  typedef typename get_pod_type<eT>::result pod_type;
+  
+  arma_aligned const Mat<eT> R;  //!< upper triangular factor
+  
+  inline ~chol_factor();
+  inline  chol_factor();
+  
+  template<typename T1> inline explicit chol_factor(const Base<eT,T1>& X);
+  
+  template<typename T1> inline bool factorise(const Base<eT,T1>& X);
+  
+  template<typename T1> inline bool    solve(Mat<eT>& out, const Base<eT,T1>& B) const;
+  template<typename T1> inline Mat<eT> solve(              const Base<eT,T1>& B) const;
+  
+  template<typename T1> inline bool   update(const Base<eT,T1>& x);
+  template<typename T1> inline bool downdate(const Base<eT,T1>& x);
+  
+  inline void reset();
+  
+  arma_inline bool  is_empty() const;
+  arma_inline uword n_rows()   const;
+  
+  
+  private:
+  
+  template<typename T1> inline bool rank1_mod(const Base<eT,T1>& x, const bool is_update, const char* caller);
+  };
+
+
+
+//! @}
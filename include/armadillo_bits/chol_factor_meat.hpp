@@ -0,0 +1,243 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+//! \addtogroup chol_factor
+//! @{
+
+
+
+template<typename eT>
+inline
+chol_factor<eT>::~chol_factor()
+  {
+  arma_extra_debug_sigprint_this(this);
+  }
+
+
+
+template<typename eT>
+inline
+chol_factor<eT>::chol_factor()
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  arma_type_check(( is_supported_blas_type<eT>::value == false ));
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+chol_factor<eT>::chol_factor(const Base<eT,T1>& X)
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  arma_type_check(( is_supported_blas_type<eT>::value == false ));
+  
+  const bool status = factorise(X);
+  
+  if(status == false)
+    {
+    arma_stop_runtime_error("chol_factor(): decomposition failed");
+    }
+  }
+
+
+
+//! returns false if the given matrix is not positive definite
+template<typename eT>
+template<typename T1>
+inline
+bool
+chol_factor<eT>::factorise(const Base<eT,T1>& X)
+  {
+  arma_extra_debug_sigprint();
+  
+  const bool status = auxlib::chol(access::rw(R), X, 0);
+  
+  if(status == false)  { reset(); }
+  
+  return status;
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+bool
+chol_factor<eT>::solve(Mat<eT>& out, const Base<eT,T1>& B) const
+  {
+  arma_extra_debug_sigprint();
+  
+  out = B.get_ref();
+  
+  arma_debug_check( (R.n_rows != out.n_rows), "chol_factor::solve(): number of rows in given matrix must match the factorised matrix" );
+  
+  const bool status = auxlib::chol_fact_solve(out, R);
+  
+  if(status == false)  { out.reset(); }
+  
+  return status;
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+Mat<eT>
+chol_factor<eT>::solve(const Base<eT,T1>& B) const
+  {
+  arma_extra_debug_sigprint();
+  
+  Mat<eT> out;
+  
+  const bool status = solve(out, B);
+  
+  if(status == false)
+    {
+    arma_stop_runtime_error("chol_factor::solve(): solution not found");
+    }
+  
+  return out;
+  }
+
+
+
+//! rank-1 update: modifies R so that R.t()*R becomes X + x*x.t(), where X is the previously factorised matrix
+template<typename eT>
+template<typename T1>
+inline
+bool
+chol_factor<eT>::update(const Base<eT,T1>& x)
+  {
+  arma_extra_debug_sigprint();
+  
+  return rank1_mod(x, true, "chol_factor::update()");
+  }
+
+
+
+//! rank-1 downdate: modifies R so that R.t()*R becomes X - x*x.t(), where X is the previously factorised matrix;
+//! returns false and leaves R unchanged if the downdated matrix is not positive definite
+template<typename eT>
+template<typename T1>
+inline
+bool
+chol_factor<eT>::downdate(const Base<eT,T1>& x)
+  {
+  arma_extra_debug_sigprint();
+  
+  return rank1_mod(x, false, "chol_factor::downdate()");
+  }
+
+
+
+template<typename eT>
+inline
+void
+chol_factor<eT>::reset()
+  {
+  arma_extra_debug_sigprint();
+  
+  access::rw(R).reset();
+  }
+
+
+
+template<typename eT>
+arma_inline
+bool
+chol_factor<eT>::is_empty() const
+  {
+  return R.is_empty();
+  }
+
+
+
+template<typename eT>
+arma_inline
+uword
+chol_factor<eT>::n_rows() const
+  {
+  return R.n_rows;
+  }
+
+
+
+
+//! sequence of (hyperbolic) rotations applied to the rows of R, requiring O(n^2) operations
+template<typename eT>
+template<typename T1>
+inline
+bool
+chol_factor<eT>::rank1_mod(const Base<eT,T1>& x, const bool is_update, const char* caller)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  const quasi_unwrap<T1> U(x.get_ref());
+  
+  const Mat<eT>& xx = U.M;
+  
+  const uword N = R.n_rows;
+  
+  arma_debug_check( ((xx.is_vec() == false) && (xx.is_empty() == false)), caller, ": given object must be a vector" );
+  arma_debug_check( (xx.n_elem != N),                                  caller, ": size of given vector must match the factorised matrix" );
+  
+  if(N == 0)  { return true; }
+  
+  // rows of x.t(), stored as a column
+  podarray<eT> y(N);
+  
+  for(uword i=0; i < N; ++i)  { y[i] = access::alt_conj(xx[i]); }
+  
+  Mat<eT> RR(R);
+  
+  for(uword k=0; k < N; ++k)
+    {
+    const T R_kk = access::tmp_real( RR.at(k,k) );
+    const eT y_k = y[k];
+    
+    const T abs_y_k = std::abs(y_k);
+    
+    const T r_sq = (is_update) ? (R_kk*R_kk + abs_y_k*abs_y_k) : ( (R_kk - abs_y_k) * (R_kk + abs_y_k) );
+    
+    if( (r_sq <= T(0)) || (arma_isfinite(r_sq) == false) )  { return false; }
+    
+    const T  r = std::sqrt(r_sq);
+    const T  c = r / R_kk;
+    const eT s = y_k / R_kk;
+    
+    const eT s_conj = access::alt_conj(s);
+    
+    RR.at(k,k) = eT(r);
+    
+    for(uword j=(k+1); j < N; ++j)
+      {
+      eT& R_kj = RR.at(k,j);
+      
+      R_kj = (is_update) ? ((R_kj + s_conj*y[j]) / c) : ((R_kj - s_conj*y[j]) / c);
+      
+      y[j] = c*y[j] - s*R_kj;
+      }
+    }
+  
+  access::rw(R).steal_mem(RR);
+  
+  return true;
+  }
+
+
+
+//! @}
@@ -95,6 +95,9 @@
 
 #undef ARMA_HAVE_TR1
 #undef ARMA_HAVE_GETTIMEOFDAY
+#undef ARMA_HAVE_POSIX_MMAP
+#undef ARMA_HAVE_POSIX_FSYNC
+#undef ARMA_HAVE_THREAD_LOCAL
 #undef ARMA_HAVE_SNPRINTF
 #undef ARMA_HAVE_ISFINITE
 #undef ARMA_HAVE_LOG1P
@@ -107,6 +110,21 @@
 #endif
 
 
+#if (defined(_POSIX_MAPPED_FILES) && (_POSIX_MAPPED_FILES > 0))
+  #define ARMA_HAVE_POSIX_MMAP
+#endif
+
+
+#if (defined(_POSIX_FSYNC) && (_POSIX_FSYNC > 0))
+  #define ARMA_HAVE_POSIX_FSYNC
+#endif
+
+
+#if defined(ARMA_USE_CXX11)
+  #define ARMA_HAVE_THREAD_LOCAL
+#endif
+
+
 // posix_memalign() is part of IEEE standard 1003.1
 // http://pubs.opengroup.org/onlinepubs/009696899/functions/posix_memalign.html
 // http://pubs.opengroup.org/onlinepubs/9699919799/basedefs/unistd.h.html
@@ -123,6 +141,7 @@
   
   #undef  ARMA_HAVE_POSIX_MEMALIGN
   #undef  ARMA_USE_EXTERN_CXX11_RNG
+  #undef  ARMA_HAVE_THREAD_LOCAL
   // TODO: thread local storage (TLS) (eg. "extern thread_local") appears currently broken on Mac OS X
 #endif
 
@@ -124,6 +124,20 @@
 //// it must be an integer that is at least 1.
 //// The minimum recommended size is 16.
 
+#if !defined(ARMA_LAPACK_WORK_CACHE_MAX)
+  #define ARMA_LAPACK_WORK_CACHE_MAX 1048576
+#endif
+//// This is the maximum size (in terms of elements) of the per-thread workspace kept for LAPACK functions,
+//// which avoids memory allocation when decompositions of the same size are done repeatedly.
+//// Larger workspaces are allocated on each call. Set to 0 to disable the per-thread workspace.
+//// The per-thread workspace requires C++11.
+
+// #define ARMA_DONT_USE_PHILOX_RNG
+//// Uncomment the above line if you want randu(), randn(), randi() and randg() to fill objects
+//// using the sequential random number generator instead of the counter-based Philox generator.
+//// The Philox generator allows large objects to be filled in parallel via OpenMP,
+//// with the generated values not depending on the number of threads.
+
 // #define ARMA_NO_DEBUG
 //// Uncomment the above line if you want to disable all run-time checks.
 //// This will result in faster code, but you first need to make sure that your code runs correctly!
@@ -170,6 +170,50 @@
   #define arma_slarnv slarnv
   #define arma_dlarnv dlarnv
   
+  #define arma_sgbsv sgbsv
+  #define arma_dgbsv dgbsv
+  #define arma_cgbsv cgbsv
+  #define arma_zgbsv zgbsv
+  
+  #define arma_sgtsv sgtsv
+  #define arma_dgtsv dgtsv
+  #define arma_cgtsv cgtsv
+  #define arma_zgtsv zgtsv
+  
+  #define arma_sposv sposv
+  #define arma_dposv dposv
+  #define arma_cposv cposv
+  #define arma_zposv zposv
+  
+  #define arma_strcon strcon
+  #define arma_dtrcon dtrcon
+  
+  #define arma_ctrcon ctrcon
+  #define arma_ztrcon ztrcon
+  
+  #define arma_spocon spocon
+  #define arma_dpocon dpocon
+  
+  #define arma_cpocon cpocon
+  #define arma_zpocon zpocon
+  
+  #define arma_sgbcon sgbcon
+  #define arma_dgbcon dgbcon
+  
+  #define arma_cgbcon cgbcon
+  #define arma_zgbcon zgbcon
+  
+  #define arma_spotrs spotrs
+  #define arma_dpotrs dpotrs
+  #define arma_cpotrs cpotrs
+  #define arma_zpotrs zpotrs
+  
+  #define arma_sormqr sormqr
+  #define arma_dormqr dormqr
+  
+  #define arma_cunmqr cunmqr
+  #define arma_zunmqr zunmqr
+  
 #else
   
   #define arma_sgetrf SGETRF
@@ -326,6 +370,50 @@
   #define arma_slarnv SLARNV
   #define arma_dlarnv DLARNV
   
+  #define arma_sgbsv SGBSV
+  #define arma_dgbsv DGBSV
+  #define arma_cgbsv CGBSV
+  #define arma_zgbsv ZGBSV
+  
+  #define arma_sgtsv SGTSV
+  #define arma_dgtsv DGTSV
+  #define arma_cgtsv CGTSV
+  #define arma_zgtsv ZGTSV
+  
+  #define arma_sposv SPOSV
+  #define arma_dposv DPOSV
+  #define arma_cposv CPOSV
+  #define arma_zposv ZPOSV
+  
+  #define arma_strcon STRCON
+  #define arma_dtrcon DTRCON
+  
+  #define arma_ctrcon CTRCON
+  #define arma_ztrcon ZTRCON
+  
+  #define arma_spocon SPOCON
+  #define arma_dpocon DPOCON
+  
+  #define arma_cpocon CPOCON
+  #define arma_zpocon ZPOCON
+  
+  #define arma_sgbcon SGBCON
+  #define arma_dgbcon DGBCON
+  
+  #define arma_cgbcon CGBCON
+  #define arma_zgbcon ZGBCON
+  
+  #define arma_spotrs SPOTRS
+  #define arma_dpotrs DPOTRS
+  #define arma_cpotrs CPOTRS
+  #define arma_zpotrs ZPOTRS
+  
+  #define arma_sormqr SORMQR
+  #define arma_dormqr DORMQR
+  
+  #define arma_cunmqr CUNMQR
+  #define arma_zunmqr ZUNMQR
+  
 #endif
 
 
@@ -534,6 +622,62 @@ extern "C"
   // generate a vector of random numbers
   void arma_fortran(arma_slarnv)(blas_int* idist, blas_int* iseed, blas_int* n, float*  x);
   void arma_fortran(arma_dlarnv)(blas_int* idist, blas_int* iseed, blas_int* n, double* x);
+  
+  // solve system of linear equations, using band LU decomposition
+  void arma_fortran(arma_sgbsv)(blas_int* n, blas_int* kl, blas_int* ku, blas_int* nrhs, float*  ab, blas_int* ldab, blas_int* ipiv, float*  b, blas_int* ldb, blas_int* info);
+  void arma_fortran(arma_dgbsv)(blas_int* n, blas_int* kl, blas_int* ku, blas_int* nrhs, double* ab, blas_int* ldab, blas_int* ipiv, double* b, blas_int* ldb, blas_int* info);
+  void arma_fortran(arma_cgbsv)(blas_int* n, blas_int* kl, blas_int* ku, blas_int* nrhs, void*   ab, blas_int* ldab, blas_int* ipiv, void*   b, blas_int* ldb, blas_int* info);
+  void arma_fortran(arma_zgbsv)(blas_int* n, blas_int* kl, blas_int* ku, blas_int* nrhs, void*   ab, blas_int* ldab, blas_int* ipiv, void*   b, blas_int* ldb, blas_int* info);
+  
+  // solve system of linear equations, with tridiagonal matrix
+  void arma_fortran(arma_sgtsv)(blas_int* n, blas_int* nrhs, float*  dl, float*  d, float*  du, float*  b, blas_int* ldb, blas_int* info);
+  void arma_fortran(arma_dgtsv)(blas_int* n, blas_int* nrhs, double* dl, double* d, double* du, double* b, blas_int* ldb, blas_int* info);
+  void arma_fortran(arma_cgtsv)(blas_int* n, blas_int* nrhs, void*   dl, void*   d, void*   du, void*   b, blas_int* ldb, blas_int* info);
+  void arma_fortran(arma_zgtsv)(blas_int* n, blas_int* nrhs, void*   dl, void*   d, void*   du, void*   b, blas_int* ldb, blas_int* info);
+  
+  // solve system of linear equations, using Cholesky decomposition
+  void arma_fortran(arma_sposv)(char* uplo, blas_int* n, blas_int* nrhs, float*  a, blas_int* lda, float*  b, blas_int* ldb, blas_int* info);
+  void arma_fortran(arma_dposv)(char* uplo, blas_int* n, blas_int* nrhs, double* a, blas_int* lda, double* b, blas_int* ldb, blas_int* info);
+  void arma_fortran(arma_cposv)(char* uplo, blas_int* n, blas_int* nrhs, void*   a, blas_int* lda, void*   b, blas_int* ldb, blas_int* info);
+  void arma_fortran(arma_zposv)(char* uplo, blas_int* n, blas_int* nrhs, void*   a, blas_int* lda, void*   b, blas_int* ldb, blas_int* info);
+  
+  // estimate reciprocal condition number of triangular matrix (real)
+  void arma_fortran(arma_strcon)(char* norm, char* uplo, char* diag, blas_int* n, float*  a, blas_int* lda, float*  rcond, float*  work, blas_int* iwork, blas_int* info);
+  void arma_fortran(arma_dtrcon)(char* norm, char* uplo, char* diag, blas_int* n, double* a, blas_int* lda, double* rcond, double* work, blas_int* iwork, blas_int* info);
+  
+  // estimate reciprocal condition number of triangular matrix (complex)
+  void arma_fortran(arma_ctrcon)(char* norm, char* uplo, char* diag, blas_int* n, void* a, blas_int* lda, float*  rcond, void* work, float*  rwork, blas_int* info);
+  void arma_fortran(arma_ztrcon)(char* norm, char* uplo, char* diag, blas_int* n, void* a, blas_int* lda, double* rcond, void* work, double* rwork, blas_int* info);
+  
+  // estimate reciprocal condition number of symmetric positive definite matrix, using its Cholesky decomposition (real)
+  void arma_fortran(arma_spocon)(char* uplo, blas_int* n, float*  a, blas_int* lda, float*  anorm, float*  rcond, float*  work, blas_int* iwork, blas_int* info);
+  void arma_fortran(arma_dpocon)(char* uplo, blas_int* n, double* a, blas_int* lda, double* anorm, double* rcond, double* work, blas_int* iwork, blas_int* info);
+  
+  // estimate reciprocal condition number of hermitian positive definite matrix, using its Cholesky decomposition (complex)
+  void arma_fortran(arma_cpocon)(char* uplo, blas_int* n, void* a, blas_int* lda, float*  anorm, float*  rcond, void* work, float*  rwork, blas_int* info);
+  void arma_fortran(arma_zpocon)(char* uplo, blas_int* n, void* a, blas_int* lda, double* anorm, double* rcond, void* work, double* rwork, blas_int* info);
+  
+  // estimate reciprocal condition number of band matrix, using its LU decomposition (real)
+  void arma_fortran(arma_sgbcon)(char* norm, blas_int* n, blas_int* kl, blas_int* ku, float*  ab, blas_int* ldab, blas_int* ipiv, float*  anorm, float*  rcond, float*  work, blas_int* iwork, blas_int* info);
+  void arma_fortran(arma_dgbcon)(char* norm, blas_int* n, blas_int* kl, blas_int* ku, double* ab, blas_int* ldab, blas_int* ipiv, double* anorm, double* rcond, double* work, blas_int* iwork, blas_int* info);
+  
+  // estimate reciprocal condition number of band matrix, using its LU decomposition (complex)
+  void arma_fortran(arma_cgbcon)(char* norm, blas_int* n, blas_int* kl, blas_int* ku, void* ab, blas_int* ldab, blas_int* ipiv, float*  anorm, float*  rcond, void* work, float*  rwork, blas_int* info);
+  void arma_fortran(arma_zgbcon)(char* norm, blas_int* n, blas_int* kl, blas_int* ku, void* ab, blas_int* ldab, blas_int* ipiv, double* anorm, double* rcond, void* work, double* rwork, blas_int* info);
+  
+  // solve linear equations using Cholesky decomposition
+  void arma_fortran(arma_spotrs)(char* uplo, blas_int* n, blas_int* nrhs, float*  a, blas_int* lda, float*  b, blas_int* ldb, blas_int* info);
+  void arma_fortran(arma_dpotrs)(char* uplo, blas_int* n, blas_int* nrhs, double* a, blas_int* lda, double* b, blas_int* ldb, blas_int* info);
+  void arma_fortran(arma_cpotrs)(char* uplo, blas_int* n, blas_int* nrhs, void*   a, blas_int* lda, void*   b, blas_int* ldb, blas_int* info);
+  void arma_fortran(arma_zpotrs)(char* uplo, blas_int* n, blas_int* nrhs, void*   a, blas_int* lda, void*   b, blas_int* ldb, blas_int* info);
+  
+  // multiply matrix by Q from QR decomposition (real)
+  void arma_fortran(arma_sormqr)(char* side, char* trans, blas_int* m, blas_int* n, blas_int* k, float*  a, blas_int* lda, float*  tau, float*  c, blas_int* ldc, float*  work, blas_int* lwork, blas_int* info);
+  void arma_fortran(arma_dormqr)(char* side, char* trans, blas_int* m, blas_int* n, blas_int* k, double* a, blas_int* lda, double* tau, double* c, blas_int* ldc, double* work, blas_int* lwork, blas_int* info);
+  
+  // multiply matrix by Q from QR decomposition (complex)
+  void arma_fortran(arma_cunmqr)(char* side, char* trans, blas_int* m, blas_int* n, blas_int* k, void* a, blas_int* lda, void* tau, void* c, blas_int* ldc, void* work, blas_int* lwork, blas_int* info);
+  void arma_fortran(arma_zunmqr)(char* side, char* trans, blas_int* m, blas_int* n, blas_int* k, void* a, blas_int* lda, void* tau, void* c, blas_int* ldc, void* work, blas_int* lwork, blas_int* info);
   }
 
 
@@ -33,10 +33,27 @@ class diskio
   inline arma_cold static std::string gen_tmp_name(const std::string& x);
   
   inline arma_cold static bool safe_rename(const std::string& old_name, const std::string& new_name);
+  inline arma_cold static bool sync_file(const std::string& name);
+  inline arma_cold static bool sync_dir (const std::string& name);
   
   template<typename eT> inline static bool convert_naninf(eT&              val, const std::string& token);
   template<typename  T> inline static bool convert_naninf(std::complex<T>& val, const std::string& token);
   
+  template<typename eT> inline static bool convert_token(eT&              val, const char* start, const char* end);
+  template<typename  T> inline static bool convert_token(std::complex<T>& val, const char* start, const char* end);
+  
+  inline static bool convert_token_fast(double& val, const char* ptr, const char* end);
+  
+  inline static void  read_text(std::vector<char>& buffer, std::istream& f);
+  inline static uword find_text_end(const char* mem, const uword n_chars);
+  inline static uvec  split_text(const char* mem, const uword n_chars);
+  
+  template<typename eT> inline static bool  can_format_text(const std::ostream& f);
+  template<typename eT> inline static uword format_elem(char* out, const eT val, const typename arma_integral_only<eT>::result* junk = 0);
+  template<typename eT> inline static uword format_elem(char* out, const eT val, const typename arma_real_only<eT>::result*     junk = 0);
+  template<typename  T> inline static uword format_elem(char* out, const std::complex<T>& val);
+  template<typename eT> inline static bool  save_text_blocks(const Mat<eT>& x, std::ostream& f, const bool csv);
+  
   //
   // matrix saving
   
@@ -47,7 +64,7 @@ class diskio
   template<typename eT> inline static bool save_arma_binary(const Mat<eT>&                x, const std::string& final_name);
   template<typename eT> inline static bool save_pgm_binary (const Mat<eT>&                x, const std::string& final_name);
   template<typename  T> inline static bool save_pgm_binary (const Mat< std::complex<T> >& x, const std::string& final_name);
-  template<typename eT> inline static bool save_hdf5_binary(const Mat<eT>&                x, const std::string& final_name);
+  template<typename eT> inline static bool save_hdf5_binary(const Mat<eT>&                x, const std::string& final_name, const bool compress = false);
   
   template<typename eT> inline static bool save_raw_ascii  (const Mat<eT>&                x, std::ostream& f);
   template<typename eT> inline static bool save_raw_binary (const Mat<eT>&                x, std::ostream& f);
@@ -69,6 +86,7 @@ class diskio
   template<typename eT> inline static bool load_pgm_binary (Mat<eT>&                x, const std::string& name, std::string& err_msg);
   template<typename  T> inline static bool load_pgm_binary (Mat< std::complex<T> >& x, const std::string& name, std::string& err_msg);
   template<typename eT> inline static bool load_hdf5_binary(Mat<eT>&                x, const std::string& name, std::string& err_msg);
+  template<typename eT> inline static bool load_hdf5_binary(Mat<eT>&                x, const std::string& name, const span& row_span, const span& col_span, std::string& err_msg);
   template<typename eT> inline static bool load_auto_detect(Mat<eT>&                x, const std::string& name, std::string& err_msg);
   
   template<typename eT> inline static bool load_raw_ascii  (Mat<eT>&                x, std::istream& f,  std::string& err_msg);
@@ -88,10 +106,12 @@ class diskio
   
   template<typename eT> inline static bool save_coord_ascii(const SpMat<eT>& x, const std::string& final_name);
   template<typename eT> inline static bool save_arma_binary(const SpMat<eT>& x, const std::string& final_name);
+  template<typename eT> inline static bool save_mtx_ascii  (const SpMat<eT>& x, const std::string& final_name);
   
   template<typename eT> inline static bool save_coord_ascii(const SpMat<eT>& x,                std::ostream& f);
   template<typename  T> inline static bool save_coord_ascii(const SpMat< std::complex<T> >& x, std::ostream& f);
   template<typename eT> inline static bool save_arma_binary(const SpMat<eT>& x,                std::ostream& f);
+  template<typename eT> inline static bool save_mtx_ascii  (const SpMat<eT>& x,                std::ostream& f);
   
   
   //
@@ -99,10 +119,26 @@ class diskio
   
   template<typename eT> inline static bool load_coord_ascii(SpMat<eT>& x, const std::string& name, std::string& err_msg);
   template<typename eT> inline static bool load_arma_binary(SpMat<eT>& x, const std::string& name, std::string& err_msg);
+  template<typename eT> inline static bool load_mtx_ascii  (SpMat<eT>& x, const std::string& name, std::string& err_msg);
   
   template<typename eT> inline static bool load_coord_ascii(SpMat<eT>& x,                std::istream& f, std::string& err_msg);
   template<typename  T> inline static bool load_coord_ascii(SpMat< std::complex<T> >& x, std::istream& f, std::string& err_msg);
   template<typename eT> inline static bool load_arma_binary(SpMat<eT>& x,                std::istream& f, std::string& err_msg);
+  template<typename eT> inline static bool load_mtx_ascii  (SpMat<eT>& x,                std::istream& f, std::string& err_msg);
+  
+  
+  //
+  // Matrix Market helpers
+  
+  template<typename eT> inline static void mtx_write_val(std::ostream& f, const eT&              val);
+  template<typename  T> inline static void mtx_write_val(std::ostream& f, const std::complex<T>& val);
+  
+  template<typename eT> inline static void mtx_set_val(eT&              val, const eT& val_real, const eT& val_imag);
+  template<typename  T> inline static void mtx_set_val(std::complex<T>& val, const  T& val_real, const  T& val_imag);
+  
+  inline static bool convert_index(uword& val, const char* start, const char* end, const uword n);
+  
+  template<typename eT> inline static bool parse_mtx_text(podarray<uword>& rows, podarray<uword>& cols, podarray<eT>& vals, uword& n_entries, const char* start, const char* end, const uword n_rows, const uword n_cols, const uword field_type);
   
   
   
@@ -113,7 +149,7 @@ class diskio
   template<typename eT> inline static bool save_raw_binary (const Cube<eT>& x, const std::string& name);
   template<typename eT> inline static bool save_arma_ascii (const Cube<eT>& x, const std::string& name);
   template<typename eT> inline static bool save_arma_binary(const Cube<eT>& x, const std::string& name);
-  template<typename eT> inline static bool save_hdf5_binary(const Cube<eT>& x, const std::string& name);
+  template<typename eT> inline static bool save_hdf5_binary(const Cube<eT>& x, const std::string& name, const bool compress = false);
   
   template<typename eT> inline static bool save_raw_ascii  (const Cube<eT>& x, std::ostream& f);
   template<typename eT> inline static bool save_raw_binary (const Cube<eT>& x, std::ostream& f);
@@ -129,6 +165,7 @@ class diskio
   template<typename eT> inline static bool load_arma_ascii (Cube<eT>& x, const std::string& name, std::string& err_msg);
   template<typename eT> inline static bool load_arma_binary(Cube<eT>& x, const std::string& name, std::string& err_msg);
   template<typename eT> inline static bool load_hdf5_binary(Cube<eT>& x, const std::string& name, std::string& err_msg);
+  template<typename eT> inline static bool load_hdf5_binary(Cube<eT>& x, const std::string& name, const span& slice_span, std::string& err_msg);
   template<typename eT> inline static bool load_auto_detect(Cube<eT>& x, const std::string& name, std::string& err_msg);
   
   template<typename eT> inline static bool load_raw_ascii  (Cube<eT>& x, std::istream& f, std::string& err_msg);
@@ -156,8 +193,100 @@ class diskio
   inline static bool load_std_string(      field<std::string>& x, const std::string&  name, std::string& err_msg);
   inline static bool load_std_string(      field<std::string>& x,       std::istream& f,    std::string& err_msg);
   
+  
+  //
+  // compressed binary format
+  
+  template<typename T1> inline static std::string gen_cmp_header(const T1& x);
+  
+  template<typename eT> inline static bool save_compressed_array(const eT* mem, const uword n_elem, std::ostream& f);
+  template<typename eT> inline static bool load_compressed_array(      eT* mem, const uword n_elem_total, const uword elem_start, const uword n_elem, std::istream& f);
+  
+  template<typename eT> inline static bool save_arma_compressed(const Mat<eT>&   x, const std::string& final_name);
+  template<typename eT> inline static bool save_arma_compressed(const SpMat<eT>& x, const std::string& final_name);
+  template<typename eT> inline static bool save_arma_compressed(const Cube<eT>&  x, const std::string& final_name);
+  template<typename T1> inline static bool save_arma_compressed(const field<T1>& x, const std::string& final_name);
+  
+  template<typename eT> inline static bool save_arma_compressed(const Mat<eT>&   x, std::ostream& f);
+  template<typename eT> inline static bool save_arma_compressed(const SpMat<eT>& x, std::ostream& f);
+  template<typename eT> inline static bool save_arma_compressed(const Cube<eT>&  x, std::ostream& f);
+  template<typename T1> inline static bool save_arma_compressed(const field<T1>& x, std::ostream& f);
+  
+  template<typename eT> inline static bool load_arma_compressed(Mat<eT>&   x, const std::string& name, std::string& err_msg);
+  template<typename eT> inline static bool load_arma_compressed(SpMat<eT>& x, const std::string& name, std::string& err_msg);
+  template<typename eT> inline static bool load_arma_compressed(Cube<eT>&  x, const std::string& name, std::string& err_msg);
+  template<typename T1> inline static bool load_arma_compressed(field<T1>& x, const std::string& name, std::string& err_msg);
+  
+  template<typename eT> inline static bool load_arma_compressed(Mat<eT>&   x, std::istream& f, std::string& err_msg);
+  template<typename eT> inline static bool load_arma_compressed(SpMat<eT>& x, std::istream& f, std::string& err_msg);
+  template<typename eT> inline static bool load_arma_compressed(Cube<eT>&  x, std::istream& f, std::string& err_msg);
+  template<typename T1> inline static bool load_arma_compressed(field<T1>& x, std::istream& f, std::string& err_msg);
+  
+  
+  //
+  // loading a part of a matrix or cube
+  
+  template<typename eT> inline static bool load_submat(Mat<eT>&  x, const std::string& name, const span& row_span, const span& col_span, const file_type type, std::string& err_msg);
+  template<typename eT> inline static bool load_slices(Cube<eT>& x, const std::string& name, const span& slice_span,                    const file_type type, std::string& err_msg);
+  
+  inline static file_type guess_span_file_type(const std::string& name, const char* bin_header, const char* cmp_header);
+  
+  template<typename eT> inline static bool load_arma_binary_cols    (Mat<eT>& x, std::istream& f, const span& col_span, std::string& err_msg);
+  template<typename eT> inline static bool load_arma_compressed_cols(Mat<eT>& x, std::istream& f, const span& col_span, std::string& err_msg);
+  
+  template<typename eT> inline static bool load_arma_binary_slices    (Cube<eT>& x, std::istream& f, const span& slice_span, std::string& err_msg);
+  template<typename eT> inline static bool load_arma_compressed_slices(Cube<eT>& x, std::istream& f, const span& slice_span, std::string& err_msg);
+  
+  
+  //
+  // serialisation to/from memory buffers, using the arma_binary format
+  
+  inline static uword serialise_header(char* buf, const uword pos, const std::string& header, const std::string& dims);
+  inline static uword serialise_bytes (char* buf, const uword pos, const void* mem, const uword n_bytes);
+  
+  template<typename eT> inline static uword serialise(const Mat<eT>&   x, char* buf, const uword pos);
+  template<typename eT> inline static uword serialise(const SpMat<eT>& x, char* buf, const uword pos);
+  template<typename eT> inline static uword serialise(const Cube<eT>&  x, char* buf, const uword pos);
+  template<typename T1> inline static uword serialise(const field<T1>& x, char* buf, const uword pos);
+  
+  inline static bool deserialise_token(std::string& token, const char* buf, const uword buf_n_bytes, uword& pos);
+  inline static bool deserialise_uword(uword&       val,   const char* buf, const uword buf_n_bytes, uword& pos);
+  
+  template<typename eT> inline static bool deserialise(Mat<eT>&   x, const char* buf, const uword buf_n_bytes, uword& pos, char* buf_rw);
+  template<typename eT> inline static bool deserialise(SpMat<eT>& x, const char* buf, const uword buf_n_bytes, uword& pos, char* buf_rw);
+  template<typename eT> inline static bool deserialise(Cube<eT>&  x, const char* buf, const uword buf_n_bytes, uword& pos, char* buf_rw);
+  template<typename T1> inline static bool deserialise(field<T1>& x, const char* buf, const uword buf_n_bytes, uword& pos, char* buf_rw);
+  
 
-
+  //
+  // NumPy .npy format
+  
+  template<typename eT> inline static std::string gen_npy_descr();
+  
+  inline static std::string gen_npy_header(const std::string& descr, const bool fortran_order, const std::string& shape);
+  inline static bool       read_npy_header(std::istream& f, std::string& descr, bool& fortran_order, podarray<uword>& shape);
+  
+  inline static void npy_swap_bytes(char* mem, const uword n_bytes, const uword word_size);
+  
+  template<typename fT> inline static bool read_npy_elem(podarray<fT>& tmp, const uword n_elem, const bool swap, std::istream& f);
+  template<typename eT, typename fT> inline static bool read_npy_elem(eT* mem, const uword n_elem, const bool swap, std::istream& f);
+  
+  template<typename eT> inline static bool read_npy_data(eT*              mem, const uword n_elem, const std::string& descr, std::istream& f, std::string& err_msg);
+  template<typename  T> inline static bool read_npy_data(std::complex<T>* mem, const uword n_elem, const std::string& descr, std::istream& f, std::string& err_msg);
+  
+  template<typename eT> inline static bool save_npy_binary(const Mat<eT>&  x, const std::string& final_name);
+  template<typename eT> inline static bool save_npy_binary(const Cube<eT>& x, const std::string& final_name);
+  
+  template<typename eT> inline static bool save_npy_binary(const Mat<eT>&  x, std::ostream& f);
+  template<typename eT> inline static bool save_npy_binary(const Cube<eT>& x, std::ostream& f);
+  
+  template<typename eT> inline static bool load_npy_binary(Mat<eT>&  x, const std::string& name, std::string& err_msg);
+  template<typename eT> inline static bool load_npy_binary(Cube<eT>& x, const std::string& name, std::string& err_msg);
+  
+  template<typename eT> inline static bool load_npy_binary(Mat<eT>&  x, std::istream& f, std::string& err_msg);
+  template<typename eT> inline static bool load_npy_binary(Cube<eT>& x, std::istream& f, std::string& err_msg);
+  
+  
   //
   // handling of PPM images by cubes
 
@@ -672,6 +672,70 @@ diskio::safe_rename(const std::string& old_name, const std::string& new_name)
 
 
 
+//! Flush the contents of a file to the storage device.
+//! Returns true without doing anything if this isn't supported on the system.
+inline
+arma_cold
+bool
+diskio::sync_file(const std::string& name)
+  {
+  #if defined(ARMA_HAVE_POSIX_FSYNC)
+    {
+    const int fd = ::open(name.c_str(), O_WRONLY);
+    
+    if(fd < 0)  { return false; }
+    
+    const bool sync_okay = (::fsync(fd) == 0);
+    
+    ::close(fd);
+    
+    return sync_okay;
+    }
+  #else
+    {
+    arma_ignore(name);
+    
+    return true;
+    }
+  #endif
+  }
+
+
+
+//! Flush the directory containing the named file to the storage device, so that a preceding rename is not lost.
+//! Returns true without doing anything if this isn't supported on the system or by the file system.
+inline
+arma_cold
+bool
+diskio::sync_dir(const std::string& name)
+  {
+  #if defined(ARMA_HAVE_POSIX_FSYNC)
+    {
+    const std::string::size_type sep = name.find_last_of('/');
+    
+    const std::string dir_name = (sep == std::string::npos) ? std::string(".") : ( (sep == 0) ? std::string("/") : name.substr(0, sep) );
+    
+    const int fd = ::open(dir_name.c_str(), O_RDONLY);
+    
+    if(fd < 0)  { return false; }
+    
+    const bool sync_okay = (::fsync(fd) == 0) || (errno == EINVAL);
+    
+    ::close(fd);
+    
+    return sync_okay;
+    }
+  #else
+    {
+    arma_ignore(name);
+    
+    return true;
+    }
+  #endif
+  }
+
+
+
 template<typename eT>
 inline
 bool
@@ -755,294 +819,568 @@ diskio::convert_naninf(std::complex<T>& val, const std::string& token)
 
 
 
-//! Save a matrix as raw text (no header, human readable).
-//! Matrices can be loaded in Matlab and Octave, as long as they don't have complex elements.
+//! Convert a token from a text file, in the same manner as stream extraction followed by convert_naninf().
+//! The token is given as the range [start, end), and is followed by a delimiter or a terminating zero.
 template<typename eT>
 inline
 bool
-diskio::save_raw_ascii(const Mat<eT>& x, const std::string& final_name)
+diskio::convert_token(eT& val, const char* start, const char* end)
   {
-  arma_extra_debug_sigprint();
+  while( (start < end) && ((*start == ' ') || (*start == '\t') || (*start == '\r') || (*start == '\v') || (*start == '\f')) )  { ++start; }
   
-  const std::string tmp_name = diskio::gen_tmp_name(final_name);
+  if(start == end)  { return false; }
   
-  std::fstream f(tmp_name.c_str(), std::fstream::out);
+  const bool neg = (start[0] == '-');
   
-  bool save_okay = f.is_open();
+  if( (is_signed<eT>::value == false) && neg )  { val = eT(0); return true; }
   
-  if(save_okay == true)
+  const char* digits = ( neg || (start[0] == '+') ) ? (start+1) : start;
+  
+  if( (digits < end) && (digits[0] >= '0') && (digits[0] <= '9') )
     {
-    save_okay = diskio::save_raw_ascii(x, f);
-    
-    f.flush();
-    f.close();
-    
-    if(save_okay == true)
+    if(is_real<eT>::value)
       {
-      save_okay = diskio::safe_rename(tmp_name, final_name);
+      // std::strtod() accepts hexadecimal numbers, but stream extraction only reads the leading zero
+      
+      if( ((digits+1) < end) && (digits[0] == '0') && ((digits[1] == 'x') || (digits[1] == 'X')) )  { val = eT(0); return true; }
+      
+      double tmp = double(0);
+      
+      if(diskio::convert_token_fast(tmp, digits, end) == false)  { tmp = std::strtod(digits, 0); }
+      
+      val = eT( neg ? -tmp : tmp );
+      
+      return true;
+      }
+    else
+      {
+      eT tmp = eT(0);
+      
+      for(const char* ptr = digits; (ptr < end) && (*ptr >= '0') && (*ptr <= '9'); ++ptr)
+        {
+        tmp = eT(10)*tmp + eT(*ptr - '0');
+        }
+      
+      val = neg ? cond_rel< is_signed<eT>::value >::make_neg(tmp) : tmp;
+      
+      return true;
       }
     }
   
-  return save_okay;
+  if( is_real<eT>::value && (digits < end) && (digits[0] == '.') && ((digits+1) < end) && (digits[1] >= '0') && (digits[1] <= '9') )
+    {
+    double tmp = double(0);
+    
+    if(diskio::convert_token_fast(tmp, digits, end) == false)  { tmp = std::strtod(digits, 0); }
+    
+    val = eT( neg ? -tmp : tmp );
+    
+    return true;
+    }
+  
+  return diskio::convert_naninf( val, std::string(start, end) );
   }
 
 
 
-//! Save a matrix as raw text (no header, human readable).
-//! Matrices can be loaded in Matlab and Octave, as long as they don't have complex elements.
-template<typename eT>
+//! Convert an unsigned decimal number with at most 15 significant digits and a small exponent.
+//! Such numbers (including the ones written by save_raw_ascii() and save_csv_ascii())
+//! are converted exactly via one multiplication or division by a power of 10;
+//! otherwise false is returned and the caller falls back to std::strtod().
 inline
 bool
-diskio::save_raw_ascii(const Mat<eT>& x, std::ostream& f)
+diskio::convert_token_fast(double& val, const char* ptr, const char* end)
   {
-  arma_extra_debug_sigprint();
+  static const double powers[] =
+    {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
   
-  uword cell_width;
+  double mantissa = double(0);
   
-  // TODO: need sane values for complex numbers
+  uword n_digits     = 0;  // significant digits
+  int   exponent     = 0;
+  bool  found_digits = false;
   
-  if( (is_float<eT>::value) || (is_double<eT>::value) )
+  for(; (ptr < end) && (*ptr >= '0') && (*ptr <= '9'); ++ptr)
     {
-    f.setf(ios::scientific);
-    f.precision(14);
-    cell_width = 22;
+    found_digits = true;
+    
+    if( (n_digits > 0) || (*ptr != '0') )  { mantissa = double(10)*mantissa + double(*ptr - '0'); ++n_digits; }
     }
   
-  for(uword row=0; row < x.n_rows; ++row)
+  if( (ptr < end) && (*ptr == '.') )
     {
-    for(uword col=0; col < x.n_cols; ++col)
+    for(++ptr; (ptr < end) && (*ptr >= '0') && (*ptr <= '9'); ++ptr)
       {
-      f.put(' ');
+      found_digits = true;
       
-      if( (is_float<eT>::value) || (is_double<eT>::value) )
+      if( (n_digits > 0) || (*ptr != '0') )  { mantissa = double(10)*mantissa + double(*ptr - '0'); ++n_digits; }
+      
+      --exponent;
+      }
+    }
+  
+  if( (found_digits == false) || (n_digits > 15) )  { return false; }
+  
+  if( (ptr < end) && ((*ptr == 'e') || (*ptr == 'E')) )
+    {
+    const char* exp_ptr = ptr+1;
+    
+    const bool exp_neg = (exp_ptr < end) && (*exp_ptr == '-');
+    
+    if( (exp_ptr < end) && ((*exp_ptr == '-') || (*exp_ptr == '+')) )  { ++exp_ptr; }
+    
+    if( (exp_ptr < end) && (*exp_ptr >= '0') && (*exp_ptr <= '9') )
+      {
+      int exp_val = 0;
+      
+      for(; (exp_ptr < end) && (*exp_ptr >= '0') && (*exp_ptr <= '9'); ++exp_ptr)
         {
-        f.width(std::streamsize(cell_width));
+        if(exp_val < 10000)  { exp_val = 10*exp_val + int(*exp_ptr - '0'); }
         }
       
-      arma_ostream::print_elem(f, x.at(row,col), false);
+      exponent += (exp_neg) ? -exp_val : exp_val;
       }
-      
-    f.put('\n');
     }
+    
+       if( (mantissa == double(0)) || (exponent == 0) )  { val = mantissa;                    }
+  else if( (exponent > 0) && (exponent <=  22) )         { val = mantissa * powers[ exponent]; }
+  else if( (exponent < 0) && (exponent >= -22) )         { val = mantissa / powers[-exponent]; }
+  else                                                   { return false;                       }
   
-  return f.good();
+  return true;
   }
 
 
 
-//! Save a matrix as raw binary (no header)
-template<typename eT>
+template<typename T>
 inline
 bool
-diskio::save_raw_binary(const Mat<eT>& x, const std::string& final_name)
+diskio::convert_token(std::complex<T>& val, const char* start, const char* end)
+  {
+  const std::string token(start, end);
+  
+  std::stringstream ss(token);
+  
+  ss >> val;
+  
+  if(ss.fail() == false)  { return true; }
+  
+  return diskio::convert_naninf( val, token );
+  }
+
+
+
+//! Read the remainder of a stream into memory, followed by a terminating zero.
+//! If the size of the stream is known, the memory is allocated once.
+inline
+void
+diskio::read_text(std::vector<char>& buffer, std::istream& f)
   {
   arma_extra_debug_sigprint();
   
-  const std::string tmp_name = diskio::gen_tmp_name(final_name);
+  f.clear();
+  const std::streampos pos1 = f.tellg();
   
-  std::ofstream f(tmp_name.c_str(), std::fstream::binary);
+  uword n_expected = 0;
   
-  bool save_okay = f.is_open();
+  if(pos1 != std::streampos(-1))
+    {
+    f.seekg(0, std::ios::end);
+    
+    const std::streampos pos2 = f.tellg();
+    
+    if( (pos2 != std::streampos(-1)) && (pos2 > pos1) )  { n_expected = uword(pos2 - pos1); }
+    
+    f.clear();
+    f.seekg(pos1);
+    }
   
-  if(save_okay == true)
+  buffer.resize( ((n_expected > 0) ? n_expected : uword(65536)) + 1 );
+  
+  uword n_chars = 0;
+  
+  while(true)
     {
-    save_okay = diskio::save_raw_binary(x, f);
+    f.read( &(buffer[n_chars]), std::streamsize(buffer.size() - 1 - n_chars) );
     
-    f.flush();
-    f.close();
+    n_chars += uword(f.gcount());
     
-    if(save_okay == true)
-      {
-      save_okay = diskio::safe_rename(tmp_name, final_name);
-      }
+    if( (f.good() == false) || (f.peek() == std::char_traits<char>::eof()) )  { break; }
+    
+    buffer.resize( 2*buffer.size() );
     }
   
-  return save_okay;
+  buffer.resize(n_chars + 1);
+  
+  buffer[n_chars] = char(0);
   }
 
 
 
-template<typename eT>
+//! Find the end of the data in a text file, which is terminated by the first empty line
 inline
-bool
-diskio::save_raw_binary(const Mat<eT>& x, std::ostream& f)
+uword
+diskio::find_text_end(const char* mem, const uword n_chars)
   {
-  arma_extra_debug_sigprint();
+  if( (n_chars == 0) || (mem[0] == '\n') )  { return 0; }
   
-  f.write( reinterpret_cast<const char*>(x.mem), std::streamsize(x.n_elem*sizeof(eT)) );
+  const char* ptr = mem;
+  const char* end = mem + n_chars;
   
-  return f.good();
+  while(ptr < end)
+    {
+    const char* newline = (const char*)( std::memchr(ptr, '\n', size_t(end - ptr)) );
+    
+    if(newline == 0)  { return n_chars; }
+    
+    if( ((newline+1) < end) && (newline[1] == '\n') )  { return uword((newline+1) - mem); }
+    
+    ptr = newline+1;
+    }
+  
+  return n_chars;
   }
 
 
 
-//! Save a matrix in text format (human readable),
-//! with a header that indicates the matrix type as well as its dimensions
-template<typename eT>
+//! Split text into chunks which start at the beginning of lines, one chunk per thread.
+//! chunk k is given by the range [chunk_starts[k], chunk_starts[k+1]).
 inline
-bool
-diskio::save_arma_ascii(const Mat<eT>& x, const std::string& final_name)
+uvec
+diskio::split_text(const char* mem, const uword n_chars)
   {
   arma_extra_debug_sigprint();
   
-  const std::string tmp_name = diskio::gen_tmp_name(final_name);
+  #if defined(_OPENMP)
+    const uword n_threads = (n_chars >= uword(1024*1024)) ? uword( (std::max)(int(1), omp_get_max_threads()) ) : uword(1);
+  #else
+    const uword n_threads = 1;
+  #endif
   
-  std::ofstream f(tmp_name.c_str());
+  uvec chunk_starts(n_threads + 1);
   
-  bool save_okay = f.is_open();
-
-  if(save_okay == true)  
+  chunk_starts[0]         = 0;
+  chunk_starts[n_threads] = n_chars;
+  
+  for(uword k=1; k < n_threads; ++k)
     {
-    save_okay = diskio::save_arma_ascii(x, f);
+    const uword guess = (std::max)( chunk_starts[k-1], (n_chars / n_threads) * k );
     
-    f.flush();
-    f.close();
+    const char* newline = (guess < n_chars) ? (const char*)( std::memchr(mem + guess, '\n', size_t(n_chars - guess)) ) : 0;
     
-    if(save_okay == true)
-      {
-      save_okay = diskio::safe_rename(tmp_name, final_name);
-      }
+    chunk_starts[k] = (newline != 0) ? uword((newline+1) - mem) : n_chars;
     }
   
-  return save_okay;
+  return chunk_starts;
   }
 
 
 
-//! Save a matrix in text format (human readable),
-//! with a header that indicates the matrix type as well as its dimensions
+//! Determine whether elements can be formatted via format_elem() instead of the stream,
+//! giving exactly the same text; this requires the stream settings used by the text formats
+//! (scientific notation with a precision of 14 for floating point elements), the classic locale,
+//! and no other formatting flags
 template<typename eT>
 inline
 bool
-diskio::save_arma_ascii(const Mat<eT>& x, std::ostream& f)
+diskio::can_format_text(const std::ostream& f)
   {
   arma_extra_debug_sigprint();
   
-  const ios::fmtflags orig_flags = f.flags();
+  const bool is_fp = (is_float<eT>::value) || (is_double<eT>::value) || (is_cx<eT>::yes);
   
-  f << diskio::gen_txt_header(x) << '\n';
-  f << x.n_rows << ' ' << x.n_cols << '\n';
+  const ios::fmtflags flags = f.flags() & ~(ios::skipws | ios::scientific);
   
-  uword cell_width;
+  if(flags != ios::dec)  { return false; }
   
-  // TODO: need sane values for complex numbers
+  if( is_fp && ( ((f.flags() & ios::scientific) == 0) || (f.precision() != 14) ) )  { return false; }
   
-  if( (is_float<eT>::value) || (is_double<eT>::value) )
-    {
-    f.setf(ios::scientific);
-    f.precision(14);
-    cell_width = 22;
-    }
-    
-  for(uword row=0; row < x.n_rows; ++row)
-    {
-    for(uword col=0; col < x.n_cols; ++col)
-      {
-      f.put(' ');
-      
-      if( (is_float<eT>::value) || (is_double<eT>::value) )        
-        {
-        f.width(std::streamsize(cell_width));
-        }
-      
-      arma_ostream::print_elem(f, x.at(row,col), false);
-      }
-    
-    f.put('\n');
-    }
+  if( (f.width() != 0) || (f.fill() != ' ') )  { return false; }
   
-  const bool save_okay = f.good();
+  if(f.getloc() != std::locale::classic())  { return false; }
   
-  f.flags(orig_flags);
+  // std::sprintf() uses the decimal point of the C locale
+  const std::lconv* lc = std::localeconv();
   
-  return save_okay;
+  if( (lc == 0) || (lc->decimal_point == 0) || (std::strcmp(lc->decimal_point, ".") != 0) )  { return false; }
+  
+  return true;
   }
 
 
 
-//! Save a matrix in CSV text format (human readable)
+//! format an integer element as per operator<<, without using a stream; returns the number of characters
 template<typename eT>
 inline
-bool
-diskio::save_csv_ascii(const Mat<eT>& x, const std::string& final_name)
+uword
+diskio::format_elem(char* out, const eT val, const typename arma_integral_only<eT>::result* junk)
   {
-  arma_extra_debug_sigprint();
+  arma_ignore(junk);
   
-  const std::string tmp_name = diskio::gen_tmp_name(final_name);
+  char  digits[32];
+  uword n_digits = 0;
   
-  std::ofstream f(tmp_name.c_str());
+  const bool neg = (is_signed<eT>::value) && (val < eT(0));
   
-  bool save_okay = f.is_open();
+  eT v = val;
   
-  if(save_okay == true)  
+  do
     {
-    save_okay = diskio::save_csv_ascii(x, f);
+    const eT q = v / eT(10);
+    const eT r = v - q*eT(10);
     
-    f.flush();
-    f.close();
+    digits[n_digits] = char( '0' + ((neg) ? -int(r) : int(r)) );
+    ++n_digits;
     
-    if(save_okay == true)
-      {
-      save_okay = diskio::safe_rename(tmp_name, final_name);
-      }
+    v = q;
     }
+  while(v != eT(0));
   
-  return save_okay;
+  uword n = 0;
+  
+  if(neg)  { out[n] = '-'; ++n; }
+  
+  while(n_digits > 0)  { --n_digits; out[n] = digits[n_digits]; ++n; }
+  
+  return n;
   }
 
 
 
-//! Save a matrix in CSV text format (human readable)
+//! format a floating point element as per arma_ostream::print_elem() using scientific notation with a precision of 14,
+//! without using a stream; returns the number of characters
 template<typename eT>
 inline
-bool
-diskio::save_csv_ascii(const Mat<eT>& x, std::ostream& f)
+uword
+diskio::format_elem(char* out, const eT val, const typename arma_real_only<eT>::result* junk)
   {
-  arma_extra_debug_sigprint();
-  
-  const ios::fmtflags orig_flags = f.flags();
-  
-  // TODO: need sane values for complex numbers
+  arma_ignore(junk);
   
-  if( (is_float<eT>::value) || (is_double<eT>::value) )
+  if(arma_isfinite(val))
     {
-    f.setf(ios::scientific);
-    f.precision(14);
+    // negative zero is printed as zero
+    const double tmp = (val != eT(0)) ? double(val) : double(0);
+    
+    return uword( std::sprintf(out, "%.14e", tmp) );
     }
   
-  uword x_n_rows = x.n_rows;
-  uword x_n_cols = x.n_cols;
+  const char* str = arma_isinf(val) ? ((val <= eT(0)) ? "-inf" : "inf") : "nan";
   
-  for(uword row=0; row < x_n_rows; ++row)
+  const uword n = uword(std::strlen(str));
+  
+  std::memcpy(out, str, n);
+  
+  return n;
+  }
+
+
+
+//! format a complex element as per arma_ostream::print_elem(), without using a stream; returns the number of characters
+template<typename T>
+inline
+uword
+diskio::format_elem(char* out, const std::complex<T>& val)
+  {
+  uword n = 0;
+  
+  out[n] = '(';  ++n;
+  
+  for(uword part=0; part < 2; ++part)
     {
-    for(uword col=0; col < x_n_cols; ++col)
+    const T x = (part == 0) ? val.real() : val.imag();
+    
+    if(arma_isfinite(x))
       {
-      arma_ostream::print_elem(f, x.at(row,col), false);
+      n += uword( std::sprintf(out + n, "%.14e", double(x)) );
+      }
+    else
+      {
+      const char* str = arma_isinf(x) ? ((x <= T(0)) ? "-inf" : "+inf") : "nan";
       
-      if( col < (x_n_cols-1) )
+      const uword len = uword(std::strlen(str));
+      
+      std::memcpy(out + n, str, len);  n += len;
+      }
+    
+    out[n] = (part == 0) ? ',' : ')';  ++n;
+    }
+  
+  return n;
+  }
+
+
+
+//! Save a matrix as text in the layout of the raw_ascii format (or the csv_ascii format if csv is true).
+//! Blocks of rows are formatted into per-thread buffers (when OpenMP is enabled), which are then written in order.
+//! Must only be used if can_format_text() is true, so that the output is the same as via the stream.
+template<typename eT>
+inline
+bool
+diskio::save_text_blocks(const Mat<eT>& x, std::ostream& f, const bool csv)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword x_n_rows = x.n_rows;
+  const uword x_n_cols = x.n_cols;
+  
+  if(x_n_rows == 0)  { return f.good(); }
+  
+  // for raw_ascii, each element is preceded by a space, and floating point elements are right aligned within 22 characters
+  const uword cell_width = ( (csv == false) && ((is_float<eT>::value) || (is_double<eT>::value)) ) ? uword(22) : uword(0);
+  
+  const uword max_row_len  = x_n_cols * uword(64) + uword(1);  // upper bound on the formatted length of a row
+  const uword block_n_rows = (std::max)( uword(1), uword(65536) / (std::max)(x_n_cols, uword(1)) );
+  const uword n_blocks     = (x_n_rows + block_n_rows - 1) / block_n_rows;
+  
+  #if defined(_OPENMP)
+    const uword n_threads = (x.n_elem >= uword(65536)) ? uword( (std::max)(int(1), omp_get_max_threads()) ) : uword(1);
+  #else
+    const uword n_threads = 1;
+  #endif
+  
+  std::vector< std::vector<char> > buffers(n_threads);
+  
+  uvec buffer_lengths(n_threads);
+  
+  for(uword block_start=0; block_start < n_blocks; block_start += n_threads)
+    {
+    const uword n_active = (std::min)(n_threads, n_blocks - block_start);
+    
+    #if defined(_OPENMP)
+      #pragma omp parallel for schedule(static,1)
+    #endif
+    for(uword t=0; t < n_active; ++t)
+      {
+      const uword row_start = (block_start + t) * block_n_rows;
+      const uword row_end   = (std::min)(x_n_rows, row_start + block_n_rows);
+      
+      std::vector<char>& buffer = buffers[t];
+      
+      if(buffer.size() < ((row_end - row_start) * max_row_len))  { buffer.resize((row_end - row_start) * max_row_len); }
+      
+      char* out = &(buffer[0]);
+      
+      uword pos = 0;
+      
+      char tmp[64];
+      
+      for(uword row=row_start; row < row_end; ++row)
         {
-        f.put(',');
+        for(uword col=0; col < x_n_cols; ++col)
+          {
+          if(csv == false)  { out[pos] = ' '; ++pos; }
+          
+          const uword len = diskio::format_elem(tmp, x.at(row,col));
+          
+          for(uword i=len; i < cell_width; ++i)  { out[pos] = ' '; ++pos; }
+          
+          std::memcpy(out + pos, tmp, len);  pos += len;
+          
+          if( csv && (col < (x_n_cols-1)) )  { out[pos] = ','; ++pos; }
+          }
+        
+        out[pos] = '\n';  ++pos;
         }
+      
+      buffer_lengths[t] = pos;
       }
     
-    f.put('\n');
+    for(uword t=0; t < n_active; ++t)
+      {
+      f.write( &(buffers[t][0]), std::streamsize(buffer_lengths[t]) );
+      }
     }
   
-  const bool save_okay = f.good();
+  return f.good();
+  }
+
+
+
+//! Save a matrix as raw text (no header, human readable).
+//! Matrices can be loaded in Matlab and Octave, as long as they don't have complex elements.
+template<typename eT>
+inline
+bool
+diskio::save_raw_ascii(const Mat<eT>& x, const std::string& final_name)
+  {
+  arma_extra_debug_sigprint();
   
-  f.flags(orig_flags);
+  const std::string tmp_name = diskio::gen_tmp_name(final_name);
+  
+  std::fstream f(tmp_name.c_str(), std::fstream::out);
+  
+  bool save_okay = f.is_open();
+  
+  if(save_okay == true)
+    {
+    save_okay = diskio::save_raw_ascii(x, f);
+    
+    f.flush();
+    f.close();
+    
+    if(save_okay == true)
+      {
+      save_okay = diskio::safe_rename(tmp_name, final_name);
+      }
+    }
   
   return save_okay;
   }
 
 
 
-//! Save a matrix in binary format,
-//! with a header that stores the matrix type as well as its dimensions
+//! Save a matrix as raw text (no header, human readable).
+//! Matrices can be loaded in Matlab and Octave, as long as they don't have complex elements.
 template<typename eT>
 inline
 bool
-diskio::save_arma_binary(const Mat<eT>& x, const std::string& final_name)
+diskio::save_raw_ascii(const Mat<eT>& x, std::ostream& f)
+  {
+  arma_extra_debug_sigprint();
+  
+  uword cell_width;
+  
+  // TODO: need sane values for complex numbers
+  
+  if( (is_float<eT>::value) || (is_double<eT>::value) )
+    {
+    f.setf(ios::scientific);
+    f.precision(14);
+    cell_width = 22;
+    }
+  
+  if(diskio::can_format_text<eT>(f))  { return diskio::save_text_blocks(x, f, false); }
+  
+  for(uword row=0; row < x.n_rows; ++row)
+    {
+    for(uword col=0; col < x.n_cols; ++col)
+      {
+      f.put(' ');
+      
+      if( (is_float<eT>::value) || (is_double<eT>::value) )
+        {
+        f.width(std::streamsize(cell_width));
+        }
+      
+      arma_ostream::print_elem(f, x.at(row,col), false);
+      }
+      
+    f.put('\n');
+    }
+  
+  return f.good();
+  }
+
+
+
+//! Save a matrix as raw binary (no header)
+template<typename eT>
+inline
+bool
+diskio::save_raw_binary(const Mat<eT>& x, const std::string& final_name)
   {
   arma_extra_debug_sigprint();
   
@@ -1054,7 +1392,7 @@ diskio::save_arma_binary(const Mat<eT>& x, const std::string& final_name)
   
   if(save_okay == true)
     {
-    save_okay = diskio::save_arma_binary(x, f);
+    save_okay = diskio::save_raw_binary(x, f);
     
     f.flush();
     f.close();
@@ -1070,17 +1408,12 @@ diskio::save_arma_binary(const Mat<eT>& x, const std::string& final_name)
 
 
 
-//! Save a matrix in binary format,
-//! with a header that stores the matrix type as well as its dimensions
 template<typename eT>
 inline
 bool
-diskio::save_arma_binary(const Mat<eT>& x, std::ostream& f)
+diskio::save_raw_binary(const Mat<eT>& x, std::ostream& f)
   {
   arma_extra_debug_sigprint();
-
-  f << diskio::gen_bin_header(x) << '\n';
-  f << x.n_rows << ' ' << x.n_cols << '\n';
   
   f.write( reinterpret_cast<const char*>(x.mem), std::streamsize(x.n_elem*sizeof(eT)) );
   
@@ -1089,23 +1422,24 @@ diskio::save_arma_binary(const Mat<eT>& x, std::ostream& f)
 
 
 
-//! Save a matrix as a PGM greyscale image
+//! Save a matrix in text format (human readable),
+//! with a header that indicates the matrix type as well as its dimensions
 template<typename eT>
 inline
 bool
-diskio::save_pgm_binary(const Mat<eT>& x, const std::string& final_name)
+diskio::save_arma_ascii(const Mat<eT>& x, const std::string& final_name)
   {
   arma_extra_debug_sigprint();
   
   const std::string tmp_name = diskio::gen_tmp_name(final_name);
   
-  std::fstream f(tmp_name.c_str(), std::fstream::out | std::fstream::binary);
+  std::ofstream f(tmp_name.c_str());
   
   bool save_okay = f.is_open();
-  
-  if(save_okay == true)
+
+  if(save_okay == true)  
     {
-    save_okay = diskio::save_pgm_binary(x, f);
+    save_okay = diskio::save_arma_ascii(x, f);
     
     f.flush();
     f.close();
@@ -1121,79 +1455,327 @@ diskio::save_pgm_binary(const Mat<eT>& x, const std::string& final_name)
 
 
 
-//
-// TODO:
-// add functionality to save the image in a normalised format,
-// i.e. scaled so that every value falls in the [0,255] range.
-
-//! Save a matrix as a PGM greyscale image
+//! Save a matrix in text format (human readable),
+//! with a header that indicates the matrix type as well as its dimensions
 template<typename eT>
 inline
 bool
-diskio::save_pgm_binary(const Mat<eT>& x, std::ostream& f)
+diskio::save_arma_ascii(const Mat<eT>& x, std::ostream& f)
   {
   arma_extra_debug_sigprint();
   
-  f << "P5" << '\n';
-  f << x.n_cols << ' ' << x.n_rows << '\n';
-  f << 255 << '\n';
+  const ios::fmtflags orig_flags = f.flags();
   
-  const uword n_elem = x.n_rows * x.n_cols;
-  podarray<u8> tmp(n_elem);
+  f << diskio::gen_txt_header(x) << '\n';
+  f << x.n_rows << ' ' << x.n_cols << '\n';
   
-  uword i = 0;
+  uword cell_width;
+  
+  // TODO: need sane values for complex numbers
+  
+  if( (is_float<eT>::value) || (is_double<eT>::value) )
+    {
+    f.setf(ios::scientific);
+    f.precision(14);
+    cell_width = 22;
+    }
   
+  if(diskio::can_format_text<eT>(f))
+    {
+    const bool save_okay = diskio::save_text_blocks(x, f, false);
+    
+    f.flags(orig_flags);
+    
+    return save_okay;
+    }
+    
   for(uword row=0; row < x.n_rows; ++row)
     {
     for(uword col=0; col < x.n_cols; ++col)
       {
-      tmp[i] = u8( x.at(row,col) );  // TODO: add round() ?
-      ++i;
+      f.put(' ');
+      
+      if( (is_float<eT>::value) || (is_double<eT>::value) )        
+        {
+        f.width(std::streamsize(cell_width));
+        }
+      
+      arma_ostream::print_elem(f, x.at(row,col), false);
       }
+    
+    f.put('\n');
     }
   
-  f.write(reinterpret_cast<const char*>(tmp.mem), std::streamsize(n_elem) );
+  const bool save_okay = f.good();
   
-  return f.good();
+  f.flags(orig_flags);
+  
+  return save_okay;
   }
 
 
 
-//! Save a matrix as a PGM greyscale image
-template<typename T>
+//! Save a matrix in CSV text format (human readable)
+template<typename eT>
 inline
 bool
-diskio::save_pgm_binary(const Mat< std::complex<T> >& x, const std::string& final_name)
+diskio::save_csv_ascii(const Mat<eT>& x, const std::string& final_name)
   {
   arma_extra_debug_sigprint();
   
-  const uchar_mat tmp = conv_to<uchar_mat>::from(x);
+  const std::string tmp_name = diskio::gen_tmp_name(final_name);
   
-  return diskio::save_pgm_binary(tmp, final_name);
+  std::ofstream f(tmp_name.c_str());
+  
+  bool save_okay = f.is_open();
+  
+  if(save_okay == true)  
+    {
+    save_okay = diskio::save_csv_ascii(x, f);
+    
+    f.flush();
+    f.close();
+    
+    if(save_okay == true)
+      {
+      save_okay = diskio::safe_rename(tmp_name, final_name);
+      }
+    }
+  
+  return save_okay;
   }
 
 
 
-//! Save a matrix as a PGM greyscale image
-template<typename T>
+//! Save a matrix in CSV text format (human readable)
+template<typename eT>
 inline
 bool
-diskio::save_pgm_binary(const Mat< std::complex<T> >& x, std::ostream& f)
+diskio::save_csv_ascii(const Mat<eT>& x, std::ostream& f)
   {
   arma_extra_debug_sigprint();
   
-  const uchar_mat tmp = conv_to<uchar_mat>::from(x);
+  const ios::fmtflags orig_flags = f.flags();
   
-  return diskio::save_pgm_binary(tmp, f);
+  // TODO: need sane values for complex numbers
+  
+  if( (is_float<eT>::value) || (is_double<eT>::value) )
+    {
+    f.setf(ios::scientific);
+    f.precision(14);
+    }
+  
+  if(diskio::can_format_text<eT>(f))
+    {
+    const bool save_okay = diskio::save_text_blocks(x, f, true);
+    
+    f.flags(orig_flags);
+    
+    return save_okay;
+    }
+  
+  uword x_n_rows = x.n_rows;
+  uword x_n_cols = x.n_cols;
+  
+  for(uword row=0; row < x_n_rows; ++row)
+    {
+    for(uword col=0; col < x_n_cols; ++col)
+      {
+      arma_ostream::print_elem(f, x.at(row,col), false);
+      
+      if( col < (x_n_cols-1) )
+        {
+        f.put(',');
+        }
+      }
+    
+    f.put('\n');
+    }
+  
+  const bool save_okay = f.good();
+  
+  f.flags(orig_flags);
+  
+  return save_okay;
+  }
+
+
+
+//! Save a matrix in binary format,
+//! with a header that stores the matrix type as well as its dimensions
+template<typename eT>
+inline
+bool
+diskio::save_arma_binary(const Mat<eT>& x, const std::string& final_name)
+  {
+  arma_extra_debug_sigprint();
+  
+  const std::string tmp_name = diskio::gen_tmp_name(final_name);
+  
+  std::ofstream f(tmp_name.c_str(), std::fstream::binary);
+  
+  bool save_okay = f.is_open();
+  
+  if(save_okay == true)
+    {
+    save_okay = diskio::save_arma_binary(x, f);
+    
+    f.flush();
+    f.close();
+    
+    if(save_okay == true)
+      {
+      save_okay = diskio::safe_rename(tmp_name, final_name);
+      }
+    }
+  
+  return save_okay;
+  }
+
+
+
+//! Save a matrix in binary format,
+//! with a header that stores the matrix type as well as its dimensions
+template<typename eT>
+inline
+bool
+diskio::save_arma_binary(const Mat<eT>& x, std::ostream& f)
+  {
+  arma_extra_debug_sigprint();
+
+  f << diskio::gen_bin_header(x) << '\n';
+  
+  std::ostringstream dims;
+  
+  dims << x.n_rows << ' ' << x.n_cols << '\n';
+  
+  // align the start of the data to 16 bytes, so that the file can be used via memory mapping (see mmap_mat);
+  // the padding consists of spaces before the dimensions, which are skipped when the dimensions are read
+  
+  const std::streampos pos = f.tellp();
+  
+  if(pos >= 0)
+    {
+    const uword n_extra = (uword(pos) + uword(dims.str().length())) % uword(16);
+    
+    if(n_extra > 0)  { f << std::string(uword(16) - n_extra, ' '); }
+    }
+  
+  f << dims.str();
+  
+  f.write( reinterpret_cast<const char*>(x.mem), std::streamsize(x.n_elem*sizeof(eT)) );
+  
+  return f.good();
+  }
+
+
+
+//! Save a matrix as a PGM greyscale image
+template<typename eT>
+inline
+bool
+diskio::save_pgm_binary(const Mat<eT>& x, const std::string& final_name)
+  {
+  arma_extra_debug_sigprint();
+  
+  const std::string tmp_name = diskio::gen_tmp_name(final_name);
+  
+  std::fstream f(tmp_name.c_str(), std::fstream::out | std::fstream::binary);
+  
+  bool save_okay = f.is_open();
+  
+  if(save_okay == true)
+    {
+    save_okay = diskio::save_pgm_binary(x, f);
+    
+    f.flush();
+    f.close();
+    
+    if(save_okay == true)
+      {
+      save_okay = diskio::safe_rename(tmp_name, final_name);
+      }
+    }
+  
+  return save_okay;
+  }
+
+
+
+//
+// TODO:
+// add functionality to save the image in a normalised format,
+// i.e. scaled so that every value falls in the [0,255] range.
+
+//! Save a matrix as a PGM greyscale image
+template<typename eT>
+inline
+bool
+diskio::save_pgm_binary(const Mat<eT>& x, std::ostream& f)
+  {
+  arma_extra_debug_sigprint();
+  
+  f << "P5" << '\n';
+  f << x.n_cols << ' ' << x.n_rows << '\n';
+  f << 255 << '\n';
+  
+  const uword n_elem = x.n_rows * x.n_cols;
+  podarray<u8> tmp(n_elem);
+  
+  uword i = 0;
+  
+  for(uword row=0; row < x.n_rows; ++row)
+    {
+    for(uword col=0; col < x.n_cols; ++col)
+      {
+      tmp[i] = u8( x.at(row,col) );  // TODO: add round() ?
+      ++i;
+      }
+    }
+  
+  f.write(reinterpret_cast<const char*>(tmp.mem), std::streamsize(n_elem) );
+  
+  return f.good();
+  }
+
+
+
+//! Save a matrix as a PGM greyscale image
+template<typename T>
+inline
+bool
+diskio::save_pgm_binary(const Mat< std::complex<T> >& x, const std::string& final_name)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uchar_mat tmp = conv_to<uchar_mat>::from(x);
+  
+  return diskio::save_pgm_binary(tmp, final_name);
+  }
+
+
+
+//! Save a matrix as a PGM greyscale image
+template<typename T>
+inline
+bool
+diskio::save_pgm_binary(const Mat< std::complex<T> >& x, std::ostream& f)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uchar_mat tmp = conv_to<uchar_mat>::from(x);
+  
+  return diskio::save_pgm_binary(tmp, f);
   }
 
 
 
-//! Save a matrix as part of a HDF5 file
+//! Save a matrix as part of a HDF5 file.
+//! If compress is true, the dataset uses a chunked layout with the shuffle and deflate filters.
 template<typename eT>
 inline 
 bool 
-diskio::save_hdf5_binary(const Mat<eT>& x, const std::string& final_name)
+diskio::save_hdf5_binary(const Mat<eT>& x, const std::string& final_name, const bool compress)
   {
   arma_extra_debug_sigprint();
   
@@ -1227,7 +1809,8 @@ diskio::save_hdf5_binary(const Mat<eT>& x, const std::string& final_name)
     // MATLAB forces the users to specify a name at save time for HDF5; Octave
     // will use the default of 'dataset' unless otherwise specified, so we will
     // use that.
-    hid_t dataset = arma_H5Dcreate(file, "dataset", datatype, dataspace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    hid_t dcpl    = (compress) ? hdf5_misc::create_compressed_dcpl(2, dims, uword(sizeof(eT))) : hid_t(H5P_DEFAULT);
+    hid_t dataset = arma_H5Dcreate(file, "dataset", datatype, dataspace, H5P_DEFAULT, dcpl, H5P_DEFAULT);
     
     // H5Dwrite does not make a distinction between row-major and column-major;
     // it just writes the memory.  MATLAB and Octave store HDF5 matrices as
@@ -1236,6 +1819,8 @@ diskio::save_hdf5_binary(const Mat<eT>& x, const std::string& final_name)
     herr_t status = arma_H5Dwrite(dataset, datatype, H5S_ALL, H5S_ALL, H5P_DEFAULT, x.mem);
     save_okay = (status >= 0);
     
+    if(dcpl != H5P_DEFAULT)  { arma_H5Pclose(dcpl); }
+    
     arma_H5Dclose(dataset);
     arma_H5Tclose(datatype);
     arma_H5Sclose(dataspace);
@@ -1249,6 +1834,7 @@ diskio::save_hdf5_binary(const Mat<eT>& x, const std::string& final_name)
     {
     arma_ignore(x);
     arma_ignore(final_name);
+    arma_ignore(compress);
     
     arma_stop_logic_error("Mat::save(): use of HDF5 needs to be enabled");
     
@@ -1261,7 +1847,6 @@ diskio::save_hdf5_binary(const Mat<eT>& x, const std::string& final_name)
 
 //! Load a matrix as raw text (no header, human readable).
 //! Can read matrices saved as text in Matlab and Octave.
-//! NOTE: this is much slower than reading a file with a header.
 template<typename eT>
 inline
 bool
@@ -1287,7 +1872,8 @@ diskio::load_raw_ascii(Mat<eT>& x, const std::string& name, std::string& err_msg
 
 //! Load a matrix as raw text (no header, human readable).
 //! Can read matrices saved as text in Matlab and Octave.
-//! NOTE: this is much slower than reading a file with a header.
+//! The text is read into memory in one go, and is then parsed by several threads (when OpenMP is enabled);
+//! each thread processes a chunk of lines.
 template<typename eT>
 inline
 bool
@@ -1295,115 +1881,143 @@ diskio::load_raw_ascii(Mat<eT>& x, std::istream& f, std::string& err_msg)
   {
   arma_extra_debug_sigprint();
   
-  bool load_okay = f.good();
+  if(f.good() == false)  { return false; }
   
-  f.clear();
-  const std::fstream::pos_type pos1 = f.tellg();
+  std::vector<char> buffer;
+  
+  diskio::read_text(buffer, f);
+  
+  const char* mem     = &(buffer[0]);
+  const uword n_chars = diskio::find_text_end(mem, uword(buffer.size() - 1));
+  
+  // an empty file indicates an empty matrix
+  if(n_chars == 0)  { x.reset(); return true; }
+  
+  const uvec  chunk_starts = diskio::split_text(mem, n_chars);
+  const uword n_chunks     = chunk_starts.n_elem - 1;
   
   //
   // work out the size
   
+  uvec chunk_n_rows(n_chunks, fill::zeros);
+  uvec chunk_n_cols(n_chunks, fill::zeros);
+  uvec chunk_status(n_chunks, fill::ones );
+  
+  #if defined(_OPENMP)
+    #pragma omp parallel for schedule(static,1)
+  #endif
+  for(uword k=0; k < n_chunks; ++k)
+    {
+    const char* ptr = mem + chunk_starts[k];
+    const char* end = mem + chunk_starts[k+1];
+    
+    while(ptr < end)
+      {
+      uword line_n_cols = 0;
+      
+      while( (ptr < end) && (*ptr != '\n') )
+        {
+        const char c = *ptr;
+        
+        if( (c == ' ') || (c == '\t') || (c == '\r') || (c == '\v') || (c == '\f') )
+          {
+          ++ptr;
+          }
+        else
+          {
+          ++line_n_cols;
+          
+          while( (ptr < end) && (*ptr != '\n') && (*ptr != ' ') && (*ptr != '\t') && (*ptr != '\r') && (*ptr != '\v') && (*ptr != '\f') )  { ++ptr; }
+          }
+        }
+      
+      ++ptr;  // skip the newline
+      
+      if(chunk_n_rows[k] == 0)  { chunk_n_cols[k] = line_n_cols; }
+      
+      if(line_n_cols != chunk_n_cols[k])  { chunk_status[k] = 0; }
+      
+      chunk_n_rows[k]++;
+      }
+    }
+  
   uword f_n_rows = 0;
   uword f_n_cols = 0;
   
   bool f_n_cols_found = false;
   
-  std::string line_string;
-  std::string token;
-  
-  std::stringstream line_stream;
-  
-  while( (f.good() == true) && (load_okay == true) )
+  for(uword k=0; k < n_chunks; ++k)
     {
-    std::getline(f, line_string);
+    if(chunk_n_rows[k] == 0)  { continue; }
     
-    if(line_string.size() == 0)
+    if(f_n_cols_found == false)
       {
-      break;
+      f_n_cols       = chunk_n_cols[k];
+      f_n_cols_found = true;
       }
     
-    line_stream.clear();
-    line_stream.str(line_string);
-    
-    uword line_n_cols = 0;
-    
-    while (line_stream >> token)
+    if( (chunk_status[k] == 0) || (chunk_n_cols[k] != f_n_cols) )
       {
-      ++line_n_cols;
+      err_msg = "inconsistent number of columns in ";
+      return false;
       }
     
-    if(f_n_cols_found == false)
-      {
-      f_n_cols = line_n_cols;
-      f_n_cols_found = true;
-      }
-    else
-      {
-      if(line_n_cols != f_n_cols)
-        {
-        err_msg = "inconsistent number of columns in ";
-        load_okay = false;
-        }
-      }
-    
-    ++f_n_rows;
+    f_n_rows += chunk_n_rows[k];
     }
-    
-  if(load_okay == true)
+  
+  x.set_size(f_n_rows, f_n_cols);
+  
+  //
+  // parse the data
+  
+  const uvec chunk_row_starts = cumsum(chunk_n_rows) - chunk_n_rows;
+  
+  #if defined(_OPENMP)
+    #pragma omp parallel for schedule(static,1)
+  #endif
+  for(uword k=0; k < n_chunks; ++k)
     {
-    f.clear();
-    f.seekg(pos1);
+    const char* ptr = mem + chunk_starts[k];
+    const char* end = mem + chunk_starts[k+1];
     
-    x.set_size(f_n_rows, f_n_cols);
-    
-    std::stringstream ss;
+    uword row = chunk_row_starts[k];
     
-    for(uword row=0; (row < x.n_rows) && (load_okay == true); ++row)
+    while(ptr < end)
       {
-      for(uword col=0; (col < x.n_cols) && (load_okay == true); ++col)
+      uword col = 0;
+      
+      while( (ptr < end) && (*ptr != '\n') )
         {
-        f >> token;
+        const char c = *ptr;
         
-        if( (is_signed<eT>::value == false) && (token.length() > 0) && (token[0] == '-') )
+        if( (c == ' ') || (c == '\t') || (c == '\r') || (c == '\v') || (c == '\f') )
           {
-          x.at(row,col) = eT(0);
+          ++ptr;
           }
         else
           {
-          ss.clear();
-          ss.str(token);
+          const char* token_start = ptr;
           
-          eT val = eT(0);
-          ss >> val;
+          while( (ptr < end) && (*ptr != '\n') && (*ptr != ' ') && (*ptr != '\t') && (*ptr != '\r') && (*ptr != '\v') && (*ptr != '\f') )  { ++ptr; }
           
-          if(ss.fail() == false)
-            {
-            x.at(row,col) = val;
-            }
-          else
-            {
-            const bool success = diskio::convert_naninf( x.at(row,col), token );
-            
-            if(success == false)
-              {
-              load_okay = false;
-              err_msg = "couldn't interpret data in ";
-              }
-            }
+          if(diskio::convert_token( x.at(row,col), token_start, ptr ) == false)  { chunk_status[k] = 0; }
+          
+          ++col;
           }
         }
+      
+      ++ptr;
+      ++row;
       }
     }
   
-  
-  // an empty file indicates an empty matrix
-  if( (f_n_cols_found == false) && (load_okay == true) )
+  if(any(chunk_status == 0))
     {
-    x.reset();
+    err_msg = "couldn't interpret data in ";
+    return false;
     }
   
-  
-  return load_okay;
+  return true;
   }
 
 
@@ -1610,7 +2224,9 @@ diskio::load_csv_ascii(Mat<eT>& x, const std::string& name, std::string& err_msg
 
 
 
-//! Load a matrix in CSV text format (human readable)
+//! Load a matrix in CSV text format (human readable).
+//! The text is read into memory in one go, and is then parsed by several threads (when OpenMP is enabled);
+//! each thread processes a chunk of lines.
 template<typename eT>
 inline
 bool
@@ -1618,103 +2234,89 @@ diskio::load_csv_ascii(Mat<eT>& x, std::istream& f, std::string&)
   {
   arma_extra_debug_sigprint();
   
-  bool load_okay = f.good();
+  const bool load_okay = f.good();
   
-  f.clear();
-  const std::fstream::pos_type pos1 = f.tellg();
+  std::vector<char> buffer;
   
-  //
-  // work out the size
+  diskio::read_text(buffer, f);
   
-  uword f_n_rows = 0;
-  uword f_n_cols = 0;
+  const char* mem     = &(buffer[0]);
+  const uword n_chars = diskio::find_text_end(mem, uword(buffer.size() - 1));
   
-  std::string line_string;
-  std::string token;
+  const uvec  chunk_starts = diskio::split_text(mem, n_chars);
+  const uword n_chunks     = chunk_starts.n_elem - 1;
   
-  std::stringstream line_stream;
+  //
+  // work out the size
   
-  while( (f.good() == true) && (load_okay == true) )
+  uvec chunk_n_rows(n_chunks, fill::zeros);
+  uvec chunk_n_cols(n_chunks, fill::zeros);
+  
+  #if defined(_OPENMP)
+    #pragma omp parallel for schedule(static,1)
+  #endif
+  for(uword k=0; k < n_chunks; ++k)
     {
-    std::getline(f, line_string);
-    
-    if(line_string.size() == 0)
-      {
-      break;
-      }
-    
-    line_stream.clear();
-    line_stream.str(line_string);
-    
-    uword line_n_cols = 0;
-    
-    while(line_stream.good() == true)
-      {
-      std::getline(line_stream, token, ',');
-      ++line_n_cols;
-      }
+    const char* ptr = mem + chunk_starts[k];
+    const char* end = mem + chunk_starts[k+1];
     
-    if(f_n_cols < line_n_cols)
+    while(ptr < end)
       {
-      f_n_cols = line_n_cols;
+      uword line_n_cols = 1;
+      
+      for(; (ptr < end) && (*ptr != '\n'); ++ptr)
+        {
+        if(*ptr == ',')  { ++line_n_cols; }
+        }
+      
+      ++ptr;  // skip the newline
+      
+      if(chunk_n_cols[k] < line_n_cols)  { chunk_n_cols[k] = line_n_cols; }
+      
+      chunk_n_rows[k]++;
       }
-    
-    ++f_n_rows;
     }
   
-  f.clear();
-  f.seekg(pos1);
+  const uword f_n_rows = accu(chunk_n_rows);
+  const uword f_n_cols = (n_chunks > 0) ? max(chunk_n_cols) : uword(0);
   
   x.zeros(f_n_rows, f_n_cols);
   
-  uword row = 0;
+  //
+  // parse the data; tokens which can't be interpreted are left as zero
   
-  std::stringstream ss;
+  const uvec chunk_row_starts = cumsum(chunk_n_rows) - chunk_n_rows;
   
-  while(f.good() == true)
+  #if defined(_OPENMP)
+    #pragma omp parallel for schedule(static,1)
+  #endif
+  for(uword k=0; k < n_chunks; ++k)
     {
-    std::getline(f, line_string);
-    
-    if(line_string.size() == 0)
-      {
-      break;
-      }
-    
-    line_stream.clear();
-    line_stream.str(line_string);
+    const char* ptr = mem + chunk_starts[k];
+    const char* end = mem + chunk_starts[k+1];
     
-    uword col = 0;
+    uword row = chunk_row_starts[k];
     
-    while(line_stream.good() == true)
+    while(ptr < end)
       {
-      std::getline(line_stream, token, ',');
+      uword col = 0;
       
-      if( (is_signed<eT>::value == false) && (token.length() > 0) && (token[0] == '-') )
-        {
-        x.at(row,col) = eT(0);
-        }
-      else
+      while(true)
         {
-        ss.clear();
-        ss.str(token);
+        const char* token_start = ptr;
         
-        eT val = eT(0);
-        ss >> val;
+        while( (ptr < end) && (*ptr != '\n') && (*ptr != ',') )  { ++ptr; }
         
-        if(ss.fail() == false)
-          {
-          x.at(row,col) = val;
-          }
-        else
-          {
-          diskio::convert_naninf( x.at(row,col), token );
-          }
+        diskio::convert_token( x.at(row,col), token_start, ptr );
+        
+        ++col;
+        
+        if( (ptr < end) && (*ptr == ',') )  { ++ptr; }  else  { break; }
         }
       
-      ++col;
+      ++ptr;  // skip the newline
+      ++row;
       }
-    
-    ++row;
     }
   
   return load_okay;
@@ -2008,6 +2610,20 @@ diskio::load_hdf5_binary(Mat<eT>& x, const std::string& name, std::string& err_m
   {
   arma_extra_debug_sigprint();
   
+  return diskio::load_hdf5_binary(x, name, span::all, span::all, err_msg);
+  }
+
+
+
+//! Load a HDF5 file as a matrix, or only the given rows and columns of the matrix.
+//! A partial load reads only the selected part of the dataset (hyperslab).
+template<typename eT>
+inline
+bool
+diskio::load_hdf5_binary(Mat<eT>& x, const std::string& name, const span& row_span, const span& col_span, std::string& err_msg)
+  {
+  arma_extra_debug_sigprint();
+  
   #if defined(ARMA_USE_HDF5)
     {
 
@@ -2071,29 +2687,71 @@ diskio::load_hdf5_binary(Mat<eT>& x, const std::string& name, std::string& err_m
         
         if(ndims == 1) { dims[1] = 1; }  // Vector case; fake second dimension (one column).
         
-        x.set_size(dims[1], dims[0]);
+        const uword f_n_rows = uword(dims[1]);
+        const uword f_n_cols = uword(dims[0]);
+        
+        const uword row1 = (row_span.whole) ? uword(0) : row_span.a;
+        const uword row2 = (row_span.whole) ? f_n_rows : row_span.b + 1;
+        const uword col1 = (col_span.whole) ? uword(0) : col_span.a;
+        const uword col2 = (col_span.whole) ? f_n_cols : col_span.b + 1;
+        
+        const bool in_bounds = (row1 <= row2) && (row2 <= f_n_rows) && (col1 <= col2) && (col2 <= f_n_cols);
+        
+        if(in_bounds == false)  { err_msg = "requested rows or columns are out of bounds in "; }
+        
+        hid_t memspace  = H5S_ALL;
+        hid_t selection = H5S_ALL;
+        
+        if( in_bounds && ((row1 != 0) || (row2 != f_n_rows) || (col1 != 0) || (col2 != f_n_cols)) && (row1 != row2) && (col1 != col2) )
+          {
+          // the columns of the matrix are the first dimension of the dataset
+          hsize_t start[2];
+          hsize_t count[2];
+          
+          start[0] = col1;  count[0] = col2 - col1;
+          start[1] = row1;  count[1] = row2 - row1;
+          
+          if(arma_H5Sselect_hyperslab(filespace, H5S_SELECT_SET, start, NULL, count, NULL) >= 0)
+            {
+            memspace  = arma_H5Screate_simple(ndims, count, NULL);
+            selection = filespace;
+            }
+          }
+        
+        if(in_bounds)  { x.set_size(row2 - row1, col2 - col1); }
         
         // Now we have to see what type is stored to figure out how to load it.
         hid_t datatype = arma_H5Dget_type(dataset);
         hid_t mat_type = hdf5_misc::get_hdf5_type<eT>();
         
-        // If these are the same type, it is simple.
-        if(arma_H5Tequal(datatype, mat_type) > 0)
+        if( in_bounds && ((x.n_elem == 0) || (memspace < 0)) )
           {
-          // Load directly; H5S_ALL used so that we load the entire dataset.
-          hid_t read_status = arma_H5Dread(dataset, datatype, H5S_ALL, H5S_ALL, H5P_DEFAULT, void_ptr(x.memptr()));
-          
-          if(read_status >= 0) { load_okay = true; }
+          // nothing to read, or the hyperslab couldn't be set up
+          load_okay = (x.n_elem == 0);
           }
         else
+        if(in_bounds)
           {
-          // Load into another array and convert its type accordingly.
-          hid_t read_status = hdf5_misc::load_and_convert_hdf5(x.memptr(), dataset, datatype, x.n_elem);
-          
-          if(read_status >= 0) { load_okay = true; }
+          // If these are the same type, it is simple.
+          if(arma_H5Tequal(datatype, mat_type) > 0)
+            {
+            // Load directly; H5S_ALL used (unless a hyperslab is selected) so that we load the entire dataset.
+            hid_t read_status = arma_H5Dread(dataset, datatype, memspace, selection, H5P_DEFAULT, void_ptr(x.memptr()));
+            
+            if(read_status >= 0) { load_okay = true; }
+            }
+          else
+            {
+            // Load into another array and convert its type accordingly.
+            hid_t read_status = hdf5_misc::load_and_convert_hdf5(x.memptr(), dataset, datatype, x.n_elem, memspace, selection);
+            
+            if(read_status >= 0) { load_okay = true; }
+            }
           }
         
         // Now clean up.
+        if(memspace > 0)  { arma_H5Sclose(memspace); }
+        
         arma_H5Tclose(datatype);
         arma_H5Tclose(mat_type);
         arma_H5Sclose(filespace);
@@ -2103,7 +2761,7 @@ diskio::load_hdf5_binary(Mat<eT>& x, const std::string& name, std::string& err_m
     
       arma_H5Fclose(fid);
 
-      if(load_okay == false)
+      if( (load_okay == false) && err_msg.empty() )
         {
         err_msg = "unsupported or incorrect HDF5 data in ";
         }
@@ -2126,6 +2784,8 @@ diskio::load_hdf5_binary(Mat<eT>& x, const std::string& name, std::string& err_m
     {
     arma_ignore(x);
     arma_ignore(name);
+    arma_ignore(row_span);
+    arma_ignore(col_span);
     arma_ignore(err_msg);
 
     arma_stop_logic_error("Mat::load(): use of HDF5 needs to be enabled");
@@ -2176,7 +2836,9 @@ diskio::load_auto_detect(Mat<eT>& x, std::istream& f, std::string& err_msg)
   
   static const std::string ARMA_MAT_TXT = "ARMA_MAT_TXT";
   static const std::string ARMA_MAT_BIN = "ARMA_MAT_BIN";
+  static const std::string ARMA_MAT_CMP = "ARMA_MAT_CMP";
   static const std::string           P5 = "P5";
+  static const std::string          NPY = "\x93NUMPY";
   
   podarray<char> raw_header( uword(ARMA_MAT_TXT.length()) + 1);
   
@@ -2200,10 +2862,20 @@ diskio::load_auto_detect(Mat<eT>& x, std::istream& f, std::string& err_msg)
     return load_arma_binary(x, f, err_msg);
     }
   else
+  if(ARMA_MAT_CMP == header.substr(0,ARMA_MAT_CMP.length()))
+    {
+    return load_arma_compressed(x, f, err_msg);
+    }
+  else
   if(P5 == header.substr(0,P5.length()))
     {
     return load_pgm_binary(x, f, err_msg);
     }
+  else
+  if(NPY == header.substr(0,NPY.length()))
+    {
+    return load_npy_binary(x, f, err_msg);
+    }
   else
     {
     const file_type ft = guess_file_type(f);
@@ -2421,7 +3093,24 @@ diskio::save_arma_binary(const SpMat<eT>& x, std::ostream& f)
   arma_extra_debug_sigprint();
   
   f << diskio::gen_bin_header(x) << '\n';
-  f << x.n_rows << ' ' << x.n_cols << ' ' << x.n_nonzero << '\n';
+  
+  std::ostringstream dims;
+  
+  dims << x.n_rows << ' ' << x.n_cols << ' ' << x.n_nonzero << '\n';
+  
+  // align the start of the values to 16 bytes, as per save_arma_binary() for dense matrices;
+  // the row indices and column pointers directly follow the values, without padding
+  
+  const std::streampos pos = f.tellp();
+  
+  if(pos >= 0)
+    {
+    const uword n_extra = (uword(pos) + uword(dims.str().length())) % uword(16);
+    
+    if(n_extra > 0)  { f << std::string(uword(16) - n_extra, ' '); }
+    }
+  
+  f << dims.str();
   
   f.write( reinterpret_cast<const char*>(x.values),      std::streamsize(x.n_nonzero*sizeof(eT))     );
   f.write( reinterpret_cast<const char*>(x.row_indices), std::streamsize(x.n_nonzero*sizeof(uword))  );
@@ -3094,15 +3783,11 @@ diskio::load_arma_binary(SpMat<eT>& x, std::istream& f, std::string& err_msg)
 
 
 
-// cubes
-
-
-
-//! Save a cube as raw text (no header, human readable).
+//! Save a sparse matrix in Matrix Market coordinate format (general symmetry, one-based indices)
 template<typename eT>
 inline
 bool
-diskio::save_raw_ascii(const Cube<eT>& x, const std::string& final_name)
+diskio::save_mtx_ascii(const SpMat<eT>& x, const std::string& final_name)
   {
   arma_extra_debug_sigprint();
   
@@ -3114,7 +3799,7 @@ diskio::save_raw_ascii(const Cube<eT>& x, const std::string& final_name)
   
   if(save_okay == true)
     {
-    save_okay = save_raw_ascii(x, f);
+    save_okay = diskio::save_mtx_ascii(x, f);
     
     f.flush();
     f.close();
@@ -3130,201 +3815,555 @@ diskio::save_raw_ascii(const Cube<eT>& x, const std::string& final_name)
 
 
 
-//! Save a cube as raw text (no header, human readable).
 template<typename eT>
 inline
 bool
-diskio::save_raw_ascii(const Cube<eT>& x, std::ostream& f)
+diskio::save_mtx_ascii(const SpMat<eT>& x, std::ostream& f)
   {
   arma_extra_debug_sigprint();
   
-  uword cell_width;
+  typedef typename get_pod_type<eT>::result T;
   
-  // TODO: need sane values for complex numbers
+  const ios::fmtflags orig_flags     = f.flags();
+  const std::streamsize orig_precision = f.precision();
   
-  if( (is_float<eT>::value) || (is_double<eT>::value) )
+  const char* field = (is_complex<eT>::value) ? "complex" : ( (is_real<T>::value) ? "real" : "integer" );
+  
+  f << "%%MatrixMarket matrix coordinate " << field << " general" << '\n';
+  f << x.n_rows << ' ' << x.n_cols << ' ' << x.n_nonzero << '\n';
+  
+  if(is_real<T>::value)
     {
+    // enough digits so that the values are read back exactly
     f.setf(ios::scientific);
-    f.precision(14);
-    cell_width = 22;
+    f.precision( (is_float<T>::value) ? 8 : 16 );
     }
   
-  for(uword slice=0; slice < x.n_slices; ++slice)
+  for(uword col=0; col < x.n_cols; ++col)
     {
-    for(uword row=0; row < x.n_rows; ++row)
+    const uword index_start = x.col_ptrs[col    ];
+    const uword index_end   = x.col_ptrs[col + 1];
+    
+    for(uword i=index_start; i < index_end; ++i)
       {
-      for(uword col=0; col < x.n_cols; ++col)
-        {
-        f.put(' ');
-        
-        if( (is_float<eT>::value) || (is_double<eT>::value) )
-          {
-          f.width(std::streamsize(cell_width));
-          }
-        
-        arma_ostream::print_elem(f, x.at(row,col,slice), false);
-        }
-        
-      f.put('\n');
+      f << (x.row_indices[i] + 1) << ' ' << (col + 1) << ' ';
+      
+      diskio::mtx_write_val(f, x.values[i]);
+      
+      f << '\n';
       }
     }
   
-  return f.good();
+  const bool save_okay = f.good();
+  
+  f.flags(orig_flags);
+  f.precision(orig_precision);
+  
+  return save_okay;
   }
 
 
 
-//! Save a cube as raw binary (no header)
 template<typename eT>
 inline
-bool
-diskio::save_raw_binary(const Cube<eT>& x, const std::string& final_name)
+void
+diskio::mtx_write_val(std::ostream& f, const eT& val)
   {
-  arma_extra_debug_sigprint();
-  
-  const std::string tmp_name = diskio::gen_tmp_name(final_name);
+  f << +val;  // unary plus to write u8 and s8 values as numbers rather than characters
+  }
+
+
+
+template<typename T>
+inline
+void
+diskio::mtx_write_val(std::ostream& f, const std::complex<T>& val)
+  {
+  f << +(val.real()) << ' ' << +(val.imag());
+  }
+
+
+
+template<typename eT>
+inline
+void
+diskio::mtx_set_val(eT& val, const eT& val_real, const eT& val_imag)
+  {
+  arma_ignore(val_imag);
   
-  std::ofstream f(tmp_name.c_str(), std::fstream::binary);
+  val = val_real;
+  }
+
+
+
+template<typename T>
+inline
+void
+diskio::mtx_set_val(std::complex<T>& val, const T& val_real, const T& val_imag)
+  {
+  val = std::complex<T>(val_real, val_imag);
+  }
+
+
+
+//! Convert a one-based index in the range [start, end); the index must be in the range [1, n]
+inline
+bool
+diskio::convert_index(uword& val, const char* start, const char* end, const uword n)
+  {
+  if(start == end)  { return false; }
   
-  bool save_okay = f.is_open();
+  uword tmp = 0;
   
-  if(save_okay == true)
+  for(const char* ptr = start; ptr < end; ++ptr)
     {
-    save_okay = diskio::save_raw_binary(x, f);
+    if( (*ptr < '0') || (*ptr > '9') || (tmp > n) )  { return false; }
     
-    f.flush();
-    f.close();
-    
-    if(save_okay == true)
-      {
-      save_okay = diskio::safe_rename(tmp_name, final_name);
-      }
+    tmp = uword(10)*tmp + uword(*ptr - '0');
     }
   
-  return save_okay;
+  if( (tmp == 0) || (tmp > n) )  { return false; }
+  
+  val = tmp - 1;
+  
+  return true;
   }
 
 
 
+//! Parse the entries of a Matrix Market file in the range [start, end), which starts at the beginning of a line.
+//! The zero-based locations and the values are stored in rows, cols and vals; n_entries is set to the number of entries found.
 template<typename eT>
 inline
 bool
-diskio::save_raw_binary(const Cube<eT>& x, std::ostream& f)
+diskio::parse_mtx_text(podarray<uword>& rows, podarray<uword>& cols, podarray<eT>& vals, uword& n_entries, const char* start, const char* end, const uword n_rows, const uword n_cols, const uword field_type)
   {
   arma_extra_debug_sigprint();
   
-  f.write( reinterpret_cast<const char*>(x.mem), std::streamsize(x.n_elem*sizeof(eT)) );
+  typedef typename get_pod_type<eT>::result T;
   
-  return f.good();
-  }
-
-
+  const uword n_lines = uword( std::count(start, end, '\n') ) + 1;
+  
+  rows.set_size(n_lines);
+  cols.set_size(n_lines);
+  vals.set_size(n_lines);
+  
+  n_entries = 0;
+  
+  // field_type: 0 = real or integer, 1 = complex, 2 = pattern
+  const uword n_needed = (field_type == 2) ? 2 : ( (field_type == 1) ? 4 : 3 );
+  
+  const char* tok_start[4];
+  const char* tok_end  [4];
+  
+  const char* ptr = start;
+  
+  while(ptr < end)
+    {
+    const char* line_end = (const char*)( std::memchr(ptr, '\n', size_t(end - ptr)) );
+    
+    if(line_end == 0)  { line_end = end; }
+    
+    uword n_tok = 0;
+    
+    for(const char* p = ptr; (p < line_end) && (n_tok < 4);)
+      {
+      while( (p < line_end) && ((*p == ' ') || (*p == '\t') || (*p == '\r')) )  { ++p; }
+      
+      if(p == line_end)  { break; }
+      
+      tok_start[n_tok] = p;
+      
+      while( (p < line_end) && (*p != ' ') && (*p != '\t') && (*p != '\r') )  { ++p; }
+      
+      tok_end[n_tok] = p;
+      
+      ++n_tok;
+      }
+    
+    ptr = line_end + 1;
+    
+    if( (n_tok == 0) || (tok_start[0][0] == '%') )  { continue; }  // empty line or comment
+    
+    if(n_tok < n_needed)  { return false; }
+    
+    uword row;
+    uword col;
+    
+    if(diskio::convert_index(row, tok_start[0], tok_end[0], n_rows) == false)  { return false; }
+    if(diskio::convert_index(col, tok_start[1], tok_end[1], n_cols) == false)  { return false; }
+    
+    T val_real = T(1);
+    T val_imag = T(0);
+    
+    if(field_type != 2)
+      {
+      if(diskio::convert_token(val_real, tok_start[2], tok_end[2]) == false)  { return false; }
+      
+      if(field_type == 1)
+        {
+        if(diskio::convert_token(val_imag, tok_start[3], tok_end[3]) == false)  { return false; }
+        }
+      }
+    
+    rows[n_entries] = row;
+    cols[n_entries] = col;
+    
+    diskio::mtx_set_val(vals[n_entries], val_real, val_imag);
+    
+    ++n_entries;
+    }
+  
+  return true;
+  }
+
+
 
-//! Save a cube in text format (human readable),
-//! with a header that indicates the cube type as well as its dimensions
 template<typename eT>
 inline
 bool
-diskio::save_arma_ascii(const Cube<eT>& x, const std::string& final_name)
+diskio::load_mtx_ascii(SpMat<eT>& x, const std::string& name, std::string& err_msg)
   {
   arma_extra_debug_sigprint();
   
-  const std::string tmp_name = diskio::gen_tmp_name(final_name);
-  
-  std::ofstream f(tmp_name.c_str());
+  std::fstream f;
+  f.open(name.c_str(), std::fstream::in | std::fstream::binary);
   
-  bool save_okay = f.is_open();
+  bool load_okay = f.is_open();
   
-  if(save_okay == true)
+  if(load_okay == true)
     {
-    save_okay = diskio::save_arma_ascii(x, f);
-    
-    f.flush();
+    load_okay = diskio::load_mtx_ascii(x, f, err_msg);
     f.close();
-    
-    if(save_okay == true)
-      {
-      save_okay = diskio::safe_rename(tmp_name, final_name);
-      }
     }
   
-  return save_okay;
+  return load_okay;
   }
 
 
 
-//! Save a cube in text format (human readable),
-//! with a header that indicates the cube type as well as its dimensions
+//! Load a sparse matrix in Matrix Market coordinate format.
+//! The real, integer, complex and pattern fields are supported,
+//! as well as the general, symmetric, skew-symmetric and hermitian symmetry types.
+//! The entries are parsed in parallel (when OpenMP is enabled) and placed directly in CSC form;
+//! duplicate entries are summed.
 template<typename eT>
 inline
 bool
-diskio::save_arma_ascii(const Cube<eT>& x, std::ostream& f)
+diskio::load_mtx_ascii(SpMat<eT>& x, std::istream& f, std::string& err_msg)
   {
   arma_extra_debug_sigprint();
   
-  const ios::fmtflags orig_flags = f.flags();
+  std::string line;
   
-  f << diskio::gen_txt_header(x) << '\n';
-  f << x.n_rows << ' ' << x.n_cols << ' ' << x.n_slices << '\n';
+  std::getline(f, line);
   
-  uword cell_width;
+  for(uword i=0; i < line.length(); ++i)  { if( (line[i] >= 'A') && (line[i] <= 'Z') )  { line[i] = char(line[i] - 'A' + 'a'); } }
   
-  // TODO: need sane values for complex numbers
+  std::stringstream header(line);
   
-  if( (is_float<eT>::value) || (is_double<eT>::value) )
+  std::string f_banner;
+  std::string f_object;
+  std::string f_format;
+  std::string f_field;
+  std::string f_symmetry;
+  
+  header >> f_banner >> f_object >> f_format >> f_field >> f_symmetry;
+  
+  if( (f_banner != "%%matrixmarket") || (f_object != "matrix") )
     {
-    f.setf(ios::scientific);
-    f.precision(14);
-    cell_width = 22;
+    err_msg = "incorrect header in ";
+    return false;
+    }
+  
+  if(f_format != "coordinate")
+    {
+    err_msg = "unsupported Matrix Market format in ";
+    return false;
+    }
+  
+  uword field_type;
+  
+       if( (f_field == "real") || (f_field == "double") || (f_field == "integer") )  { field_type = 0; }
+  else if(  f_field == "complex"                                                  )  { field_type = 1; }
+  else if(  f_field == "pattern"                                                  )  { field_type = 2; }
+  else
+    {
+    err_msg = "unsupported Matrix Market field in ";
+    return false;
+    }
+  
+  if( (field_type == 1) && (is_complex<eT>::value == false) )
+    {
+    err_msg = "complex data can't be loaded into a real matrix from ";
+    return false;
+    }
+  
+  uword symmetry;
+  
+       if(f_symmetry == "general"       )  { symmetry = 0; }
+  else if(f_symmetry == "symmetric"     )  { symmetry = 1; }
+  else if(f_symmetry == "skew-symmetric")  { symmetry = 2; }
+  else if(f_symmetry == "hermitian"     )  { symmetry = 3; }
+  else
+    {
+    err_msg = "unsupported Matrix Market symmetry in ";
+    return false;
     }
+  
+  uword f_n_rows    = 0;
+  uword f_n_cols    = 0;
+  uword f_n_entries = 0;
+  
+  bool size_found = false;
+  
+  while(f.good())
+    {
+    std::getline(f, line);
     
-  for(uword slice=0; slice < x.n_slices; ++slice)
+    if( (line.find_first_not_of(" \t\r") == std::string::npos) || (line[0] == '%') )  { continue; }
+    
+    std::stringstream ss(line);
+    
+    ss >> f_n_rows >> f_n_cols >> f_n_entries;
+    
+    size_found = (ss.fail() == false);
+    
+    break;
+    }
+  
+  if( (size_found == false) || ((symmetry != 0) && (f_n_rows != f_n_cols)) )
     {
-    for(uword row=0; row < x.n_rows; ++row)
+    err_msg = "incorrect header in ";
+    return false;
+    }
+  
+  std::vector<char> buffer;
+  
+  diskio::read_text(buffer, f);
+  
+  const char* mem     = &(buffer[0]);
+  const uword n_chars = uword(buffer.size()) - 1;
+  
+  const uvec  chunk_starts = diskio::split_text(mem, n_chars);
+  const uword n_chunks     = chunk_starts.n_elem - 1;
+  
+  std::vector< podarray<uword> > chunk_rows(n_chunks);
+  std::vector< podarray<uword> > chunk_cols(n_chunks);
+  std::vector< podarray<eT>    > chunk_vals(n_chunks);
+  
+  podarray<uword> chunk_n_entries(n_chunks);
+  
+  uword n_bad = 0;
+  
+  #if defined(_OPENMP)
+    #pragma omp parallel for schedule(static) reduction(+:n_bad)
+  #endif
+  for(uword k=0; k < n_chunks; ++k)
+    {
+    const bool status = diskio::parse_mtx_text(chunk_rows[k], chunk_cols[k], chunk_vals[k], chunk_n_entries[k], mem + chunk_starts[k], mem + chunk_starts[k+1], f_n_rows, f_n_cols, field_type);
+    
+    if(status == false)  { ++n_bad; }
+    }
+  
+  uword n_entries = 0;
+  
+  for(uword k=0; k < n_chunks; ++k)  { n_entries += chunk_n_entries[k]; }
+  
+  if( (n_bad > 0) || (n_entries != f_n_entries) )
+    {
+    err_msg = "corrupted data in ";
+    return false;
+    }
+  
+  // count the number of entries in each column, including the mirrored entries of symmetric matrices
+  
+  x.set_size(f_n_rows, f_n_cols);
+  
+  uword* col_ptrs = access::rwp(x.col_ptrs);
+  
+  for(uword col=0; col <= f_n_cols; ++col)  { col_ptrs[col] = 0; }
+  
+  for(uword k=0; k < n_chunks; ++k)
+    {
+    const uword* rows = chunk_rows[k].memptr();
+    const uword* cols = chunk_cols[k].memptr();
+    const eT*    vals = chunk_vals[k].memptr();
+    
+    for(uword i=0; i < chunk_n_entries[k]; ++i)
       {
-      for(uword col=0; col < x.n_cols; ++col)
+      if(vals[i] == eT(0))  { continue; }
+      
+      ++col_ptrs[cols[i] + 1];
+      
+      if( (symmetry != 0) && (rows[i] != cols[i]) )  { ++col_ptrs[rows[i] + 1]; }
+      }
+    }
+  
+  for(uword col=0; col < f_n_cols; ++col)  { col_ptrs[col + 1] += col_ptrs[col]; }
+  
+  x.mem_resize(col_ptrs[f_n_cols]);
+  
+  uword* row_indices = access::rwp(x.row_indices);
+  eT*    values      = access::rwp(x.values);
+  
+  podarray<uword> fill_pos(col_ptrs, f_n_cols);
+  
+  for(uword k=0; k < n_chunks; ++k)
+    {
+    const uword* rows = chunk_rows[k].memptr();
+    const uword* cols = chunk_cols[k].memptr();
+    const eT*    vals = chunk_vals[k].memptr();
+    
+    for(uword i=0; i < chunk_n_entries[k]; ++i)
+      {
+      const eT val = vals[i];
+      
+      if(val == eT(0))  { continue; }
+      
+      const uword row = rows[i];
+      const uword col = cols[i];
+      
+      uword& pos = fill_pos[col];
+      
+      row_indices[pos] = row;
+      values     [pos] = val;
+      ++pos;
+      
+      if( (symmetry != 0) && (row != col) )
         {
-        f.put(' ');
-        
-        if( (is_float<eT>::value) || (is_double<eT>::value) )        
-          {
-          f.width(std::streamsize(cell_width));
-          }
+        uword& pos_t = fill_pos[row];
         
-        arma_ostream::print_elem(f, x.at(row,col,slice), false);
+        row_indices[pos_t] = col;
+        values     [pos_t] = (symmetry == 1) ? val : ( (symmetry == 2) ? eT(-val) : eT(access::alt_conj(val)) );
+        ++pos_t;
         }
+      }
+    }
+  
+  // sort the entries within each column and sum duplicate entries
+  
+  podarray<uword> col_n_nz(f_n_cols);
+  
+  #if defined(_OPENMP)
+    #pragma omp parallel for schedule(dynamic, 1024)
+  #endif
+  for(uword col=0; col < f_n_cols; ++col)
+    {
+    const uword index_start = col_ptrs[col    ];
+    const uword index_end   = col_ptrs[col + 1];
+    
+    bool is_sorted = true;
+    
+    for(uword i=index_start+1; i < index_end; ++i)
+      {
+      if(row_indices[i] <= row_indices[i-1])  { is_sorted = false; break; }
+      }
+    
+    if(is_sorted)  { col_n_nz[col] = index_end - index_start; continue; }
+    
+    const uword N = index_end - index_start;
+    
+    std::vector< arma_sort_index_packet<uword> > packets(N);
+    
+    for(uword i=0; i < N; ++i)
+      {
+      packets[i].val   = row_indices[index_start + i];
+      packets[i].index = i;
+      }
+    
+    std::sort( packets.begin(), packets.end(), arma_sort_index_helper_ascend<uword>() );
+    
+    podarray<eT> tmp_vals(values + index_start, N);
+    
+    uword n_out = 0;
+    
+    for(uword i=0; i < N; ++i)
+      {
+      const uword row = packets[i].val;
+      const eT    val = tmp_vals[packets[i].index];
       
-      f.put('\n');
+      if( (n_out > 0) && (row_indices[index_start + n_out - 1] == row) )
+        {
+        values[index_start + n_out - 1] += val;
+        }
+      else
+        {
+        row_indices[index_start + n_out] = row;
+        values     [index_start + n_out] = val;
+        ++n_out;
+        }
+      }
+    
+    // remove entries which summed to zero
+    
+    uword n_nz = 0;
+    
+    for(uword i=0; i < n_out; ++i)
+      {
+      if(values[index_start + i] != eT(0))
+        {
+        row_indices[index_start + n_nz] = row_indices[index_start + i];
+        values     [index_start + n_nz] = values     [index_start + i];
+        ++n_nz;
+        }
       }
+    
+    col_n_nz[col] = n_nz;
     }
   
-  const bool save_okay = f.good();
+  // close the gaps left by summed entries
   
-  f.flags(orig_flags);
+  uword n_nz = 0;
   
-  return save_okay;
+  for(uword col=0; col < f_n_cols; ++col)
+    {
+    const uword index_start = col_ptrs[col];
+    
+    col_ptrs[col] = n_nz;
+    
+    if(index_start != n_nz)
+      {
+      for(uword i=0; i < col_n_nz[col]; ++i)
+        {
+        row_indices[n_nz + i] = row_indices[index_start + i];
+        values     [n_nz + i] = values     [index_start + i];
+        }
+      }
+    
+    n_nz += col_n_nz[col];
+    }
+  
+  col_ptrs[f_n_cols] = n_nz;
+  
+  x.mem_resize(n_nz);
+  
+  return true;
   }
 
 
 
-//! Save a cube in binary format,
-//! with a header that stores the cube type as well as its dimensions
+// cubes
+
+
+
+//! Save a cube as raw text (no header, human readable).
 template<typename eT>
 inline
 bool
-diskio::save_arma_binary(const Cube<eT>& x, const std::string& final_name)
+diskio::save_raw_ascii(const Cube<eT>& x, const std::string& final_name)
   {
   arma_extra_debug_sigprint();
   
   const std::string tmp_name = diskio::gen_tmp_name(final_name);
   
-  std::ofstream f(tmp_name.c_str(), std::fstream::binary);
+  std::fstream f(tmp_name.c_str(), std::fstream::out);
   
   bool save_okay = f.is_open();
   
   if(save_okay == true)
     {
-    save_okay = diskio::save_arma_binary(x, f);
+    save_okay = save_raw_ascii(x, f);
     
     f.flush();
     f.close();
@@ -3340,42 +4379,287 @@ diskio::save_arma_binary(const Cube<eT>& x, const std::string& final_name)
 
 
 
-//! Save a cube in binary format,
-//! with a header that stores the cube type as well as its dimensions
+//! Save a cube as raw text (no header, human readable).
 template<typename eT>
 inline
 bool
-diskio::save_arma_binary(const Cube<eT>& x, std::ostream& f)
+diskio::save_raw_ascii(const Cube<eT>& x, std::ostream& f)
   {
   arma_extra_debug_sigprint();
   
-  f << diskio::gen_bin_header(x) << '\n';
-  f << x.n_rows << ' ' << x.n_cols << ' ' << x.n_slices << '\n';
+  uword cell_width;
   
-  f.write( reinterpret_cast<const char*>(x.mem), std::streamsize(x.n_elem*sizeof(eT)) );
+  // TODO: need sane values for complex numbers
   
-  return f.good();
-  }
-
-
-
-//! Save a cube as part of a HDF5 file
-template<typename eT>
-inline
-bool
-diskio::save_hdf5_binary(const Cube<eT>& x, const std::string& final_name)
-  {
-  arma_extra_debug_sigprint();
-
-  #if defined(ARMA_USE_HDF5)
+  if( (is_float<eT>::value) || (is_double<eT>::value) )
     {
-    #if !defined(ARMA_PRINT_HDF5_ERRORS)
-      {
-      // Disable annoying HDF5 error messages.
-      arma_H5Eset_auto(H5E_DEFAULT, NULL, NULL);
-      }
-    #endif
-
+    f.setf(ios::scientific);
+    f.precision(14);
+    cell_width = 22;
+    }
+  
+  if(diskio::can_format_text<eT>(f))
+    {
+    for(uword slice=0; slice < x.n_slices; ++slice)  { diskio::save_text_blocks(x.slice(slice), f, false); }
+    
+    return f.good();
+    }
+  
+  for(uword slice=0; slice < x.n_slices; ++slice)
+    {
+    for(uword row=0; row < x.n_rows; ++row)
+      {
+      for(uword col=0; col < x.n_cols; ++col)
+        {
+        f.put(' ');
+        
+        if( (is_float<eT>::value) || (is_double<eT>::value) )
+          {
+          f.width(std::streamsize(cell_width));
+          }
+        
+        arma_ostream::print_elem(f, x.at(row,col,slice), false);
+        }
+        
+      f.put('\n');
+      }
+    }
+  
+  return f.good();
+  }
+
+
+
+//! Save a cube as raw binary (no header)
+template<typename eT>
+inline
+bool
+diskio::save_raw_binary(const Cube<eT>& x, const std::string& final_name)
+  {
+  arma_extra_debug_sigprint();
+  
+  const std::string tmp_name = diskio::gen_tmp_name(final_name);
+  
+  std::ofstream f(tmp_name.c_str(), std::fstream::binary);
+  
+  bool save_okay = f.is_open();
+  
+  if(save_okay == true)
+    {
+    save_okay = diskio::save_raw_binary(x, f);
+    
+    f.flush();
+    f.close();
+    
+    if(save_okay == true)
+      {
+      save_okay = diskio::safe_rename(tmp_name, final_name);
+      }
+    }
+  
+  return save_okay;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+diskio::save_raw_binary(const Cube<eT>& x, std::ostream& f)
+  {
+  arma_extra_debug_sigprint();
+  
+  f.write( reinterpret_cast<const char*>(x.mem), std::streamsize(x.n_elem*sizeof(eT)) );
+  
+  return f.good();
+  }
+
+
+
+//! Save a cube in text format (human readable),
+//! with a header that indicates the cube type as well as its dimensions
+template<typename eT>
+inline
+bool
+diskio::save_arma_ascii(const Cube<eT>& x, const std::string& final_name)
+  {
+  arma_extra_debug_sigprint();
+  
+  const std::string tmp_name = diskio::gen_tmp_name(final_name);
+  
+  std::ofstream f(tmp_name.c_str());
+  
+  bool save_okay = f.is_open();
+  
+  if(save_okay == true)
+    {
+    save_okay = diskio::save_arma_ascii(x, f);
+    
+    f.flush();
+    f.close();
+    
+    if(save_okay == true)
+      {
+      save_okay = diskio::safe_rename(tmp_name, final_name);
+      }
+    }
+  
+  return save_okay;
+  }
+
+
+
+//! Save a cube in text format (human readable),
+//! with a header that indicates the cube type as well as its dimensions
+template<typename eT>
+inline
+bool
+diskio::save_arma_ascii(const Cube<eT>& x, std::ostream& f)
+  {
+  arma_extra_debug_sigprint();
+  
+  const ios::fmtflags orig_flags = f.flags();
+  
+  f << diskio::gen_txt_header(x) << '\n';
+  f << x.n_rows << ' ' << x.n_cols << ' ' << x.n_slices << '\n';
+  
+  uword cell_width;
+  
+  // TODO: need sane values for complex numbers
+  
+  if( (is_float<eT>::value) || (is_double<eT>::value) )
+    {
+    f.setf(ios::scientific);
+    f.precision(14);
+    cell_width = 22;
+    }
+  
+  if(diskio::can_format_text<eT>(f))
+    {
+    for(uword slice=0; slice < x.n_slices; ++slice)  { diskio::save_text_blocks(x.slice(slice), f, false); }
+    
+    const bool save_okay = f.good();
+    
+    f.flags(orig_flags);
+    
+    return save_okay;
+    }
+    
+  for(uword slice=0; slice < x.n_slices; ++slice)
+    {
+    for(uword row=0; row < x.n_rows; ++row)
+      {
+      for(uword col=0; col < x.n_cols; ++col)
+        {
+        f.put(' ');
+        
+        if( (is_float<eT>::value) || (is_double<eT>::value) )        
+          {
+          f.width(std::streamsize(cell_width));
+          }
+        
+        arma_ostream::print_elem(f, x.at(row,col,slice), false);
+        }
+      
+      f.put('\n');
+      }
+    }
+  
+  const bool save_okay = f.good();
+  
+  f.flags(orig_flags);
+  
+  return save_okay;
+  }
+
+
+
+//! Save a cube in binary format,
+//! with a header that stores the cube type as well as its dimensions
+template<typename eT>
+inline
+bool
+diskio::save_arma_binary(const Cube<eT>& x, const std::string& final_name)
+  {
+  arma_extra_debug_sigprint();
+  
+  const std::string tmp_name = diskio::gen_tmp_name(final_name);
+  
+  std::ofstream f(tmp_name.c_str(), std::fstream::binary);
+  
+  bool save_okay = f.is_open();
+  
+  if(save_okay == true)
+    {
+    save_okay = diskio::save_arma_binary(x, f);
+    
+    f.flush();
+    f.close();
+    
+    if(save_okay == true)
+      {
+      save_okay = diskio::safe_rename(tmp_name, final_name);
+      }
+    }
+  
+  return save_okay;
+  }
+
+
+
+//! Save a cube in binary format,
+//! with a header that stores the cube type as well as its dimensions
+template<typename eT>
+inline
+bool
+diskio::save_arma_binary(const Cube<eT>& x, std::ostream& f)
+  {
+  arma_extra_debug_sigprint();
+  
+  f << diskio::gen_bin_header(x) << '\n';
+  
+  std::ostringstream dims;
+  
+  dims << x.n_rows << ' ' << x.n_cols << ' ' << x.n_slices << '\n';
+  
+  // align the start of the data to 16 bytes, as per save_arma_binary() for matrices
+  
+  const std::streampos pos = f.tellp();
+  
+  if(pos >= 0)
+    {
+    const uword n_extra = (uword(pos) + uword(dims.str().length())) % uword(16);
+    
+    if(n_extra > 0)  { f << std::string(uword(16) - n_extra, ' '); }
+    }
+  
+  f << dims.str();
+  
+  f.write( reinterpret_cast<const char*>(x.mem), std::streamsize(x.n_elem*sizeof(eT)) );
+  
+  return f.good();
+  }
+
+
+
+//! Save a cube as part of a HDF5 file.
+//! If compress is true, the dataset uses a chunked layout with the shuffle and deflate filters.
+template<typename eT>
+inline
+bool
+diskio::save_hdf5_binary(const Cube<eT>& x, const std::string& final_name, const bool compress)
+  {
+  arma_extra_debug_sigprint();
+
+  #if defined(ARMA_USE_HDF5)
+    {
+    #if !defined(ARMA_PRINT_HDF5_ERRORS)
+      {
+      // Disable annoying HDF5 error messages.
+      arma_H5Eset_auto(H5E_DEFAULT, NULL, NULL);
+      }
+    #endif
+
     bool save_okay = false;
 
     const std::string tmp_name = diskio::gen_tmp_name(final_name);
@@ -3398,11 +4682,14 @@ diskio::save_hdf5_binary(const Cube<eT>& x, const std::string& final_name)
     // MATLAB forces the users to specify a name at save time for HDF5; Octave
     // will use the default of 'dataset' unless otherwise specified, so we will
     // use that.
-    hid_t dataset = arma_H5Dcreate(file, "dataset", datatype, dataspace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    hid_t dcpl    = (compress) ? hdf5_misc::create_compressed_dcpl(3, dims, uword(sizeof(eT))) : hid_t(H5P_DEFAULT);
+    hid_t dataset = arma_H5Dcreate(file, "dataset", datatype, dataspace, H5P_DEFAULT, dcpl, H5P_DEFAULT);
 
     herr_t status = arma_H5Dwrite(dataset, datatype, H5S_ALL, H5S_ALL, H5P_DEFAULT, x.mem);
     save_okay = (status >= 0);
 
+    if(dcpl != H5P_DEFAULT)  { arma_H5Pclose(dcpl); }
+    
     arma_H5Dclose(dataset);
     arma_H5Tclose(datatype);
     arma_H5Sclose(dataspace);
@@ -3416,6 +4703,7 @@ diskio::save_hdf5_binary(const Cube<eT>& x, const std::string& final_name)
     {
     arma_ignore(x);
     arma_ignore(final_name);
+    arma_ignore(compress);
 
     arma_stop_logic_error("Cube::save(): use of HDF5 needs to be enabled");
 
@@ -3759,12 +5047,26 @@ bool
 diskio::load_hdf5_binary(Cube<eT>& x, const std::string& name, std::string& err_msg)
   {
   arma_extra_debug_sigprint();
+  
+  return diskio::load_hdf5_binary(x, name, span::all, err_msg);
+  }
 
-  #if defined(ARMA_USE_HDF5)
-    {
 
-    // These may be necessary to store the error handler (if we need to).
-    herr_t (*old_func)(hid_t, void*);
+
+//! Load a HDF5 file as a cube, or only the given slices of the cube.
+//! A partial load reads only the selected part of the dataset (hyperslab).
+template<typename eT>
+inline
+bool
+diskio::load_hdf5_binary(Cube<eT>& x, const std::string& name, const span& slice_span, std::string& err_msg)
+  {
+  arma_extra_debug_sigprint();
+
+  #if defined(ARMA_USE_HDF5)
+    {
+
+    // These may be necessary to store the error handler (if we need to).
+    herr_t (*old_func)(hid_t, void*);
     void *old_client_data;
 
     #if !defined(ARMA_PRINT_HDF5_ERRORS)
@@ -3824,29 +5126,69 @@ diskio::load_hdf5_binary(Cube<eT>& x, const std::string& name, std::string& err_
         if (ndims == 1) { dims[1] = 1; dims[2] = 1; }  // Vector case; one row/colum, several slices
         if (ndims == 2) { dims[2] = 1; } // Matrix case; one column, several rows/slices
 
-        x.set_size(dims[2], dims[1], dims[0]);
+        const uword f_n_slices = uword(dims[0]);
+        
+        const uword slice1 = (slice_span.whole) ? uword(0)   : slice_span.a;
+        const uword slice2 = (slice_span.whole) ? f_n_slices : slice_span.b + 1;
+        
+        const bool in_bounds = (slice1 <= slice2) && (slice2 <= f_n_slices);
+        
+        if(in_bounds == false)  { err_msg = "requested slices are out of bounds in "; }
+        
+        hid_t memspace  = H5S_ALL;
+        hid_t selection = H5S_ALL;
+        
+        if( in_bounds && ((slice1 != 0) || (slice2 != f_n_slices)) && (slice1 != slice2) && (dims[1] > 0) && (dims[2] > 0) )
+          {
+          // the slices of the cube are the first dimension of the dataset
+          hsize_t start[3];
+          hsize_t count[3];
+          
+          start[0] = slice1;  count[0] = slice2 - slice1;
+          start[1] = 0;       count[1] = dims[1];
+          start[2] = 0;       count[2] = dims[2];
+          
+          if(arma_H5Sselect_hyperslab(filespace, H5S_SELECT_SET, start, NULL, count, NULL) >= 0)
+            {
+            memspace  = arma_H5Screate_simple(ndims, count, NULL);
+            selection = filespace;
+            }
+          }
+        
+        if(in_bounds)  { x.set_size(dims[2], dims[1], slice2 - slice1); }
 
         // Now we have to see what type is stored to figure out how to load it.
         hid_t datatype = arma_H5Dget_type(dataset);
         hid_t mat_type = hdf5_misc::get_hdf5_type<eT>();
 
-        // If these are the same type, it is simple.
-        if(arma_H5Tequal(datatype, mat_type) > 0)
+        if( in_bounds && ((x.n_elem == 0) || (memspace < 0)) )
           {
-          // Load directly; H5S_ALL used so that we load the entire dataset.
-          hid_t read_status = arma_H5Dread(dataset, datatype, H5S_ALL, H5S_ALL, H5P_DEFAULT, void_ptr(x.memptr()));
-
-          if(read_status >= 0) { load_okay = true; }
+          // nothing to read, or the hyperslab couldn't be set up
+          load_okay = (x.n_elem == 0);
           }
         else
+        if(in_bounds)
           {
-          // Load into another array and convert its type accordingly.
-          hid_t read_status = hdf5_misc::load_and_convert_hdf5(x.memptr(), dataset, datatype, x.n_elem);
+          // If these are the same type, it is simple.
+          if(arma_H5Tequal(datatype, mat_type) > 0)
+            {
+            // Load directly; H5S_ALL used (unless a hyperslab is selected) so that we load the entire dataset.
+            hid_t read_status = arma_H5Dread(dataset, datatype, memspace, selection, H5P_DEFAULT, void_ptr(x.memptr()));
 
-          if(read_status >= 0) { load_okay = true; }
+            if(read_status >= 0) { load_okay = true; }
+            }
+          else
+            {
+            // Load into another array and convert its type accordingly.
+            hid_t read_status = hdf5_misc::load_and_convert_hdf5(x.memptr(), dataset, datatype, x.n_elem, memspace, selection);
+            
+            if(read_status >= 0) { load_okay = true; }
+            }
           }
 
         // Now clean up.
+        if(memspace > 0)  { arma_H5Sclose(memspace); }
+        
         arma_H5Tclose(datatype);
         arma_H5Tclose(mat_type);
         arma_H5Sclose(filespace);
@@ -3856,7 +5198,7 @@ diskio::load_hdf5_binary(Cube<eT>& x, const std::string& name, std::string& err_
 
       arma_H5Fclose(fid);
 
-      if(load_okay == false)
+      if( (load_okay == false) && err_msg.empty() )
         {
         err_msg = "unsupported or incorrect HDF5 data in ";
         }
@@ -3879,6 +5221,7 @@ diskio::load_hdf5_binary(Cube<eT>& x, const std::string& name, std::string& err_
     {
     arma_ignore(x);
     arma_ignore(name);
+    arma_ignore(slice_span);
     arma_ignore(err_msg);
 
     arma_stop_logic_error("Cube::load(): use of HDF5 needs to be enabled");
@@ -3929,7 +5272,9 @@ diskio::load_auto_detect(Cube<eT>& x, std::istream& f, std::string& err_msg)
   
   static const std::string ARMA_CUB_TXT = "ARMA_CUB_TXT";
   static const std::string ARMA_CUB_BIN = "ARMA_CUB_BIN";
+  static const std::string ARMA_CUB_CMP = "ARMA_CUB_CMP";
   static const std::string           P6 = "P6";
+  static const std::string          NPY = "\x93NUMPY";
   
   podarray<char> raw_header(uword(ARMA_CUB_TXT.length()) + 1);
   
@@ -3953,10 +5298,20 @@ diskio::load_auto_detect(Cube<eT>& x, std::istream& f, std::string& err_msg)
     return load_arma_binary(x, f, err_msg);
     }
   else
+  if(ARMA_CUB_CMP == header.substr(0, ARMA_CUB_CMP.length()))
+    {
+    return load_arma_compressed(x, f, err_msg);
+    }
+  else
   if(P6 == header.substr(0, P6.length()))
     {
     return load_ppm_binary(x, f, err_msg);
     }
+  else
+  if(NPY == header.substr(0, NPY.length()))
+    {
+    return load_npy_binary(x, f, err_msg);
+    }
   else
     {
     const file_type ft = guess_file_type(f);
@@ -3981,44 +5336,2112 @@ diskio::load_auto_detect(Cube<eT>& x, std::istream& f, std::string& err_msg)
       }
     }
   
-  return false;
+  return false;
+  }
+
+
+
+
+
+// fields
+
+
+
+template<typename T1>
+inline
+bool
+diskio::save_arma_binary(const field<T1>& x, const std::string& final_name)
+  {
+  arma_extra_debug_sigprint();
+  
+  const std::string tmp_name = diskio::gen_tmp_name(final_name);
+  
+  std::ofstream f( tmp_name.c_str(), std::fstream::binary );
+  
+  bool save_okay = f.is_open();
+  
+  if(save_okay == true)
+    {
+    save_okay = diskio::save_arma_binary(x, f);
+    
+    f.flush();
+    f.close();
+    
+    if(save_okay == true)
+      {
+      save_okay = diskio::safe_rename(tmp_name, final_name);
+      }
+    }
+  
+  return save_okay;
+  }
+
+
+
+template<typename T1>
+inline
+bool
+diskio::save_arma_binary(const field<T1>& x, std::ostream& f)
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_type_check(( (is_Mat<T1>::value == false) && (is_Cube<T1>::value == false) ));
+  
+  if(x.n_slices <= 1)
+    {
+    f << "ARMA_FLD_BIN" << '\n';
+    f << x.n_rows << '\n';
+    f << x.n_cols << '\n';
+    }
+  else
+    {
+    f << "ARMA_FL3_BIN" << '\n';
+    f << x.n_rows   << '\n';
+    f << x.n_cols   << '\n';
+    f << x.n_slices << '\n';
+    }
+  
+  bool save_okay = true;
+  
+  for(uword i=0; i<x.n_elem; ++i)
+    {
+    save_okay = diskio::save_arma_binary(x[i], f);
+    
+    if(save_okay == false)
+      {
+      break;
+      }
+    }
+  
+  return save_okay;
+  }
+
+
+
+template<typename T1>
+inline
+bool
+diskio::load_arma_binary(field<T1>& x, const std::string& name, std::string& err_msg)
+  {
+  arma_extra_debug_sigprint();
+  
+  std::ifstream f( name.c_str(), std::fstream::binary );
+  
+  bool load_okay = f.is_open();
+  
+  if(load_okay == true)
+    {
+    load_okay = diskio::load_arma_binary(x, f, err_msg);
+    f.close();
+    }
+  
+  return load_okay;
+  }
+
+
+
+template<typename T1>
+inline
+bool
+diskio::load_arma_binary(field<T1>& x, std::istream& f, std::string& err_msg)
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_type_check(( (is_Mat<T1>::value == false) && (is_Cube<T1>::value == false) ));
+  
+  bool load_okay = true;
+  
+  std::string f_type;
+  f >> f_type;
+  
+  if(f_type == "ARMA_FLD_BIN")
+    {
+    uword f_n_rows;
+    uword f_n_cols;
+  
+    f >> f_n_rows;
+    f >> f_n_cols;
+    
+    x.set_size(f_n_rows, f_n_cols);
+    
+    f.get();      
+    
+    for(uword i=0; i<x.n_elem; ++i)
+      {
+      load_okay = diskio::load_arma_binary(x[i], f, err_msg);
+      
+      if(load_okay == false)
+        {
+        break;
+        }
+      }
+    }
+  else
+  if(f_type == "ARMA_FL3_BIN")
+    {
+    uword f_n_rows;
+    uword f_n_cols;
+    uword f_n_slices;
+  
+    f >> f_n_rows;
+    f >> f_n_cols;
+    f >> f_n_slices;
+    
+    x.set_size(f_n_rows, f_n_cols, f_n_slices);
+    
+    f.get();      
+    
+    for(uword i=0; i<x.n_elem; ++i)
+      {
+      load_okay = diskio::load_arma_binary(x[i], f, err_msg);
+      
+      if(load_okay == false)
+        {
+        break;
+        }
+      }
+    }
+  else
+    {
+    load_okay = false;
+    err_msg = "unsupported field type in ";
+    }
+  
+  return load_okay;
+  }
+
+
+
+inline
+bool
+diskio::save_std_string(const field<std::string>& x, const std::string& final_name)
+  {
+  arma_extra_debug_sigprint();
+  
+  const std::string tmp_name = diskio::gen_tmp_name(final_name);
+  
+  std::ofstream f( tmp_name.c_str(), std::fstream::binary );
+  
+  bool save_okay = f.is_open();
+  
+  if(save_okay == true)
+    {
+    save_okay = diskio::save_std_string(x, f);
+    
+    f.flush();
+    f.close();
+    
+    if(save_okay == true)
+      {
+      save_okay = diskio::safe_rename(tmp_name, final_name);
+      }
+    }
+  
+  return save_okay;
+  }
+
+
+
+inline
+bool
+diskio::save_std_string(const field<std::string>& x, std::ostream& f)
+  {
+  arma_extra_debug_sigprint();
+  
+  for(uword row=0; row<x.n_rows; ++row)
+  for(uword col=0; col<x.n_cols; ++col)
+    {
+    f << x.at(row,col);
+    
+    if(col < x.n_cols-1)
+      {
+      f << ' ';
+      }
+    else
+      {
+      f << '\n';
+      }
+    }
+  
+  return f.good();
+  }
+
+
+
+inline
+bool
+diskio::load_std_string(field<std::string>& x, const std::string& name, std::string& err_msg)
+  {
+  arma_extra_debug_sigprint();
+  
+  std::ifstream f( name.c_str() );
+  
+  bool load_okay = f.is_open();
+  
+  if(load_okay == true)
+    {
+    load_okay = diskio::load_std_string(x, f, err_msg);
+    f.close();
+    }
+  
+  return load_okay;
+  }
+
+
+
+inline
+bool
+diskio::load_std_string(field<std::string>& x, std::istream& f, std::string& err_msg)
+  {
+  arma_extra_debug_sigprint();
+  
+  bool load_okay = true;
+  
+  //
+  // work out the size
+  
+  uword f_n_rows = 0;
+  uword f_n_cols = 0;
+  
+  bool f_n_cols_found = false;
+  
+  std::string line_string;
+  std::string token;
+  
+  while( (f.good() == true) && (load_okay == true) )
+    {
+    std::getline(f, line_string);
+    if(line_string.size() == 0)
+      break;
+    
+    std::stringstream line_stream(line_string);
+    
+    uword line_n_cols = 0;
+    while (line_stream >> token)
+      line_n_cols++;
+    
+    if(f_n_cols_found == false)
+      {
+      f_n_cols = line_n_cols;
+      f_n_cols_found = true;
+      }
+    else
+      {
+      if(line_n_cols != f_n_cols)
+        {
+        load_okay = false;
+        err_msg = "inconsistent number of columns in ";
+        }
+      }
+    
+    ++f_n_rows;
+    }
+    
+  if(load_okay == true)
+    {
+    f.clear();
+    f.seekg(0, ios::beg);
+    //f.seekg(start);
+    
+    x.set_size(f_n_rows, f_n_cols);
+  
+    for(uword row=0; row < x.n_rows; ++row)
+      {
+      for(uword col=0; col < x.n_cols; ++col)
+        {
+        f >> x.at(row,col);
+        }
+      }
+    }
+  
+  if(f.good() == false)
+    {
+    load_okay = false; 
+    }
+  
+  return load_okay;
+  }
+
+
+
+//! Try to load a field by automatically determining its type
+template<typename T1>
+inline
+bool
+diskio::load_auto_detect(field<T1>& x, const std::string& name, std::string& err_msg)
+  {
+  arma_extra_debug_sigprint();
+  
+  std::fstream f;
+  f.open(name.c_str(), std::fstream::in | std::fstream::binary);
+  
+  bool load_okay = f.is_open();
+  
+  if(load_okay == true)
+    {
+    load_okay = diskio::load_auto_detect(x, f, err_msg);
+    f.close();
+    }
+  
+  return load_okay;
+  }
+
+
+
+//! Try to load a field by automatically determining its type
+template<typename T1>
+inline
+bool
+diskio::load_auto_detect(field<T1>& x, std::istream& f, std::string& err_msg)
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_type_check(( is_Mat<T1>::value == false ));
+  
+  static const std::string ARMA_FLD_BIN = "ARMA_FLD_BIN";
+  static const std::string ARMA_FL3_BIN = "ARMA_FL3_BIN";
+  static const std::string ARMA_FLD_CMP = "ARMA_FLD_CMP";
+  static const std::string ARMA_FL3_CMP = "ARMA_FL3_CMP";
+  static const std::string           P6 = "P6";
+  
+  podarray<char> raw_header(uword(ARMA_FLD_BIN.length()) + 1);
+  
+  std::streampos pos = f.tellg();
+  
+  f.read( raw_header.memptr(), std::streamsize(ARMA_FLD_BIN.length()) );
+  
+  f.clear();
+  f.seekg(pos);
+  
+  raw_header[uword(ARMA_FLD_BIN.length())] = '\0';
+  
+  const std::string header = raw_header.mem;
+  
+  if(ARMA_FLD_BIN == header.substr(0, ARMA_FLD_BIN.length()))
+    {
+    return load_arma_binary(x, f, err_msg);
+    }
+  else
+  if(ARMA_FL3_BIN == header.substr(0, ARMA_FL3_BIN.length()))
+    {
+    return load_arma_binary(x, f, err_msg);
+    }
+  else
+  if( (ARMA_FLD_CMP == header.substr(0, ARMA_FLD_CMP.length())) || (ARMA_FL3_CMP == header.substr(0, ARMA_FL3_CMP.length())) )
+    {
+    return load_arma_compressed(x, f, err_msg);
+    }
+  else
+  if(P6 == header.substr(0, P6.length()))
+    {
+    return load_ppm_binary(x, f, err_msg);
+    }
+  else
+    {
+    err_msg = "unsupported header in ";
+    return false;
+    }
+  }
+
+
+
+//
+// handling of PPM images by cubes
+
+
+template<typename eT>
+inline
+bool
+diskio::load_ppm_binary(Cube<eT>& x, const std::string& name, std::string& err_msg)
+  {
+  arma_extra_debug_sigprint();
+  
+  std::fstream f;
+  f.open(name.c_str(), std::fstream::in | std::fstream::binary);
+  
+  bool load_okay = f.is_open();
+  
+  if(load_okay == true)
+    {
+    load_okay = diskio::load_ppm_binary(x, f, err_msg);
+    f.close();
+    }
+  
+  return load_okay;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+diskio::load_ppm_binary(Cube<eT>& x, std::istream& f, std::string& err_msg)
+  {
+  arma_extra_debug_sigprint();
+  
+  bool load_okay = true;
+  
+  std::string f_header;
+  f >> f_header;
+  
+  if(f_header == "P6")
+    {
+    uword f_n_rows = 0;
+    uword f_n_cols = 0;
+    int f_maxval = 0;
+  
+    diskio::pnm_skip_comments(f);
+  
+    f >> f_n_cols;
+    diskio::pnm_skip_comments(f);
+  
+    f >> f_n_rows;
+    diskio::pnm_skip_comments(f);
+  
+    f >> f_maxval;
+    f.get();
+    
+    if( (f_maxval > 0) || (f_maxval <= 65535) )
+      {
+      x.set_size(f_n_rows, f_n_cols, 3);
+      
+      if(f_maxval <= 255)
+        {
+        const uword n_elem = 3*f_n_cols*f_n_rows;
+        podarray<u8> tmp(n_elem);
+        
+        f.read( reinterpret_cast<char*>(tmp.memptr()), std::streamsize(n_elem) );
+        
+        uword i = 0;
+        
+        //cout << "f_n_cols = " << f_n_cols << endl;
+        //cout << "f_n_rows = " << f_n_rows << endl;
+        
+        
+        for(uword row=0; row < f_n_rows; ++row)
+          {
+          for(uword col=0; col < f_n_cols; ++col)
+            {
+            x.at(row,col,0) = eT(tmp[i+0]);
+            x.at(row,col,1) = eT(tmp[i+1]);
+            x.at(row,col,2) = eT(tmp[i+2]);
+            i+=3;
+            }
+          
+          }
+        }
+      else
+        {
+        const uword n_elem = 3*f_n_cols*f_n_rows;
+        podarray<u16> tmp(n_elem);
+        
+        f.read( reinterpret_cast<char *>(tmp.memptr()), std::streamsize(2*n_elem) );
+        
+        uword i = 0;
+        
+        for(uword row=0; row < f_n_rows; ++row)
+          {
+          for(uword col=0; col < f_n_cols; ++col)
+            {
+            x.at(row,col,0) = eT(tmp[i+0]);
+            x.at(row,col,1) = eT(tmp[i+1]);
+            x.at(row,col,2) = eT(tmp[i+2]);
+            i+=3;
+            }
+          
+          }
+        
+        }
+      
+      }
+    else
+      {
+      load_okay = false;
+      err_msg = "currently no code available to handle loading ";
+      }
+      
+    if(f.good() == false)
+      {
+      load_okay = false;
+      }
+    
+    }
+  else
+    {
+    load_okay = false;
+    err_msg = "unsupported header in ";
+    }
+  
+  return load_okay;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+diskio::save_ppm_binary(const Cube<eT>& x, const std::string& final_name)
+  {
+  arma_extra_debug_sigprint();
+  
+  const std::string tmp_name = diskio::gen_tmp_name(final_name);
+  
+  std::ofstream f( tmp_name.c_str(), std::fstream::binary );
+  
+  bool save_okay = f.is_open();
+  
+  if(save_okay == true)
+    {
+    save_okay = diskio::save_ppm_binary(x, f);
+    
+    f.flush();
+    f.close();
+    
+    if(save_okay == true)
+      {
+      save_okay = diskio::safe_rename(tmp_name, final_name);
+      }
+    }
+  
+  return save_okay;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+diskio::save_ppm_binary(const Cube<eT>& x, std::ostream& f)
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_check( (x.n_slices != 3), "diskio::save_ppm_binary(): given cube must have exactly 3 slices" );
+  
+  const uword n_elem = 3 * x.n_rows * x.n_cols;
+  podarray<u8> tmp(n_elem);
+  
+  uword i = 0;
+  for(uword row=0; row < x.n_rows; ++row)
+    {
+    for(uword col=0; col < x.n_cols; ++col)
+      {
+      tmp[i+0] = u8( access::tmp_real( x.at(row,col,0) ) );
+      tmp[i+1] = u8( access::tmp_real( x.at(row,col,1) ) );
+      tmp[i+2] = u8( access::tmp_real( x.at(row,col,2) ) );
+      
+      i+=3;
+      }
+    }
+  
+  f << "P6" << '\n';
+  f << x.n_cols << '\n';
+  f << x.n_rows << '\n';
+  f << 255 << '\n';
+  
+  f.write( reinterpret_cast<const char*>(tmp.mem), std::streamsize(n_elem) );
+  
+  return f.good();
+  }
+
+
+
+//
+// handling of PPM images by fields
+
+
+
+template<typename T1>
+inline
+bool
+diskio::load_ppm_binary(field<T1>& x, const std::string& name, std::string& err_msg)
+  {
+  arma_extra_debug_sigprint();
+  
+  std::fstream f;
+  f.open(name.c_str(), std::fstream::in | std::fstream::binary);
+  
+  bool load_okay = f.is_open();
+  
+  if(load_okay == true)
+    {
+    load_okay = diskio::load_ppm_binary(x, f, err_msg);
+    f.close();
+    }
+  
+  return load_okay;
+  }
+
+
+
+template<typename T1>
+inline
+bool
+diskio::load_ppm_binary(field<T1>& x, std::istream& f, std::string& err_msg)
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_type_check(( is_Mat<T1>::value == false ));
+  typedef typename T1::elem_type eT;
+  
+  bool load_okay = true;
+  
+  std::string f_header;
+  f >> f_header;
+  
+  if(f_header == "P6")
+    {
+    uword f_n_rows = 0;
+    uword f_n_cols = 0;
+    int f_maxval = 0;
+  
+    diskio::pnm_skip_comments(f);
+  
+    f >> f_n_cols;
+    diskio::pnm_skip_comments(f);
+  
+    f >> f_n_rows;
+    diskio::pnm_skip_comments(f);
+  
+    f >> f_maxval;
+    f.get();
+    
+    if( (f_maxval > 0) || (f_maxval <= 65535) )
+      {
+      x.set_size(3);
+      Mat<eT>& R = x(0);
+      Mat<eT>& G = x(1);
+      Mat<eT>& B = x(2);
+      
+      R.set_size(f_n_rows,f_n_cols);
+      G.set_size(f_n_rows,f_n_cols);
+      B.set_size(f_n_rows,f_n_cols);
+      
+      if(f_maxval <= 255)
+        {
+        const uword n_elem = 3*f_n_cols*f_n_rows;
+        podarray<u8> tmp(n_elem);
+        
+        f.read( reinterpret_cast<char*>(tmp.memptr()), std::streamsize(n_elem) );
+        
+        uword i = 0;
+        
+        //cout << "f_n_cols = " << f_n_cols << endl;
+        //cout << "f_n_rows = " << f_n_rows << endl;
+        
+        
+        for(uword row=0; row < f_n_rows; ++row)
+          {
+          for(uword col=0; col < f_n_cols; ++col)
+            {
+            R.at(row,col) = eT(tmp[i+0]);
+            G.at(row,col) = eT(tmp[i+1]);
+            B.at(row,col) = eT(tmp[i+2]);
+            i+=3;
+            }
+          
+          }
+        }
+      else
+        {
+        const uword n_elem = 3*f_n_cols*f_n_rows;
+        podarray<u16> tmp(n_elem);
+        
+        f.read( reinterpret_cast<char *>(tmp.memptr()), std::streamsize(2*n_elem) );
+        
+        uword i = 0;
+        
+        for(uword row=0; row < f_n_rows; ++row)
+          {
+          for(uword col=0; col < f_n_cols; ++col)
+            {
+            R.at(row,col) = eT(tmp[i+0]);
+            G.at(row,col) = eT(tmp[i+1]);
+            B.at(row,col) = eT(tmp[i+2]);
+            i+=3;
+            }
+          
+          }
+        
+        }
+      
+      }
+    else
+      {
+      load_okay = false;
+      err_msg = "currently no code available to handle loading ";
+      }
+    
+    if(f.good() == false)
+      {
+      load_okay = false;
+      }
+    
+    }
+  else
+    {
+    load_okay = false;
+    err_msg = "unsupported header in ";
+    }
+  
+  return load_okay;
+  }
+
+
+
+template<typename T1>
+inline
+bool
+diskio::save_ppm_binary(const field<T1>& x, const std::string& final_name)
+  {
+  arma_extra_debug_sigprint();
+  
+  const std::string tmp_name = diskio::gen_tmp_name(final_name);
+  std::ofstream f( tmp_name.c_str(), std::fstream::binary );
+  
+  bool save_okay = f.is_open();
+  
+  if(save_okay == true)
+    {
+    save_okay = diskio::save_ppm_binary(x, f);
+    
+    f.flush();
+    f.close();
+    
+    if(save_okay == true)
+      {
+      save_okay = diskio::safe_rename(tmp_name, final_name);
+      }
+    }
+  
+  return save_okay;
+  }
+
+
+
+template<typename T1>
+inline
+bool
+diskio::save_ppm_binary(const field<T1>& x, std::ostream& f)
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_type_check(( is_Mat<T1>::value == false ));
+  
+  typedef typename T1::elem_type eT;
+  
+  arma_debug_check( (x.n_elem != 3), "diskio::save_ppm_binary(): given field must have exactly 3 matrices of equal size" );
+  
+  bool same_size = true;
+  for(uword i=1; i<3; ++i)
+    {
+    if( (x(0).n_rows != x(i).n_rows) || (x(0).n_cols != x(i).n_cols) )
+      {
+      same_size = false;
+      break;
+      }
+    }
+  
+  arma_debug_check( (same_size != true), "diskio::save_ppm_binary(): given field must have exactly 3 matrices of equal size" );
+  
+  const Mat<eT>& R = x(0);
+  const Mat<eT>& G = x(1);
+  const Mat<eT>& B = x(2);
+  
+  f << "P6" << '\n';
+  f << R.n_cols << '\n';
+  f << R.n_rows << '\n';
+  f << 255 << '\n';
+
+  const uword n_elem = 3 * R.n_rows * R.n_cols;
+  podarray<u8> tmp(n_elem);
+
+  uword i = 0;
+  for(uword row=0; row < R.n_rows; ++row)
+    {
+    for(uword col=0; col < R.n_cols; ++col)
+      {
+      tmp[i+0] = u8( access::tmp_real( R.at(row,col) ) );
+      tmp[i+1] = u8( access::tmp_real( G.at(row,col) ) );
+      tmp[i+2] = u8( access::tmp_real( B.at(row,col) ) );
+      
+      i+=3;
+      }
+    }
+  
+  f.write( reinterpret_cast<const char*>(tmp.mem), std::streamsize(n_elem) );
+  
+  return f.good();
+  }
+
+
+
+//
+// compressed binary format
+
+
+
+//! Generate the header for the arma_compressed format, eg. "ARMA_MAT_CMP_FN008";
+//! the element type is encoded as per the arma_binary format
+template<typename T1>
+inline
+std::string
+diskio::gen_cmp_header(const T1& x)
+  {
+  std::string header = diskio::gen_bin_header(x);
+  
+  header.replace(9, 3, "CMP");
+  
+  return header;
+  }
+
+
+
+//! Save an array of elements as a sequence of independently compressed blocks.
+//! Layout: number of elements per block (u32), compressed size of each block (u32), followed by the blocks.
+//! The blocks are compressed in parallel when OpenMP is enabled.
+template<typename eT>
+inline
+bool
+diskio::save_compressed_array(const eT* mem, const uword n_elem, std::ostream& f)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword block_n_elem = lz_codec::n_elem_per_block<eT>();
+  const uword n_blocks     = (n_elem + block_n_elem - 1) / block_n_elem;
+  
+  std::vector< podarray<u8> > blocks(n_blocks);
+  
+  podarray<u32> sizes(n_blocks);
+  
+  #if defined(_OPENMP)
+    #pragma omp parallel for schedule(dynamic)
+  #endif
+  for(uword b=0; b < n_blocks; ++b)
+    {
+    const uword elem_start = b * block_n_elem;
+    const uword elem_count = (std::min)(block_n_elem, n_elem - elem_start);
+    
+    podarray<u8> work;
+    
+    const uword n_used = lz_codec::encode(work, mem + elem_start, elem_count);
+    
+    blocks[b] = podarray<u8>(work.memptr(), n_used);
+    sizes[b]  = u32(n_used);
+    }
+  
+  const u32 block_n_elem_u32 = u32(block_n_elem);
+  
+  f.write( reinterpret_cast<const char*>(&block_n_elem_u32), std::streamsize(sizeof(u32))          );
+  f.write( reinterpret_cast<const char*>(sizes.memptr()),    std::streamsize(n_blocks*sizeof(u32)) );
+  
+  for(uword b=0; b < n_blocks; ++b)
+    {
+    f.write( reinterpret_cast<const char*>(blocks[b].memptr()), std::streamsize(blocks[b].n_elem) );
+    }
+  
+  return f.good();
+  }
+
+
+
+//! Load elements [elem_start, elem_start + n_elem) of an array saved by save_compressed_array();
+//! only the blocks which overlap the requested elements are read and decompressed (in parallel when OpenMP is enabled).
+//! The stream is left positioned after the end of the array.
+template<typename eT>
+inline
+bool
+diskio::load_compressed_array(eT* mem, const uword n_elem_total, const uword elem_start, const uword n_elem, std::istream& f)
+  {
+  arma_extra_debug_sigprint();
+  
+  u32 block_n_elem_u32 = 0;
+  
+  f.read( reinterpret_cast<char*>(&block_n_elem_u32), std::streamsize(sizeof(u32)) );
+  
+  const uword block_n_elem = uword(block_n_elem_u32);
+  
+  if( (f.good() == false) || (block_n_elem == 0) || ((elem_start + n_elem) > n_elem_total) )  { return false; }
+  
+  const uword n_blocks = (n_elem_total + block_n_elem - 1) / block_n_elem;
+  
+  podarray<u32> sizes(n_blocks);
+  
+  f.read( reinterpret_cast<char*>(sizes.memptr()), std::streamsize(n_blocks*sizeof(u32)) );
+  
+  const std::streampos data_pos = f.tellg();
+  
+  if( (f.good() == false) || (data_pos < 0) )  { return false; }
+  
+  podarray<uword> offsets(n_blocks + 1);
+  
+  offsets[0] = 0;
+  
+  for(uword b=0; b < n_blocks; ++b)  { offsets[b+1] = offsets[b] + uword(sizes[b]); }
+  
+  if(n_elem > 0)
+    {
+    const uword b_first = elem_start / block_n_elem;
+    const uword b_last  = (elem_start + n_elem - 1) / block_n_elem;
+    
+    podarray<u8> data(offsets[b_last + 1] - offsets[b_first]);
+    
+    f.seekg( data_pos + std::streamoff(offsets[b_first]) );
+    
+    f.read( reinterpret_cast<char*>(data.memptr()), std::streamsize(data.n_elem) );
+    
+    if(f.good() == false)  { return false; }
+    
+    uword n_bad = 0;
+    
+    #if defined(_OPENMP)
+      #pragma omp parallel for schedule(dynamic) reduction(+:n_bad)
+    #endif
+    for(uword b=b_first; b <= b_last; ++b)
+      {
+      const uword block_start = b * block_n_elem;
+      const uword block_count = (std::min)(block_n_elem, n_elem_total - block_start);
+      
+      const uword lo = (std::max)(block_start,               elem_start         );
+      const uword hi = (std::min)(block_start + block_count, elem_start + n_elem);
+      
+      const u8*   in         = data.memptr() + (offsets[b] - offsets[b_first]);
+      const uword in_n_bytes = uword(sizes[b]);
+      
+      bool status;
+      
+      if( (lo == block_start) && (hi == (block_start + block_count)) )
+        {
+        status = lz_codec::decode(mem + (block_start - elem_start), block_count, in, in_n_bytes);
+        }
+      else
+        {
+        podarray<eT> tmp(block_count);
+        
+        status = lz_codec::decode(tmp.memptr(), block_count, in, in_n_bytes);
+        
+        if(status)  { arrayops::copy( mem + (lo - elem_start), tmp.memptr() + (lo - block_start), hi - lo ); }
+        }
+      
+      if(status == false)  { ++n_bad; }
+      }
+    
+    if(n_bad > 0)  { return false; }
+    }
+  
+  f.seekg( data_pos + std::streamoff(offsets[n_blocks]) );
+  
+  return f.good();
+  }
+
+
+
+//! Save a matrix in compressed binary format,
+//! with a header that stores the matrix type as well as its dimensions
+template<typename eT>
+inline
+bool
+diskio::save_arma_compressed(const Mat<eT>& x, const std::string& final_name)
+  {
+  arma_extra_debug_sigprint();
+  
+  const std::string tmp_name = diskio::gen_tmp_name(final_name);
+  
+  std::ofstream f(tmp_name.c_str(), std::fstream::binary);
+  
+  bool save_okay = f.is_open();
+  
+  if(save_okay == true)
+    {
+    save_okay = diskio::save_arma_compressed(x, f);
+    
+    f.flush();
+    f.close();
+    
+    if(save_okay == true)
+      {
+      save_okay = diskio::safe_rename(tmp_name, final_name);
+      }
+    }
+  
+  return save_okay;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+diskio::save_arma_compressed(const Mat<eT>& x, std::ostream& f)
+  {
+  arma_extra_debug_sigprint();
+  
+  f << diskio::gen_cmp_header(x) << '\n';
+  f << x.n_rows << ' ' << x.n_cols << '\n';
+  
+  return diskio::save_compressed_array(x.memptr(), x.n_elem, f);
+  }
+
+
+
+template<typename eT>
+inline
+bool
+diskio::save_arma_compressed(const SpMat<eT>& x, const std::string& final_name)
+  {
+  arma_extra_debug_sigprint();
+  
+  const std::string tmp_name = diskio::gen_tmp_name(final_name);
+  
+  std::ofstream f(tmp_name.c_str(), std::fstream::binary);
+  
+  bool save_okay = f.is_open();
+  
+  if(save_okay == true)
+    {
+    save_okay = diskio::save_arma_compressed(x, f);
+    
+    f.flush();
+    f.close();
+    
+    if(save_okay == true)
+      {
+      save_okay = diskio::safe_rename(tmp_name, final_name);
+      }
+    }
+  
+  return save_okay;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+diskio::save_arma_compressed(const SpMat<eT>& x, std::ostream& f)
+  {
+  arma_extra_debug_sigprint();
+  
+  f << diskio::gen_cmp_header(x) << '\n';
+  f << x.n_rows << ' ' << x.n_cols << ' ' << x.n_nonzero << '\n';
+  
+  bool save_okay = true;
+  
+  save_okay = save_okay && diskio::save_compressed_array(x.values,      x.n_nonzero,  f);
+  save_okay = save_okay && diskio::save_compressed_array(x.row_indices, x.n_nonzero,  f);
+  save_okay = save_okay && diskio::save_compressed_array(x.col_ptrs,    x.n_cols + 1, f);
+  
+  return save_okay;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+diskio::save_arma_compressed(const Cube<eT>& x, const std::string& final_name)
+  {
+  arma_extra_debug_sigprint();
+  
+  const std::string tmp_name = diskio::gen_tmp_name(final_name);
+  
+  std::ofstream f(tmp_name.c_str(), std::fstream::binary);
+  
+  bool save_okay = f.is_open();
+  
+  if(save_okay == true)
+    {
+    save_okay = diskio::save_arma_compressed(x, f);
+    
+    f.flush();
+    f.close();
+    
+    if(save_okay == true)
+      {
+      save_okay = diskio::safe_rename(tmp_name, final_name);
+      }
+    }
+  
+  return save_okay;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+diskio::save_arma_compressed(const Cube<eT>& x, std::ostream& f)
+  {
+  arma_extra_debug_sigprint();
+  
+  f << diskio::gen_cmp_header(x) << '\n';
+  f << x.n_rows << ' ' << x.n_cols << ' ' << x.n_slices << '\n';
+  
+  return diskio::save_compressed_array(x.memptr(), x.n_elem, f);
+  }
+
+
+
+template<typename T1>
+inline
+bool
+diskio::save_arma_compressed(const field<T1>& x, const std::string& final_name)
+  {
+  arma_extra_debug_sigprint();
+  
+  const std::string tmp_name = diskio::gen_tmp_name(final_name);
+  
+  std::ofstream f(tmp_name.c_str(), std::fstream::binary);
+  
+  bool save_okay = f.is_open();
+  
+  if(save_okay == true)
+    {
+    save_okay = diskio::save_arma_compressed(x, f);
+    
+    f.flush();
+    f.close();
+    
+    if(save_okay == true)
+      {
+      save_okay = diskio::safe_rename(tmp_name, final_name);
+      }
+    }
+  
+  return save_okay;
+  }
+
+
+
+template<typename T1>
+inline
+bool
+diskio::save_arma_compressed(const field<T1>& x, std::ostream& f)
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_type_check(( (is_Mat<T1>::value == false) && (is_Cube<T1>::value == false) ));
+  
+  if(x.n_slices <= 1)
+    {
+    f << "ARMA_FLD_CMP" << '\n';
+    f << x.n_rows << '\n';
+    f << x.n_cols << '\n';
+    }
+  else
+    {
+    f << "ARMA_FL3_CMP" << '\n';
+    f << x.n_rows   << '\n';
+    f << x.n_cols   << '\n';
+    f << x.n_slices << '\n';
+    }
+  
+  bool save_okay = true;
+  
+  for(uword i=0; i<x.n_elem; ++i)
+    {
+    save_okay = diskio::save_arma_compressed(x[i], f);
+    
+    if(save_okay == false)
+      {
+      break;
+      }
+    }
+  
+  return save_okay;
+  }
+
+
+
+//! Load a matrix in compressed binary format
+template<typename eT>
+inline
+bool
+diskio::load_arma_compressed(Mat<eT>& x, const std::string& name, std::string& err_msg)
+  {
+  arma_extra_debug_sigprint();
+  
+  std::ifstream f;
+  f.open(name.c_str(), std::fstream::binary);
+  
+  bool load_okay = f.is_open();
+  
+  if(load_okay == true)
+    {
+    load_okay = diskio::load_arma_compressed(x, f, err_msg);
+    f.close();
+    }
+  
+  return load_okay;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+diskio::load_arma_compressed(Mat<eT>& x, std::istream& f, std::string& err_msg)
+  {
+  arma_extra_debug_sigprint();
+  
+  return diskio::load_arma_compressed_cols(x, f, span::all, err_msg);
+  }
+
+
+
+template<typename eT>
+inline
+bool
+diskio::load_arma_compressed(SpMat<eT>& x, const std::string& name, std::string& err_msg)
+  {
+  arma_extra_debug_sigprint();
+  
+  std::ifstream f;
+  f.open(name.c_str(), std::fstream::binary);
+  
+  bool load_okay = f.is_open();
+  
+  if(load_okay == true)
+    {
+    load_okay = diskio::load_arma_compressed(x, f, err_msg);
+    f.close();
+    }
+  
+  return load_okay;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+diskio::load_arma_compressed(SpMat<eT>& x, std::istream& f, std::string& err_msg)
+  {
+  arma_extra_debug_sigprint();
+  
+  std::string f_header;
+  uword       f_n_rows = 0;
+  uword       f_n_cols = 0;
+  uword       f_n_nz   = 0;
+  
+  f >> f_header;
+  f >> f_n_rows;
+  f >> f_n_cols;
+  f >> f_n_nz;
+  
+  if(f_header != diskio::gen_cmp_header(x))
+    {
+    err_msg = "incorrect header in ";
+    return false;
+    }
+  
+  f.get();
+  
+  x.set_size(f_n_rows, f_n_cols);
+  
+  x.mem_resize(f_n_nz);
+  
+  bool load_okay = f.good();
+  
+  load_okay = load_okay && diskio::load_compressed_array(access::rwp(x.values),      f_n_nz,       0, f_n_nz,       f);
+  load_okay = load_okay && diskio::load_compressed_array(access::rwp(x.row_indices), f_n_nz,       0, f_n_nz,       f);
+  load_okay = load_okay && diskio::load_compressed_array(access::rwp(x.col_ptrs),    f_n_cols + 1, 0, f_n_cols + 1, f);
+  
+  if(load_okay)
+    {
+    for(uword i=0; i < f_n_cols; ++i)  { if(x.col_ptrs[i+1] < x.col_ptrs[i])  { load_okay = false; break; } }
+    for(uword i=0; i < f_n_nz;   ++i)  { if(x.row_indices[i] >= f_n_rows)    { load_okay = false; break; } }
+    
+    if( (x.col_ptrs[0] != 0) || (x.col_ptrs[f_n_cols] != f_n_nz) )  { load_okay = false; }
+    }
+  
+  if(load_okay == false)
+    {
+    x.reset();
+    err_msg = "corrupted data in ";
+    }
+  
+  return load_okay;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+diskio::load_arma_compressed(Cube<eT>& x, const std::string& name, std::string& err_msg)
+  {
+  arma_extra_debug_sigprint();
+  
+  std::ifstream f;
+  f.open(name.c_str(), std::fstream::binary);
+  
+  bool load_okay = f.is_open();
+  
+  if(load_okay == true)
+    {
+    load_okay = diskio::load_arma_compressed(x, f, err_msg);
+    f.close();
+    }
+  
+  return load_okay;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+diskio::load_arma_compressed(Cube<eT>& x, std::istream& f, std::string& err_msg)
+  {
+  arma_extra_debug_sigprint();
+  
+  return diskio::load_arma_compressed_slices(x, f, span::all, err_msg);
+  }
+
+
+
+template<typename T1>
+inline
+bool
+diskio::load_arma_compressed(field<T1>& x, const std::string& name, std::string& err_msg)
+  {
+  arma_extra_debug_sigprint();
+  
+  std::ifstream f( name.c_str(), std::fstream::binary );
+  
+  bool load_okay = f.is_open();
+  
+  if(load_okay == true)
+    {
+    load_okay = diskio::load_arma_compressed(x, f, err_msg);
+    f.close();
+    }
+  
+  return load_okay;
+  }
+
+
+
+template<typename T1>
+inline
+bool
+diskio::load_arma_compressed(field<T1>& x, std::istream& f, std::string& err_msg)
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_type_check(( (is_Mat<T1>::value == false) && (is_Cube<T1>::value == false) ));
+  
+  bool load_okay = true;
+  
+  std::string f_type;
+  f >> f_type;
+  
+  if( (f_type == "ARMA_FLD_CMP") || (f_type == "ARMA_FL3_CMP") )
+    {
+    uword f_n_rows   = 0;
+    uword f_n_cols   = 0;
+    uword f_n_slices = 1;
+    
+    f >> f_n_rows;
+    f >> f_n_cols;
+    
+    if(f_type == "ARMA_FL3_CMP")  { f >> f_n_slices; }
+    
+    x.set_size(f_n_rows, f_n_cols, f_n_slices);
+    
+    f.get();
+    
+    for(uword i=0; i<x.n_elem; ++i)
+      {
+      load_okay = diskio::load_arma_compressed(x[i], f, err_msg);
+      
+      if(load_okay == false)
+        {
+        break;
+        }
+      }
+    }
+  else
+    {
+    load_okay = false;
+    err_msg = "unsupported field type in ";
+    }
+  
+  return load_okay;
+  }
+
+
+
+//! Load a submatrix (a range of rows and columns) of a matrix stored in arma_binary, arma_compressed or hdf5_binary format.
+//! For arma_binary and arma_compressed files only the requested columns are read;
+//! for hdf5_binary files only the requested rows and columns are read, via a hyperslab selection.
+template<typename eT>
+inline
+bool
+diskio::load_submat(Mat<eT>& x, const std::string& name, const span& row_span, const span& col_span, const file_type type, std::string& err_msg)
+  {
+  arma_extra_debug_sigprint();
+  
+  const file_type f_type = (type == auto_detect) ? diskio::guess_span_file_type(name, "ARMA_MAT_BIN", "ARMA_MAT_CMP") : type;
+  
+  if( (f_type == hdf5_binary) || (f_type == hdf5_binary_compressed) )
+    {
+    return diskio::load_hdf5_binary(x, name, row_span, col_span, err_msg);
+    }
+  
+  std::ifstream f;
+  f.open(name.c_str(), std::fstream::binary);
+  
+  if(f.is_open() == false)  { return false; }
+  
+  bool load_okay;
+  
+  switch(f_type)
+    {
+    case arma_binary:
+      load_okay = diskio::load_arma_binary_cols(x, f, col_span, err_msg);
+      break;
+    
+    case arma_compressed:
+      load_okay = diskio::load_arma_compressed_cols(x, f, col_span, err_msg);
+      break;
+    
+    default:
+      err_msg = "unsupported file type for loading a submatrix from ";
+      return false;
+    }
+  
+  if( load_okay && (row_span.whole == false) )
+    {
+    if(row_span.b >= x.n_rows)
+      {
+      err_msg = "requested rows are out of bounds in ";
+      return false;
+      }
+    
+    Mat<eT> tmp = x.rows(row_span.a, row_span.b);
+    
+    x.steal_mem(tmp);
+    }
+  
+  return load_okay;
+  }
+
+
+
+//! Load a range of slices of a cube stored in arma_binary, arma_compressed or hdf5_binary format,
+//! without reading the other slices
+template<typename eT>
+inline
+bool
+diskio::load_slices(Cube<eT>& x, const std::string& name, const span& slice_span, const file_type type, std::string& err_msg)
+  {
+  arma_extra_debug_sigprint();
+  
+  const file_type f_type = (type == auto_detect) ? diskio::guess_span_file_type(name, "ARMA_CUB_BIN", "ARMA_CUB_CMP") : type;
+  
+  if( (f_type == hdf5_binary) || (f_type == hdf5_binary_compressed) )
+    {
+    return diskio::load_hdf5_binary(x, name, slice_span, err_msg);
+    }
+  
+  std::ifstream f;
+  f.open(name.c_str(), std::fstream::binary);
+  
+  if(f.is_open() == false)  { return false; }
+  
+  switch(f_type)
+    {
+    case arma_binary:
+      return diskio::load_arma_binary_slices(x, f, slice_span, err_msg);
+      break;
+    
+    case arma_compressed:
+      return diskio::load_arma_compressed_slices(x, f, slice_span, err_msg);
+      break;
+    
+    default:
+      err_msg = "unsupported file type for loading a range of slices from ";
+      return false;
+    }
+  }
+
+
+
+//! Determine the type of a file for load_submat() and load_slices(),
+//! based on the header of the arma_binary and arma_compressed formats, as well as the signature of HDF5 files
+inline
+file_type
+diskio::guess_span_file_type(const std::string& name, const char* bin_header, const char* cmp_header)
+  {
+  arma_extra_debug_sigprint();
+  
+  std::ifstream f;
+  f.open(name.c_str(), std::fstream::binary);
+  
+  if(f.is_open() == false)  { return file_type_unknown; }
+  
+  podarray<char> raw_header(13);
+  
+  raw_header.zeros();
+  
+  f.read( raw_header.memptr(), std::streamsize(12) );
+  
+  f.close();
+  
+  const std::string header = raw_header.mem;
+  
+  if(header == bin_header)  { return arma_binary;     }
+  if(header == cmp_header)  { return arma_compressed; }
+  
+  #if defined(ARMA_USE_HDF5)
+    {
+    if(arma_H5Fis_hdf5(name.c_str()) > 0)  { return hdf5_binary; }
+    }
+  #endif
+  
+  return file_type_unknown;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+diskio::load_arma_binary_cols(Mat<eT>& x, std::istream& f, const span& col_span, std::string& err_msg)
+  {
+  arma_extra_debug_sigprint();
+  
+  std::string f_header;
+  uword       f_n_rows = 0;
+  uword       f_n_cols = 0;
+  
+  f >> f_header;
+  f >> f_n_rows;
+  f >> f_n_cols;
+  
+  if(f_header != diskio::gen_bin_header(x))
+    {
+    err_msg = "incorrect header in ";
+    return false;
+    }
+  
+  const uword col1 = (col_span.whole) ? uword(0) : col_span.a;
+  const uword col2 = (col_span.whole) ? f_n_cols : col_span.b + 1;
+  
+  if( (col1 > col2) || (col2 > f_n_cols) )
+    {
+    err_msg = "requested columns are out of bounds in ";
+    return false;
+    }
+  
+  f.get();
+  
+  const std::streampos pos = f.tellg();
+  
+  x.set_size(f_n_rows, col2 - col1);
+  
+  f.seekg( pos + std::streamoff(col1 * f_n_rows * uword(sizeof(eT))) );
+  
+  f.read( reinterpret_cast<char*>(x.memptr()), std::streamsize(x.n_elem*sizeof(eT)) );
+  
+  return f.good();
+  }
+
+
+
+template<typename eT>
+inline
+bool
+diskio::load_arma_compressed_cols(Mat<eT>& x, std::istream& f, const span& col_span, std::string& err_msg)
+  {
+  arma_extra_debug_sigprint();
+  
+  std::string f_header;
+  uword       f_n_rows = 0;
+  uword       f_n_cols = 0;
+  
+  f >> f_header;
+  f >> f_n_rows;
+  f >> f_n_cols;
+  
+  if(f_header != diskio::gen_cmp_header(x))
+    {
+    err_msg = "incorrect header in ";
+    return false;
+    }
+  
+  const uword col1 = (col_span.whole) ? uword(0) : col_span.a;
+  const uword col2 = (col_span.whole) ? f_n_cols : col_span.b + 1;
+  
+  if( (col1 > col2) || (col2 > f_n_cols) )
+    {
+    err_msg = "requested columns are out of bounds in ";
+    return false;
+    }
+  
+  f.get();
+  
+  x.set_size(f_n_rows, col2 - col1);
+  
+  const bool load_okay = f.good() && diskio::load_compressed_array(x.memptr(), f_n_rows*f_n_cols, col1*f_n_rows, x.n_elem, f);
+  
+  if(load_okay == false)  { err_msg = "corrupted data in "; }
+  
+  return load_okay;
+  }
+
+
+template<typename eT>
+inline
+bool
+diskio::load_arma_binary_slices(Cube<eT>& x, std::istream& f, const span& slice_span, std::string& err_msg)
+  {
+  arma_extra_debug_sigprint();
+  
+  std::string f_header;
+  uword       f_n_rows   = 0;
+  uword       f_n_cols   = 0;
+  uword       f_n_slices = 0;
+  
+  f >> f_header;
+  f >> f_n_rows;
+  f >> f_n_cols;
+  f >> f_n_slices;
+  
+  if(f_header != diskio::gen_bin_header(x))
+    {
+    err_msg = "incorrect header in ";
+    return false;
+    }
+  
+  const uword slice1 = (slice_span.whole) ? uword(0)   : slice_span.a;
+  const uword slice2 = (slice_span.whole) ? f_n_slices : slice_span.b + 1;
+  
+  if( (slice1 > slice2) || (slice2 > f_n_slices) )
+    {
+    err_msg = "requested slices are out of bounds in ";
+    return false;
+    }
+  
+  f.get();
+  
+  const std::streampos pos = f.tellg();
+  
+  x.set_size(f_n_rows, f_n_cols, slice2 - slice1);
+  
+  f.seekg( pos + std::streamoff(slice1 * f_n_rows * f_n_cols * uword(sizeof(eT))) );
+  
+  f.read( reinterpret_cast<char*>(x.memptr()), std::streamsize(x.n_elem*sizeof(eT)) );
+  
+  return f.good();
+  }
+
+
+
+template<typename eT>
+inline
+bool
+diskio::load_arma_compressed_slices(Cube<eT>& x, std::istream& f, const span& slice_span, std::string& err_msg)
+  {
+  arma_extra_debug_sigprint();
+  
+  std::string f_header;
+  uword       f_n_rows   = 0;
+  uword       f_n_cols   = 0;
+  uword       f_n_slices = 0;
+  
+  f >> f_header;
+  f >> f_n_rows;
+  f >> f_n_cols;
+  f >> f_n_slices;
+  
+  if(f_header != diskio::gen_cmp_header(x))
+    {
+    err_msg = "incorrect header in ";
+    return false;
+    }
+  
+  const uword slice1 = (slice_span.whole) ? uword(0)   : slice_span.a;
+  const uword slice2 = (slice_span.whole) ? f_n_slices : slice_span.b + 1;
+  
+  if( (slice1 > slice2) || (slice2 > f_n_slices) )
+    {
+    err_msg = "requested slices are out of bounds in ";
+    return false;
+    }
+  
+  f.get();
+  
+  x.set_size(f_n_rows, f_n_cols, slice2 - slice1);
+  
+  const uword n_elem_slice = f_n_rows * f_n_cols;
+  
+  const bool load_okay = f.good() && diskio::load_compressed_array(x.memptr(), n_elem_slice*f_n_slices, slice1*n_elem_slice, x.n_elem, f);
+  
+  if(load_okay == false)  { err_msg = "corrupted data in "; }
+  
+  return load_okay;
+  }
+
+
+
+//! write the header of the arma_binary format into buf (if buf is not null),
+//! with spaces before the dimensions so that the data which follows starts 16 byte aligned relative to the start of buf,
+//! as per save_arma_binary();
+//! returns the position after the header
+inline
+uword
+diskio::serialise_header(char* buf, const uword pos, const std::string& header, const std::string& dims)
+  {
+  arma_extra_debug_sigprint();
+  
+  uword out_pos = pos;
+  
+  if(buf != 0)  { std::memcpy(buf + out_pos, header.c_str(), header.length());  buf[out_pos + header.length()] = '\n'; }
+  
+  out_pos += header.length() + 1;
+  
+  const uword n_extra = (out_pos + uword(dims.length())) % uword(16);
+  const uword n_pad   = (n_extra > 0) ? (uword(16) - n_extra) : uword(0);
+  
+  if(buf != 0)  { std::memset(buf + out_pos, ' ', n_pad); }
+  
+  out_pos += n_pad;
+  
+  return diskio::serialise_bytes(buf, out_pos, dims.c_str(), uword(dims.length()));
+  }
+
+
+
+inline
+uword
+diskio::serialise_bytes(char* buf, const uword pos, const void* mem, const uword n_bytes)
+  {
+  if( (buf != 0) && (n_bytes > 0) )  { std::memcpy(buf + pos, mem, n_bytes); }
+  
+  return pos + n_bytes;
+  }
+
+
+
+//! Serialise a matrix into buf using the arma_binary format, starting at pos;
+//! if buf is null, nothing is written and only the required size is determined.
+//! Returns the position after the matrix.
+template<typename eT>
+inline
+uword
+diskio::serialise(const Mat<eT>& x, char* buf, const uword pos)
+  {
+  arma_extra_debug_sigprint();
+  
+  std::ostringstream dims;
+  
+  dims << x.n_rows << ' ' << x.n_cols << '\n';
+  
+  const uword data_pos = diskio::serialise_header(buf, pos, diskio::gen_bin_header(x), dims.str());
+  
+  return diskio::serialise_bytes(buf, data_pos, x.mem, x.n_elem*uword(sizeof(eT)));
+  }
+
+
+
+template<typename eT>
+inline
+uword
+diskio::serialise(const SpMat<eT>& x, char* buf, const uword pos)
+  {
+  arma_extra_debug_sigprint();
+  
+  std::ostringstream dims;
+  
+  dims << x.n_rows << ' ' << x.n_cols << ' ' << x.n_nonzero << '\n';
+  
+  uword out_pos = diskio::serialise_header(buf, pos, diskio::gen_bin_header(x), dims.str());
+  
+  out_pos = diskio::serialise_bytes(buf, out_pos, x.values,      x.n_nonzero*uword(sizeof(eT))      );
+  out_pos = diskio::serialise_bytes(buf, out_pos, x.row_indices, x.n_nonzero*uword(sizeof(uword))   );
+  out_pos = diskio::serialise_bytes(buf, out_pos, x.col_ptrs,    (x.n_cols+1)*uword(sizeof(uword))  );
+  
+  return out_pos;
+  }
+
+
+
+template<typename eT>
+inline
+uword
+diskio::serialise(const Cube<eT>& x, char* buf, const uword pos)
+  {
+  arma_extra_debug_sigprint();
+  
+  std::ostringstream dims;
+  
+  dims << x.n_rows << ' ' << x.n_cols << ' ' << x.n_slices << '\n';
+  
+  const uword data_pos = diskio::serialise_header(buf, pos, diskio::gen_bin_header(x), dims.str());
+  
+  return diskio::serialise_bytes(buf, data_pos, x.mem, x.n_elem*uword(sizeof(eT)));
+  }
+
+
+
+template<typename T1>
+inline
+uword
+diskio::serialise(const field<T1>& x, char* buf, const uword pos)
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_type_check(( (is_Mat<T1>::value == false) && (is_Cube<T1>::value == false) ));
+  
+  std::ostringstream header;
+  
+  if(x.n_slices <= 1)
+    {
+    header << "ARMA_FLD_BIN" << '\n' << x.n_rows << '\n' << x.n_cols << '\n';
+    }
+  else
+    {
+    header << "ARMA_FL3_BIN" << '\n' << x.n_rows << '\n' << x.n_cols << '\n' << x.n_slices << '\n';
+    }
+  
+  uword out_pos = diskio::serialise_bytes(buf, pos, header.str().c_str(), uword(header.str().length()));
+  
+  for(uword i=0; i<x.n_elem; ++i)
+    {
+    out_pos = diskio::serialise(x[i], buf, out_pos);
+    }
+  
+  return out_pos;
+  }
+
+
+
+//! read a whitespace delimited token from buf, as per operator>>
+inline
+bool
+diskio::deserialise_token(std::string& token, const char* buf, const uword buf_n_bytes, uword& pos)
+  {
+  while( (pos < buf_n_bytes) && ((buf[pos] == ' ') || (buf[pos] == '\n') || (buf[pos] == '\r') || (buf[pos] == '\t')) )  { ++pos; }
+  
+  const uword start = pos;
+  
+  while( (pos < buf_n_bytes) && (buf[pos] != ' ') && (buf[pos] != '\n') && (buf[pos] != '\r') && (buf[pos] != '\t') )  { ++pos; }
+  
+  token.assign(buf + start, pos - start);
+  
+  return (pos > start);
+  }
+
+
+
+inline
+bool
+diskio::deserialise_uword(uword& val, const char* buf, const uword buf_n_bytes, uword& pos)
+  {
+  std::string token;
+  
+  if(diskio::deserialise_token(token, buf, buf_n_bytes, pos) == false)  { return false; }
+  
+  val = 0;
+  
+  for(uword i=0; i < token.length(); ++i)
+    {
+    const char c = token[i];
+    
+    if( (c < '0') || (c > '9') )  { return false; }
+    
+    const uword digit = uword(c - '0');
+    
+    if( val > ((ARMA_MAX_UWORD - digit) / 10) )  { return false; }
+    
+    val = val*10 + digit;
+    }
+  
+  return true;
+  }
+
+
+
+//! Deserialise a matrix stored in buf using the arma_binary format, starting at pos.
+//! buf_rw is either NULL or a writable pointer to the same memory as buf;
+//! in the latter case the matrix uses the memory directly if the data is suitably aligned,
+//! as per the Mat(aux_mem, n_rows, n_cols, false, false) constructor.
+//! The dimensions in the header are checked against the size of buf before any memory is used or allocated.
+template<typename eT>
+inline
+bool
+diskio::deserialise(Mat<eT>& x, const char* buf, const uword buf_n_bytes, uword& pos, char* buf_rw)
+  {
+  arma_extra_debug_sigprint();
+  
+  std::string f_header;
+  uword       f_n_rows = 0;
+  uword       f_n_cols = 0;
+  
+  if(diskio::deserialise_token(f_header, buf, buf_n_bytes, pos) == false)  { return false; }
+  
+  if(f_header != diskio::gen_bin_header(x))  { return false; }
+  
+  if(diskio::deserialise_uword(f_n_rows, buf, buf_n_bytes, pos) == false)  { return false; }
+  if(diskio::deserialise_uword(f_n_cols, buf, buf_n_bytes, pos) == false)  { return false; }
+  
+  if(pos >= buf_n_bytes)  { return false; }
+  
+  ++pos;
+  
+  const uword max_n_elem = ARMA_MAX_UWORD / uword(sizeof(eT));
+  
+  if( (f_n_rows > 0) && (f_n_cols > (max_n_elem / f_n_rows)) )  { return false; }
+  
+  const uword n_bytes = f_n_rows*f_n_cols*uword(sizeof(eT));
+  
+  if(n_bytes > (buf_n_bytes - pos))  { return false; }
+  
+  const char* data = buf + pos;
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  if( (buf_rw != NULL) && ((std::size_t(data) % sizeof(T)) == 0) )
+    {
+    Mat<eT> tmp( reinterpret_cast<eT*>(buf_rw + pos), f_n_rows, f_n_cols, false, false );
+    
+    x.steal_mem(tmp);
+    }
+  else
+    {
+    x.set_size(f_n_rows, f_n_cols);
+    
+    diskio::serialise_bytes(reinterpret_cast<char*>(x.memptr()), 0, data, n_bytes);
+    }
+  
+  pos += n_bytes;
+  
+  return true;
   }
 
 
 
-
-
-// fields
+//! Deserialise a sparse matrix stored in buf using the arma_binary format, starting at pos.
+//! The data is always copied, as sparse matrices don't use auxiliary memory.
+template<typename eT>
+inline
+bool
+diskio::deserialise(SpMat<eT>& x, const char* buf, const uword buf_n_bytes, uword& pos, char* buf_rw)
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(buf_rw);
+  
+  std::string f_header;
+  uword       f_n_rows = 0;
+  uword       f_n_cols = 0;
+  uword       f_n_nz   = 0;
+  
+  if(diskio::deserialise_token(f_header, buf, buf_n_bytes, pos) == false)  { return false; }
+  
+  if(f_header != diskio::gen_bin_header(x))  { return false; }
+  
+  if(diskio::deserialise_uword(f_n_rows, buf, buf_n_bytes, pos) == false)  { return false; }
+  if(diskio::deserialise_uword(f_n_cols, buf, buf_n_bytes, pos) == false)  { return false; }
+  if(diskio::deserialise_uword(f_n_nz,   buf, buf_n_bytes, pos) == false)  { return false; }
+  
+  if(pos >= buf_n_bytes)  { return false; }
+  
+  ++pos;
+  
+  if( f_n_nz   >  (ARMA_MAX_UWORD / uword(sizeof(eT) + sizeof(uword))) )  { return false; }
+  if( f_n_cols >= (ARMA_MAX_UWORD / uword(sizeof(uword)))              )  { return false; }
+  
+  const uword n_bytes_values  = f_n_nz*uword(sizeof(eT));
+  const uword n_bytes_indices = f_n_nz*uword(sizeof(uword));
+  const uword n_bytes_ptrs    = (f_n_cols+1)*uword(sizeof(uword));
+  
+  const uword n_bytes_avail = buf_n_bytes - pos;
+  
+  if( n_bytes_ptrs > n_bytes_avail )                                       { return false; }
+  if( (n_bytes_values + n_bytes_indices) > (n_bytes_avail - n_bytes_ptrs) )  { return false; }
+  
+  SpMat<eT> tmp(f_n_rows, f_n_cols);
+  
+  tmp.mem_resize(f_n_nz);
+  
+  pos += n_bytes_values;   std::memcpy( access::rwp(tmp.values),      buf + pos - n_bytes_values,  n_bytes_values  );
+  pos += n_bytes_indices;  std::memcpy( access::rwp(tmp.row_indices), buf + pos - n_bytes_indices, n_bytes_indices );
+  pos += n_bytes_ptrs;     std::memcpy( access::rwp(tmp.col_ptrs),    buf + pos - n_bytes_ptrs,    n_bytes_ptrs    );
+  
+  // reject data which would break the invariants of the CSC layout
+  
+  if(tmp.col_ptrs[f_n_cols] != f_n_nz)  { return false; }
+  
+  for(uword i=0; i < f_n_cols; ++i)  { if(tmp.col_ptrs[i+1] < tmp.col_ptrs[i])  { return false; } }
+  for(uword i=0; i < f_n_nz;   ++i)  { if(tmp.row_indices[i] >= f_n_rows)       { return false; } }
+  
+  x.steal_mem(tmp);
+  
+  return true;
+  }
 
 
 
-template<typename T1>
+//! Deserialise a cube stored in buf using the arma_binary format, starting at pos.
+//! If buf_rw is not NULL and the data is suitably aligned, the cube uses the memory of buf directly (see the matrix version).
+template<typename eT>
 inline
 bool
-diskio::save_arma_binary(const field<T1>& x, const std::string& final_name)
+diskio::deserialise(Cube<eT>& x, const char* buf, const uword buf_n_bytes, uword& pos, char* buf_rw)
   {
   arma_extra_debug_sigprint();
   
-  const std::string tmp_name = diskio::gen_tmp_name(final_name);
+  std::string f_header;
+  uword       f_n_rows   = 0;
+  uword       f_n_cols   = 0;
+  uword       f_n_slices = 0;
   
-  std::ofstream f( tmp_name.c_str(), std::fstream::binary );
+  if(diskio::deserialise_token(f_header, buf, buf_n_bytes, pos) == false)  { return false; }
   
-  bool save_okay = f.is_open();
+  if(f_header != diskio::gen_bin_header(x))  { return false; }
   
-  if(save_okay == true)
+  if(diskio::deserialise_uword(f_n_rows,   buf, buf_n_bytes, pos) == false)  { return false; }
+  if(diskio::deserialise_uword(f_n_cols,   buf, buf_n_bytes, pos) == false)  { return false; }
+  if(diskio::deserialise_uword(f_n_slices, buf, buf_n_bytes, pos) == false)  { return false; }
+  
+  if(pos >= buf_n_bytes)  { return false; }
+  
+  ++pos;
+  
+  const uword max_n_elem = ARMA_MAX_UWORD / uword(sizeof(eT));
+  
+  if( (f_n_rows > 0) && (f_n_cols > (max_n_elem / f_n_rows)) )  { return false; }
+  
+  const uword n_elem_slice = f_n_rows*f_n_cols;
+  
+  if( (n_elem_slice > 0) && (f_n_slices > (max_n_elem / n_elem_slice)) )  { return false; }
+  
+  const uword n_bytes = n_elem_slice*f_n_slices*uword(sizeof(eT));
+  
+  if(n_bytes > (buf_n_bytes - pos))  { return false; }
+  
+  const char* data = buf + pos;
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  if( (buf_rw != NULL) && ((std::size_t(data) % sizeof(T)) == 0) )
     {
-    save_okay = diskio::save_arma_binary(x, f);
+    Cube<eT> tmp( reinterpret_cast<eT*>(buf_rw + pos), f_n_rows, f_n_cols, f_n_slices, false, false );
     
-    f.flush();
-    f.close();
+    x.steal_mem(tmp);
+    }
+  else
+    {
+    x.set_size(f_n_rows, f_n_cols, f_n_slices);
     
-    if(save_okay == true)
-      {
-      save_okay = diskio::safe_rename(tmp_name, final_name);
-      }
+    diskio::serialise_bytes(reinterpret_cast<char*>(x.memptr()), 0, data, n_bytes);
     }
   
-  return save_okay;
+  pos += n_bytes;
+  
+  return true;
   }
 
 
@@ -4026,383 +7449,389 @@ diskio::save_arma_binary(const field<T1>& x, const std::string& final_name)
 template<typename T1>
 inline
 bool
-diskio::save_arma_binary(const field<T1>& x, std::ostream& f)
+diskio::deserialise(field<T1>& x, const char* buf, const uword buf_n_bytes, uword& pos, char* buf_rw)
   {
   arma_extra_debug_sigprint();
   
   arma_type_check(( (is_Mat<T1>::value == false) && (is_Cube<T1>::value == false) ));
   
-  if(x.n_slices <= 1)
-    {
-    f << "ARMA_FLD_BIN" << '\n';
-    f << x.n_rows << '\n';
-    f << x.n_cols << '\n';
-    }
-  else
+  std::string f_type;
+  
+  if(diskio::deserialise_token(f_type, buf, buf_n_bytes, pos) == false)  { return false; }
+  
+  if( (f_type != "ARMA_FLD_BIN") && (f_type != "ARMA_FL3_BIN") )  { return false; }
+  
+  uword f_n_rows   = 0;
+  uword f_n_cols   = 0;
+  uword f_n_slices = 1;
+  
+  if(diskio::deserialise_uword(f_n_rows, buf, buf_n_bytes, pos) == false)  { return false; }
+  if(diskio::deserialise_uword(f_n_cols, buf, buf_n_bytes, pos) == false)  { return false; }
+  
+  if(f_type == "ARMA_FL3_BIN")
     {
-    f << "ARMA_FL3_BIN" << '\n';
-    f << x.n_rows   << '\n';
-    f << x.n_cols   << '\n';
-    f << x.n_slices << '\n';
+    if(diskio::deserialise_uword(f_n_slices, buf, buf_n_bytes, pos) == false)  { return false; }
     }
   
-  bool save_okay = true;
+  // each object takes at least one byte, which bounds the number of objects
+  
+  const uword max_n_elem = buf_n_bytes - pos;
+  
+  if( (f_n_rows > 0) && (f_n_cols > (max_n_elem / f_n_rows)) )  { return false; }
+  
+  const uword n_elem_slice = f_n_rows*f_n_cols;
+  
+  if( (n_elem_slice > 0) && (f_n_slices > (max_n_elem / n_elem_slice)) )  { return false; }
+  
+  x.set_size(f_n_rows, f_n_cols, f_n_slices);
   
   for(uword i=0; i<x.n_elem; ++i)
     {
-    save_okay = diskio::save_arma_binary(x[i], f);
-    
-    if(save_okay == false)
-      {
-      break;
-      }
+    if(diskio::deserialise(x[i], buf, buf_n_bytes, pos, buf_rw) == false)  { return false; }
     }
   
-  return save_okay;
+  return true;
   }
 
 
 
-template<typename T1>
+
+//
+// NumPy .npy format
+
+
+
+//! Generate the NumPy element type descriptor for eT, eg. "<f8" for double on little endian systems
+template<typename eT>
 inline
-bool
-diskio::load_arma_binary(field<T1>& x, const std::string& name, std::string& err_msg)
+std::string
+diskio::gen_npy_descr()
   {
-  arma_extra_debug_sigprint();
+  arma_type_check(( is_supported_elem_type<eT>::value == false ));
   
-  std::ifstream f( name.c_str(), std::fstream::binary );
+  union
+    {
+    unsigned short a;
+    unsigned char  b[sizeof(unsigned short)];
+    } endian_test;
   
-  bool load_okay = f.is_open();
+  endian_test.a = 1;
   
-  if(load_okay == true)
-    {
-    load_okay = diskio::load_arma_binary(x, f, err_msg);
-    f.close();
-    }
+  const char order = (sizeof(eT) == 1) ? '|' : ( (endian_test.b[0] == 1) ? '<' : '>' );
   
-  return load_okay;
+  const char kind = (is_cx<eT>::yes) ? 'c' : ( (is_non_integral<eT>::value) ? 'f' : ( (is_signed<eT>::value) ? 'i' : 'u' ) );
+  
+  std::ostringstream descr;
+  
+  descr << order << kind << sizeof(eT);
+  
+  return descr.str();
   }
 
 
 
-template<typename T1>
+//! Generate the header of a .npy file (format version 1.0).
+//! The header is padded with spaces so that the data starts at a multiple of 64 bytes,
+//! which keeps the data aligned when the file is memory mapped.
+inline
+std::string
+diskio::gen_npy_header(const std::string& descr, const bool fortran_order, const std::string& shape)
+  {
+  std::string dict = "{'descr': '" + descr + "', 'fortran_order': " + (fortran_order ? "True" : "False") + ", 'shape': " + shape + ", }";
+  
+  // magic string (6 bytes), version (2 bytes), length of the dictionary (2 bytes), dictionary, newline
+  const uword n_used = 10 + uword(dict.length()) + 1;
+  
+  dict.append( (64 - (n_used % 64)) % 64, ' ' );
+  dict.push_back('\n');
+  
+  const uword dict_len = uword(dict.length());
+  
+  std::string header("\x93NUMPY", 6);
+  
+  header.push_back( char(1) );
+  header.push_back( char(0) );
+  header.push_back( char( dict_len       & 0xFF) );
+  header.push_back( char((dict_len >> 8) & 0xFF) );
+  
+  return header + dict;
+  }
+
+
+
+//! Read the header of a .npy file (format versions 1.0, 2.0 and 3.0)
+//! and extract the element type descriptor, the ordering of the data and the dimensions.
+//! The stream is left at the start of the data.
 inline
 bool
-diskio::load_arma_binary(field<T1>& x, std::istream& f, std::string& err_msg)
+diskio::read_npy_header(std::istream& f, std::string& descr, bool& fortran_order, podarray<uword>& shape)
   {
   arma_extra_debug_sigprint();
   
-  arma_type_check(( (is_Mat<T1>::value == false) && (is_Cube<T1>::value == false) ));
+  unsigned char prefix[8];
   
-  bool load_okay = true;
+  f.read(reinterpret_cast<char*>(prefix), 8);
   
-  std::string f_type;
-  f >> f_type;
+  if( (f.good() == false) || (std::memcmp(prefix, "\x93NUMPY", 6) != 0) )  { return false; }
   
-  if(f_type == "ARMA_FLD_BIN")
-    {
-    uword f_n_rows;
-    uword f_n_cols;
+  uword dict_len = 0;
   
-    f >> f_n_rows;
-    f >> f_n_cols;
-    
-    x.set_size(f_n_rows, f_n_cols);
+  if(prefix[6] == 1)
+    {
+    unsigned char len[2];
     
-    f.get();      
+    f.read(reinterpret_cast<char*>(len), 2);
     
-    for(uword i=0; i<x.n_elem; ++i)
-      {
-      load_okay = diskio::load_arma_binary(x[i], f, err_msg);
-      
-      if(load_okay == false)
-        {
-        break;
-        }
-      }
+    dict_len = uword(len[0]) | (uword(len[1]) << 8);
     }
   else
-  if(f_type == "ARMA_FL3_BIN")
+  if( (prefix[6] == 2) || (prefix[6] == 3) )
     {
-    uword f_n_rows;
-    uword f_n_cols;
-    uword f_n_slices;
-  
-    f >> f_n_rows;
-    f >> f_n_cols;
-    f >> f_n_slices;
-    
-    x.set_size(f_n_rows, f_n_cols, f_n_slices);
+    unsigned char len[4];
     
-    f.get();      
+    f.read(reinterpret_cast<char*>(len), 4);
     
-    for(uword i=0; i<x.n_elem; ++i)
-      {
-      load_okay = diskio::load_arma_binary(x[i], f, err_msg);
-      
-      if(load_okay == false)
-        {
-        break;
-        }
-      }
+    dict_len = uword(len[0]) | (uword(len[1]) << 8) | (uword(len[2]) << 16) | (uword(len[3]) << 24);
     }
   else
     {
-    load_okay = false;
-    err_msg = "unsupported field type in ";
+    return false;
     }
   
-  return load_okay;
-  }
-
-
-
-inline
-bool
-diskio::save_std_string(const field<std::string>& x, const std::string& final_name)
-  {
-  arma_extra_debug_sigprint();
+  if( (f.good() == false) || (dict_len == 0) )  { return false; }
   
-  const std::string tmp_name = diskio::gen_tmp_name(final_name);
+  std::string dict(dict_len, ' ');
   
-  std::ofstream f( tmp_name.c_str(), std::fstream::binary );
+  f.read(&dict[0], std::streamsize(dict_len));
   
-  bool save_okay = f.is_open();
+  if(f.good() == false)  { return false; }
   
-  if(save_okay == true)
-    {
-    save_okay = diskio::save_std_string(x, f);
-    
-    f.flush();
-    f.close();
-    
-    if(save_okay == true)
-      {
-      save_okay = diskio::safe_rename(tmp_name, final_name);
-      }
-    }
+  const std::string::size_type descr_pos   = dict.find(':', dict.find("'descr'"));
+  const std::string::size_type fortran_pos = dict.find(':', dict.find("'fortran_order'"));
+  const std::string::size_type shape_pos   = dict.find(':', dict.find("'shape'"));
   
-  return save_okay;
-  }
-
-
-
-inline
-bool
-diskio::save_std_string(const field<std::string>& x, std::ostream& f)
-  {
-  arma_extra_debug_sigprint();
+  if( (descr_pos == std::string::npos) || (fortran_pos == std::string::npos) || (shape_pos == std::string::npos) )  { return false; }
   
-  for(uword row=0; row<x.n_rows; ++row)
-  for(uword col=0; col<x.n_cols; ++col)
+  // element type: a quoted string; structured types (lists of fields) are not supported
+  
+  const std::string::size_type descr_start = dict.find_first_not_of(' ', descr_pos + 1);
+  
+  if( (descr_start == std::string::npos) || ((dict[descr_start] != '\'') && (dict[descr_start] != '"')) )  { return false; }
+  
+  const std::string::size_type descr_end = dict.find(dict[descr_start], descr_start + 1);
+  
+  if(descr_end == std::string::npos)  { return false; }
+  
+  descr = dict.substr(descr_start + 1, descr_end - descr_start - 1);
+  
+  // ordering of the data
+  
+  const std::string::size_type fortran_start = dict.find_first_not_of(' ', fortran_pos + 1);
+  
+  if(fortran_start == std::string::npos)  { return false; }
+  
+       if(dict.compare(fortran_start, 4, "True" ) == 0)  { fortran_order = true;  }
+  else if(dict.compare(fortran_start, 5, "False") == 0)  { fortran_order = false; }
+  else                                                   { return false;          }
+  
+  // dimensions: a tuple of integers, eg. "(4, 5)", "(4,)" or "()"
+  
+  const std::string::size_type shape_start = dict.find_first_not_of(' ', shape_pos + 1);
+  
+  if( (shape_start == std::string::npos) || (dict[shape_start] != '(') )  { return false; }
+  
+  const std::string::size_type shape_end = dict.find(')', shape_start);
+  
+  if(shape_end == std::string::npos)  { return false; }
+  
+  const uword max_n_dims = 32;
+  
+  uword dims[max_n_dims];
+  uword n_dims    = 0;
+  bool  in_number = false;
+  
+  for(std::string::size_type i = shape_start + 1; i < shape_end; ++i)
     {
-    f << x.at(row,col);
+    const char c = dict[i];
     
-    if(col < x.n_cols-1)
+    if( (c >= '0') && (c <= '9') )
       {
-      f << ' ';
+      if(in_number == false)
+        {
+        if(n_dims >= max_n_dims)  { return false; }
+        
+        dims[n_dims] = 0;
+        
+        ++n_dims;
+        
+        in_number = true;
+        }
+      
+      dims[n_dims-1] = dims[n_dims-1] * 10 + uword(c - '0');
       }
     else
       {
-      f << '\n';
+      // files written by Python 2 may have integers with the 'L' suffix
+      if( (c != ',') && (c != ' ') && (c != 'L') )  { return false; }
+      
+      in_number = false;
       }
     }
   
-  return f.good();
+  shape.set_size(n_dims);
+  
+  arrayops::copy(shape.memptr(), dims, n_dims);
+  
+  return true;
   }
 
 
 
+//! reverse the order of bytes in each word
 inline
-bool
-diskio::load_std_string(field<std::string>& x, const std::string& name, std::string& err_msg)
+void
+diskio::npy_swap_bytes(char* mem, const uword n_bytes, const uword word_size)
   {
-  arma_extra_debug_sigprint();
-  
-  std::ifstream f( name.c_str() );
-  
-  bool load_okay = f.is_open();
-  
-  if(load_okay == true)
+  for(uword i=0; (i + word_size) <= n_bytes; i += word_size)
     {
-    load_okay = diskio::load_std_string(x, f, err_msg);
-    f.close();
+    char* a = mem + i;
+    char* b = mem + i + word_size - 1;
+    
+    while(a < b)  { std::swap(*a, *b);  ++a;  --b; }
     }
-  
-  return load_okay;
   }
 
 
 
+//! read n_elem elements of type fT, converting from the byte order of the file if required
+template<typename fT>
 inline
 bool
-diskio::load_std_string(field<std::string>& x, std::istream& f, std::string& err_msg)
+diskio::read_npy_elem(podarray<fT>& tmp, const uword n_elem, const bool swap, std::istream& f)
   {
   arma_extra_debug_sigprint();
   
-  bool load_okay = true;
-  
-  //
-  // work out the size
-  
-  uword f_n_rows = 0;
-  uword f_n_cols = 0;
-  
-  bool f_n_cols_found = false;
-  
-  std::string line_string;
-  std::string token;
+  tmp.set_size(n_elem);
   
-  while( (f.good() == true) && (load_okay == true) )
-    {
-    std::getline(f, line_string);
-    if(line_string.size() == 0)
-      break;
-    
-    std::stringstream line_stream(line_string);
-    
-    uword line_n_cols = 0;
-    while (line_stream >> token)
-      line_n_cols++;
-    
-    if(f_n_cols_found == false)
-      {
-      f_n_cols = line_n_cols;
-      f_n_cols_found = true;
-      }
-    else
-      {
-      if(line_n_cols != f_n_cols)
-        {
-        load_okay = false;
-        err_msg = "inconsistent number of columns in ";
-        }
-      }
-    
-    ++f_n_rows;
-    }
-    
-  if(load_okay == true)
-    {
-    f.clear();
-    f.seekg(0, ios::beg);
-    //f.seekg(start);
-    
-    x.set_size(f_n_rows, f_n_cols);
+  const uword n_bytes = n_elem * uword(sizeof(fT));
   
-    for(uword row=0; row < x.n_rows; ++row)
-      {
-      for(uword col=0; col < x.n_cols; ++col)
-        {
-        f >> x.at(row,col);
-        }
-      }
-    }
+  f.read(reinterpret_cast<char*>(tmp.memptr()), std::streamsize(n_bytes));
   
-  if(f.good() == false)
-    {
-    load_okay = false; 
-    }
+  if(swap)  { diskio::npy_swap_bytes(reinterpret_cast<char*>(tmp.memptr()), n_bytes, uword(sizeof(typename get_pod_type<fT>::result))); }
   
-  return load_okay;
+  return f.good();
   }
 
 
 
-//! Try to load a field by automatically determining its type
-template<typename T1>
+//! read n_elem elements of type fT and convert them to eT
+template<typename eT, typename fT>
 inline
 bool
-diskio::load_auto_detect(field<T1>& x, const std::string& name, std::string& err_msg)
+diskio::read_npy_elem(eT* mem, const uword n_elem, const bool swap, std::istream& f)
   {
   arma_extra_debug_sigprint();
   
-  std::fstream f;
-  f.open(name.c_str(), std::fstream::in | std::fstream::binary);
+  podarray<fT> tmp;
   
-  bool load_okay = f.is_open();
+  const bool load_okay = diskio::read_npy_elem(tmp, n_elem, swap, f);
   
-  if(load_okay == true)
-    {
-    load_okay = diskio::load_auto_detect(x, f, err_msg);
-    f.close();
-    }
+  if(load_okay)  { arrayops::convert(mem, tmp.memptr(), n_elem); }
   
   return load_okay;
   }
 
 
 
-//! Try to load a field by automatically determining its type
-template<typename T1>
+//! Read the data of a .npy file into mem.
+//! The data is converted if its element type or byte order differs from eT;
+//! complex data can't be loaded into a real matrix.
+template<typename eT>
 inline
 bool
-diskio::load_auto_detect(field<T1>& x, std::istream& f, std::string& err_msg)
+diskio::read_npy_data(eT* mem, const uword n_elem, const std::string& descr, std::istream& f, std::string& err_msg)
   {
   arma_extra_debug_sigprint();
   
-  arma_type_check(( is_Mat<T1>::value == false ));
-  
-  static const std::string ARMA_FLD_BIN = "ARMA_FLD_BIN";
-  static const std::string ARMA_FL3_BIN = "ARMA_FL3_BIN";
-  static const std::string           P6 = "P6";
-  
-  podarray<char> raw_header(uword(ARMA_FLD_BIN.length()) + 1);
-  
-  std::streampos pos = f.tellg();
+  if(descr == diskio::gen_npy_descr<eT>())
+    {
+    f.read(reinterpret_cast<char*>(mem), std::streamsize(n_elem*uword(sizeof(eT))));
+    
+    return f.good();
+    }
   
-  f.read( raw_header.memptr(), std::streamsize(ARMA_FLD_BIN.length()) );
+  if(descr.length() < 3)  { err_msg = "unsupported element type in ";  return false; }
   
-  f.clear();
-  f.seekg(pos);
+  const char        order     = descr[0];
+  const std::string kind_size = descr.substr(1);
+  const bool        swap      = ( (order == '<') || (order == '>') ) && (order != diskio::gen_npy_descr<double>()[0]);
   
-  raw_header[uword(ARMA_FLD_BIN.length())] = '\0';
+       if( (kind_size == "b1") || (kind_size == "u1") )  { return diskio::read_npy_elem<eT, u8    >(mem, n_elem, swap, f); }
+  else if(  kind_size == "i1"                         )  { return diskio::read_npy_elem<eT, s8    >(mem, n_elem, swap, f); }
+  else if(  kind_size == "u2"                         )  { return diskio::read_npy_elem<eT, u16   >(mem, n_elem, swap, f); }
+  else if(  kind_size == "i2"                         )  { return diskio::read_npy_elem<eT, s16   >(mem, n_elem, swap, f); }
+  else if(  kind_size == "u4"                         )  { return diskio::read_npy_elem<eT, u32   >(mem, n_elem, swap, f); }
+  else if(  kind_size == "i4"                         )  { return diskio::read_npy_elem<eT, s32   >(mem, n_elem, swap, f); }
+#if defined(ARMA_USE_U64S64)
+  else if(  kind_size == "u8"                         )  { return diskio::read_npy_elem<eT, u64   >(mem, n_elem, swap, f); }
+  else if(  kind_size == "i8"                         )  { return diskio::read_npy_elem<eT, s64   >(mem, n_elem, swap, f); }
+#endif
+  else if(  kind_size == "f4"                         )  { return diskio::read_npy_elem<eT, float >(mem, n_elem, swap, f); }
+  else if(  kind_size == "f8"                         )  { return diskio::read_npy_elem<eT, double>(mem, n_elem, swap, f); }
   
-  const std::string header = raw_header.mem;
+  err_msg = "unsupported element type in ";
   
-  if(ARMA_FLD_BIN == header.substr(0, ARMA_FLD_BIN.length()))
-    {
-    return load_arma_binary(x, f, err_msg);
-    }
-  else
-  if(ARMA_FL3_BIN == header.substr(0, ARMA_FL3_BIN.length()))
-    {
-    return load_arma_binary(x, f, err_msg);
-    }
-  else
-  if(P6 == header.substr(0, P6.length()))
-    {
-    return load_ppm_binary(x, f, err_msg);
-    }
-  else
-    {
-    err_msg = "unsupported header in ";
-    return false;
-    }
+  return false;
   }
 
 
 
-//
-// handling of PPM images by cubes
-
-
-template<typename eT>
+//! Read the data of a .npy file into mem;
+//! only complex data can be loaded into a complex matrix
+template<typename T>
 inline
 bool
-diskio::load_ppm_binary(Cube<eT>& x, const std::string& name, std::string& err_msg)
+diskio::read_npy_data(std::complex<T>* mem, const uword n_elem, const std::string& descr, std::istream& f, std::string& err_msg)
   {
   arma_extra_debug_sigprint();
   
-  std::fstream f;
-  f.open(name.c_str(), std::fstream::in | std::fstream::binary);
+  typedef std::complex<T> eT;
   
-  bool load_okay = f.is_open();
+  if(descr == diskio::gen_npy_descr<eT>())
+    {
+    f.read(reinterpret_cast<char*>(mem), std::streamsize(n_elem*uword(sizeof(eT))));
+    
+    return f.good();
+    }
   
-  if(load_okay == true)
+  if(descr.length() < 3)  { err_msg = "unsupported element type in ";  return false; }
+  
+  const char        order     = descr[0];
+  const std::string kind_size = descr.substr(1);
+  const bool        swap      = ( (order == '<') || (order == '>') ) && (order != diskio::gen_npy_descr<double>()[0]);
+  
+  bool load_okay = false;
+  
+  if(kind_size == "c8")
     {
-    load_okay = diskio::load_ppm_binary(x, f, err_msg);
-    f.close();
+    podarray< std::complex<float> > tmp;
+    
+    load_okay = diskio::read_npy_elem(tmp, n_elem, swap, f);
+    
+    if(load_okay)  { arrayops::convert_cx(mem, tmp.memptr(), n_elem); }
+    }
+  else
+  if(kind_size == "c16")
+    {
+    podarray< std::complex<double> > tmp;
+    
+    load_okay = diskio::read_npy_elem(tmp, n_elem, swap, f);
+    
+    if(load_okay)  { arrayops::convert_cx(mem, tmp.memptr(), n_elem); }
+    }
+  else
+    {
+    err_msg = "unsupported element type in ";
     }
   
   return load_okay;
@@ -4410,127 +7839,56 @@ diskio::load_ppm_binary(Cube<eT>& x, const std::string& name, std::string& err_m
 
 
 
+//! Save a matrix in the NumPy .npy format, using column-major (Fortran) ordering.
+//! Column vectors are saved as one dimensional arrays.
 template<typename eT>
 inline
 bool
-diskio::load_ppm_binary(Cube<eT>& x, std::istream& f, std::string& err_msg)
+diskio::save_npy_binary(const Mat<eT>& x, const std::string& final_name)
   {
   arma_extra_debug_sigprint();
   
-  bool load_okay = true;
-  
-  std::string f_header;
-  f >> f_header;
-  
-  if(f_header == "P6")
-    {
-    uword f_n_rows = 0;
-    uword f_n_cols = 0;
-    int f_maxval = 0;
-  
-    diskio::pnm_skip_comments(f);
+  const std::string tmp_name = diskio::gen_tmp_name(final_name);
   
-    f >> f_n_cols;
-    diskio::pnm_skip_comments(f);
+  std::ofstream f(tmp_name.c_str(), std::fstream::binary);
   
-    f >> f_n_rows;
-    diskio::pnm_skip_comments(f);
+  bool save_okay = f.is_open();
   
-    f >> f_maxval;
-    f.get();
+  if(save_okay == true)
+    {
+    save_okay = diskio::save_npy_binary(x, f);
     
-    if( (f_maxval > 0) || (f_maxval <= 65535) )
-      {
-      x.set_size(f_n_rows, f_n_cols, 3);
-      
-      if(f_maxval <= 255)
-        {
-        const uword n_elem = 3*f_n_cols*f_n_rows;
-        podarray<u8> tmp(n_elem);
-        
-        f.read( reinterpret_cast<char*>(tmp.memptr()), std::streamsize(n_elem) );
-        
-        uword i = 0;
-        
-        //cout << "f_n_cols = " << f_n_cols << endl;
-        //cout << "f_n_rows = " << f_n_rows << endl;
-        
-        
-        for(uword row=0; row < f_n_rows; ++row)
-          {
-          for(uword col=0; col < f_n_cols; ++col)
-            {
-            x.at(row,col,0) = eT(tmp[i+0]);
-            x.at(row,col,1) = eT(tmp[i+1]);
-            x.at(row,col,2) = eT(tmp[i+2]);
-            i+=3;
-            }
-          
-          }
-        }
-      else
-        {
-        const uword n_elem = 3*f_n_cols*f_n_rows;
-        podarray<u16> tmp(n_elem);
-        
-        f.read( reinterpret_cast<char *>(tmp.memptr()), std::streamsize(2*n_elem) );
-        
-        uword i = 0;
-        
-        for(uword row=0; row < f_n_rows; ++row)
-          {
-          for(uword col=0; col < f_n_cols; ++col)
-            {
-            x.at(row,col,0) = eT(tmp[i+0]);
-            x.at(row,col,1) = eT(tmp[i+1]);
-            x.at(row,col,2) = eT(tmp[i+2]);
-            i+=3;
-            }
-          
-          }
-        
-        }
-      
-      }
-    else
-      {
-      load_okay = false;
-      err_msg = "currently no code available to handle loading ";
-      }
-      
-    if(f.good() == false)
+    f.flush();
+    f.close();
+    
+    if(save_okay == true)
       {
-      load_okay = false;
+      save_okay = diskio::safe_rename(tmp_name, final_name);
       }
-    
-    }
-  else
-    {
-    load_okay = false;
-    err_msg = "unsupported header in ";
     }
   
-  return load_okay;
+  return save_okay;
   }
 
 
 
+//! Save a cube in the NumPy .npy format, using column-major (Fortran) ordering
 template<typename eT>
 inline
 bool
-diskio::save_ppm_binary(const Cube<eT>& x, const std::string& final_name)
+diskio::save_npy_binary(const Cube<eT>& x, const std::string& final_name)
   {
   arma_extra_debug_sigprint();
   
   const std::string tmp_name = diskio::gen_tmp_name(final_name);
   
-  std::ofstream f( tmp_name.c_str(), std::fstream::binary );
+  std::ofstream f(tmp_name.c_str(), std::fstream::binary);
   
   bool save_okay = f.is_open();
   
   if(save_okay == true)
     {
-    save_okay = diskio::save_ppm_binary(x, f);
+    save_okay = diskio::save_npy_binary(x, f);
     
     f.flush();
     f.close();
@@ -4549,60 +7907,65 @@ diskio::save_ppm_binary(const Cube<eT>& x, const std::string& final_name)
 template<typename eT>
 inline
 bool
-diskio::save_ppm_binary(const Cube<eT>& x, std::ostream& f)
+diskio::save_npy_binary(const Mat<eT>& x, std::ostream& f)
   {
   arma_extra_debug_sigprint();
   
-  arma_debug_check( (x.n_slices != 3), "diskio::save_ppm_binary(): given cube must have exactly 3 slices" );
-  
-  const uword n_elem = 3 * x.n_rows * x.n_cols;
-  podarray<u8> tmp(n_elem);
+  std::ostringstream shape;
   
-  uword i = 0;
-  for(uword row=0; row < x.n_rows; ++row)
+  if(x.vec_state == 1)
     {
-    for(uword col=0; col < x.n_cols; ++col)
-      {
-      tmp[i+0] = u8( access::tmp_real( x.at(row,col,0) ) );
-      tmp[i+1] = u8( access::tmp_real( x.at(row,col,1) ) );
-      tmp[i+2] = u8( access::tmp_real( x.at(row,col,2) ) );
-      
-      i+=3;
-      }
+    shape << '(' << x.n_rows << ",)";
+    }
+  else
+    {
+    shape << '(' << x.n_rows << ", " << x.n_cols << ')';
     }
   
-  f << "P6" << '\n';
-  f << x.n_cols << '\n';
-  f << x.n_rows << '\n';
-  f << 255 << '\n';
+  f << diskio::gen_npy_header(diskio::gen_npy_descr<eT>(), (x.vec_state != 1), shape.str());
   
-  f.write( reinterpret_cast<const char*>(tmp.mem), std::streamsize(n_elem) );
+  f.write( reinterpret_cast<const char*>(x.mem), std::streamsize(x.n_elem*sizeof(eT)) );
   
   return f.good();
   }
 
 
 
-//
-// handling of PPM images by fields
+template<typename eT>
+inline
+bool
+diskio::save_npy_binary(const Cube<eT>& x, std::ostream& f)
+  {
+  arma_extra_debug_sigprint();
+  
+  std::ostringstream shape;
+  
+  shape << '(' << x.n_rows << ", " << x.n_cols << ", " << x.n_slices << ')';
+  
+  f << diskio::gen_npy_header(diskio::gen_npy_descr<eT>(), true, shape.str());
+  
+  f.write( reinterpret_cast<const char*>(x.mem), std::streamsize(x.n_elem*sizeof(eT)) );
+  
+  return f.good();
+  }
 
 
 
-template<typename T1>
+template<typename eT>
 inline
 bool
-diskio::load_ppm_binary(field<T1>& x, const std::string& name, std::string& err_msg)
+diskio::load_npy_binary(Mat<eT>& x, const std::string& name, std::string& err_msg)
   {
   arma_extra_debug_sigprint();
   
-  std::fstream f;
-  f.open(name.c_str(), std::fstream::in | std::fstream::binary);
+  std::ifstream f;
+  f.open(name.c_str(), std::fstream::binary);
   
   bool load_okay = f.is_open();
   
   if(load_okay == true)
     {
-    load_okay = diskio::load_ppm_binary(x, f, err_msg);
+    load_okay = diskio::load_npy_binary(x, f, err_msg);
     f.close();
     }
   
@@ -4611,114 +7974,22 @@ diskio::load_ppm_binary(field<T1>& x, const std::string& name, std::string& err_
 
 
 
-template<typename T1>
+template<typename eT>
 inline
 bool
-diskio::load_ppm_binary(field<T1>& x, std::istream& f, std::string& err_msg)
+diskio::load_npy_binary(Cube<eT>& x, const std::string& name, std::string& err_msg)
   {
   arma_extra_debug_sigprint();
   
-  arma_type_check(( is_Mat<T1>::value == false ));
-  typedef typename T1::elem_type eT;
-  
-  bool load_okay = true;
-  
-  std::string f_header;
-  f >> f_header;
-  
-  if(f_header == "P6")
-    {
-    uword f_n_rows = 0;
-    uword f_n_cols = 0;
-    int f_maxval = 0;
-  
-    diskio::pnm_skip_comments(f);
-  
-    f >> f_n_cols;
-    diskio::pnm_skip_comments(f);
+  std::ifstream f;
+  f.open(name.c_str(), std::fstream::binary);
   
-    f >> f_n_rows;
-    diskio::pnm_skip_comments(f);
+  bool load_okay = f.is_open();
   
-    f >> f_maxval;
-    f.get();
-    
-    if( (f_maxval > 0) || (f_maxval <= 65535) )
-      {
-      x.set_size(3);
-      Mat<eT>& R = x(0);
-      Mat<eT>& G = x(1);
-      Mat<eT>& B = x(2);
-      
-      R.set_size(f_n_rows,f_n_cols);
-      G.set_size(f_n_rows,f_n_cols);
-      B.set_size(f_n_rows,f_n_cols);
-      
-      if(f_maxval <= 255)
-        {
-        const uword n_elem = 3*f_n_cols*f_n_rows;
-        podarray<u8> tmp(n_elem);
-        
-        f.read( reinterpret_cast<char*>(tmp.memptr()), std::streamsize(n_elem) );
-        
-        uword i = 0;
-        
-        //cout << "f_n_cols = " << f_n_cols << endl;
-        //cout << "f_n_rows = " << f_n_rows << endl;
-        
-        
-        for(uword row=0; row < f_n_rows; ++row)
-          {
-          for(uword col=0; col < f_n_cols; ++col)
-            {
-            R.at(row,col) = eT(tmp[i+0]);
-            G.at(row,col) = eT(tmp[i+1]);
-            B.at(row,col) = eT(tmp[i+2]);
-            i+=3;
-            }
-          
-          }
-        }
-      else
-        {
-        const uword n_elem = 3*f_n_cols*f_n_rows;
-        podarray<u16> tmp(n_elem);
-        
-        f.read( reinterpret_cast<char *>(tmp.memptr()), std::streamsize(2*n_elem) );
-        
-        uword i = 0;
-        
-        for(uword row=0; row < f_n_rows; ++row)
-          {
-          for(uword col=0; col < f_n_cols; ++col)
-            {
-            R.at(row,col) = eT(tmp[i+0]);
-            G.at(row,col) = eT(tmp[i+1]);
-            B.at(row,col) = eT(tmp[i+2]);
-            i+=3;
-            }
-          
-          }
-        
-        }
-      
-      }
-    else
-      {
-      load_okay = false;
-      err_msg = "currently no code available to handle loading ";
-      }
-    
-    if(f.good() == false)
-      {
-      load_okay = false;
-      }
-    
-    }
-  else
+  if(load_okay == true)
     {
-    load_okay = false;
-    err_msg = "unsupported header in ";
+    load_okay = diskio::load_npy_binary(x, f, err_msg);
+    f.close();
     }
   
   return load_okay;
@@ -4726,92 +7997,134 @@ diskio::load_ppm_binary(field<T1>& x, std::istream& f, std::string& err_msg)
 
 
 
-template<typename T1>
+//! Load a matrix from a .npy file with at most two dimensions.
+//! One dimensional arrays are loaded as column vectors, unless x is a row vector.
+//! Data in row-major (C) ordering is transposed, unless it has only one row or column.
+template<typename eT>
 inline
 bool
-diskio::save_ppm_binary(const field<T1>& x, const std::string& final_name)
+diskio::load_npy_binary(Mat<eT>& x, std::istream& f, std::string& err_msg)
   {
   arma_extra_debug_sigprint();
   
-  const std::string tmp_name = diskio::gen_tmp_name(final_name);
-  std::ofstream f( tmp_name.c_str(), std::fstream::binary );
+  std::string     descr;
+  bool            fortran_order = true;
+  podarray<uword> shape;
   
-  bool save_okay = f.is_open();
+  if(diskio::read_npy_header(f, descr, fortran_order, shape) == false)
+    {
+    err_msg = "incorrect header in ";
+    return false;
+    }
   
-  if(save_okay == true)
+  if(shape.n_elem > 2)
     {
-    save_okay = diskio::save_ppm_binary(x, f);
-    
-    f.flush();
-    f.close();
+    err_msg = "too many dimensions in ";
+    return false;
+    }
+  
+  uword f_n_rows = 1;
+  uword f_n_cols = 1;
+  
+  if(shape.n_elem == 1)
+    {
+    if(x.vec_state == 2)  { f_n_cols = shape[0]; }  else  { f_n_rows = shape[0]; }
+    }
+  else
+  if(shape.n_elem == 2)
+    {
+    f_n_rows = shape[0];
+    f_n_cols = shape[1];
+    }
+  
+  if( (fortran_order == true) || (f_n_rows == 1) || (f_n_cols == 1) )
+    {
+    x.set_size(f_n_rows, f_n_cols);
     
-    if(save_okay == true)
-      {
-      save_okay = diskio::safe_rename(tmp_name, final_name);
-      }
+    return diskio::read_npy_data(x.memptr(), x.n_elem, descr, f, err_msg);
     }
   
-  return save_okay;
+  // row-major data is the transpose of column-major data
+  
+  Mat<eT> tmp(f_n_cols, f_n_rows);
+  
+  const bool load_okay = diskio::read_npy_data(tmp.memptr(), tmp.n_elem, descr, f, err_msg);
+  
+  if(load_okay)  { op_strans::apply_mat_noalias(x, tmp); }
+  
+  return load_okay;
   }
 
 
 
-template<typename T1>
+//! Load a cube from a .npy file with at most three dimensions;
+//! data in row-major (C) ordering is permuted into column-major ordering
+template<typename eT>
 inline
 bool
-diskio::save_ppm_binary(const field<T1>& x, std::ostream& f)
+diskio::load_npy_binary(Cube<eT>& x, std::istream& f, std::string& err_msg)
   {
   arma_extra_debug_sigprint();
   
-  arma_type_check(( is_Mat<T1>::value == false ));
+  std::string     descr;
+  bool            fortran_order = true;
+  podarray<uword> shape;
   
-  typedef typename T1::elem_type eT;
+  if(diskio::read_npy_header(f, descr, fortran_order, shape) == false)
+    {
+    err_msg = "incorrect header in ";
+    return false;
+    }
   
-  arma_debug_check( (x.n_elem != 3), "diskio::save_ppm_binary(): given field must have exactly 3 matrices of equal size" );
+  if(shape.n_elem > 3)
+    {
+    err_msg = "too many dimensions in ";
+    return false;
+    }
   
-  bool same_size = true;
-  for(uword i=1; i<3; ++i)
+  uword dims[3] = { 1, 1, 1 };
+  
+  uword n_nontrivial = 0;
+  
+  for(uword i=0; i < shape.n_elem; ++i)
     {
-    if( (x(0).n_rows != x(i).n_rows) || (x(0).n_cols != x(i).n_cols) )
-      {
-      same_size = false;
-      break;
-      }
+    dims[i] = shape[i];
+    
+    if(dims[i] > 1)  { ++n_nontrivial; }
     }
   
-  arma_debug_check( (same_size != true), "diskio::save_ppm_binary(): given field must have exactly 3 matrices of equal size" );
+  x.set_size(dims[0], dims[1], dims[2]);
   
-  const Mat<eT>& R = x(0);
-  const Mat<eT>& G = x(1);
-  const Mat<eT>& B = x(2);
+  if( (fortran_order == true) || (n_nontrivial <= 1) )
+    {
+    return diskio::read_npy_data(x.memptr(), x.n_elem, descr, f, err_msg);
+    }
   
-  f << "P6" << '\n';
-  f << R.n_cols << '\n';
-  f << R.n_rows << '\n';
-  f << 255 << '\n';
-
-  const uword n_elem = 3 * R.n_rows * R.n_cols;
-  podarray<u8> tmp(n_elem);
-
-  uword i = 0;
-  for(uword row=0; row < R.n_rows; ++row)
+  podarray<eT> tmp(x.n_elem);
+  
+  const bool load_okay = diskio::read_npy_data(tmp.memptr(), tmp.n_elem, descr, f, err_msg);
+  
+  if(load_okay)
     {
-    for(uword col=0; col < R.n_cols; ++col)
+    const uword n_rows   = x.n_rows;
+    const uword n_cols   = x.n_cols;
+    const uword n_slices = x.n_slices;
+    
+    eT* out = x.memptr();
+    
+    for(uword s=0; s < n_slices; ++s)
+    for(uword c=0; c < n_cols;   ++c)
+    for(uword r=0; r < n_rows;   ++r)
       {
-      tmp[i+0] = u8( access::tmp_real( R.at(row,col) ) );
-      tmp[i+1] = u8( access::tmp_real( G.at(row,col) ) );
-      tmp[i+2] = u8( access::tmp_real( B.at(row,col) ) );
-      
-      i+=3;
+      (*out) = tmp[ (r*n_cols + c)*n_slices + s ];  ++out;
       }
     }
   
-  f.write( reinterpret_cast<const char*>(tmp.mem), std::streamsize(n_elem) );
-  
-  return f.good();
+  return load_okay;
   }
 
 
 
+
 //! @}
 
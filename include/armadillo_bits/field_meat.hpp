@@ -1875,6 +1875,103 @@ field<oT>::quiet_load(std::istream& is, const file_type type)
 
 
 
+//! number of bytes required by serialise()
+template<typename oT>
+inline
+uword
+field<oT>::serialised_size() const
+  {
+  arma_extra_debug_sigprint();
+  
+  return diskio::serialise(*this, 0, 0);
+  }
+
+
+
+//! write the field into buf using the arma_binary format (as per save() into a stream), without going through iostreams;
+//! returns the number of bytes used, or zero if buf is too small
+template<typename oT>
+inline
+uword
+field<oT>::serialise(void* buf, const uword buf_n_bytes) const
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword n_bytes = (*this).serialised_size();
+  
+  if( (buf == 0) || (n_bytes > buf_n_bytes) )  { return 0; }
+  
+  diskio::serialise(*this, static_cast<char*>(buf), 0);
+  
+  return n_bytes;
+  }
+
+
+
+//! read the field from buf, which holds data written by serialise() or save() using the arma_binary format;
+//! the data is always copied, as buf is read-only;
+//! returns false if buf doesn't hold a valid field, in which case the field is reset
+template<typename oT>
+inline
+bool
+field<oT>::deserialise(const void* buf, const uword buf_n_bytes)
+  {
+  arma_extra_debug_sigprint();
+  
+  uword pos = 0;
+  
+  const bool load_okay = (buf != 0) && diskio::deserialise(*this, static_cast<const char*>(buf), buf_n_bytes, pos, (char*) NULL);
+  
+  if(load_okay == false)  { (*this).reset(); }
+  
+  return load_okay;
+  }
+
+
+
+//! as per deserialise(const void*, const uword), but if copy_aux_mem is false,
+//! the matrices or cubes in the field use the memory of buf directly (as per the advanced constructors), if the data is suitably aligned;
+//! buf must then remain valid and must not be modified by other means while the field uses it
+template<typename oT>
+inline
+bool
+field<oT>::deserialise(void* buf, const uword buf_n_bytes, const bool copy_aux_mem)
+  {
+  arma_extra_debug_sigprint();
+  
+  uword pos = 0;
+  
+  char* buf_rw = (copy_aux_mem) ? (char*) NULL : static_cast<char*>(buf);
+  
+  const bool load_okay = (buf != 0) && diskio::deserialise(*this, static_cast<const char*>(buf), buf_n_bytes, pos, buf_rw);
+  
+  if(load_okay == false)  { (*this).reset(); }
+  
+  return load_okay;
+  }
+
+
+
+#if defined(ARMA_USE_CXX11)
+
+//! save the field to a file on a background thread;
+//! the field is copied before the function returns, and the file is written via a temporary file followed by renaming;
+//! if sync is true, the contents of the file are flushed to the storage device before renaming
+template<typename oT>
+arma_warn_unused
+inline
+std::future<bool>
+field<oT>::save_async(const std::string name, const file_type type, const bool sync) const
+  {
+  arma_extra_debug_sigprint();
+  
+  return async_save< field<oT> >::apply(*this, name, type, sync);
+  }
+
+#endif
+
+
+
 //! construct a field from a given field
 template<typename oT>
 inline
@@ -2486,6 +2583,10 @@ field_aux::save(const field< Mat<eT> >& x, const std::string& name, const file_t
       return diskio::save_arma_binary(x, name);
       break;
       
+    case arma_compressed:
+      return diskio::save_arma_compressed(x, name);
+      break;
+      
     case ppm_binary:
       return diskio::save_ppm_binary(x, name);
       break;
@@ -2511,6 +2612,10 @@ field_aux::save(const field< Mat<eT> >& x, std::ostream& os, const file_type typ
       return diskio::save_arma_binary(x, os);
       break;
       
+    case arma_compressed:
+      return diskio::save_arma_compressed(x, os);
+      break;
+      
     case ppm_binary:
       return diskio::save_ppm_binary(x, os);
       break;
@@ -2540,6 +2645,10 @@ field_aux::load(field< Mat<eT> >& x, const std::string& name, const file_type ty
       return diskio::load_arma_binary(x, name, err_msg);
       break;
       
+    case arma_compressed:
+      return diskio::load_arma_compressed(x, name, err_msg);
+      break;
+      
     case ppm_binary:
       return diskio::load_ppm_binary(x, name, err_msg);
       break;
@@ -2569,6 +2678,10 @@ field_aux::load(field< Mat<eT> >& x, std::istream& is, const file_type type, std
       return diskio::load_arma_binary(x, is, err_msg);
       break;
       
+    case arma_compressed:
+      return diskio::load_arma_compressed(x, is, err_msg);
+      break;
+      
     case ppm_binary:
       return diskio::load_ppm_binary(x, is, err_msg);
       break;
@@ -2594,6 +2707,10 @@ field_aux::save(const field< Col<eT> >& x, const std::string& name, const file_t
       return diskio::save_arma_binary(x, name);
       break;
       
+    case arma_compressed:
+      return diskio::save_arma_compressed(x, name);
+      break;
+      
     case ppm_binary:
       return diskio::save_ppm_binary(x, name);
       break;
@@ -2619,6 +2736,10 @@ field_aux::save(const field< Col<eT> >& x, std::ostream& os, const file_type typ
       return diskio::save_arma_binary(x, os);
       break;
       
+    case arma_compressed:
+      return diskio::save_arma_compressed(x, os);
+      break;
+      
     case ppm_binary:
       return diskio::save_ppm_binary(x, os);
       break;
@@ -2648,6 +2769,10 @@ field_aux::load(field< Col<eT> >& x, const std::string& name, const file_type ty
       return diskio::load_arma_binary(x, name, err_msg);
       break;
       
+    case arma_compressed:
+      return diskio::load_arma_compressed(x, name, err_msg);
+      break;
+      
     case ppm_binary:
       return diskio::load_ppm_binary(x, name, err_msg);
       break;
@@ -2677,6 +2802,10 @@ field_aux::load(field< Col<eT> >& x, std::istream& is, const file_type type, std
       return diskio::load_arma_binary(x, is, err_msg);
       break;
       
+    case arma_compressed:
+      return diskio::load_arma_compressed(x, is, err_msg);
+      break;
+      
     case ppm_binary:
       return diskio::load_ppm_binary(x, is, err_msg);
       break;
@@ -2702,6 +2831,10 @@ field_aux::save(const field< Row<eT> >& x, const std::string& name, const file_t
       return diskio::save_arma_binary(x, name);
       break;
       
+    case arma_compressed:
+      return diskio::save_arma_compressed(x, name);
+      break;
+      
     case ppm_binary:
       return diskio::save_ppm_binary(x, name);
       break;
@@ -2727,6 +2860,10 @@ field_aux::save(const field< Row<eT> >& x, std::ostream& os, const file_type typ
       return diskio::save_arma_binary(x, os);
       break;
       
+    case arma_compressed:
+      return diskio::save_arma_compressed(x, os);
+      break;
+      
     case ppm_binary:
       return diskio::save_ppm_binary(x, os);
       break;
@@ -2756,6 +2893,10 @@ field_aux::load(field< Row<eT> >& x, const std::string& name, const file_type ty
       return diskio::load_arma_binary(x, name, err_msg);
       break;
       
+    case arma_compressed:
+      return diskio::load_arma_compressed(x, name, err_msg);
+      break;
+      
     case ppm_binary:
       return diskio::load_ppm_binary(x, name, err_msg);
       break;
@@ -2785,6 +2926,10 @@ field_aux::load(field< Row<eT> >& x, std::istream& is, const file_type type, std
       return diskio::load_arma_binary(x, is, err_msg);
       break;
       
+    case arma_compressed:
+      return diskio::load_arma_compressed(x, is, err_msg);
+      break;
+      
     case ppm_binary:
       return diskio::load_ppm_binary(x, is, err_msg);
       break;
@@ -2809,6 +2954,10 @@ field_aux::save(const field< Cube<eT> >& x, const std::string& name, const file_
     case arma_binary:
       return diskio::save_arma_binary(x, name);
       break;
+      
+    case arma_compressed:
+      return diskio::save_arma_compressed(x, name);
+      break;
     
     default:
       err_msg = " [unsupported type] filename = ";
@@ -2830,6 +2979,10 @@ field_aux::save(const field< Cube<eT> >& x, std::ostream& os, const file_type ty
     case arma_binary:
       return diskio::save_arma_binary(x, os);
       break;
+      
+    case arma_compressed:
+      return diskio::save_arma_compressed(x, os);
+      break;
     
     default:
       err_msg = " [unsupported type] filename = ";
@@ -2852,6 +3005,10 @@ field_aux::load(field< Cube<eT> >& x, const std::string& name, const file_type t
     case arma_binary:
       return diskio::load_arma_binary(x, name, err_msg);
       break;
+      
+    case arma_compressed:
+      return diskio::load_arma_compressed(x, name, err_msg);
+      break;
     
     default:
       err_msg = " [unsupported type] filename = ";
@@ -2875,6 +3032,10 @@ field_aux::load(field< Cube<eT> >& x, std::istream& is, const file_type type, st
       return diskio::load_arma_binary(x, is, err_msg);
       break;
       
+    case arma_compressed:
+      return diskio::load_arma_compressed(x, is, err_msg);
+      break;
+      
     default:
       err_msg = " [unsupported type] filename = ";
       return false;
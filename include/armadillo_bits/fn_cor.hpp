@@ -29,6 +29,27 @@ cor(const Base<typename T1::elem_type,T1>& X, const uword norm_type = 0)
 
 
 
+//! nan_method = "all":      NaN values propagate to the result;
+//! nan_method = "pairwise": for each pair of columns, use only the rows where both elements are not NaN
+template<typename T1>
+arma_warn_unused
+inline
+const Op<T1, op_cor>
+cor(const Base<typename T1::elem_type,T1>& X, const uword norm_type, const char* nan_method)
+  {
+  arma_extra_debug_sigprint();
+  
+  const char sig = (nan_method != NULL) ? nan_method[0] : char(0);
+  
+  arma_debug_check( (norm_type > 1), "cor(): parameter 'norm_type' must be 0 or 1" );
+  
+  arma_debug_check( ((sig != 'a') && (sig != 'p')), "cor(): unknown nan_method" );
+  
+  return Op<T1, op_cor>(X.get_ref(), norm_type, ((sig == 'p') ? uword(1) : uword(0)));
+  }
+
+
+
 template<typename T1, typename T2>
 arma_warn_unused
 inline
@@ -13,6 +13,7 @@
 
 
 
+//! if batch_size > 0, mini-batch k-means is used, where each iteration only uses batch_size randomly selected vectors
 template<typename T1>
 inline
 typename enable_if2<is_real<typename T1::elem_type>::value, bool>::result
@@ -23,7 +24,8 @@ kmeans
   const uword                            k,
   const gmm_seed_mode&                   seed_mode,
   const uword                            n_iter,
-  const bool                             print_mode
+  const bool                             print_mode,
+  const uword                            batch_size = 0
   )
   {
   arma_extra_debug_sigprint();
@@ -32,7 +34,7 @@ kmeans
   
   gmm_priv::gmm_diag<eT> model;
   
-  const bool status = model.kmeans_wrapper(means, data.get_ref(), k, seed_mode, n_iter, print_mode);
+  const bool status = model.kmeans_wrapper(means, data.get_ref(), k, seed_mode, n_iter, print_mode, batch_size);
   
   if(status == true)
     {
@@ -0,0 +1,85 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+//! \addtogroup fn_kurtosis
+//! @{
+
+
+
+template<typename T1>
+arma_warn_unused
+inline
+const mtOp<typename T1::pod_type, T1, op_kurtosis>
+kurtosis
+  (
+  const T1& X,
+  const uword norm_type = 0,
+  const uword dim = 0,
+  const typename enable_if< is_arma_type<T1>::value       == true  >::result* junk1 = 0,
+  const typename enable_if< resolves_to_vector<T1>::value == false >::result* junk2 = 0,
+  const typename enable_if< is_real<typename T1::elem_type>::value >::result* junk3 = 0
+  )
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk1);
+  arma_ignore(junk2);
+  arma_ignore(junk3);
+  
+  return mtOp<typename T1::pod_type, T1, op_kurtosis>(X, norm_type, dim);
+  }
+
+
+
+template<typename T1>
+arma_warn_unused
+inline
+const mtOp<typename T1::pod_type, T1, op_kurtosis>
+kurtosis
+  (
+  const T1& X,
+  const uword norm_type,
+  const uword dim,
+  const typename enable_if< resolves_to_vector<T1>::value == true >::result* junk1 = 0,
+  const typename enable_if< is_real<typename T1::elem_type>::value >::result* junk2 = 0
+  )
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk1);
+  arma_ignore(junk2);
+  
+  return mtOp<typename T1::pod_type, T1, op_kurtosis>(X, norm_type, dim);
+  }
+
+
+
+template<typename T1>
+arma_warn_unused
+inline
+typename T1::pod_type
+kurtosis
+  (
+  const T1& X,
+  const uword norm_type = 0,
+  const arma_empty_class junk1 = arma_empty_class(),
+  const typename enable_if< resolves_to_vector<T1>::value == true >::result* junk2 = 0,
+  const typename enable_if< is_real<typename T1::elem_type>::value >::result* junk3 = 0
+  )
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk1);
+  arma_ignore(junk2);
+  arma_ignore(junk3);
+  
+  return op_kurtosis::kurtosis_vec(X, norm_type);
+  }
+
+
+
+//! @}
@@ -22,71 +22,51 @@ randg(const uword n_rows, const uword n_cols, const distr_param& param = distr_p
   arma_extra_debug_sigprint();
   arma_ignore(junk);
   
-  #if defined(ARMA_USE_CXX11)
+  typedef typename obj_type::elem_type eT;
+  
+  if(is_Col<obj_type>::value == true)
+    {
+    arma_debug_check( (n_cols != 1), "randg(): incompatible size" );
+    }
+  else
+  if(is_Row<obj_type>::value == true)
     {
-    if(is_Col<obj_type>::value == true)
-      {
-      arma_debug_check( (n_cols != 1), "randg(): incompatible size" );
-      }
-    else
-    if(is_Row<obj_type>::value == true)
-      {
-      arma_debug_check( (n_rows != 1), "randg(): incompatible size" );
-      }
-    
-    obj_type out(n_rows, n_cols);
-    
-    double a;
-    double b;
-    
-    if(param.state == 0)
-      {
-      a = double(1);
-      b = double(1);
-      }
-    else
-    if(param.state == 1)
-      {
-      a = double(param.a_int);
-      b = double(param.b_int);
-      }
-    else
-      {
-      a = param.a_double;
-      b = param.b_double;
-      }
-    
-    arma_debug_check( ((a <= double(0)) || (b <= double(0))), "randg(): a and b must be greater than zero" );
-    
-    #if defined(ARMA_USE_EXTERN_CXX11_RNG)
-      {
-      arma_rng_cxx11_instance.randg_fill(out.memptr(), out.n_elem, a, b);
-      }
-    #else
-      {
-      arma_rng_cxx11 local_arma_rng_cxx11_instance;
-      
-      typedef typename arma_rng_cxx11::seed_type seed_type;
-      
-      local_arma_rng_cxx11_instance.set_seed( seed_type(arma_rng::randi<seed_type>()) );
-      
-      local_arma_rng_cxx11_instance.randg_fill(out.memptr(), out.n_elem, a, b);
-      }
-    #endif
-    
-    return out;
+    arma_debug_check( (n_rows != 1), "randg(): incompatible size" );
     }
-  #else
+  
+  obj_type out(n_rows, n_cols);
+  
+  double a;
+  double b;
+  
+  if(param.state == 0)
+    {
+    a = double(1);
+    b = double(1);
+    }
+  else
+  if(param.state == 1)
+    {
+    a = double(param.a_int);
+    b = double(param.b_int);
+    }
+  else
+    {
+    a = param.a_double;
+    b = param.b_double;
+    }
+  
+  arma_debug_check( ((a <= double(0)) || (b <= double(0))), "randg(): a and b must be greater than zero" );
+  
+  #if !defined(ARMA_USE_PHILOX_RNG) && !defined(ARMA_USE_CXX11)
     {
-    arma_ignore(n_rows);
-    arma_ignore(n_cols);
-    arma_ignore(param);
-    
     arma_stop_logic_error("randg(): C++11 compiler required");
-    
-    return obj_type();
     }
   #endif
+  
+  arma_rng::randg<eT>::fill(out.memptr(), out.n_elem, a, b);
+  
+  return out;
   }
 
 
@@ -172,62 +152,41 @@ randg(const uword n_rows, const uword n_cols, const uword n_slices, const distr_
   arma_extra_debug_sigprint();
   arma_ignore(junk);
   
-  #if defined(ARMA_USE_CXX11)
-    {
-    cube_type out(n_rows, n_cols, n_slices);
+  typedef typename cube_type::elem_type eT;
+  
+  cube_type out(n_rows, n_cols, n_slices);
   
-    double a;
-    double b;
-    
-    if(param.state == 0)
-      {
-      a = double(1);
-      b = double(1);
-      }
-    else
-    if(param.state == 1)
-      {
-      a = double(param.a_int);
-      b = double(param.b_int);
-      }
-    else
-      {
-      a = param.a_double;
-      b = param.b_double;
-      }
-    
-    arma_debug_check( ((a <= double(0)) || (b <= double(0))), "randg(): a and b must be greater than zero" );
-    
-    #if defined(ARMA_USE_EXTERN_CXX11_RNG)
-      {
-      arma_rng_cxx11_instance.randg_fill(out.memptr(), out.n_elem, a, b);
-      }
-    #else
-      {
-      arma_rng_cxx11 local_arma_rng_cxx11_instance;
-      
-      typedef typename arma_rng_cxx11::seed_type seed_type;
-      
-      local_arma_rng_cxx11_instance.set_seed( seed_type(arma_rng::randi<seed_type>()) );
-      
-      local_arma_rng_cxx11_instance.randg_fill(out.memptr(), out.n_elem, a, b);
-      }
-    #endif
-    
-    return out;
+  double a;
+  double b;
+  
+  if(param.state == 0)
+    {
+    a = double(1);
+    b = double(1);
     }
-  #else
+  else
+  if(param.state == 1)
+    {
+    a = double(param.a_int);
+    b = double(param.b_int);
+    }
+  else
+    {
+    a = param.a_double;
+    b = param.b_double;
+    }
+  
+  arma_debug_check( ((a <= double(0)) || (b <= double(0))), "randg(): a and b must be greater than zero" );
+  
+  #if !defined(ARMA_USE_PHILOX_RNG) && !defined(ARMA_USE_CXX11)
     {
-    arma_ignore(n_rows);
-    arma_ignore(n_cols);
-    arma_ignore(n_slices);
-    arma_ignore(param);
-    
     arma_stop_logic_error("randg(): C++11 compiler required");
-    
-    return cube_type();
     }
   #endif
+  
+  arma_rng::randg<eT>::fill(out.memptr(), out.n_elem, a, b);
+  
+  return out;
   }
 
 
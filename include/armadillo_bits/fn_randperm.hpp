@@ -0,0 +1,56 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+//! \addtogroup fn_randperm
+//! @{
+
+
+
+//! random permutation of the integers 0, 1, ..., N-1
+arma_warn_unused
+inline
+uvec
+randperm(const uword N)
+  {
+  arma_extra_debug_sigprint();
+  
+  uvec out(N);
+  
+  op_shuffle::gen_perm(out.memptr(), N, N);
+  
+  return out;
+  }
+
+
+
+//! M unique integers randomly chosen from 0, 1, ..., N-1
+arma_warn_unused
+inline
+uvec
+randperm(const uword N, const uword M)
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_check( (M > N), "randperm(): 'M' must be less than or equal to 'N'" );
+  
+  podarray<uword> tmp(N);
+  
+  op_shuffle::gen_perm(tmp.memptr(), N, M);
+  
+  uvec out(M);
+  
+  arrayops::copy( out.memptr(), tmp.memptr(), M );
+  
+  return out;
+  }
+
+
+
+//! @}
@@ -58,8 +58,8 @@ glue_cor::direct_cor(Mat<eT>& out, const Mat<eT>& A, const Mat<eT>& B, const uwo
     out.set_size(1,1);
     out[0] = out_acc/norm_val;
     
-    const Mat<eT> stddev_A = (A.n_rows == 1) ? Mat<eT>(stddev(trans(A))) : Mat<eT>(stddev(A));
-    const Mat<eT> stddev_B = (B.n_rows == 1) ? Mat<eT>(stddev(trans(B))) : Mat<eT>(stddev(B));
+    const Mat<eT> stddev_A = (A.n_rows == 1) ? Mat<eT>(stddev(trans(A), norm_type)) : Mat<eT>(stddev(A, norm_type));
+    const Mat<eT> stddev_B = (B.n_rows == 1) ? Mat<eT>(stddev(trans(B), norm_type)) : Mat<eT>(stddev(B, norm_type));
     
     out /= stddev_A * stddev_B;
     }
@@ -68,12 +68,10 @@ glue_cor::direct_cor(Mat<eT>& out, const Mat<eT>& A, const Mat<eT>& B, const uwo
     arma_debug_assert_mul_size(A, B, true, false, "cor()");
     
     const uword N = A.n_rows;
-    const eT norm_val = (norm_type == 0) ? ( (N > 1) ? eT(N-1) : eT(1) ) : eT(N);
     
-    out = trans(A) * B;
-    out -= (trans(sum(A)) * sum(B))/eT(N);
-    out /= norm_val;
-    out /= trans(stddev(A)) * stddev(B);
+    op_cov::centred_cross(out, A, B);
+    
+    out /= eT(N) * (trans(stddev(A,1)) * stddev(B,1));
     }
   }
 
@@ -125,8 +123,8 @@ glue_cor::direct_cor(Mat< std::complex<T> >& out, const Mat< std::complex<T> >&
     out.set_size(1,1);
     out[0] = out_acc/norm_val;
     
-    const Mat<T> stddev_A = (A.n_rows == 1) ? Mat<T>(stddev(trans(A))) : Mat<T>(stddev(A));
-    const Mat<T> stddev_B = (B.n_rows == 1) ? Mat<T>(stddev(trans(B))) : Mat<T>(stddev(B));
+    const Mat<T> stddev_A = (A.n_rows == 1) ? Mat<T>(stddev(trans(A), norm_type)) : Mat<T>(stddev(A, norm_type));
+    const Mat<T> stddev_B = (B.n_rows == 1) ? Mat<T>(stddev(trans(B), norm_type)) : Mat<T>(stddev(B, norm_type));
     
     out /= conv_to< Mat<eT> >::from( stddev_A * stddev_B );
     }
@@ -135,12 +133,10 @@ glue_cor::direct_cor(Mat< std::complex<T> >& out, const Mat< std::complex<T> >&
     arma_debug_assert_mul_size(A, B, true, false, "cor()");
     
     const uword N = A.n_rows;
-    const eT norm_val = (norm_type == 0) ? ( (N > 1) ? eT(N-1) : eT(1) ) : eT(N);
     
-    out = trans(A) * B;                     // out = strans(conj(A)) * B;
-    out -= (trans(sum(A)) * sum(B))/eT(N);  // out -= (strans(conj(sum(A))) * sum(B))/eT(N);
-    out /= norm_val;
-    out /= conv_to< Mat<eT> >::from( trans(stddev(A)) * stddev(B) );
+    op_cov::centred_cross(out, A, B);  // out = strans(conj(A - mean(A))) * (B - mean(B))
+    
+    out /= conv_to< Mat<eT> >::from( T(N) * (trans(stddev(A,1)) * stddev(B,1)) );
     }
   }
 
@@ -12,6 +12,23 @@
 //! @{
 
 
+//! bin index of a value for hist(), given strictly increasing centers;
+//! n_centers indicates that the value is not counted (NaN)
+template<typename eT>
+struct glue_hist_bin
+  {
+  const interval_finder<eT> finder;
+  
+  const eT*   centers;
+  const uword n_centers;
+  
+  inline glue_hist_bin(const eT* in_centers, const uword in_n_centers);
+  
+  arma_inline uword operator()(const eT val) const;
+  };
+
+
+
 class glue_hist
    {
    public:
@@ -12,6 +12,54 @@
 //! @{
 
 
+template<typename eT>
+inline
+glue_hist_bin<eT>::glue_hist_bin(const eT* in_centers, const uword in_n_centers)
+  : finder   (in_centers, in_n_centers)
+  , centers  (in_centers  )
+  , n_centers(in_n_centers)
+  {
+  arma_extra_debug_sigprint();
+  }
+
+
+
+template<typename eT>
+arma_inline
+uword
+glue_hist_bin<eT>::operator()(const eT val) const
+  {
+  if(arma_isfinite(val))
+    {
+    // the nearest center is either the last center <= val, or the center after it;
+    // on ties the lower center is used
+    
+    const uword k = finder.find(val);
+    
+    if(k == n_centers)      { return 0;           }
+    if(k == (n_centers-1))  { return n_centers-1; }
+    
+    const eT center_a = centers[k  ];
+    const eT center_b = centers[k+1];
+    
+    const eT dist_a = (center_a >= val) ? (center_a - val) : (val - center_a);
+    const eT dist_b = (center_b >= val) ? (center_b - val) : (val - center_b);
+    
+    return (dist_b < dist_a) ? (k+1) : k;
+    }
+  
+  // -inf
+  if(val < eT(0)) { return 0; }
+  
+  // +inf
+  if(val > eT(0)) { return n_centers-1; }
+  
+  // ignore NaN
+  return n_centers;
+  }
+
+
+
 template<typename eT>
 inline
 void
@@ -31,6 +79,54 @@ glue_hist::apply_noalias(Mat<uword>& out, const Mat<eT>& X, const Mat<eT>& C, co
   const eT* C_mem    = C.memptr();
   const eT  center_0 = C_mem[0];
   
+  bool C_is_increasing = interval_finder<eT>::is_sorted(C_mem, C_n_elem);
+  
+  for(uword j=1; C_is_increasing && (j < C_n_elem); ++j)  { C_is_increasing = (C_mem[j-1] < C_mem[j]); }
+  
+  if(C_is_increasing)
+    {
+    // find the nearest center via interval_finder (direct calculation for uniformly spaced centers, otherwise a lookup table),
+    // instead of scanning the centers for each element
+    
+    const glue_hist_bin<eT> bin(C_mem, C_n_elem);
+    
+    if(dim == 0)
+      {
+      out.zeros(C_n_elem, X_n_cols);
+      
+      for(uword col=0; col < X_n_cols; ++col)
+        {
+        glue_histc::count_bins(out.colptr(col), C_n_elem, X.colptr(col), X_n_rows, bin);
+        }
+      }
+    else
+    if(dim == 1)
+      {
+      out.zeros(X_n_rows, C_n_elem);
+      
+      if(X_n_rows == 1)
+        {
+        glue_histc::count_bins(out.memptr(), C_n_elem, X.memptr(), X.n_elem, bin);
+        }
+      else
+        {
+        for(uword col=0; col < X_n_cols; ++col)
+          {
+          const eT* X_coldata = X.colptr(col);
+          
+          for(uword row=0; row < X_n_rows; ++row)
+            {
+            const uword j = bin(X_coldata[row]);
+            
+            if(j < C_n_elem)  { out.at(row,j)++; }
+            }
+          }
+        }
+      }
+    
+    return;
+    }
+  
   if(dim == 0)
     {
     out.zeros(C_n_elem, X_n_cols);
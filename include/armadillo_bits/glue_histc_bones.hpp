@@ -12,13 +12,35 @@
 //! @{
 
 
+//! bin index of a value for histc(), given sorted edges;
+//! n_edges indicates that the value is not counted
+template<typename eT>
+struct glue_histc_bin
+  {
+  const interval_finder<eT> finder;
+  
+  const eT*   edges;
+  const uword n_edges;
+  
+  inline glue_histc_bin(const eT* in_edges, const uword in_n_edges);
+  
+  arma_inline uword operator()(const eT x) const;
+  };
+
+
+
 class glue_histc
    {
    public:
    
+   static const uword parallel_n_elem = 65536;  //!< minimum number of elements for counting in parallel
+   
    template<typename eT>
    inline static void apply_noalias(Mat<uword>& C, const Mat<eT>& A, const Mat<eT>& B, const uword dim);
    
+   template<typename eT, typename bin_type>
+   inline static void count_bins(uword* counts, const uword n_bins, const eT* mem, const uword n_elem, const bin_type& bin);
+   
    template<typename T1, typename T2>
    inline static void apply(Mat<uword>& C, const mtGlue<uword,T1,T2,glue_histc>& expr);
    };
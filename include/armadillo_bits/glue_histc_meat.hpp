@@ -12,6 +12,93 @@
 //! @{
 
 
+template<typename eT>
+inline
+glue_histc_bin<eT>::glue_histc_bin(const eT* in_edges, const uword in_n_edges)
+  : finder (in_edges, in_n_edges)
+  , edges  (in_edges  )
+  , n_edges(in_n_edges)
+  {
+  arma_extra_debug_sigprint();
+  }
+
+
+
+template<typename eT>
+arma_inline
+uword
+glue_histc_bin<eT>::operator()(const eT x) const
+  {
+  const uword i = finder.find(x);
+  
+  // the last bin only counts values equal to the last edge, for compatibility with Matlab
+  
+  return ( (i < (n_edges-1)) || ((i == (n_edges-1)) && (x == edges[i])) ) ? i : n_edges;
+  }
+
+
+
+//! add the bins of mem[0] ... mem[n_elem-1] to counts;
+//! bin(x) returns the bin of x, or a value >= n_bins if x is not counted.
+//! when OpenMP is enabled, large arrays are split into blocks counted by separate threads into private histograms,
+//! which are then summed
+template<typename eT, typename bin_type>
+inline
+void
+glue_histc::count_bins(uword* counts, const uword n_bins, const eT* mem, const uword n_elem, const bin_type& bin)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(_OPENMP)
+    {
+    const uword n_threads = uword( (std::max)(int(1), omp_get_max_threads()) );
+    
+    if( (n_elem >= glue_histc::parallel_n_elem) && (n_threads > 1) && (omp_in_parallel() == 0) )
+      {
+      podarray<uword> partial(n_threads * n_bins);
+      
+      partial.zeros();
+      
+      const uword block_size = (n_elem + n_threads - 1) / n_threads;
+      
+      #pragma omp parallel for schedule(static,1)
+      for(uword t=0; t < n_threads; ++t)
+        {
+        const uword start = (std::min)(t * block_size, n_elem);
+        const uword end   = (std::min)(start + block_size, n_elem);
+        
+        uword* partial_t = partial.memptr() + t*n_bins;
+        
+        for(uword j=start; j < end; ++j)
+          {
+          const uword i = bin(mem[j]);
+          
+          if(i < n_bins)  { partial_t[i]++; }
+          }
+        }
+      
+      for(uword t=0; t < n_threads; ++t)
+        {
+        const uword* partial_t = partial.memptr() + t*n_bins;
+        
+        for(uword i=0; i < n_bins; ++i)  { counts[i] += partial_t[i]; }
+        }
+      
+      return;
+      }
+    }
+  #endif
+  
+  for(uword j=0; j < n_elem; ++j)
+    {
+    const uword i = bin(mem[j]);
+    
+    if(i < n_bins)  { counts[i]++; }
+    }
+  }
+
+
+
 template<typename eT>
 inline
 void
@@ -28,6 +115,52 @@ glue_histc::apply_noalias(Mat<uword>& C, const Mat<eT>& A, const Mat<eT>& B, con
   
   if( B_n_elem == uword(0) )  { C.reset(); return; }
   
+  if(interval_finder<eT>::is_sorted(B.memptr(), B_n_elem))
+    {
+    // interval_finder over the edges (direct calculation of the bin for uniformly spaced edges, otherwise a lookup table),
+    // instead of scanning all edges for each element
+    
+    const glue_histc_bin<eT> bin(B.memptr(), B_n_elem);
+    
+    if(dim == uword(0))
+      {
+      C.zeros(B_n_elem, A_n_cols);
+      
+      for(uword col=0; col < A_n_cols; ++col)
+        {
+        glue_histc::count_bins(C.colptr(col), B_n_elem, A.colptr(col), A_n_rows, bin);
+        }
+      }
+    else
+    if(dim == uword(1))
+      {
+      C.zeros(A_n_rows, B_n_elem);
+      
+      if(A_n_rows == 1)
+        {
+        glue_histc::count_bins(C.memptr(), B_n_elem, A.memptr(), A.n_elem, bin);
+        }
+      else
+        {
+        for(uword col=0; col < A_n_cols; ++col)
+          {
+          const eT* A_coldata = A.colptr(col);
+          
+          for(uword row=0; row < A_n_rows; ++row)
+            {
+            const uword i = bin(A_coldata[row]);
+            
+            if(i < B_n_elem)  { C.at(row,i)++; }
+            }
+          }
+        }
+      }
+    
+    return;
+    }
+  
+  // edges which are not sorted: scan all edges for each element
+  
   const eT*   B_mem       = B.memptr();
   const uword B_n_elem_m1 = B_n_elem - 1;
   
@@ -0,0 +1,70 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+//! \addtogroup glue_quantile
+//! @{
+
+
+
+//! stores the quantiles of each vector in out; used with op_median::apply_to_vecs()
+template<typename eT>
+struct glue_quantile_worker
+  {
+  Mat<eT>* out;
+  uword    dim;
+  
+  const uword* ranks;      //!< sorted positions of the order statistics which are required
+  uword        n_ranks;
+  const uword* pos_a;      //!< for each probability: positions of the two order statistics to interpolate between
+  const uword* pos_b;
+  const eT*    weight_b;   //!< for each probability: interpolation weight of the second order statistic
+  uword        n_probs;
+  
+  inline void operator() (const uword i, eT* mem, const uword n_elem) const;
+  };
+
+
+
+class glue_quantile
+  {
+  public:
+  
+  template<typename eT>
+  inline static void apply_noalias(Mat<eT>& out, const Mat<eT>& X, const Mat<eT>& P, const uword dim);
+  
+  template<typename eT>
+  inline static void apply_noalias(Mat<eT>& out, Mat<eT>& X, const Mat<eT>& P, const uword dim);
+  
+  template<typename eT>
+  inline static void multi_select(eT* X, const uword start, const uword end, const uword* ranks, const uword n_ranks);
+  
+  template<typename T1, typename T2>
+  inline static void apply(Mat<typename T1::elem_type>& out, const Glue<T1,T2,glue_quantile>& expr);
+  
+  
+  private:
+  
+  template<typename eT, typename T_X>
+  inline static void apply_noalias_helper(Mat<eT>& out, T_X& X, const Mat<eT>& P, const uword dim);
+  };
+
+
+
+class glue_quantile_default
+  {
+  public:
+  
+  template<typename T1, typename T2>
+  inline static void apply(Mat<typename T1::elem_type>& out, const Glue<T1,T2,glue_quantile_default>& expr);
+  };
+
+
+
+//! @}
@@ -0,0 +1,250 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+//! \addtogroup glue_quantile
+//! @{
+
+
+
+template<typename eT>
+inline
+void
+glue_quantile_worker<eT>::operator() (const uword i, eT* mem, const uword n_elem) const
+  {
+  // with many probabilities, sorting all elements is quicker than repeated selection
+  
+  if(n_ranks <= 8)
+    {
+    glue_quantile::multi_select(mem, 0, n_elem, ranks, n_ranks);
+    }
+  else
+    {
+    op_sort::direct_sort_ascending(mem, n_elem);
+    }
+  
+  for(uword j=0; j < n_probs; ++j)
+    {
+    const eT val_a = mem[ pos_a[j] ];
+    const eT val_b = mem[ pos_b[j] ];
+    
+    const eT val = (pos_a[j] == pos_b[j]) ? val_a : (val_a + weight_b[j] * (val_b - val_a));
+    
+    if(dim == 0)  { out->at(j,i) = val; }  else  { out->at(i,j) = val; }
+    }
+  }
+
+
+
+//! rearrange X[start] ... X[end-1] so that X[ranks[k]] is the element which would be at that position if X was sorted;
+//! the ranks must be sorted and within the [start, end-1] interval.
+//! each call to std::nth_element() partitions the elements, so that the remaining ranks are found in smaller parts
+template<typename eT>
+inline
+void
+glue_quantile::multi_select(eT* X, const uword start, const uword end, const uword* ranks, const uword n_ranks)
+  {
+  if(n_ranks == 0)  { return; }
+  
+  const uword mid  = n_ranks / 2;
+  const uword rank = ranks[mid];
+  
+  std::nth_element(X + start, X + rank, X + end);
+  
+  glue_quantile::multi_select(X, start,  rank, ranks,          mid              );
+  glue_quantile::multi_select(X, rank+1, end,  ranks + mid+1, n_ranks - (mid+1));
+  }
+
+
+
+//! the columns or rows of X are copied before being reordered
+template<typename eT>
+inline
+void
+glue_quantile::apply_noalias(Mat<eT>& out, const Mat<eT>& X, const Mat<eT>& P, const uword dim)
+  {
+  arma_extra_debug_sigprint();
+  
+  glue_quantile::apply_noalias_helper(out, X, P, dim);
+  }
+
+
+
+//! the columns of X are reordered in place
+template<typename eT>
+inline
+void
+glue_quantile::apply_noalias(Mat<eT>& out, Mat<eT>& X, const Mat<eT>& P, const uword dim)
+  {
+  arma_extra_debug_sigprint();
+  
+  glue_quantile::apply_noalias_helper(out, X, P, dim);
+  }
+
+
+
+//! T_X is either Mat<eT> or const Mat<eT>, which selects the corresponding op_median::apply_to_vecs()
+template<typename eT, typename T_X>
+inline
+void
+glue_quantile::apply_noalias_helper(Mat<eT>& out, T_X& X, const Mat<eT>& P, const uword dim)
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_check( ((P.is_vec() == false) && (P.is_empty() == false)), "quantile(): parameter 'P' must be a vector" );
+  
+  arma_debug_check( X.has_nan(), "quantile(): detected NaN" );
+  
+  const uword P_n_elem = P.n_elem;
+  const eT*   P_mem    = P.memptr();
+  
+  for(uword j=0; j < P_n_elem; ++j)
+    {
+    const eT p = P_mem[j];
+    
+    arma_debug_check( ((p < eT(0)) || (p > eT(1)) || arma_isnan(p)), "quantile(): parameter 'P' must have values in the [0,1] interval" );
+    }
+  
+  const uword N = (dim == 0) ? X.n_rows : X.n_cols;
+  
+  if(dim == 0)
+    {
+    out.set_size( ((N > 0) ? P_n_elem : uword(0)), X.n_cols );
+    }
+  else
+    {
+    out.set_size( X.n_rows, ((N > 0) ? P_n_elem : uword(0)) );
+    }
+  
+  if( (N == 0) || (P_n_elem == 0) )  { return; }
+  
+  // as per Matlab: the sorted elements are taken to be the quantiles at (0.5 / N), (1.5 / N), ..., ((N-0.5) / N),
+  // with linear interpolation in between
+  
+  podarray<uword> pos_a(P_n_elem);
+  podarray<uword> pos_b(P_n_elem);
+  podarray<eT>    weight_b(P_n_elem);
+  podarray<uword> ranks(2*P_n_elem);
+  
+  for(uword j=0; j < P_n_elem; ++j)
+    {
+    const eT h = eT(N) * P_mem[j] + eT(0.5);  // position among the sorted elements, counting from 1
+    
+    if(h <= eT(1))
+      {
+      pos_a[j] = 0;  pos_b[j] = 0;  weight_b[j] = eT(0);
+      }
+    else
+    if(h >= eT(N))
+      {
+      pos_a[j] = N-1;  pos_b[j] = N-1;  weight_b[j] = eT(0);
+      }
+    else
+      {
+      const eT h_floor = std::floor(h);
+      
+      pos_a[j]    = uword(h_floor) - 1;
+      pos_b[j]    = uword(h_floor);
+      weight_b[j] = h - h_floor;
+      }
+    
+    ranks[2*j  ] = pos_a[j];
+    ranks[2*j+1] = pos_b[j];
+    }
+  
+  std::sort( ranks.memptr(), ranks.memptr() + ranks.n_elem );
+  
+  const uword n_ranks = uword( std::unique(ranks.memptr(), ranks.memptr() + ranks.n_elem) - ranks.memptr() );
+  
+  glue_quantile_worker<eT> worker;
+  
+  worker.out      = &out;
+  worker.dim      = dim;
+  worker.ranks    = ranks.memptr();
+  worker.n_ranks  = n_ranks;
+  worker.pos_a    = pos_a.memptr();
+  worker.pos_b    = pos_b.memptr();
+  worker.weight_b = weight_b.memptr();
+  worker.n_probs  = P_n_elem;
+  
+  op_median::apply_to_vecs(X, dim, worker);
+  }
+
+
+
+template<typename T1, typename T2>
+inline
+void
+glue_quantile::apply(Mat<typename T1::elem_type>& out, const Glue<T1,T2,glue_quantile>& expr)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  const uword dim = expr.aux_uword;
+  
+  arma_debug_check( (dim > 1), "quantile(): parameter 'dim' must be 0 or 1" );
+  
+  const quasi_unwrap<T2> UP(expr.B);
+  
+  if(is_Mat<T1>::value)
+    {
+    const quasi_unwrap<T1> UX(expr.A);
+    
+    if(UX.is_alias(out) || UP.is_alias(out))
+      {
+      Mat<eT> tmp;
+      
+      glue_quantile::apply_noalias(tmp, UX.M, UP.M, dim);
+      
+      out.steal_mem(tmp);
+      }
+    else
+      {
+      glue_quantile::apply_noalias(out, UX.M, UP.M, dim);
+      }
+    }
+  else
+    {
+    // the columns of the evaluated expression are reordered in place, instead of being copied
+    
+    Mat<eT> X(expr.A);
+    
+    if(UP.is_alias(out))
+      {
+      Mat<eT> tmp;
+      
+      glue_quantile::apply_noalias(tmp, X, UP.M, dim);
+      
+      out.steal_mem(tmp);
+      }
+    else
+      {
+      glue_quantile::apply_noalias(out, X, UP.M, dim);
+      }
+    }
+  }
+
+
+
+template<typename T1, typename T2>
+inline
+void
+glue_quantile_default::apply(Mat<typename T1::elem_type>& out, const Glue<T1,T2,glue_quantile_default>& expr)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword dim = (T1::is_row) ? 1 : 0;
+  
+  glue_quantile::apply(out, Glue<T1,T2,glue_quantile>(expr.A, expr.B, dim));
+  }
+
+
+
+//! @}
@@ -54,15 +54,6 @@ namespace solve_opts
     : flags(in_flags)
     {}
   
-  inline
-  const opts
-  opts::operator+(const opts& rhs) const
-    {
-    const opts result( flags | rhs.flags );
-    
-    return result;
-    }
-  
   // The values below (eg. 1u << 1) are for internal Armadillo use only.
   // The values can change without notice.
   
@@ -72,6 +63,15 @@ namespace solve_opts
   static const uword flag_no_approx   = uword(1u << 2);
   static const uword flag_triu        = uword(1u << 3);
   static const uword flag_tril        = uword(1u << 4);
+  static const uword flag_band        = uword(1u << 5);
+  static const uword flag_band_auto   = uword(1u << 6);
+  
+  // The bandwidths given to band() are stored in the upper bits of the flags.
+  // Bandwidths which are too large to be stored are determined from the matrix instead (flag_band_auto).
+  
+  static const uword band_shift = uword(8);
+  static const uword band_bits  = uword( (sizeof(uword)*8 - 8) / 2 );
+  static const uword band_mask  = (uword(1) << band_bits) - uword(1);
   
   struct opts_none        : public opts { inline opts_none()        : opts(flag_none       ) {} };
   struct opts_fast        : public opts { inline opts_fast()        : opts(flag_fast       ) {} };
@@ -86,6 +86,19 @@ namespace solve_opts
   static const opts_no_approx   no_approx;
   static const opts_triu        triu;
   static const opts_tril        tril;
+  
+  //! band matrix with kl sub-diagonals and ku super-diagonals
+  inline
+  const opts
+  band(const uword kl, const uword ku)
+    {
+    const bool can_store = (kl <= band_mask) && (ku <= band_mask);
+    
+    return (can_store) ? opts(flag_band | (kl << band_shift) | (ku << (band_shift + band_bits))) : opts(flag_band | flag_band_auto);
+    }
+  
+  inline uword band_kl(const uword flags) { return ( flags >>  band_shift              ) & band_mask; }
+  inline uword band_ku(const uword flags) { return ( flags >> (band_shift + band_bits) ) & band_mask; }
   }
 
 
@@ -46,12 +46,14 @@ glue_solve_gen::apply(Mat<eT>& out, const Base<eT,T1>& A_expr, const Base<eT,T2>
   const bool fast        = bool(flags & solve_opts::flag_fast       );
   const bool equilibrate = bool(flags & solve_opts::flag_equilibrate);
   const bool no_approx   = bool(flags & solve_opts::flag_no_approx  );
+  const bool band        = bool(flags & solve_opts::flag_band       );
   
   arma_extra_debug_print("glue_solve_gen::apply(): enabled flags:");
   
   if(fast       )  { arma_extra_debug_print("fast");        }
   if(equilibrate)  { arma_extra_debug_print("equilibrate"); }
   if(no_approx  )  { arma_extra_debug_print("no_approx");   }
+  if(band       )  { arma_extra_debug_print("band");        }
   
   T    rcond  = T(0);
   bool status = false;
@@ -62,19 +64,134 @@ glue_solve_gen::apply(Mat<eT>& out, const Base<eT,T1>& A_expr, const Base<eT,T2>
     {
     arma_extra_debug_print("glue_solve_gen::apply(): detected square system");
     
-    if(fast)
+    // look for structure which allows a cheaper solver than LU decomposition of a dense matrix;
+    // structure is not detected when equilibration is requested, as only the dense solver provides it
+    
+    const bool detect = (band == false) && (equilibrate == false);
+    
+    uword KL = (band) ? solve_opts::band_kl(flags) : uword(0);
+    uword KU = (band) ? solve_opts::band_ku(flags) : uword(0);
+    
+    if( band && bool(flags & solve_opts::flag_band_auto) )
+      {
+      arma_extra_debug_print("glue_solve_gen::apply(): bandwidths too large to be stored; finding them in A");
+      
+      band_helper::find_band(KL, KU, A, uword(ARMA_MAX_UWORD));
+      }
+    
+    const bool is_band  = (band) || ( detect && band_helper::is_band(KL, KU, A, uword(32)) );
+    const bool is_triu  = (detect) && (is_band == false) && trimat_helper::is_triu(A);
+    const bool is_tril  = (detect) && (is_band == false) && (is_triu == false) && trimat_helper::is_tril(A);
+    const bool is_sympd = (detect) && (is_band == false) && (is_triu == false) && (is_tril == false) && sympd_helper::guess_sympd(A);
+    
+    bool use_gen = true;
+    
+    if(is_band)
       {
-      arma_extra_debug_print("glue_solve_gen::apply(): (fast)");
+      arma_debug_check( ((KL >= A.n_rows) || (KU >= A.n_rows)) && (A.n_rows > 0), "solve(): bandwidth must be less than the number of rows" );
+      
+      if(equilibrate)  { arma_debug_warn("solve(): option 'equilibrate' ignored for band matrices"); }
       
-      if(equilibrate)  { arma_debug_warn("solve(): option 'equilibrate' ignored, as option 'fast' is enabled"); }
+      if( (KL == 0) && (KU == 0) )
+        {
+        arma_extra_debug_print("glue_solve_gen::apply(): (diagonal)");
+        
+        status = auxlib::solve_diag(out, rcond, A, B_expr.get_ref());
+        }
+      else
+      if(fast)
+        {
+        if( (KL == 1) && (KU == 1) )
+          {
+          arma_extra_debug_print("glue_solve_gen::apply(): (tridiagonal, fast)");
+          
+          status = auxlib::solve_tridiag_fast(out, A, B_expr.get_ref());
+          }
+        else
+          {
+          arma_extra_debug_print("glue_solve_gen::apply(): (band, fast)");
+          
+          status = auxlib::solve_band_fast(out, A, KL, KU, B_expr.get_ref());
+          }
+        }
+      else
+        {
+        arma_extra_debug_print("glue_solve_gen::apply(): (band)");
+        
+        status = auxlib::solve_band_rcond(out, rcond, A, KL, KU, B_expr.get_ref());
+        }
       
-      status = auxlib::solve_square_fast(out, A, B_expr.get_ref());  // A is overwritten
+      use_gen = false;
       }
     else
+    if(is_triu || is_tril)
       {
-      arma_extra_debug_print("glue_solve_gen::apply(): (refine)");
+      const uword layout = (is_triu) ? uword(0) : uword(1);
+      
+      if(fast)
+        {
+        arma_extra_debug_print("glue_solve_gen::apply(): (triangular, fast)");
+        
+        status = auxlib::solve_tri(out, A, B_expr.get_ref(), layout);
+        }
+      else
+        {
+        arma_extra_debug_print("glue_solve_gen::apply(): (triangular)");
+        
+        status = auxlib::solve_tri_rcond(out, rcond, A, B_expr.get_ref(), layout);
+        }
       
-      status = auxlib::solve_square_refine(out, rcond, A, B_expr, equilibrate);  // A is overwritten
+      use_gen = false;
+      }
+    else
+    if(is_sympd)
+      {
+      if(fast)
+        {
+        arma_extra_debug_print("glue_solve_gen::apply(): (sympd, fast)");
+        
+        status = auxlib::solve_sympd_fast(out, A, B_expr.get_ref());  // A is overwritten
+        }
+      else
+        {
+        arma_extra_debug_print("glue_solve_gen::apply(): (sympd)");
+        
+        status = auxlib::solve_sympd_rcond(out, rcond, A, B_expr.get_ref());  // A is overwritten
+        }
+      
+      if(status == false)
+        {
+        arma_extra_debug_print("glue_solve_gen::apply(): matrix is not positive definite; using general solver");
+        
+        A = A_expr.get_ref();
+        }
+      
+      use_gen = (status == false);
+      }
+    
+    // the structured solvers only estimate rcond; treat badly conditioned systems in the same way as the dense solver
+    
+    if( (use_gen == false) && (fast == false) && (status == true) && (rcond < std::numeric_limits<T>::epsilon()) )
+      {
+      status = false;
+      }
+    
+    if(use_gen)
+      {
+      if(fast)
+        {
+        arma_extra_debug_print("glue_solve_gen::apply(): (fast)");
+        
+        if(equilibrate)  { arma_debug_warn("solve(): option 'equilibrate' ignored, as option 'fast' is enabled"); }
+        
+        status = auxlib::solve_square_fast(out, A, B_expr.get_ref());  // A is overwritten
+        }
+      else
+        {
+        arma_extra_debug_print("glue_solve_gen::apply(): (refine)");
+        
+        status = auxlib::solve_square_refine(out, rcond, A, B_expr, equilibrate);  // A is overwritten
+        }
       }
     
     if( (status == false) && (no_approx == false) )
@@ -199,4 +316,22 @@ glue_solve_tri::apply(Mat<eT>& out, const Base<eT,T1>& A_expr, const Base<eT,T2>
 
 
 
+//
+// solve_opts
+
+
+//! the bandwidths of two band() options can't be stored together, so combining them is rejected
+inline
+const solve_opts::opts
+solve_opts::opts::operator+(const opts& rhs) const
+  {
+  arma_debug_check( ((flags & rhs.flags & flag_band) != uword(0)), "solve(): band() options can't be combined" );
+  
+  const opts result( flags | rhs.flags );
+  
+  return result;
+  }
+
+
+
 //! @}
@@ -37,12 +37,14 @@ struct gmm_seed_static_subset : public gmm_seed_mode { inline gmm_seed_static_su
 struct gmm_seed_static_spread : public gmm_seed_mode { inline gmm_seed_static_spread() : gmm_seed_mode(3) {} };
 struct gmm_seed_random_subset : public gmm_seed_mode { inline gmm_seed_random_subset() : gmm_seed_mode(4) {} };
 struct gmm_seed_random_spread : public gmm_seed_mode { inline gmm_seed_random_spread() : gmm_seed_mode(5) {} };
+struct gmm_seed_random_pp     : public gmm_seed_mode { inline gmm_seed_random_pp()     : gmm_seed_mode(6) {} };
 
 static const gmm_seed_keep_existing keep_existing;
 static const gmm_seed_static_subset static_subset;
 static const gmm_seed_static_spread static_spread;
 static const gmm_seed_random_subset random_subset;
 static const gmm_seed_random_spread random_spread;
+static const gmm_seed_random_pp     random_pp;
 
 
 namespace gmm_priv
@@ -50,6 +52,8 @@ namespace gmm_priv
 
 struct gmm_empty_arg {};
 
+template<typename eT> class gmm_full;
+
 
 #if defined(_OPENMP)
   struct arma_omp_state
@@ -144,7 +148,8 @@ class gmm_diag
     const uword           n_gaus,
     const gmm_seed_mode&  seed_mode,
     const uword           km_iter,
-    const bool            print_mode
+    const bool            print_mode,
+    const uword           batch_size
     );
   
   
@@ -152,6 +157,7 @@ class gmm_diag
   
   protected:
   
+  friend class gmm_full<eT>;  // gmm_full uses the k-means implementation
   
   arma_aligned Row<eT> log_det_etc;
   arma_aligned Row<eT> log_hefts;
@@ -164,9 +170,9 @@ class gmm_diag
   inline void init(const uword in_n_dim, const uword in_n_gaus);
   
   inline void init_constants();
-
+  
   inline umat internal_gen_boundaries(const uword N) const;
-
+  
   inline eT internal_scalar_log_p(const eT* x                     ) const;
   inline eT internal_scalar_log_p(const eT* x, const uword gaus_id) const;
   
@@ -190,7 +196,13 @@ class gmm_diag
   
   template<uword dist_id> inline bool km_iterate(const Mat<eT>& X, const uword max_iter, const bool verbose, const char* signature);
   
-  template<uword dist_id> inline void km_update_stats(const Mat<eT>& X, const uword start_index, const uword end_index, const Mat<eT>& old_means, field< running_mean_vec<eT> >& running_means) const;
+  template<uword dist_id> inline void km_update_stats(const Mat<eT>& X, const uword start_index, const uword end_index, const Mat<eT>& old_means, const Col<eT>& half_min_dists, const Col<eT>& mean_moves, const Col<eT>& lower_shifts, uvec& assignments, Col<eT>& upper_bounds, Col<eT>& lower_bounds, field< running_mean_vec<eT> >& running_means) const;
+  
+  template<uword dist_id> inline void km_half_min_dists(Col<eT>& half_min_dists, const Mat<eT>& cur_means) const;
+  
+  template<uword dist_id> inline bool km_iterate_batch(const Mat<eT>& X, const uword max_iter, const uword batch_size, const bool verbose, const char* signature);
+  
+  template<uword dist_id> inline void km_batch_stats(const Mat<eT>& X, const uvec& batch, const uword start_index, const uword end_index, const Mat<eT>& cur_means, Mat<eT>& acc_means, uvec& acc_counts) const;
   
   //
   
@@ -661,7 +661,8 @@ gmm_diag<eT>::learn
     || (seed_mode == static_subset)
     || (seed_mode == static_spread)
     || (seed_mode == random_subset)
-    || (seed_mode == random_spread);
+    || (seed_mode == random_spread)
+    || (seed_mode == random_pp);
   
   arma_debug_check( (dist_mode_ok == false), "gmm_diag::learn(): dist_mode must be eucl_dist or maha_dist" );
   arma_debug_check( (seed_mode_ok == false), "gmm_diag::learn(): unknown seed_mode"                        );
@@ -781,7 +782,8 @@ gmm_diag<eT>::kmeans_wrapper
   const uword          N_gaus,
   const gmm_seed_mode& seed_mode,
   const uword          km_iter,
-  const bool           print_mode
+  const bool           print_mode,
+  const uword          batch_size
   )
   {
   arma_extra_debug_sigprint();
@@ -791,7 +793,8 @@ gmm_diag<eT>::kmeans_wrapper
     || (seed_mode == static_subset)
     || (seed_mode == static_spread)
     || (seed_mode == random_subset)
-    || (seed_mode == random_spread);
+    || (seed_mode == random_spread)
+    || (seed_mode == random_pp);
   
   arma_debug_check( (seed_mode_ok == false), "kmeans(): unknown seed_mode" );
   
@@ -835,7 +838,7 @@ gmm_diag<eT>::kmeans_wrapper
     
     bool status = false;
     
-    status = km_iterate<1>(X, km_iter, print_mode, "kmeans()");
+    status = (batch_size > 0) ? km_iterate_batch<1>(X, km_iter, batch_size, print_mode, "kmeans()") : km_iterate<1>(X, km_iter, print_mode, "kmeans()");
     
     stream_state.restore(get_stream_err2());
     
@@ -1588,6 +1591,98 @@ gmm_diag<eT>::generate_initial_means(const Mat<eT>& X, const gmm_seed_mode& seed
       access::rw(means).col(g) = X.unsafe_col(best_i);
       }
     }
+  else
+  if(seed_mode == random_pp)
+    {
+    // k-means++: each new mean is a sample chosen with probability proportional to
+    // its squared distance from the nearest mean chosen so far
+    
+    const uword N = X.n_cols;
+    
+    access::rw(means).col(0) = X.unsafe_col( as_scalar(randi<uvec>(1, distr_param(0,N-1))) );
+    
+    Col<eT> min_dists(N);
+    
+    min_dists.fill(Datum<eT>::inf);
+    
+    eT* min_dists_mem = min_dists.memptr();
+    
+    const eT* mah_aux_mem = mah_aux.memptr();
+    
+    #if defined(_OPENMP)
+      const arma_omp_state save_omp_state;
+      
+      const umat boundaries = internal_gen_boundaries(N);
+      
+      const uword n_threads = boundaries.n_cols;
+    #endif
+    
+    for(uword g=1; g < N_gaus; ++g)
+      {
+      const eT* last_mean = means.colptr(g-1);
+      
+      #if defined(_OPENMP)
+        {
+        #pragma omp parallel for
+        for(uword t=0; t < n_threads; ++t)
+          {
+          const uword start_index = boundaries.at(0,t);
+          const uword   end_index = boundaries.at(1,t);
+          
+          for(uword i=start_index; i <= end_index; ++i)
+            {
+            const eT dist = distance<eT,dist_id>::eval(N_dims, X.colptr(i), last_mean, mah_aux_mem);
+            
+            if(dist < min_dists_mem[i])  { min_dists_mem[i] = dist; }
+            }
+          }
+        }
+      #else
+        {
+        for(uword i=0; i < N; ++i)
+          {
+          const eT dist = distance<eT,dist_id>::eval(N_dims, X.colptr(i), last_mean, mah_aux_mem);
+          
+          if(dist < min_dists_mem[i])  { min_dists_mem[i] = dist; }
+          }
+        }
+      #endif
+      
+      double total = double(0);
+      
+      for(uword i=0; i < N; ++i)  { total += double(min_dists_mem[i]); }
+      
+      uword best_i = N;
+      
+      if(total > double(0))
+        {
+        const double threshold = total * randu<double>();
+        
+        double acc = double(0);
+        
+        for(uword i=0; i < N; ++i)
+          {
+          acc += double(min_dists_mem[i]);
+          
+          if( (acc >= threshold) && (min_dists_mem[i] > eT(0)) )  { best_i = i; break; }
+          }
+        
+        // guard against round-off in the running sum
+        if(best_i == N)
+          {
+          for(uword i=N; i > 0; --i)
+            {
+            if(min_dists_mem[i-1] > eT(0))  { best_i = i-1; break; }
+            }
+          }
+        }
+      
+      // all samples coincide with the means chosen so far
+      if(best_i == N)  { best_i = as_scalar(randi<uvec>(1, distr_param(0,N-1))); }
+      
+      access::rw(means).col(g) = X.unsafe_col(best_i);
+      }
+    }
   
   // get_stream_err2() << "generate_initial_means():" << '\n';
   // means.print();
@@ -1646,7 +1741,9 @@ gmm_diag<eT>::generate_initial_dcovs_and_hefts(const Mat<eT>& X, const eT var_fl
 
 
 
-//! multi-threaded implementation of k-means, inspired by MapReduce
+//! multi-threaded implementation of k-means, inspired by MapReduce.
+//! distance bounds (Hamerly's algorithm) are kept for each sample,
+//! so that most samples are not compared against all means in each iteration.
 template<typename eT>
 template<uword dist_id>
 inline
@@ -1678,6 +1775,19 @@ gmm_diag<eT>::km_iterate(const Mat<eT>& X, const uword max_iter, const bool verb
   
   const eT* mah_aux_mem = mah_aux.memptr();
   
+  // for each sample: assigned mean, upper bound on the distance to the assigned mean,
+  // and lower bound on the distance to all other means
+  
+  uvec    assignments(X.n_cols, fill::zeros);
+  Col<eT> upper_bounds(X.n_cols);
+  Col<eT> lower_bounds(X.n_cols, fill::zeros);
+  
+  upper_bounds.fill(Datum<eT>::inf);
+  
+  Col<eT> half_min_dists(N_gaus);
+  Col<eT> mean_moves(N_gaus, fill::zeros);
+  Col<eT> lower_shifts(N_gaus, fill::zeros);
+  
   
   #if defined(_OPENMP)
     const arma_omp_state save_omp_state;
@@ -1701,6 +1811,8 @@ gmm_diag<eT>::km_iterate(const Mat<eT>& X, const uword max_iter, const bool verb
   
   for(uword iter=1; iter <= max_iter; ++iter)
     {
+    km_half_min_dists<dist_id>(half_min_dists, old_means);
+    
     #if defined(_OPENMP)
       {
       for(uword t=0; t < n_threads; ++t)
@@ -1716,7 +1828,7 @@ gmm_diag<eT>::km_iterate(const Mat<eT>& X, const uword max_iter, const bool verb
         {
         field< running_mean_vec<eT> >& current_running_means = t_running_means[t];
         
-        km_update_stats<dist_id>(X, boundaries.at(0,t), boundaries.at(1,t), old_means, current_running_means);
+        km_update_stats<dist_id>(X, boundaries.at(0,t), boundaries.at(1,t), old_means, half_min_dists, mean_moves, lower_shifts, assignments, upper_bounds, lower_bounds, current_running_means);
         }
       
       
@@ -1759,7 +1871,7 @@ gmm_diag<eT>::km_iterate(const Mat<eT>& X, const uword max_iter, const bool verb
       {
       for(uword g=0; g < N_gaus; ++g)  { running_means[g].reset(); }
       
-      km_update_stats<dist_id>(X, 0, X.n_cols-1, old_means, running_means);
+      km_update_stats<dist_id>(X, 0, X.n_cols-1, old_means, half_min_dists, mean_moves, lower_shifts, assignments, upper_bounds, lower_bounds, running_means);
       }
     #endif
     
@@ -1841,9 +1953,29 @@ gmm_diag<eT>::km_iterate(const Mat<eT>& X, const uword max_iter, const bool verb
     
     for(uword g=0; g < N_gaus; ++g)
       {
-      rs_delta( distance<eT,dist_id>::eval(N_dims, old_means.colptr(g), new_means.colptr(g), mah_aux_mem) );
+      const eT dist = distance<eT,dist_id>::eval(N_dims, old_means.colptr(g), new_means.colptr(g), mah_aux_mem);
+      
+      rs_delta(dist);
+      
+      mean_moves[g] = std::sqrt(dist);
       }
     
+    // the lower bound of a sample is loosened by the largest movement among the means it is not assigned to
+    
+    uword max_g     = 0;
+    eT    max_move1 = eT(0);
+    eT    max_move2 = eT(0);
+    
+    for(uword g=0; g < N_gaus; ++g)
+      {
+      const eT move = mean_moves[g];
+      
+           if(move > max_move1)  { max_move2 = max_move1; max_move1 = move; max_g = g; }
+      else if(move > max_move2)  { max_move2 = move; }
+      }
+    
+    for(uword g=0; g < N_gaus; ++g)  { lower_shifts[g] = (g == max_g) ? max_move2 : max_move1; }
+    
     if(verbose)
       {
       get_stream_err2() << signature << ": iteration: ";
@@ -1873,40 +2005,270 @@ template<typename eT>
 template<uword dist_id>
 inline
 void
-gmm_diag<eT>::km_update_stats(const Mat<eT>& X, const uword start_index, const uword end_index, const Mat<eT>& old_means, field< running_mean_vec<eT> >& running_means) const
+gmm_diag<eT>::km_update_stats
+  (
+  const Mat<eT>&                 X,
+  const uword                    start_index,
+  const uword                    end_index,
+  const Mat<eT>&                 old_means,
+  const Col<eT>&                 half_min_dists,
+  const Col<eT>&                 mean_moves,
+  const Col<eT>&                 lower_shifts,
+        uvec&                    assignments,
+        Col<eT>&                 upper_bounds,
+        Col<eT>&                 lower_bounds,
+  field< running_mean_vec<eT> >& running_means
+  ) const
   {
   arma_extra_debug_sigprint();
   
-  // get_stream_err2() << "km_update_stats(): start_index: " << start_index << '\n';
-  // get_stream_err2() << "km_update_stats():   end_index: " <<   end_index << '\n';
-  
   const uword N_dims = means.n_rows;
   const uword N_gaus = means.n_cols;
   
   const eT* mah_aux_mem = mah_aux.memptr();
   
+  uword* assignments_mem  = assignments.memptr();
+  eT*    upper_bounds_mem = upper_bounds.memptr();
+  eT*    lower_bounds_mem = lower_bounds.memptr();
+  
   for(uword i=start_index; i <= end_index; ++i)
     {
     const eT* X_colptr = X.colptr(i);
     
+    uword best_g = assignments_mem[i];
+    
+    // account for the movement of the means during the previous iteration
+    
+    eT upper = upper_bounds_mem[i] + mean_moves[best_g];
+    eT lower = lower_bounds_mem[i] - lower_shifts[best_g];
+    
+    const eT bound = (std::max)(half_min_dists[best_g], lower);
+    
+    if(upper > bound)
+      {
+      upper = std::sqrt( distance<eT,dist_id>::eval(N_dims, X_colptr, old_means.colptr(best_g), mah_aux_mem) );
+      
+      if(upper > bound)
+        {
+        // the bounds can't exclude the other means; compare against all means
+        
+        double best_dist   = Datum<eT>::inf;
+        double second_dist = Datum<eT>::inf;
+        
+        for(uword g=0; g < N_gaus; ++g)
+          {
+          const double dist = distance<eT,dist_id>::eval(N_dims, X_colptr, old_means.colptr(g), mah_aux_mem);
+          
+          if(dist <= best_dist)  { second_dist = best_dist; best_dist = dist; best_g = g; }
+          else
+          if(dist < second_dist) { second_dist = dist; }
+          }
+        
+        upper = eT( std::sqrt(best_dist)   );
+        lower = eT( std::sqrt(second_dist) );
+        }
+      }
+    
+    assignments_mem[i]  = best_g;
+    upper_bounds_mem[i] = upper;
+    lower_bounds_mem[i] = lower;
+    
+    running_means[best_g]( X.unsafe_col(i), i );
+    }
+  }
+
+
+
+//! half of the distance from each mean to its nearest other mean;
+//! a sample closer than this to its assigned mean can't be closer to any other mean
+template<typename eT>
+template<uword dist_id>
+inline
+void
+gmm_diag<eT>::km_half_min_dists(Col<eT>& half_min_dists, const Mat<eT>& cur_means) const
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword N_dims = cur_means.n_rows;
+  const uword N_gaus = cur_means.n_cols;
+  
+  const eT* mah_aux_mem = mah_aux.memptr();
+  
+  half_min_dists.fill(Datum<eT>::inf);
+  
+  for(uword g=0; g < N_gaus; ++g)
+    {
+    for(uword h=(g+1); h < N_gaus; ++h)
+      {
+      const eT dist = eT(0.5) * std::sqrt( distance<eT,dist_id>::eval(N_dims, cur_means.colptr(g), cur_means.colptr(h), mah_aux_mem) );
+      
+      if(dist < half_min_dists[g])  { half_min_dists[g] = dist; }
+      if(dist < half_min_dists[h])  { half_min_dists[h] = dist; }
+      }
+    }
+  }
+
+
+
+//! mini-batch k-means: each iteration uses a random subset of the samples,
+//! and each mean is updated with a learning rate given by the number of samples assigned to it so far.
+//! only the samples in each batch are accessed, so X can be backed by a memory-mapped file larger than the available memory.
+template<typename eT>
+template<uword dist_id>
+inline
+bool
+gmm_diag<eT>::km_iterate_batch(const Mat<eT>& X, const uword max_iter, const uword batch_size, const bool verbose, const char* signature)
+  {
+  arma_extra_debug_sigprint();
+  
+  if(verbose)
+    {
+    get_stream_err2().unsetf(ios::showbase);
+    get_stream_err2().unsetf(ios::uppercase);
+    get_stream_err2().unsetf(ios::showpos);
+    get_stream_err2().unsetf(ios::scientific);
+    
+    get_stream_err2().setf(ios::right);
+    get_stream_err2().setf(ios::fixed);
+    }
+  
+  const uword N_dims = means.n_rows;
+  const uword N_gaus = means.n_cols;
+  
+  Mat<eT> cur_means = means;
+  
+  uvec counts(N_gaus, fill::zeros);
+  
+  running_mean_scalar<double> rs_delta;
+  
+  const eT* mah_aux_mem = mah_aux.memptr();
+  
+  #if defined(_OPENMP)
+    const arma_omp_state save_omp_state;
+    
+    const umat boundaries = internal_gen_boundaries(batch_size);
+  #else
+    umat boundaries(2,1);
+    
+    boundaries.at(0,0) = 0;
+    boundaries.at(1,0) = batch_size-1;
+  #endif
+  
+  const uword n_threads = boundaries.n_cols;
+  
+  field< Mat<eT> > t_acc_means(n_threads);
+  field< uvec    > t_acc_counts(n_threads);
+  
+  if(verbose)
+    {
+    get_stream_err2() << signature << ": n_threads: " << n_threads  << '\n';
+    }
+  
+  Col<eT> tmp_mean(N_dims);
+  
+  for(uword iter=1; iter <= max_iter; ++iter)
+    {
+    const uvec batch = randi<uvec>(batch_size, distr_param(0, X.n_cols-1));
+    
+    #if defined(_OPENMP)
+      {
+      #pragma omp parallel for
+      for(uword t=0; t < n_threads; ++t)
+        {
+        km_batch_stats<dist_id>(X, batch, boundaries.at(0,t), boundaries.at(1,t), cur_means, t_acc_means[t], t_acc_counts[t]);
+        }
+      }
+    #else
+      {
+      km_batch_stats<dist_id>(X, batch, 0, batch_size-1, cur_means, t_acc_means[0], t_acc_counts[0]);
+      }
+    #endif
+    
+    rs_delta.reset();
+    
+    for(uword g=0; g < N_gaus; ++g)
+      {
+      uword batch_count = 0;
+      
+      tmp_mean.zeros();
+      
+      for(uword t=0; t < n_threads; ++t)
+        {
+        batch_count += t_acc_counts[t][g];
+        
+        tmp_mean += t_acc_means[t].col(g);
+        }
+      
+      if(batch_count == 0)  { continue; }
+      
+      // equivalent to updating the mean with each sample in turn, using a learning rate of 1/count
+      
+      const uword new_count = counts[g] + batch_count;
+      
+      tmp_mean += eT(counts[g]) * cur_means.col(g);
+      tmp_mean /= eT(new_count);
+      
+      rs_delta( distance<eT,dist_id>::eval(N_dims, cur_means.colptr(g), tmp_mean.memptr(), mah_aux_mem) );
+      
+      cur_means.col(g) = tmp_mean;
+      counts[g]        = new_count;
+      }
+    
+    if(verbose)
+      {
+      get_stream_err2() << signature << ": iteration: ";
+      get_stream_err2().unsetf(ios::scientific);
+      get_stream_err2().setf(ios::fixed);
+      get_stream_err2().width(std::streamsize(4));
+      get_stream_err2() << iter;
+      get_stream_err2() << "   delta: ";
+      get_stream_err2().unsetf(ios::fixed);
+      get_stream_err2() << rs_delta.mean() << '\n';
+      }
+    
+    if(rs_delta.mean() <= Datum<eT>::eps)  { break; }
+    }
+  
+  access::rw(means) = cur_means;
+  
+  return true;
+  }
+
+
+
+template<typename eT>
+template<uword dist_id>
+inline
+void
+gmm_diag<eT>::km_batch_stats(const Mat<eT>& X, const uvec& batch, const uword start_index, const uword end_index, const Mat<eT>& cur_means, Mat<eT>& acc_means, uvec& acc_counts) const
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword N_dims = cur_means.n_rows;
+  const uword N_gaus = cur_means.n_cols;
+  
+  const eT* mah_aux_mem = mah_aux.memptr();
+  
+  acc_means.zeros(N_dims, N_gaus);
+  acc_counts.zeros(N_gaus);
+  
+  for(uword j=start_index; j <= end_index; ++j)
+    {
+    const eT* X_colptr = X.colptr( batch[j] );
+    
     double best_dist = Datum<eT>::inf;
     uword  best_g    = 0;
     
     for(uword g=0; g < N_gaus; ++g)
       {
-      const double dist = distance<eT,dist_id>::eval(N_dims, X_colptr, old_means.colptr(g), mah_aux_mem);
-      
-      // get_stream_err2() << "g: " << g << "   dist: " << dist << '\n';
-      // old_means.col(g).print("old_means.col(g):");
-      // vec tmp(old_means.colptr(g), old_means.n_rows);
-      // tmp.print("tmp:");
+      const double dist = distance<eT,dist_id>::eval(N_dims, X_colptr, cur_means.colptr(g), mah_aux_mem);
       
       if(dist <= best_dist)  { best_dist = dist; best_g = g; }
       }
     
-    // get_stream_err2() << "best_g: " << best_g << '\n';
+    arrayops::inplace_plus( acc_means.colptr(best_g), X_colptr, N_dims );
     
-    running_means[best_g]( X.unsafe_col(i), i );
+    acc_counts[best_g]++;
     }
   }
 
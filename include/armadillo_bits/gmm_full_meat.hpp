@@ -0,0 +1,1747 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+//! \addtogroup gmm_full
+//! @{
+
+
+namespace gmm_priv
+{
+
+
+template<typename eT>
+inline
+gmm_full<eT>::~gmm_full()
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  arma_type_check(( (is_same_type<eT,float>::value == false) && (is_same_type<eT,double>::value == false) ));
+  }
+
+
+
+template<typename eT>
+inline
+gmm_full<eT>::gmm_full()
+  {
+  arma_extra_debug_sigprint_this(this);
+  }
+
+
+
+template<typename eT>
+inline
+gmm_full<eT>::gmm_full(const gmm_full<eT>& x)
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  init(x);
+  }
+
+
+
+template<typename eT>
+inline
+const gmm_full<eT>&
+gmm_full<eT>::operator=(const gmm_full<eT>& x)
+  {
+  arma_extra_debug_sigprint();
+  
+  init(x);
+  
+  return *this;
+  }
+
+
+
+template<typename eT>
+inline
+gmm_full<eT>::gmm_full(const uword in_n_dims, const uword in_n_gaus)
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  init(in_n_dims, in_n_gaus);
+  }
+
+
+
+template<typename eT>
+inline
+void
+gmm_full<eT>::reset()
+  {
+  arma_extra_debug_sigprint();
+  
+  init(0, 0);
+  }
+
+
+
+template<typename eT>
+inline
+void
+gmm_full<eT>::reset(const uword in_n_dims, const uword in_n_gaus)
+  {
+  arma_extra_debug_sigprint();
+  
+  init(in_n_dims, in_n_gaus);
+  }
+
+
+
+template<typename eT>
+template<typename T1, typename T2, typename T3>
+inline
+void
+gmm_full<eT>::set_params(const Base<eT,T1>& in_means_expr, const BaseCube<eT,T2>& in_fcovs_expr, const Base<eT,T3>& in_hefts_expr)
+  {
+  arma_extra_debug_sigprint();
+  
+  const unwrap     <T1> tmp1(in_means_expr.get_ref());
+  const unwrap_cube<T2> tmp2(in_fcovs_expr.get_ref());
+  const unwrap     <T3> tmp3(in_hefts_expr.get_ref());
+  
+  const Mat <eT>& in_means = tmp1.M;
+  const Cube<eT>& in_fcovs = tmp2.M;
+  const Mat <eT>& in_hefts = tmp3.M;
+  
+  arma_debug_check
+    (
+       (in_fcovs.n_rows != in_means.n_rows) || (in_fcovs.n_cols != in_means.n_rows) || (in_fcovs.n_slices != in_means.n_cols)
+    || (in_hefts.n_cols != in_means.n_cols) || (in_hefts.n_rows != 1),
+    "gmm_full::set_params(): given parameters have inconsistent and/or wrong sizes"
+    );
+  
+  arma_debug_check( (in_means.is_finite() == false), "gmm_full::set_params(): given means have non-finite values" );
+  arma_debug_check( (in_fcovs.is_finite() == false), "gmm_full::set_params(): given fcovs have non-finite values" );
+  arma_debug_check( (in_hefts.is_finite() == false), "gmm_full::set_params(): given hefts have non-finite values" );
+  
+  for(uword g=0; g < in_fcovs.n_slices; ++g)
+    {
+    arma_debug_check( (any(in_fcovs.slice(g).diag() <= eT(0))), "gmm_full::set_params(): given fcovs have negative or zero values on the diagonal" );
+    }
+  
+  arma_debug_check( (any(vectorise(in_hefts) < eT(0))), "gmm_full::set_params(): given hefts have negative values" );
+  
+  const eT s = accu(in_hefts);
+  
+  arma_debug_check( ((s < (eT(1) - Datum<eT>::eps)) || (s > (eT(1) + Datum<eT>::eps))), "gmm_full::set_params(): sum of given hefts is not 1" );
+  
+  access::rw(means) = in_means;
+  access::rw(fcovs) = in_fcovs;
+  access::rw(hefts) = in_hefts;
+  
+  init_constants();
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+void
+gmm_full<eT>::set_means(const Base<eT,T1>& in_means_expr)
+  {
+  arma_extra_debug_sigprint();
+  
+  const unwrap<T1> tmp(in_means_expr.get_ref());
+  
+  const Mat<eT>& in_means = tmp.M;
+  
+  arma_debug_check( (size(in_means) != size(means)), "gmm_full::set_means(): given means have incompatible size" );
+  arma_debug_check( (in_means.is_finite() == false), "gmm_full::set_means(): given means have non-finite values" );
+  
+  access::rw(means) = in_means;
+  
+  init_constants();
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+void
+gmm_full<eT>::set_fcovs(const BaseCube<eT,T1>& in_fcovs_expr)
+  {
+  arma_extra_debug_sigprint();
+  
+  const unwrap_cube<T1> tmp(in_fcovs_expr.get_ref());
+  
+  const Cube<eT>& in_fcovs = tmp.M;
+  
+  arma_debug_check( (size(in_fcovs) != size(fcovs)), "gmm_full::set_fcovs(): given fcovs have incompatible size" );
+  arma_debug_check( (in_fcovs.is_finite() == false), "gmm_full::set_fcovs(): given fcovs have non-finite values" );
+  
+  for(uword g=0; g < in_fcovs.n_slices; ++g)
+    {
+    arma_debug_check( (any(in_fcovs.slice(g).diag() <= eT(0))), "gmm_full::set_fcovs(): given fcovs have negative or zero values on the diagonal" );
+    }
+  
+  access::rw(fcovs) = in_fcovs;
+  
+  init_constants();
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+void
+gmm_full<eT>::set_hefts(const Base<eT,T1>& in_hefts_expr)
+  {
+  arma_extra_debug_sigprint();
+  
+  const unwrap<T1> tmp(in_hefts_expr.get_ref());
+  
+  const Mat<eT>& in_hefts = tmp.M;
+  
+  arma_debug_check( (size(in_hefts) != size(hefts)),     "gmm_full::set_hefts(): given hefts have incompatible size" );
+  arma_debug_check( (in_hefts.is_finite() == false),     "gmm_full::set_hefts(): given hefts have non-finite values" );
+  arma_debug_check( (any(vectorise(in_hefts) <  eT(0))), "gmm_full::set_hefts(): given hefts have negative values"   );
+  
+  const eT s = accu(in_hefts);
+  
+  arma_debug_check( ((s < (eT(1) - Datum<eT>::eps)) || (s > (eT(1) + Datum<eT>::eps))), "gmm_full::set_hefts(): sum of given hefts is not 1" );
+  
+  // make sure all hefts are positive and non-zero
+  
+  const eT* in_hefts_mem = in_hefts.memptr();
+        eT*    hefts_mem = access::rw(hefts).memptr();
+  
+  for(uword i=0; i < hefts.n_elem; ++i)
+    {
+    hefts_mem[i] = (std::max)( in_hefts_mem[i], std::numeric_limits<eT>::min() );
+    }
+  
+  access::rw(hefts) /= accu(hefts);
+  
+  log_hefts = log(hefts);
+  }
+
+
+
+template<typename eT>
+inline
+uword
+gmm_full<eT>::n_dims() const
+  {
+  return means.n_rows;
+  }
+
+
+
+template<typename eT>
+inline
+uword
+gmm_full<eT>::n_gaus() const
+  {
+  return means.n_cols;
+  }
+
+
+
+//! the model is stored as a field of matrices: means, hefts, followed by one covariance matrix per gaussian
+template<typename eT>
+inline
+bool
+gmm_full<eT>::load(const std::string name)
+  {
+  arma_extra_debug_sigprint();
+  
+  field< Mat<eT> > storage;
+  
+  bool status = storage.load(name, arma_binary);
+  
+  if( (status == false) || (storage.n_elem < 2) )
+    {
+    reset();
+    return false;
+    }
+  
+  const Mat<eT>& storage_means = storage(0);
+  const Mat<eT>& storage_hefts = storage(1);
+  
+  const uword N_dims = storage_means.n_rows;
+  const uword N_gaus = storage_means.n_cols;
+  
+  if( (storage.n_elem != (N_gaus + 2)) || (storage_hefts.n_rows != 1) || (storage_hefts.n_cols != N_gaus) )
+    {
+    reset();
+    return false;
+    }
+  
+  for(uword g=0; g < N_gaus; ++g)
+    {
+    const Mat<eT>& storage_fcov = storage(g+2);
+    
+    if( (storage_fcov.n_rows != N_dims) || (storage_fcov.n_cols != N_dims) )
+      {
+      reset();
+      return false;
+      }
+    }
+  
+  access::rw(means) = storage_means;
+  access::rw(hefts) = storage_hefts;
+  
+  access::rw(fcovs).set_size(N_dims, N_dims, N_gaus);
+  
+  for(uword g=0; g < N_gaus; ++g)
+    {
+    access::rw(fcovs).slice(g) = storage(g+2);
+    }
+  
+  init_constants();
+  
+  return true;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+gmm_full<eT>::save(const std::string name) const
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword N_gaus = means.n_cols;
+  
+  field< Mat<eT> > storage(2 + N_gaus);
+  
+  storage(0) = means;
+  storage(1) = hefts;
+  
+  for(uword g=0; g < N_gaus; ++g)
+    {
+    storage(g+2) = fcovs.slice(g);
+    }
+  
+  const bool status = storage.save(name, arma_binary);
+  
+  return status;
+  }
+
+
+
+template<typename eT>
+inline
+Col<eT>
+gmm_full<eT>::generate() const
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword N_dims = means.n_rows;
+  const uword N_gaus = means.n_cols;
+  
+  Col<eT> out( (N_gaus > 0) ? N_dims : uword(0) );
+  
+  if(N_gaus > 0)
+    {
+    const double val = randu<double>();
+    
+    double csum    = double(0);
+    uword  gaus_id = 0;
+    
+    for(uword j=0; j < N_gaus; ++j)
+      {
+      csum += hefts[j];
+      
+      if(val <= csum)  { gaus_id = j; break; }
+      }
+    
+    out =  trans(chol_fcovs[gaus_id]) * randn< Col<eT> >(N_dims);
+    out += means.col(gaus_id);
+    }
+  
+  return out;
+  }
+
+
+
+template<typename eT>
+inline
+Mat<eT>
+gmm_full<eT>::generate(const uword N_vec) const
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword N_dims = means.n_rows;
+  const uword N_gaus = means.n_cols;
+  
+  Mat<eT> out( ( (N_gaus > 0) ? N_dims : uword(0) ), N_vec );
+  
+  if(N_gaus > 0)
+    {
+    const eT* hefts_mem = hefts.memptr();
+    
+    for(uword i=0; i < N_vec; ++i)
+      {
+      const double val = randu<double>();
+      
+      double csum    = double(0);
+      uword  gaus_id = 0;
+      
+      for(uword j=0; j < N_gaus; ++j)
+        {
+        csum += hefts_mem[j];
+        
+        if(val <= csum)  { gaus_id = j; break; }
+        }
+      
+      subview_col<eT> out_col = out.col(i);
+      
+      out_col =  trans(chol_fcovs[gaus_id]) * randn< Col<eT> >(N_dims);
+      out_col += means.col(gaus_id);
+      }
+    }
+  
+  return out;
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+eT
+gmm_full<eT>::log_p(const T1& expr, const gmm_empty_arg& junk1, typename enable_if<((is_arma_type<T1>::value) && (resolves_to_colvector<T1>::value == true))>::result* junk2) const
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk1);
+  arma_ignore(junk2);
+  
+  const quasi_unwrap<T1> tmp(expr);
+  
+  arma_debug_check( (tmp.M.n_rows != means.n_rows), "gmm_full::log_p(): incompatible dimensions" );
+  
+  return internal_scalar_log_p( tmp.M.memptr() );
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+eT
+gmm_full<eT>::log_p(const T1& expr, const uword gaus_id, typename enable_if<((is_arma_type<T1>::value) && (resolves_to_colvector<T1>::value == true))>::result* junk2) const
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk2);
+  
+  const quasi_unwrap<T1> tmp(expr);
+  
+  arma_debug_check( (tmp.M.n_rows != means.n_rows), "gmm_full::log_p(): incompatible dimensions" );
+  
+  arma_debug_check( (gaus_id >= means.n_cols), "gmm_full::log_p(): specified gaussian is out of range" );
+  
+  return internal_scalar_log_p( tmp.M.memptr(), gaus_id );
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+Row<eT>
+gmm_full<eT>::log_p(const T1& expr, const gmm_empty_arg& junk1, typename enable_if<((is_arma_type<T1>::value) && (resolves_to_colvector<T1>::value == false))>::result* junk2) const
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk1);
+  arma_ignore(junk2);
+  
+  Row<eT> out;
+  
+  if(is_subview<T1>::value)
+    {
+    const subview<eT>& X = reinterpret_cast< const subview<eT>& >(expr);
+    
+    internal_vec_log_p(out, X, 0, true);
+    }
+  else
+    {
+    const unwrap<T1>   tmp(expr);
+    const Mat<eT>& X = tmp.M;
+    
+    internal_vec_log_p(out, X, 0, true);
+    }
+  
+  return out;
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+Row<eT>
+gmm_full<eT>::log_p(const T1& expr, const uword gaus_id, typename enable_if<((is_arma_type<T1>::value) && (resolves_to_colvector<T1>::value == false))>::result* junk2) const
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk2);
+  
+  arma_debug_check( (gaus_id >= means.n_cols), "gmm_full::log_p(): specified gaussian is out of range" );
+  
+  Row<eT> out;
+  
+  if(is_subview<T1>::value)
+    {
+    const subview<eT>& X = reinterpret_cast< const subview<eT>& >(expr);
+    
+    internal_vec_log_p(out, X, gaus_id, false);
+    }
+  else
+    {
+    const unwrap<T1>   tmp(expr);
+    const Mat<eT>& X = tmp.M;
+    
+    internal_vec_log_p(out, X, gaus_id, false);
+    }
+  
+  return out;
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+eT
+gmm_full<eT>::avg_log_p(const Base<eT,T1>& expr) const
+  {
+  arma_extra_debug_sigprint();
+  
+  const unwrap<T1>   tmp(expr.get_ref());
+  const Mat<eT>& X = tmp.M;
+  
+  if(X.n_cols == 0)  { return (-Datum<eT>::inf); }
+  
+  Row<eT> out;
+  
+  internal_vec_log_p(out, X, 0, true);
+  
+  return mean(out);
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+eT
+gmm_full<eT>::avg_log_p(const Base<eT,T1>& expr, const uword gaus_id) const
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_check( (gaus_id >= means.n_cols), "gmm_full::avg_log_p(): specified gaussian is out of range" );
+  
+  const unwrap<T1>   tmp(expr.get_ref());
+  const Mat<eT>& X = tmp.M;
+  
+  if(X.n_cols == 0)  { return (-Datum<eT>::inf); }
+  
+  Row<eT> out;
+  
+  internal_vec_log_p(out, X, gaus_id, false);
+  
+  return mean(out);
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+uword
+gmm_full<eT>::assign(const T1& expr, const gmm_dist_mode& dist, typename enable_if<((is_arma_type<T1>::value) && (resolves_to_colvector<T1>::value == true))>::result* junk) const
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  if(is_subview_col<T1>::value)
+    {
+    const subview_col<eT>& X = reinterpret_cast< const subview_col<eT>& >(expr);
+    
+    return internal_scalar_assign(X, dist);
+    }
+  else
+    {
+    const unwrap<T1>   tmp(expr);
+    const Mat<eT>& X = tmp.M;
+    
+    return internal_scalar_assign(X, dist);
+    }
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+urowvec
+gmm_full<eT>::assign(const T1& expr, const gmm_dist_mode& dist, typename enable_if<((is_arma_type<T1>::value) && (resolves_to_colvector<T1>::value == false))>::result* junk) const
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  urowvec out;
+  
+  if(is_subview<T1>::value)
+    {
+    const subview<eT>& X = reinterpret_cast< const subview<eT>& >(expr);
+    
+    internal_vec_assign(out, X, dist);
+    }
+  else
+    {
+    const unwrap<T1>   tmp(expr);
+    const Mat<eT>& X = tmp.M;
+    
+    internal_vec_assign(out, X, dist);
+    }
+  
+  return out;
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+urowvec
+gmm_full<eT>::raw_hist(const Base<eT,T1>& expr, const gmm_dist_mode& dist_mode) const
+  {
+  arma_extra_debug_sigprint();
+  
+  const unwrap<T1>   tmp(expr.get_ref());
+  const Mat<eT>& X = tmp.M;
+  
+  arma_debug_check( (X.n_rows != means.n_rows), "gmm_full::raw_hist(): incompatible dimensions" );
+  
+  arma_debug_check( ((dist_mode != eucl_dist) && (dist_mode != prob_dist)), "gmm_full::raw_hist(): unsupported distance mode" );
+  
+  urowvec hist;
+  
+  internal_raw_hist(hist, X, dist_mode);
+  
+  return hist;
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+Row<eT>
+gmm_full<eT>::norm_hist(const Base<eT,T1>& expr, const gmm_dist_mode& dist_mode) const
+  {
+  arma_extra_debug_sigprint();
+  
+  const unwrap<T1>   tmp(expr.get_ref());
+  const Mat<eT>& X = tmp.M;
+  
+  arma_debug_check( (X.n_rows != means.n_rows), "gmm_full::norm_hist(): incompatible dimensions" );
+  
+  arma_debug_check( ((dist_mode != eucl_dist) && (dist_mode != prob_dist)), "gmm_full::norm_hist(): unsupported distance mode" );
+  
+  urowvec hist;
+  
+  internal_raw_hist(hist, X, dist_mode);
+  
+  const uword  hist_n_elem = hist.n_elem;
+  const uword* hist_mem    = hist.memptr();
+  
+  eT acc = eT(0);
+  for(uword i=0; i<hist_n_elem; ++i)  { acc += eT(hist_mem[i]); }
+  
+  if(acc == eT(0))  { acc = eT(1); }
+  
+  Row<eT> out(hist_n_elem);
+  
+  eT* out_mem = out.memptr();
+  
+  for(uword i=0; i<hist_n_elem; ++i)  { out_mem[i] = eT(hist_mem[i]) / acc; }
+  
+  return out;
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+bool
+gmm_full<eT>::learn
+  (
+  const Base<eT,T1>&   data,
+  const uword          N_gaus,
+  const gmm_dist_mode& dist_mode,
+  const gmm_seed_mode& seed_mode,
+  const uword          km_iter,
+  const uword          em_iter,
+  const eT             var_floor,
+  const bool           print_mode
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  const bool dist_mode_ok = (dist_mode == eucl_dist) || (dist_mode == maha_dist);
+  
+  const bool seed_mode_ok = \
+       (seed_mode == keep_existing)
+    || (seed_mode == static_subset)
+    || (seed_mode == static_spread)
+    || (seed_mode == random_subset)
+    || (seed_mode == random_spread)
+    || (seed_mode == random_pp);
+  
+  arma_debug_check( (dist_mode_ok == false), "gmm_full::learn(): dist_mode must be eucl_dist or maha_dist" );
+  arma_debug_check( (seed_mode_ok == false), "gmm_full::learn(): unknown seed_mode"                        );
+  arma_debug_check( (var_floor < eT(0)    ), "gmm_full::learn(): variance floor is negative"               );
+  
+  const unwrap<T1>   tmp_X(data.get_ref());
+  const Mat<eT>& X = tmp_X.M;
+  
+  if(X.is_empty()          )  { arma_debug_warn("gmm_full::learn(): given matrix is empty"             ); return false; }
+  if(X.is_finite() == false)  { arma_debug_warn("gmm_full::learn(): given matrix has non-finite values"); return false; }
+  
+  if(N_gaus == 0)  { reset(); return true; }
+  
+  
+  // the means are seeded and refined by the k-means implementation in gmm_diag
+  
+  gmm_diag<eT> km;
+  
+  if(dist_mode == maha_dist)
+    {
+    km.mah_aux = var(X,1,1);
+    
+    const uword mah_aux_n_elem = km.mah_aux.n_elem;
+          eT*   mah_aux_mem    = km.mah_aux.memptr();
+    
+    for(uword i=0; i < mah_aux_n_elem; ++i)
+      {
+      const eT val = mah_aux_mem[i];
+      
+      mah_aux_mem[i] = ((val != eT(0)) && arma_isfinite(val)) ? eT(1) / val : eT(1);
+      }
+    }
+  
+  
+  // copy current model, in case of failure by k-means and/or EM
+  
+  const gmm_full<eT> orig = (*this);
+  
+  
+  // initial means
+  
+  if(seed_mode == keep_existing)
+    {
+    if(means.is_empty()        )  { arma_debug_warn("gmm_full::learn(): no existing means"      ); return false; }
+    if(X.n_rows != means.n_rows)  { arma_debug_warn("gmm_full::learn(): dimensionality mismatch"); return false; }
+    
+    access::rw(km.means) = means;
+    }
+  else
+    {
+    if(X.n_cols < N_gaus)  { arma_debug_warn("gmm_full::learn(): number of vectors is less than number of gaussians"); return false; }
+    
+    reset(X.n_rows, N_gaus);
+    
+    access::rw(km.means).zeros(X.n_rows, N_gaus);
+    
+    if(print_mode)  { get_stream_err2() << "gmm_full::learn(): generating initial means\n"; }
+    
+         if(dist_mode == eucl_dist)  { km.template generate_initial_means<1>(X, seed_mode); }
+    else if(dist_mode == maha_dist)  { km.template generate_initial_means<2>(X, seed_mode); }
+    }
+  
+  
+  // k-means
+  
+  if(km_iter > 0)
+    {
+    const arma_ostream_state stream_state(get_stream_err2());
+    
+    bool status = false;
+    
+         if(dist_mode == eucl_dist)  { status = km.template km_iterate<1>(X, km_iter, print_mode, "gmm_full::learn(): k-means"); }
+    else if(dist_mode == maha_dist)  { status = km.template km_iterate<2>(X, km_iter, print_mode, "gmm_full::learn(): k-means"); }
+    
+    stream_state.restore(get_stream_err2());
+    
+    if(status == false)  { arma_debug_warn("gmm_full::learn(): k-means algorithm failed; not enough data, or too many gaussians requested"); init(orig); return false; }
+    }
+  
+  access::rw(means) = km.means;
+  
+  
+  // initial fcovs
+  
+  const eT vfloor = (eT(var_floor) > eT(0)) ? eT(var_floor) : std::numeric_limits<eT>::min();
+  
+  if(seed_mode != keep_existing)
+    {
+    if(print_mode)  { get_stream_err2() << "gmm_full::learn(): generating initial covariances\n"; }
+    
+         if(dist_mode == eucl_dist)  { generate_initial_fcovs_and_hefts<1>(X, km.mah_aux, vfloor); }
+    else if(dist_mode == maha_dist)  { generate_initial_fcovs_and_hefts<2>(X, km.mah_aux, vfloor); }
+    }
+  
+  
+  // EM algorithm
+  
+  if(em_iter > 0)
+    {
+    const arma_ostream_state stream_state(get_stream_err2());
+    
+    const bool status = em_iterate(X, em_iter, vfloor, print_mode);
+    
+    stream_state.restore(get_stream_err2());
+    
+    if(status == false)  { arma_debug_warn("gmm_full::learn(): EM algorithm failed"); init(orig); return false; }
+    }
+  
+  init_constants();
+  
+  return true;
+  }
+
+
+
+// 
+// 
+// 
+
+
+
+template<typename eT>
+inline
+void
+gmm_full<eT>::init(const gmm_full<eT>& x)
+  {
+  arma_extra_debug_sigprint();
+  
+  gmm_full<eT>& t = *this;
+  
+  if(&t != &x)
+    {
+    access::rw(t.means) = x.means;
+    access::rw(t.fcovs) = x.fcovs;
+    access::rw(t.hefts) = x.hefts;
+    
+    init_constants();
+    }
+  }
+
+
+
+template<typename eT>
+inline
+void
+gmm_full<eT>::init(const uword in_n_dims, const uword in_n_gaus)
+  {
+  arma_extra_debug_sigprint();
+  
+  access::rw(means).zeros(in_n_dims, in_n_gaus);
+  
+  access::rw(fcovs).zeros(in_n_dims, in_n_dims, in_n_gaus);
+  
+  for(uword g=0; g < in_n_gaus; ++g)
+    {
+    access::rw(fcovs).slice(g).diag().ones();
+    }
+  
+  access::rw(hefts).set_size(in_n_gaus);
+  
+  access::rw(hefts).fill(eT(1) / eT(in_n_gaus));
+  
+  init_constants();
+  }
+
+
+
+//! Cholesky factors of the covariance matrices are obtained once per model update,
+//! so that each log-likelihood only requires a triangular matrix-vector product.
+//! covariance matrices which are not positive definite are reduced to their diagonals.
+template<typename eT>
+inline
+void
+gmm_full<eT>::init_constants()
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword N_dims = means.n_rows;
+  const uword N_gaus = means.n_cols;
+  
+  const eT tmp = (eT(N_dims)/eT(2)) * std::log(eT(2) * Datum<eT>::pi);
+  
+  chol_fcovs.set_size(N_gaus);
+  inv_chol_fcovs.set_size(N_gaus);
+  
+  inv_chol_means.set_size(N_dims, N_gaus);
+  
+  log_det_etc.set_size(N_gaus);
+  
+  for(uword g=0; g < N_gaus; ++g)
+    {
+    Mat<eT>& fcov = access::rw(fcovs).slice(g);
+    
+    Mat<eT>&     R = chol_fcovs[g];
+    Mat<eT>& inv_R = inv_chol_fcovs[g];
+    
+    bool status = auxlib::chol(R, fcov, 0);
+    
+    if(status)  { status = auxlib::inv_tr(inv_R, R, 0); }
+    
+    if(status == false)
+      {
+      Col<eT> dcov = fcov.diag();
+      
+      eT* dcov_mem = dcov.memptr();
+      
+      for(uword d=0; d < N_dims; ++d)
+        {
+        dcov_mem[d] = (std::max)( dcov_mem[d], std::numeric_limits<eT>::min() );
+        }
+      
+      fcov  = diagmat(dcov);
+      R     = diagmat(sqrt(dcov));
+      inv_R = diagmat(eT(1) / sqrt(dcov));
+      }
+    
+    inv_chol_means.col(g) = trans(inv_R) * means.col(g);
+    
+    const eT half_logdet = accu( log(R.diag()) );
+    
+    log_det_etc[g] = eT(-1) * ( tmp + half_logdet );
+    }
+  
+  eT* hefts_mem = access::rw(hefts).memptr();
+  
+  for(uword i=0; i<N_gaus; ++i)
+    {
+    hefts_mem[i] = (std::max)( hefts_mem[i], std::numeric_limits<eT>::min() );
+    }
+  
+  log_hefts = log(hefts);
+  }
+
+
+
+template<typename eT>
+inline
+umat
+gmm_full<eT>::internal_gen_boundaries(const uword N) const
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(_OPENMP)
+    const uword n_cores   = uword(omp_get_num_procs());
+    const uword n_threads = (n_cores > 0) ? ( (n_cores <= N) ? n_cores : 1 ) : 1;
+  #else
+    static const uword n_threads = 1;
+  #endif
+  
+  umat boundaries(2, n_threads);
+  
+  if(N > 0)
+    {
+    const uword chunk_size = N / n_threads;
+    
+    uword count = 0;
+    
+    for(uword t=0; t<n_threads; t++)
+      {
+      boundaries.at(0,t) = count;
+      
+      count += chunk_size;
+      
+      boundaries.at(1,t) = count-1;
+      }
+    
+    boundaries.at(1,n_threads-1) = N - 1;
+    }
+  else
+    {
+    boundaries.zeros();
+    }
+  
+  return boundaries;
+  }
+
+
+
+template<typename eT>
+arma_hot
+inline
+eT
+gmm_full<eT>::internal_scalar_log_p(const eT* x) const
+  {
+  arma_extra_debug_sigprint();
+  
+  const eT* log_hefts_mem = log_hefts.mem;
+  
+  const uword N_gaus = means.n_cols;
+  
+  if(N_gaus > 0)
+    {
+    eT log_sum = internal_scalar_log_p(x, 0) + log_hefts_mem[0];
+    
+    for(uword g=1; g < N_gaus; ++g)
+      {
+      const eT tmp = internal_scalar_log_p(x, g) + log_hefts_mem[g];
+      
+      log_sum = log_add_exp(log_sum, tmp);
+      }
+    
+    return log_sum;
+    }
+  else
+    {
+    return -Datum<eT>::inf;
+    }
+  }
+
+
+
+template<typename eT>
+arma_hot
+inline
+eT
+gmm_full<eT>::internal_scalar_log_p(const eT* x, const uword g) const
+  {
+  arma_extra_debug_sigprint();
+  
+  const eT* mean = means.colptr(g);
+  
+  const Mat<eT>& inv_R = inv_chol_fcovs[g];
+  
+  const uword N_dims = means.n_rows;
+  
+  // squared norm of inv(R).t() * (x - mean); inv(R) is upper triangular
+  
+  eT val = eT(0);
+  
+  for(uword i=0; i < N_dims; ++i)
+    {
+    const eT* inv_R_col = inv_R.colptr(i);
+    
+    eT acc = eT(0);
+    
+    for(uword j=0; j <= i; ++j)
+      {
+      acc += inv_R_col[j] * (x[j] - mean[j]);
+      }
+    
+    val += acc*acc;
+    }
+  
+  return eT(-0.5)*val + log_det_etc.mem[g];
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+void
+gmm_full<eT>::internal_block_copy(Mat<eT>& X_block, const T1& X, const uword start_index, const uword end_index) const
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword N_dims = X.n_rows;
+  
+  X_block.set_size(N_dims, end_index - start_index + 1);
+  
+  for(uword i=start_index; i <= end_index; ++i)
+    {
+    arrayops::copy( X_block.colptr(i - start_index), X.colptr(i), N_dims );
+    }
+  }
+
+
+
+//! log-likelihoods of a block of vectors for one gaussian, obtained via one matrix multiplication
+template<typename eT>
+inline
+void
+gmm_full<eT>::internal_block_log_p(eT* out_mem, const Mat<eT>& X_block, const uword g, Mat<eT>& tmp) const
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword N_dims = means.n_rows;
+  
+  tmp = trans(inv_chol_fcovs[g]) * X_block;
+  
+  const eT* inv_chol_mean = inv_chol_means.colptr(g);
+  
+  const eT log_det_etc_g = log_det_etc[g];
+  
+  for(uword i=0; i < X_block.n_cols; ++i)
+    {
+    const eT* tmp_col = tmp.colptr(i);
+    
+    eT val = eT(0);
+    
+    for(uword d=0; d < N_dims; ++d)
+      {
+      const eT diff = tmp_col[d] - inv_chol_mean[d];
+      
+      val += diff*diff;
+      }
+    
+    out_mem[i] = eT(-0.5)*val + log_det_etc_g;
+    }
+  }
+
+
+
+//! log-likelihoods of a block of vectors for the whole model;
+//! the log-likelihood of each vector for each gaussian (including the heft) is kept in lhoods, with one column per gaussian
+template<typename eT>
+inline
+void
+gmm_full<eT>::internal_block_log_p(eT* out_mem, const Mat<eT>& X_block, Mat<eT>& lhoods, Mat<eT>& tmp) const
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword N_gaus  = means.n_cols;
+  const uword N_block = X_block.n_cols;
+  
+  const eT* log_hefts_mem = log_hefts.memptr();
+  
+  lhoods.set_size(N_block, N_gaus);
+  
+  for(uword g=0; g < N_gaus; ++g)
+    {
+    eT* lhoods_col = lhoods.colptr(g);
+    
+    internal_block_log_p(lhoods_col, X_block, g, tmp);
+    
+    const eT log_heft = log_hefts_mem[g];
+    
+    for(uword i=0; i < N_block; ++i)  { lhoods_col[i] += log_heft; }
+    }
+  
+  for(uword i=0; i < N_block; ++i)
+    {
+    eT log_sum = lhoods.at(i,0);
+    
+    for(uword g=1; g < N_gaus; ++g)
+      {
+      log_sum = log_add_exp(log_sum, lhoods.at(i,g));
+      }
+    
+    out_mem[i] = log_sum;
+    }
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+void
+gmm_full<eT>::internal_range_log_p(eT* out_mem, const T1& X, const uword start_index, const uword end_index, const uword gaus_id, const bool all_gaus) const
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword block_size = 256;
+  
+  Mat<eT> X_block;
+  Mat<eT> lhoods;
+  Mat<eT> tmp;
+  
+  for(uword block_start=start_index; block_start <= end_index; block_start += block_size)
+    {
+    const uword block_end = (std::min)(block_start + block_size - 1, end_index);
+    
+    internal_block_copy(X_block, X, block_start, block_end);
+    
+    if(all_gaus)
+      {
+      internal_block_log_p(&(out_mem[block_start]), X_block, lhoods, tmp);
+      }
+    else
+      {
+      internal_block_log_p(&(out_mem[block_start]), X_block, gaus_id, tmp);
+      }
+    }
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+void
+gmm_full<eT>::internal_vec_log_p(Row<eT>& out, const T1& X, const uword gaus_id, const bool all_gaus) const
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_check( (X.n_rows != means.n_rows), "gmm_full::log_p(): incompatible dimensions" );
+  
+  const uword N = X.n_cols;
+  
+  out.set_size(N);
+  
+  if(N == 0)  { return; }
+  
+  if(means.n_cols == 0)  { out.fill(-Datum<eT>::inf); return; }
+  
+  eT* out_mem = out.memptr();
+  
+  #if defined(_OPENMP)
+    {
+    const arma_omp_state save_omp_state;
+    
+    const umat boundaries = internal_gen_boundaries(N);
+    
+    const uword n_threads = boundaries.n_cols;
+    
+    #pragma omp parallel for
+    for(uword t=0; t < n_threads; ++t)
+      {
+      internal_range_log_p(out_mem, X, boundaries.at(0,t), boundaries.at(1,t), gaus_id, all_gaus);
+      }
+    }
+  #else
+    {
+    internal_range_log_p(out_mem, X, 0, N-1, gaus_id, all_gaus);
+    }
+  #endif
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+uword
+gmm_full<eT>::internal_scalar_assign(const T1& X, const gmm_dist_mode& dist_mode) const
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword N_dims = means.n_rows;
+  const uword N_gaus = means.n_cols;
+  
+  arma_debug_check( (X.n_rows != N_dims), "gmm_full::assign(): incompatible dimensions" );
+  arma_debug_check( (N_gaus == 0),        "gmm_full::assign(): model has no means"      );
+  
+  const eT* X_mem = X.colptr(0);
+  
+  if(dist_mode == eucl_dist)
+    {
+    eT    best_dist = Datum<eT>::inf;
+    uword best_g    = 0;
+    
+    for(uword g=0; g < N_gaus; ++g)
+      {
+      const eT tmp_dist = distance<eT,1>::eval(N_dims, X_mem, means.colptr(g), X_mem);
+      
+      if(tmp_dist <= best_dist)
+        {
+        best_dist = tmp_dist;
+        best_g    = g;
+        }
+      }
+    
+    return best_g;
+    }
+  else
+  if(dist_mode == prob_dist)
+    {
+    const eT* log_hefts_mem = log_hefts.memptr();
+    
+    eT    best_p = -Datum<eT>::inf;
+    uword best_g = 0;
+    
+    for(uword g=0; g < N_gaus; ++g)
+      {
+      const eT tmp_p = internal_scalar_log_p(X_mem, g) + log_hefts_mem[g];
+      
+      if(tmp_p >= best_p)
+        {
+        best_p = tmp_p;
+        best_g = g;
+        }
+      }
+    
+    return best_g;
+    }
+  else
+    {
+    arma_debug_check(true, "gmm_full::assign(): unsupported distance mode");
+    }
+  
+  return uword(0);
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+void
+gmm_full<eT>::internal_vec_assign(urowvec& out, const T1& X, const gmm_dist_mode& dist_mode) const
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword N_dims = means.n_rows;
+  const uword N_gaus = means.n_cols;
+  
+  arma_debug_check( (X.n_rows != N_dims), "gmm_full::assign(): incompatible dimensions" );
+  
+  const uword X_n_cols = (N_gaus > 0) ? X.n_cols : 0;
+  
+  out.set_size(1,X_n_cols);
+  
+  uword* out_mem = out.memptr();
+  
+  if(dist_mode == eucl_dist)
+    {
+    for(uword i=0; i<X_n_cols; ++i)
+      {
+      const eT* X_colptr = X.colptr(i);
+      
+      eT    best_dist = Datum<eT>::inf;
+      uword best_g    = 0;
+      
+      for(uword g=0; g<N_gaus; ++g)
+        {
+        const eT tmp_dist = distance<eT,1>::eval(N_dims, X_colptr, means.colptr(g), X_colptr);
+        
+        if(tmp_dist <= best_dist)
+          {
+          best_dist = tmp_dist;
+          best_g    = g;
+          }
+        }
+      
+      out_mem[i] = best_g;
+      }
+    }
+  else
+  if(dist_mode == prob_dist)
+    {
+    const uword block_size = 256;
+    
+    Mat<eT> X_block;
+    Mat<eT> lhoods;
+    Mat<eT> tmp;
+    
+    podarray<eT> log_sums(block_size);
+    
+    for(uword block_start=0; block_start < X_n_cols; block_start += block_size)
+      {
+      const uword block_end = (std::min)(block_start + block_size - 1, X_n_cols - 1);
+      
+      internal_block_copy(X_block, X, block_start, block_end);
+      
+      internal_block_log_p(log_sums.memptr(), X_block, lhoods, tmp);
+      
+      for(uword i=0; i < X_block.n_cols; ++i)
+        {
+        eT    best_p = -Datum<eT>::inf;
+        uword best_g = 0;
+        
+        for(uword g=0; g<N_gaus; ++g)
+          {
+          const eT tmp_p = lhoods.at(i,g);
+          
+          if(tmp_p >= best_p)
+            {
+            best_p = tmp_p;
+            best_g = g;
+            }
+          }
+        
+        out_mem[block_start + i] = best_g;
+        }
+      }
+    }
+  else
+    {
+    arma_debug_check(true, "gmm_full::assign(): unsupported distance mode");
+    }
+  }
+
+
+
+template<typename eT>
+inline
+void
+gmm_full<eT>::internal_raw_hist(urowvec& hist, const Mat<eT>& X, const gmm_dist_mode& dist_mode) const
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword N_gaus = means.n_cols;
+  
+  hist.zeros(N_gaus);
+  
+  if(N_gaus == 0)  { return; }
+  
+  urowvec assignments;
+  
+  internal_vec_assign(assignments, X, dist_mode);
+  
+  const uword* assignments_mem = assignments.memptr();
+        uword* hist_mem        = hist.memptr();
+  
+  for(uword i=0; i < assignments.n_elem; ++i)  { hist_mem[ assignments_mem[i] ]++; }
+  }
+
+
+
+template<typename eT>
+template<uword dist_id>
+inline
+void
+gmm_full<eT>::generate_initial_fcovs_and_hefts(const Mat<eT>& X, const Col<eT>& mah_aux, const eT var_floor)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword N_dims = means.n_rows;
+  const uword N_gaus = means.n_cols;
+  
+  const eT* mah_aux_mem = mah_aux.memptr();
+  
+  urowvec assignments(X.n_cols);
+  
+  for(uword i=0; i<X.n_cols; ++i)
+    {
+    const eT* X_colptr = X.colptr(i);
+    
+    double min_dist = Datum<eT>::inf;
+    uword  best_g   = 0;
+    
+    for(uword g=0; g<N_gaus; ++g)
+      {
+      const double dist = distance<eT,dist_id>::eval(N_dims, X_colptr, means.colptr(g), mah_aux_mem);
+      
+      if(dist <= min_dist)  { min_dist = dist; best_g = g; }
+      }
+    
+    assignments[i] = best_g;
+    }
+  
+  for(uword g=0; g<N_gaus; ++g)
+    {
+    const uvec indices = find(assignments == g);
+    
+    if(indices.n_elem >= 2)
+      {
+      access::rw(fcovs).slice(g) = cov( trans(X.cols(indices)), 1 );
+      }
+    else
+      {
+      access::rw(fcovs).slice(g).eye();
+      }
+    
+    access::rw(hefts)(g) = (std::max)( (indices.n_elem / eT(X.n_cols)), std::numeric_limits<eT>::min() );
+    }
+  
+  em_fix_params(var_floor);
+  }
+
+
+
+//! multi-threaded implementation of Expectation-Maximisation, inspired by MapReduce
+template<typename eT>
+inline
+bool
+gmm_full<eT>::em_iterate(const Mat<eT>& X, const uword max_iter, const eT var_floor, const bool verbose)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword N_dims = means.n_rows;
+  const uword N_gaus = means.n_cols;
+  
+  if(verbose)
+    {
+    get_stream_err2().unsetf(ios::showbase);
+    get_stream_err2().unsetf(ios::uppercase);
+    get_stream_err2().unsetf(ios::showpos);
+    get_stream_err2().unsetf(ios::scientific);
+    
+    get_stream_err2().setf(ios::right);
+    get_stream_err2().setf(ios::fixed);
+    }
+  
+  #if defined(_OPENMP)
+    const arma_omp_state save_omp_state;
+  #endif
+  
+  const umat boundaries = internal_gen_boundaries(X.n_cols);
+  
+  const uword n_threads = boundaries.n_cols;
+  
+  field< Mat<eT>  > t_acc_means(n_threads);
+  field< Cube<eT> > t_acc_fcovs(n_threads);
+  
+  field< Col<eT> > t_acc_norm_lhoods(n_threads);
+  
+  Col<eT>          t_progress_log_lhood(n_threads);
+  
+  for(uword t=0; t<n_threads; t++)
+    {
+    t_acc_means[t].set_size(N_dims, N_gaus);
+    t_acc_fcovs[t].set_size(N_dims, N_dims, N_gaus);
+    
+    t_acc_norm_lhoods[t].set_size(N_gaus);
+    }
+  
+  
+  #if defined(_OPENMP)
+    if(verbose)
+      {
+      get_stream_err2() << "gmm_full::learn(): EM: n_threads: " << n_threads  << '\n';
+      }
+  #endif
+  
+  eT old_avg_log_p = -Datum<eT>::inf;
+  
+  for(uword iter=1; iter <= max_iter; ++iter)
+    {
+    init_constants();
+    
+    em_update_params(X, boundaries, t_acc_means, t_acc_fcovs, t_acc_norm_lhoods, t_progress_log_lhood);
+    
+    em_fix_params(var_floor);
+    
+    const eT new_avg_log_p = mean(t_progress_log_lhood);
+    
+    if(verbose)
+      {
+      get_stream_err2() << "gmm_full::learn(): EM: iteration: ";
+      get_stream_err2().unsetf(ios::scientific);
+      get_stream_err2().setf(ios::fixed);
+      get_stream_err2().width(std::streamsize(4));
+      get_stream_err2() << iter;
+      get_stream_err2() << "   avg_log_p: ";
+      get_stream_err2().unsetf(ios::fixed);
+      get_stream_err2() << new_avg_log_p << '\n';
+      }
+    
+    if(is_finite(new_avg_log_p) == false)  { return false; }
+    
+    if(std::abs(old_avg_log_p - new_avg_log_p) <= Datum<eT>::eps)  { break; }
+    
+    
+    old_avg_log_p = new_avg_log_p;
+    }
+  
+  
+  if(means.is_finite() == false)  { return false; }
+  if(fcovs.is_finite() == false)  { return false; }
+  if(hefts.is_finite() == false)  { return false; }
+  
+  return true;
+  }
+
+
+
+
+template<typename eT>
+inline
+void
+gmm_full<eT>::em_update_params
+  (
+  const Mat<eT>&           X,
+  const umat&              boundaries,
+        field< Mat<eT>  >& t_acc_means,
+        field< Cube<eT> >& t_acc_fcovs,
+        field< Col<eT>  >& t_acc_norm_lhoods,
+        Col<eT>&           t_progress_log_lhood
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword n_threads = boundaries.n_cols;
+  
+  
+  // em_generate_acc() is the "map" operation, which produces partial accumulators for means, full covariances and hefts
+  
+  #if defined(_OPENMP)
+    {
+    #pragma omp parallel for
+    for(uword t=0; t<n_threads; t++)
+      {
+      Mat<eT>&  acc_means          = t_acc_means[t];
+      Cube<eT>& acc_fcovs          = t_acc_fcovs[t];
+      Col<eT>&  acc_norm_lhoods    = t_acc_norm_lhoods[t];
+      eT&       progress_log_lhood = t_progress_log_lhood[t];
+      
+      em_generate_acc(X, boundaries.at(0,t), boundaries.at(1,t), acc_means, acc_fcovs, acc_norm_lhoods, progress_log_lhood);
+      }
+    }
+  #else
+    {
+    em_generate_acc(X, boundaries.at(0,0), boundaries.at(1,0), t_acc_means[0], t_acc_fcovs[0], t_acc_norm_lhoods[0], t_progress_log_lhood[0]);
+    }
+  #endif
+  
+  const uword N_gaus = means.n_cols;
+  
+  Mat<eT>&  final_acc_means = t_acc_means[0];
+  Cube<eT>& final_acc_fcovs = t_acc_fcovs[0];
+  
+  Col<eT>& final_acc_norm_lhoods = t_acc_norm_lhoods[0];
+  
+  
+  // the "reduce" operation, which combines the partial accumulators produced by the separate threads
+  
+  for(uword t=1; t<n_threads; t++)
+    {
+    final_acc_means += t_acc_means[t];
+    final_acc_fcovs += t_acc_fcovs[t];
+    
+    final_acc_norm_lhoods += t_acc_norm_lhoods[t];
+    }
+  
+  
+  eT* hefts_mem = access::rw(hefts).memptr();
+  
+  for(uword g=0; g < N_gaus; ++g)
+    {
+    const eT acc_norm_lhood = (std::max)( final_acc_norm_lhoods[g], std::numeric_limits<eT>::min() );
+    
+    hefts_mem[g] = acc_norm_lhood / eT(X.n_cols);
+    
+    subview_col<eT> mean = access::rw(means).col(g);
+    
+    mean = final_acc_means.col(g) / acc_norm_lhood;
+    
+    access::rw(fcovs).slice(g) = final_acc_fcovs.slice(g) / acc_norm_lhood - mean * trans(mean);
+    }
+  }
+
+
+
+//! the vectors are processed in blocks, so that the bulk of the work is done by matrix multiplications
+template<typename eT>
+inline
+void
+gmm_full<eT>::em_generate_acc
+  (
+  const Mat<eT>&  X,
+  const uword     start_index,
+  const uword       end_index,
+        Mat<eT>&  acc_means,
+        Cube<eT>& acc_fcovs,
+        Col<eT>&  acc_norm_lhoods,
+        eT&       progress_log_lhood
+  )
+  const
+  {
+  arma_extra_debug_sigprint();
+  
+  progress_log_lhood = eT(0);
+  
+  acc_means.zeros();
+  acc_fcovs.zeros();
+  
+  acc_norm_lhoods.zeros();
+  
+  const uword N_gaus = means.n_cols;
+  
+  const uword block_size = 256;
+  
+  Mat<eT> X_block;
+  Mat<eT> lhoods;
+  Mat<eT> tmp;
+  
+  podarray<eT> log_sums(block_size);
+  
+  eT* log_sums_mem = log_sums.memptr();
+  
+  for(uword block_start=start_index; block_start <= end_index; block_start += block_size)
+    {
+    const uword block_end = (std::min)(block_start + block_size - 1, end_index);
+    
+    X_block = X.cols(block_start, block_end);
+    
+    internal_block_log_p(log_sums_mem, X_block, lhoods, tmp);
+    
+    const uword N_block = X_block.n_cols;
+    
+    // convert the log-likelihoods into normalised likelihoods
+    
+    for(uword i=0; i < N_block; ++i)
+      {
+      const eT log_lhood_sum = log_sums_mem[i];
+      
+      progress_log_lhood += log_lhood_sum;
+      
+      for(uword g=0; g < N_gaus; ++g)
+        {
+        lhoods.at(i,g) = std::exp(lhoods.at(i,g) - log_lhood_sum);
+        }
+      }
+    
+    acc_norm_lhoods += trans(sum(lhoods));
+    
+    acc_means += X_block * lhoods;
+    
+    for(uword g=0; g < N_gaus; ++g)
+      {
+      tmp = X_block * diagmat(lhoods.col(g));
+      
+      acc_fcovs.slice(g) += tmp * trans(X_block);
+      }
+    }
+  
+  progress_log_lhood /= eT((end_index - start_index) + 1);
+  }
+
+
+
+//! make the covariance matrices symmetric and apply the variance floor to their diagonals
+template<typename eT>
+inline
+void
+gmm_full<eT>::em_fix_params(const eT var_floor)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword N_dims = means.n_rows;
+  const uword N_gaus = means.n_cols;
+  
+  for(uword g=0; g < N_gaus; ++g)
+    {
+    Mat<eT>& fcov = access::rw(fcovs).slice(g);
+    
+    for(uword c=0; c < N_dims; ++c)
+      {
+      for(uword r=(c+1); r < N_dims; ++r)
+        {
+        const eT val = eT(0.5) * (fcov.at(r,c) + fcov.at(c,r));
+        
+        fcov.at(r,c) = val;
+        fcov.at(c,r) = val;
+        }
+      
+      if(fcov.at(c,c) < var_floor)  { fcov.at(c,c) = var_floor; }
+      }
+    }
+  
+  const eT heft_sum = accu(hefts);
+  
+  if(heft_sum != eT(1))  { access::rw(hefts) /= heft_sum; }
+  }
+
+
+}
+
+
+//! @}
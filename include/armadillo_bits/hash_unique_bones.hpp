@@ -0,0 +1,71 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+//! \addtogroup hash_unique
+//! @{
+
+
+
+//! open addressing hash table (with linear probing) holding distinct values
+//! and the index of the first occurrence of each value. For internal use only!
+template<typename eT>
+class hash_unique_table
+  {
+  public:
+  
+  inline hash_unique_table();
+  
+  arma_inline void insert(const eT val, const uword index);
+  
+  inline void extract(eT* out_vals, uword* out_indices) const;
+  
+  uword n_used;
+  
+  
+  private:
+  
+  inline void init(const uword n_slots);
+  inline void grow();
+  
+  arma_inline static uword hash(const eT val);
+  
+  uword           mask;
+  podarray<eT>    vals;
+  podarray<uword> indices;  //!< ARMA_MAX_UWORD indicates an empty slot
+  };
+
+
+
+//! Hash based search for the unique elements of an array, in linear time. For internal use only!
+//! This is worthwhile when there are few distinct values compared to the number of elements;
+//! the search is abandoned (so that the caller can fall back to sorting) once the number of
+//! distinct values exceeds 1/8 of the number of elements, or if a NaN is found.
+//! -0 and +0 are treated as the same value.
+//! When OpenMP is enabled, large arrays are split into blocks which are searched in parallel,
+//! followed by merging the per-block tables.
+class hash_unique
+  {
+  public:
+  
+  static const uword min_n_elem      = 8192;     //!< smaller arrays are handled via sorting
+  static const uword parallel_n_elem = 1048576;  //!< minimum number of elements for searching in parallel
+  
+  template<typename eT, typename ea_type> inline static bool find(podarray<eT>& out_vals, podarray<uword>& out_indices, const ea_type& X, const uword n_elem, const typename enable_if2<is_cx<eT>::no,  eT>::result* junk = 0);
+  template<typename eT, typename ea_type> inline static bool find(podarray<eT>& out_vals, podarray<uword>& out_indices, const ea_type& X, const uword n_elem, const typename enable_if2<is_cx<eT>::yes, eT>::result* junk = 0);
+  
+  
+  private:
+  
+  template<typename eT, typename ea_type> inline static bool find_range(hash_unique_table<eT>& table, const ea_type& X, const uword start, const uword end);
+  };
+
+
+
+//! @}
@@ -0,0 +1,265 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+//! \addtogroup hash_unique
+//! @{
+
+
+
+template<typename eT>
+inline
+hash_unique_table<eT>::hash_unique_table()
+  : n_used(0)
+  , mask  (0)
+  {
+  arma_extra_debug_sigprint();
+  
+  init(1024);
+  }
+
+
+
+template<typename eT>
+inline
+void
+hash_unique_table<eT>::init(const uword n_slots)
+  {
+  arma_extra_debug_sigprint();
+  
+  mask = n_slots - 1;
+  
+  vals.set_size(n_slots);
+  indices.set_size(n_slots);
+  
+  arrayops::inplace_set(indices.memptr(), uword(ARMA_MAX_UWORD), n_slots);
+  }
+
+
+
+template<typename eT>
+arma_inline
+uword
+hash_unique_table<eT>::hash(const eT val)
+  {
+  // the bits of the value are mixed as two 32 bit words, so that u64 is not required
+  
+  u32 words[2] = { 0, 0 };
+  
+  std::memcpy(words, &val, (std::min)(sizeof(eT), sizeof(words)));
+  
+  u32 h = (words[0] * u32(0x9E3779B1U)) ^ ((words[1] + u32(0x7F4A7C15U)) * u32(0x85EBCA77U));
+  
+  h ^= (h >> 15);
+  h *= u32(0x2C1B3C6DU);
+  h ^= (h >> 12);
+  
+  return uword(h);
+  }
+
+
+
+template<typename eT>
+arma_inline
+void
+hash_unique_table<eT>::insert(const eT val, const uword index)
+  {
+  uword slot = hash(val) & mask;
+  
+  while(indices[slot] != ARMA_MAX_UWORD)
+    {
+    if(vals[slot] == val)  { return; }
+    
+    slot = (slot + 1) & mask;
+    }
+  
+  vals[slot]    = val;
+  indices[slot] = index;
+  
+  ++n_used;
+  
+  // keep the load factor at most 1/2
+  if( (2*n_used) > mask )  { grow(); }
+  }
+
+
+
+template<typename eT>
+inline
+void
+hash_unique_table<eT>::grow()
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword old_n_slots = mask + 1;
+  
+  const podarray<eT>    old_vals(vals);
+  const podarray<uword> old_indices(indices);
+  
+  init(2 * old_n_slots);
+  
+  n_used = 0;
+  
+  for(uword i=0; i < old_n_slots; ++i)
+    {
+    if(old_indices[i] != ARMA_MAX_UWORD)  { insert(old_vals[i], old_indices[i]); }
+    }
+  }
+
+
+
+//! copy the values and indices to out_vals and out_indices, which must have room for n_used elements
+template<typename eT>
+inline
+void
+hash_unique_table<eT>::extract(eT* out_vals, uword* out_indices) const
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword n_slots = mask + 1;
+  
+  uword count = 0;
+  
+  for(uword i=0; i < n_slots; ++i)
+    {
+    if(indices[i] != ARMA_MAX_UWORD)
+      {
+      out_vals[count]    = vals[i];
+      out_indices[count] = indices[i];
+      
+      ++count;
+      }
+    }
+  }
+
+
+
+template<typename eT, typename ea_type>
+inline
+bool
+hash_unique::find_range(hash_unique_table<eT>& table, const ea_type& X, const uword start, const uword end)
+  {
+  // give up early on data with many distinct values:
+  // the number of distinct values found so far is limited to 1/8 of the number of elements seen so far,
+  // plus an allowance of 1/32 of all elements (as most distinct values tend to be seen early on)
+  
+  const uword allowance = (end - start) / 32;
+  
+  for(uword i=start; i < end; ++i)
+    {
+    const eT val = X[i];
+    
+    if(arma_isnan(val))  { return false; }
+    
+    table.insert( ((val != eT(0)) ? val : eT(0)), i );
+    
+    if(table.n_used > (((i - start) / 8) + allowance))  { return false; }
+    }
+  
+  return (table.n_used <= ((end - start) / 8));
+  }
+
+
+
+//! store the distinct values of X[0] ... X[n_elem-1] in out_vals (in no particular order),
+//! and the index of the first occurrence of each value in out_indices;
+//! returns false if the search was abandoned
+template<typename eT, typename ea_type>
+inline
+bool
+hash_unique::find(podarray<eT>& out_vals, podarray<uword>& out_indices, const ea_type& X, const uword n_elem, const typename enable_if2<is_cx<eT>::no, eT>::result* junk)
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  #if defined(_OPENMP)
+    {
+    const uword n_threads = uword( (std::max)(int(1), omp_get_max_threads()) );
+    
+    if( (n_elem >= hash_unique::parallel_n_elem) && (n_threads > 1) && (omp_in_parallel() == 0) )
+      {
+      arma_extra_debug_print("hash_unique::find(): parallel");
+      
+      std::vector< hash_unique_table<eT> > tables(n_threads);
+      
+      podarray<uword> status(n_threads);
+      
+      const uword block_size = (n_elem + n_threads - 1) / n_threads;
+      
+      #pragma omp parallel for schedule(static,1)
+      for(uword t=0; t < n_threads; ++t)
+        {
+        const uword start = (std::min)(t * block_size, n_elem);
+        const uword end   = (std::min)(start + block_size, n_elem);
+        
+        status[t] = (hash_unique::find_range(tables[t], X, start, end)) ? uword(1) : uword(0);
+        }
+      
+      for(uword t=0; t < n_threads; ++t)  { if(status[t] == uword(0))  { return false; } }
+      
+      // merge the tables in order of the blocks, so that the first occurrence of each value is kept
+      
+      hash_unique_table<eT>& table = tables[0];
+      
+      for(uword t=1; t < n_threads; ++t)
+        {
+        const hash_unique_table<eT>& table_t = tables[t];
+        
+        podarray<eT>    vals_t(table_t.n_used);
+        podarray<uword> indices_t(table_t.n_used);
+        
+        table_t.extract(vals_t.memptr(), indices_t.memptr());
+        
+        for(uword i=0; i < table_t.n_used; ++i)  { table.insert(vals_t[i], indices_t[i]); }
+        }
+      
+      if(table.n_used > (n_elem / 8))  { return false; }
+      
+      out_vals.set_size(table.n_used);
+      out_indices.set_size(table.n_used);
+      
+      table.extract(out_vals.memptr(), out_indices.memptr());
+      
+      return true;
+      }
+    }
+  #endif
+  
+  hash_unique_table<eT> table;
+  
+  if(hash_unique::find_range(table, X, 0, n_elem) == false)  { return false; }
+  
+  out_vals.set_size(table.n_used);
+  out_indices.set_size(table.n_used);
+  
+  table.extract(out_vals.memptr(), out_indices.memptr());
+  
+  return true;
+  }
+
+
+
+//! complex numbers are not handled
+template<typename eT, typename ea_type>
+inline
+bool
+hash_unique::find(podarray<eT>& out_vals, podarray<uword>& out_indices, const ea_type& X, const uword n_elem, const typename enable_if2<is_cx<eT>::yes, eT>::result* junk)
+  {
+  arma_ignore(out_vals);
+  arma_ignore(out_indices);
+  arma_ignore(X);
+  arma_ignore(n_elem);
+  arma_ignore(junk);
+  
+  return false;
+  }
+
+
+
+//! @}
@@ -459,6 +459,8 @@ search_hdf5_file
 //! Load an HDF5 matrix into an array of type specified by datatype,
 //! then convert that into the desired array 'dest'.
 //! This should only be called when eT is not the datatype.
+//! memspace and filespace can be used to read only a part of the dataset (hyperslab);
+//! n_elem must then be the number of selected elements.
 template<typename eT>
 inline
 hid_t
@@ -467,7 +469,9 @@ load_and_convert_hdf5
   eT   *dest,
   hid_t dataset,
   hid_t datatype,
-  uword n_elem
+  uword n_elem,
+  hid_t memspace  = H5S_ALL,
+  hid_t filespace = H5S_ALL
   )
   {
   
@@ -487,7 +491,7 @@ load_and_convert_hdf5
   if(is_equal)
     {
     Col<u8> v(n_elem);
-    hid_t status = arma_H5Dread(dataset, datatype, H5S_ALL, H5S_ALL, H5P_DEFAULT, void_ptr(v.memptr()));
+    hid_t status = arma_H5Dread(dataset, datatype, memspace, filespace, H5P_DEFAULT, void_ptr(v.memptr()));
     arrayops::convert(dest, v.memptr(), n_elem);
 
     return status;
@@ -502,7 +506,7 @@ load_and_convert_hdf5
   if(is_equal)
     {
     Col<s8> v(n_elem);
-    hid_t status = arma_H5Dread(dataset, datatype, H5S_ALL, H5S_ALL, H5P_DEFAULT, void_ptr(v.memptr()));
+    hid_t status = arma_H5Dread(dataset, datatype, memspace, filespace, H5P_DEFAULT, void_ptr(v.memptr()));
     arrayops::convert(dest, v.memptr(), n_elem);
 
     return status;
@@ -517,7 +521,7 @@ load_and_convert_hdf5
   if(is_equal)
     {
     Col<u16> v(n_elem);
-    hid_t status = arma_H5Dread(dataset, datatype, H5S_ALL, H5S_ALL, H5P_DEFAULT, void_ptr(v.memptr()));
+    hid_t status = arma_H5Dread(dataset, datatype, memspace, filespace, H5P_DEFAULT, void_ptr(v.memptr()));
     arrayops::convert(dest, v.memptr(), n_elem);
 
     return status;
@@ -532,7 +536,7 @@ load_and_convert_hdf5
   if(is_equal)
     {
     Col<s16> v(n_elem);
-    hid_t status = arma_H5Dread(dataset, datatype, H5S_ALL, H5S_ALL, H5P_DEFAULT, void_ptr(v.memptr()));
+    hid_t status = arma_H5Dread(dataset, datatype, memspace, filespace, H5P_DEFAULT, void_ptr(v.memptr()));
     arrayops::convert(dest, v.memptr(), n_elem);
 
     return status;
@@ -547,7 +551,7 @@ load_and_convert_hdf5
   if(is_equal)
     {
     Col<u32> v(n_elem);
-    hid_t status = arma_H5Dread(dataset, datatype, H5S_ALL, H5S_ALL, H5P_DEFAULT, void_ptr(v.memptr()));
+    hid_t status = arma_H5Dread(dataset, datatype, memspace, filespace, H5P_DEFAULT, void_ptr(v.memptr()));
     arrayops::convert(dest, v.memptr(), n_elem);
 
     return status;
@@ -562,7 +566,7 @@ load_and_convert_hdf5
   if(is_equal)
     {
     Col<s32> v(n_elem);
-    hid_t status = arma_H5Dread(dataset, datatype, H5S_ALL, H5S_ALL, H5P_DEFAULT, void_ptr(v.memptr()));
+    hid_t status = arma_H5Dread(dataset, datatype, memspace, filespace, H5P_DEFAULT, void_ptr(v.memptr()));
     arrayops::convert(dest, v.memptr(), n_elem);
 
     return status;
@@ -579,7 +583,7 @@ load_and_convert_hdf5
     if(is_equal)
       {
       Col<u64> v(n_elem);
-      hid_t status = arma_H5Dread(dataset, datatype, H5S_ALL, H5S_ALL, H5P_DEFAULT, void_ptr(v.memptr()));
+      hid_t status = arma_H5Dread(dataset, datatype, memspace, filespace, H5P_DEFAULT, void_ptr(v.memptr()));
       arrayops::convert(dest, v.memptr(), n_elem);
 
       return status;
@@ -594,7 +598,7 @@ load_and_convert_hdf5
     if(is_equal)
       {
       Col<s64> v(n_elem);
-      hid_t status = arma_H5Dread(dataset, datatype, H5S_ALL, H5S_ALL, H5P_DEFAULT, void_ptr(v.memptr()));
+      hid_t status = arma_H5Dread(dataset, datatype, memspace, filespace, H5P_DEFAULT, void_ptr(v.memptr()));
       arrayops::convert(dest, v.memptr(), n_elem);
 
       return status;
@@ -613,7 +617,7 @@ load_and_convert_hdf5
     if(is_equal)
       {
       Col<ulng_t> v(n_elem);
-      hid_t status = arma_H5Dread(dataset, datatype, H5S_ALL, H5S_ALL, H5P_DEFAULT, void_ptr(v.memptr()));
+      hid_t status = arma_H5Dread(dataset, datatype, memspace, filespace, H5P_DEFAULT, void_ptr(v.memptr()));
       arrayops::convert(dest, v.memptr(), n_elem);
 
       return status;
@@ -628,7 +632,7 @@ load_and_convert_hdf5
     if(is_equal)
       {
       Col<slng_t> v(n_elem);
-      hid_t status = arma_H5Dread(dataset, datatype, H5S_ALL, H5S_ALL, H5P_DEFAULT, void_ptr(v.memptr()));
+      hid_t status = arma_H5Dread(dataset, datatype, memspace, filespace, H5P_DEFAULT, void_ptr(v.memptr()));
       arrayops::convert(dest, v.memptr(), n_elem);
 
       return status;
@@ -645,7 +649,7 @@ load_and_convert_hdf5
   if(is_equal)
     {
     Col<float> v(n_elem);
-    hid_t status = arma_H5Dread(dataset, datatype, H5S_ALL, H5S_ALL, H5P_DEFAULT, void_ptr(v.memptr()));
+    hid_t status = arma_H5Dread(dataset, datatype, memspace, filespace, H5P_DEFAULT, void_ptr(v.memptr()));
     arrayops::convert(dest, v.memptr(), n_elem);
 
     return status;
@@ -660,7 +664,7 @@ load_and_convert_hdf5
   if(is_equal)
     {
     Col<double> v(n_elem);
-    hid_t status = arma_H5Dread(dataset, datatype, H5S_ALL, H5S_ALL, H5P_DEFAULT, void_ptr(v.memptr()));
+    hid_t status = arma_H5Dread(dataset, datatype, memspace, filespace, H5P_DEFAULT, void_ptr(v.memptr()));
     arrayops::convert(dest, v.memptr(), n_elem);
 
     return status;
@@ -680,7 +684,7 @@ load_and_convert_hdf5
       }
     
     Col< std::complex<float> > v(n_elem);
-    hid_t status = arma_H5Dread(dataset, datatype, H5S_ALL, H5S_ALL, H5P_DEFAULT, void_ptr(v.memptr()));
+    hid_t status = arma_H5Dread(dataset, datatype, memspace, filespace, H5P_DEFAULT, void_ptr(v.memptr()));
     arrayops::convert_cx(dest, v.memptr(), n_elem);
     
     return status;
@@ -700,7 +704,7 @@ load_and_convert_hdf5
       }
     
     Col< std::complex<double> > v(n_elem);
-    hid_t status = arma_H5Dread(dataset, datatype, H5S_ALL, H5S_ALL, H5P_DEFAULT, void_ptr(v.memptr()));
+    hid_t status = arma_H5Dread(dataset, datatype, memspace, filespace, H5P_DEFAULT, void_ptr(v.memptr()));
     arrayops::convert_cx(dest, v.memptr(), n_elem);
     
     return status;
@@ -712,6 +716,50 @@ load_and_convert_hdf5
 
 
 
+//! Create the dataset creation property list for a chunked layout with the shuffle and deflate filters.
+//! Each chunk holds roughly 256 KB; the chunk is extended along the fastest changing dimension first (ie. rows),
+//! so that reading whole columns (or slices) touches as few chunks as possible.
+//! Returns H5P_DEFAULT (contiguous layout, no compression) if the dataset is empty or the plist can't be created.
+inline
+hid_t
+create_compressed_dcpl(const int rank, const hsize_t* dims, const uword elem_size)
+  {
+  for(int d=0; d < rank; ++d)  { if(dims[d] == 0)  { return H5P_DEFAULT; } }
+  
+  hid_t plist = arma_H5Pcreate(arma_H5P_DATASET_CREATE);
+  
+  if(plist < 0)  { return H5P_DEFAULT; }
+  
+  hsize_t chunk[3];
+  
+  hsize_t n_chunk_elem = hsize_t( (std::max)( uword(1), uword(262144) / elem_size ) );
+  
+  for(int d = rank-1; d >= 0; --d)
+    {
+    chunk[d] = (std::max)( hsize_t(1), (std::min)(dims[d], n_chunk_elem) );
+    
+    n_chunk_elem = (std::max)( hsize_t(1), n_chunk_elem / chunk[d] );
+    }
+  
+  bool status = (arma_H5Pset_chunk(plist, rank, chunk) >= 0);
+  
+  if(status)  { arma_H5Pset_shuffle(plist); }
+  
+  // compression is skipped if the HDF5 library was built without zlib
+  if( status && (arma_H5Zfilter_avail(H5Z_FILTER_DEFLATE) > 0) )  { arma_H5Pset_deflate(plist, 6); }
+  
+  if(status == false)
+    {
+    arma_H5Pclose(plist);
+    
+    return H5P_DEFAULT;
+    }
+  
+  return plist;
+  }
+
+
+
 }       // namespace hdf5_misc
 #endif  // #if defined(ARMA_USE_HDF5)
 
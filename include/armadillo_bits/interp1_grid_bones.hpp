@@ -0,0 +1,70 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+//! \addtogroup interp1_grid
+//! @{
+
+
+
+//! Class for 1D interpolation of the values Y at the grid points X.
+//! The grid is sanitised and the coefficients of the interpolating polynomials are computed
+//! only once, so that they can be reused for any number of query sets.
+template<typename eT>
+class interp1_grid
+  {
+  public:
+  
+  static const uword parallel_n_elem = 65536;  //!< minimum number of query points for OpenMP evaluation
+  
+  
+  inline ~interp1_grid();
+  inline  interp1_grid();
+  
+  inline                     interp1_grid(const interp1_grid& x);
+  inline const interp1_grid& operator=   (const interp1_grid& x);
+  
+  template<typename T1, typename T2>
+  inline interp1_grid(const Base<eT,T1>& X, const Base<eT,T2>& Y, const char* method = "linear");
+  
+  template<typename T1, typename T2>
+  inline void set(const Base<eT,T1>& X, const Base<eT,T2>& Y, const char* method = "linear");
+  
+  template<typename T1>
+  inline void eval(const Base<eT,T1>& XI, Mat<eT>& YI, const eT extrap_val = Datum<eT>::nan) const;
+  
+  inline void reset();
+  
+  inline uword n_knots() const;
+  
+  inline static uword method_sig(const char* method);
+  
+  
+  private:
+  
+  arma_aligned uword   interp_type;  //!< 1: nearest neighbour, 2: linear, 3: piecewise cubic (pchip, spline)
+  arma_aligned Col<eT> XG;
+  arma_aligned Col<eT> YG;
+  arma_aligned Mat<eT> coeffs;       //!< coefficients of the cubic polynomial for each interval, stored column-wise
+  
+  arma_aligned interval_finder<eT> finder;  //!< refers to the memory of XG
+  
+  inline void init(const Mat<eT>& X, const Mat<eT>& Y, const uword method);
+  
+  inline void calc_slopes_pchip (podarray<eT>& slopes) const;
+  inline void calc_slopes_spline(podarray<eT>& slopes) const;
+  
+  inline void calc_coeffs(const podarray<eT>& slopes);
+  
+  inline void eval_range(eT* YI_mem, const eT* XI_mem, const uword N, const eT extrap_val) const;
+  };
+
+
+
+//! @}
@@ -0,0 +1,560 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+//! \addtogroup interp1_grid
+//! @{
+
+
+
+template<typename eT>
+inline
+interp1_grid<eT>::~interp1_grid()
+  {
+  arma_extra_debug_sigprint_this(this);
+  }
+
+
+
+template<typename eT>
+inline
+interp1_grid<eT>::interp1_grid()
+  : interp_type(0)
+  {
+  arma_extra_debug_sigprint_this(this);
+  }
+
+
+
+//! the interval finder of the copy refers to the copied grid points
+template<typename eT>
+inline
+interp1_grid<eT>::interp1_grid(const interp1_grid& x)
+  : interp_type(x.interp_type)
+  , XG         (x.XG         )
+  , YG         (x.YG         )
+  , coeffs     (x.coeffs     )
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  finder.set(XG.memptr(), XG.n_elem);
+  }
+
+
+
+template<typename eT>
+inline
+const interp1_grid<eT>&
+interp1_grid<eT>::operator=(const interp1_grid& x)
+  {
+  arma_extra_debug_sigprint();
+  
+  if(this != &x)
+    {
+    interp_type = x.interp_type;
+    XG          = x.XG;
+    YG          = x.YG;
+    coeffs      = x.coeffs;
+    
+    finder.set(XG.memptr(), XG.n_elem);
+    }
+  
+  return *this;
+  }
+
+
+
+template<typename eT>
+template<typename T1, typename T2>
+inline
+interp1_grid<eT>::interp1_grid(const Base<eT,T1>& X, const Base<eT,T2>& Y, const char* method)
+  : interp_type(0)
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  set(X, Y, method);
+  }
+
+
+
+template<typename eT>
+template<typename T1, typename T2>
+inline
+void
+interp1_grid<eT>::set(const Base<eT,T1>& X, const Base<eT,T2>& Y, const char* method)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword sig = interp1_grid<eT>::method_sig(method);
+  
+  arma_debug_check( (sig == 0), "interp1(): unsupported interpolation type" );
+  
+  const quasi_unwrap<T1> X_tmp(X.get_ref());
+  const quasi_unwrap<T2> Y_tmp(Y.get_ref());
+  
+  init(X_tmp.M, Y_tmp.M, sig);
+  }
+
+
+
+//! evaluate the interpolation at each element of XI;
+//! elements of XI outside of the grid are set to extrap_val
+template<typename eT>
+template<typename T1>
+inline
+void
+interp1_grid<eT>::eval(const Base<eT,T1>& XI, Mat<eT>& YI, const eT extrap_val) const
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_check( (XG.n_elem < 2), "interp1_grid::eval(): grid has not been set" );
+  
+  const quasi_unwrap<T1> XI_tmp(XI.get_ref());
+  
+  const Mat<eT>& XI_M = XI_tmp.M;
+  
+  if(XI_tmp.is_alias(YI))
+    {
+    Mat<eT> tmp;
+    
+    eval(XI_M, tmp, extrap_val);
+    
+    YI.steal_mem(tmp);
+    
+    return;
+    }
+  
+  YI.copy_size(XI_M);
+  
+  const uword N = XI_M.n_elem;
+  
+  const eT* XI_mem = XI_M.memptr();
+        eT* YI_mem = YI.memptr();
+  
+  #if defined(_OPENMP)
+    {
+    const uword n_threads = uword( (std::max)(int(1), omp_get_max_threads()) );
+    
+    if( (N >= interp1_grid<eT>::parallel_n_elem) && (n_threads > 1) && (omp_in_parallel() == 0) )
+      {
+      arma_extra_debug_print("interp1_grid::eval(): parallel");
+      
+      const uword part_n_elem = (N + n_threads - 1) / n_threads;
+      
+      #pragma omp parallel for schedule(static,1)
+      for(uword t=0; t < n_threads; ++t)
+        {
+        const uword start = (std::min)(t * part_n_elem, N);
+        const uword end   = (std::min)(start + part_n_elem, N);
+        
+        eval_range(&(YI_mem[start]), &(XI_mem[start]), end - start, extrap_val);
+        }
+      
+      return;
+      }
+    }
+  #endif
+  
+  eval_range(YI_mem, XI_mem, N, extrap_val);
+  }
+
+
+
+template<typename eT>
+inline
+void
+interp1_grid<eT>::reset()
+  {
+  arma_extra_debug_sigprint();
+  
+  interp_type = 0;
+  
+  XG.reset();
+  YG.reset();
+  coeffs.reset();
+  
+  finder.set(XG.memptr(), 0);
+  }
+
+
+
+template<typename eT>
+inline
+uword
+interp1_grid<eT>::n_knots() const
+  {
+  return XG.n_elem;
+  }
+
+
+
+//! convert the name of an interpolation method to an internal code:
+//! 10: nearest neighbour, 20: linear, 30: pchip, 40: spline;
+//! the code is incremented by 1 when the name starts with '*' (assume monotonic increase in X);
+//! returns 0 for an unknown method
+template<typename eT>
+inline
+uword
+interp1_grid<eT>::method_sig(const char* method)
+  {
+  uword sig = 0;
+  
+  if(method    != NULL   )
+  if(method[0] != char(0))
+  if(method[1] != char(0))
+    {
+    const bool assume_sorted = (method[0] == '*');
+    
+    const char c = (assume_sorted) ? method[1] : method[0];
+    
+         if(c == 'n')                { sig = 10; }  // nearest neighbour
+    else if(c == 'l')                { sig = 20; }  // linear
+    else if( (c == 'p') || (c == 'c') )  { sig = 30; }  // pchip; "cubic" is the same as "pchip"
+    else if(c == 's')                { sig = 40; }  // cubic spline with not-a-knot end conditions
+    
+    if( (sig != 0) && assume_sorted )  { sig += 1; }
+    }
+  
+  return sig;
+  }
+
+
+
+template<typename eT>
+inline
+void
+interp1_grid<eT>::init(const Mat<eT>& X, const Mat<eT>& Y, const uword method)
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_check( ((X.is_vec() == false) || (Y.is_vec() == false)), "interp1(): currently only vectors are supported" );
+  
+  arma_debug_check( (X.n_elem != Y.n_elem), "interp1(): X and Y must have the same number of elements" );
+  
+  arma_debug_check( (X.n_elem < 2), "interp1(): X must have at least two unique elements" );
+  
+  const bool assume_sorted = ((method % 10) == 1);
+  
+  if(assume_sorted)
+    {
+    XG.set_size(X.n_elem);
+    YG.set_size(Y.n_elem);
+    
+    arrayops::copy( XG.memptr(), X.memptr(), X.n_elem );
+    arrayops::copy( YG.memptr(), Y.memptr(), Y.n_elem );
+    }
+  else
+    {
+    uvec X_indices;
+    
+    try { X_indices = find_unique(X,false); } catch(...) { }
+    
+    // NOTE: find_unique(X,false) provides indices of elements sorted in ascending order
+    // NOTE: find_unique(X,false) will reset X_indices if X has NaN
+    
+    const uword N_subset = X_indices.n_elem;
+    
+    arma_debug_check( (N_subset < 2), "interp1(): X must have at least two unique elements" );
+    
+    XG.set_size(N_subset);
+    YG.set_size(N_subset);
+    
+    eT* XG_mem = XG.memptr();
+    eT* YG_mem = YG.memptr();
+    
+    const eT* X_mem = X.memptr();
+    const eT* Y_mem = Y.memptr();
+    
+    const uword* X_indices_mem = X_indices.memptr();
+    
+    for(uword i=0; i<N_subset; ++i)
+      {
+      const uword j = X_indices_mem[i];
+      
+      XG_mem[i] = X_mem[j];
+      YG_mem[i] = Y_mem[j];
+      }
+    }
+  
+  const uword N      = XG.n_elem;
+  const eT*   XG_mem = XG.memptr();
+  
+  arma_debug_check( ((XG_mem[N-1] > XG_mem[0]) == false), "interp1(): X must be monotonically increasing" );
+  
+  finder.set(XG_mem, N);
+  
+  const uword type = method / 10;
+  
+  interp_type = (type < 3) ? type : uword(3);
+  
+  if(type >= 3)
+    {
+    podarray<eT> slopes;
+    
+    if(type == 3)  { calc_slopes_pchip (slopes); }
+    if(type == 4)  { calc_slopes_spline(slopes); }
+    
+    calc_coeffs(slopes);
+    }
+  else
+    {
+    coeffs.reset();
+    }
+  }
+
+
+
+//! slopes for shape-preserving piecewise cubic Hermite interpolation (Fritsch-Carlson),
+//! using the weighted harmonic mean of the adjacent secants and one-sided three-point end slopes
+template<typename eT>
+inline
+void
+interp1_grid<eT>::calc_slopes_pchip(podarray<eT>& slopes) const
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword N = XG.n_elem;
+  
+  const eT* XG_mem = XG.memptr();
+  const eT* YG_mem = YG.memptr();
+  
+  slopes.set_size(N);
+  
+  if(N == 2)
+    {
+    const eT m0 = (YG_mem[1] - YG_mem[0]) / (XG_mem[1] - XG_mem[0]);
+    
+    slopes[0] = m0;
+    slopes[1] = m0;
+    
+    return;
+    }
+  
+  podarray<eT> h(N-1);
+  podarray<eT> m(N-1);
+  
+  for(uword k=0; k < (N-1); ++k)
+    {
+    h[k] = XG_mem[k+1] - XG_mem[k];
+    m[k] = (YG_mem[k+1] - YG_mem[k]) / h[k];
+    }
+  
+  for(uword k=1; k < (N-1); ++k)
+    {
+    const eT m0 = m[k-1];
+    const eT m1 = m[k];
+    
+    if( (m0 == eT(0)) || (m1 == eT(0)) || ((m0 > eT(0)) != (m1 > eT(0))) )
+      {
+      slopes[k] = eT(0);
+      }
+    else
+      {
+      const eT w1 = eT(2)*h[k] + h[k-1];
+      const eT w2 = h[k] + eT(2)*h[k-1];
+      
+      slopes[k] = (w1 + w2) / (w1/m0 + w2/m1);
+      }
+    }
+  
+  for(uword e=0; e < 2; ++e)
+    {
+    // e = 0: first point; e = 1: last point
+    
+    const uword a = (e == 0) ? uword(0) : uword(N-2);
+    const uword b = (e == 0) ? uword(1) : uword(N-3);
+    
+    const eT d = ( (eT(2)*h[a] + h[b])*m[a] - h[a]*m[b] ) / (h[a] + h[b]);
+    
+    const int sign_d = (d    > eT(0)) ? 1 : ( (d    < eT(0)) ? -1 : 0 );
+    const int sign_a = (m[a] > eT(0)) ? 1 : ( (m[a] < eT(0)) ? -1 : 0 );
+    const int sign_b = (m[b] > eT(0)) ? 1 : ( (m[b] < eT(0)) ? -1 : 0 );
+    
+    eT val = d;
+    
+         if(sign_d != sign_a)                                              { val = eT(0);       }
+    else if( (sign_a != sign_b) && (std::abs(d) > std::abs(eT(3)*m[a])) )  { val = eT(3)*m[a];  }
+    
+    slopes[(e == 0) ? uword(0) : uword(N-1)] = val;
+    }
+  }
+
+
+
+//! slopes for a cubic spline with not-a-knot end conditions,
+//! found by solving a tridiagonal system
+template<typename eT>
+inline
+void
+interp1_grid<eT>::calc_slopes_spline(podarray<eT>& slopes) const
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword N = XG.n_elem;
+  
+  const eT* XG_mem = XG.memptr();
+  const eT* YG_mem = YG.memptr();
+  
+  slopes.set_size(N);
+  
+  if(N == 2)
+    {
+    const eT m0 = (YG_mem[1] - YG_mem[0]) / (XG_mem[1] - XG_mem[0]);
+    
+    slopes[0] = m0;
+    slopes[1] = m0;
+    
+    return;
+    }
+  
+  podarray<eT> h(N-1);
+  podarray<eT> m(N-1);
+  
+  for(uword k=0; k < (N-1); ++k)
+    {
+    h[k] = XG_mem[k+1] - XG_mem[k];
+    m[k] = (YG_mem[k+1] - YG_mem[k]) / h[k];
+    }
+  
+  podarray<eT> sub (N);
+  podarray<eT> diag(N);
+  podarray<eT> sup (N);
+  podarray<eT> rhs (N);
+  
+  for(uword i=1; i < (N-1); ++i)
+    {
+    sub [i] = h[i];
+    diag[i] = eT(2) * (h[i-1] + h[i]);
+    sup [i] = h[i-1];
+    rhs [i] = eT(3) * (h[i]*m[i-1] + h[i-1]*m[i]);
+    }
+  
+  if(N == 3)
+    {
+    // not-a-knot with three points: the parabola through the points
+    
+    diag[0] = eT(1);  sup[0] = eT(1);  rhs[0] = eT(2)*m[0];
+    sub[2]  = eT(1);  diag[2] = eT(1);  rhs[2] = eT(2)*m[1];
+    }
+  else
+    {
+    const eT d0 = h[0]   + h[1];
+    const eT d1 = h[N-2] + h[N-3];
+    
+    diag[0] = h[1];
+    sup [0] = d0;
+    rhs [0] = ( (h[0] + eT(2)*d0)*h[1]*m[0] + h[0]*h[0]*m[1] ) / d0;
+    
+    sub [N-1] = d1;
+    diag[N-1] = h[N-3];
+    rhs [N-1] = ( h[N-2]*h[N-2]*m[N-3] + (eT(2)*d1 + h[N-2])*h[N-3]*m[N-2] ) / d1;
+    }
+  
+  // forward elimination and back substitution
+  
+  for(uword i=1; i < N; ++i)
+    {
+    const eT w = sub[i] / diag[i-1];
+    
+    diag[i] -= w * sup[i-1];
+    rhs [i] -= w * rhs[i-1];
+    }
+  
+  slopes[N-1] = rhs[N-1] / diag[N-1];
+  
+  for(uword i=(N-1); i > 0; --i)
+    {
+    slopes[i-1] = (rhs[i-1] - sup[i-1]*slopes[i]) / diag[i-1];
+    }
+  }
+
+
+
+//! coefficients of y = c0 + c1*t + c2*t^2 + c3*t^3 for each interval, where t is the offset from the start of the interval
+template<typename eT>
+inline
+void
+interp1_grid<eT>::calc_coeffs(const podarray<eT>& slopes)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword N = XG.n_elem;
+  
+  const eT* XG_mem = XG.memptr();
+  const eT* YG_mem = YG.memptr();
+  
+  coeffs.set_size(4, N-1);
+  
+  for(uword k=0; k < (N-1); ++k)
+    {
+    const eT h  = XG_mem[k+1] - XG_mem[k];
+    const eT m  = (YG_mem[k+1] - YG_mem[k]) / h;
+    const eT s0 = slopes[k];
+    const eT s1 = slopes[k+1];
+    
+    eT* c = coeffs.colptr(k);
+    
+    c[0] = YG_mem[k];
+    c[1] = s0;
+    c[2] = (eT(3)*m - eT(2)*s0 - s1) / h;
+    c[3] = (s0 + s1 - eT(2)*m) / (h*h);
+    }
+  }
+
+
+
+template<typename eT>
+inline
+void
+interp1_grid<eT>::eval_range(eT* YI_mem, const eT* XI_mem, const uword N, const eT extrap_val) const
+  {
+  const eT* XG_mem = XG.memptr();
+  const eT* YG_mem = YG.memptr();
+  
+  const eT    XG_min = XG_mem[0];
+  const eT    XG_max = XG_mem[XG.n_elem - 1];
+  const uword k_last = XG.n_elem - 2;
+  
+  for(uword i=0; i<N; ++i)
+    {
+    const eT x = XI_mem[i];
+    
+    if(arma_isnan(x))                    { YI_mem[i] = Datum<eT>::nan;  continue; }
+    if( (x < XG_min) || (x > XG_max) )  { YI_mem[i] = extrap_val;      continue; }
+    
+    // x is within the grid, so the interval is found; the last grid point belongs to the last interval
+    const uword k = (std::min)( finder.find(x), k_last );
+    
+    const eT x_a = XG_mem[k  ];
+    const eT x_b = XG_mem[k+1];
+    
+    if(interp_type == 1)
+      {
+      YI_mem[i] = ( (x - x_a) <= (x_b - x) ) ? YG_mem[k] : YG_mem[k+1];
+      }
+    else
+    if(interp_type == 2)
+      {
+      const eT weight = (x - x_a) / (x_b - x_a);
+      
+      YI_mem[i] = (eT(1) - weight)*YG_mem[k] + weight*YG_mem[k+1];
+      }
+    else
+      {
+      const eT  t = x - x_a;
+      const eT* c = coeffs.colptr(k);
+      
+      YI_mem[i] = c[0] + t*(c[1] + t*(c[2] + t*c[3]));
+      }
+    }
+  }
+
+
+
+//! @}
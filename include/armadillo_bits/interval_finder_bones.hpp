@@ -0,0 +1,54 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+//! \addtogroup interval_finder
+//! @{
+
+
+
+//! Finds the interval containing a given value, where the intervals are defined by
+//! monotonically non-decreasing points x[0], x[1], ..., x[N-1]. For internal use only!
+//! Approximately evenly spaced points are handled in constant time,
+//! by estimating the position of the value and then correcting the estimate.
+//! For other points the range is split into N-1 equally sized buckets,
+//! and a lookup table provides the points within each bucket;
+//! crowded buckets are handled via binary search.
+template<typename eT>
+class interval_finder
+  {
+  public:
+  
+  inline interval_finder();
+  inline interval_finder(const eT* in_mem, const uword in_N);
+  
+  inline void set(const eT* in_mem, const uword in_N);
+  
+  inline static bool is_sorted(const eT* mem, const uword N);
+  
+  arma_inline uword find(const eT val) const;
+  
+  
+  private:
+  
+  const eT* mem;
+  uword     N;
+  
+  bool   is_uniform;
+  double origin;
+  double inv_step;
+  
+  podarray<uword> lookup;  //!< for points which are not evenly spaced: the last point <= the start of each bucket
+  
+  arma_inline uword search(const uword start, const uword n_points, const eT val) const;
+  };
+
+
+
+//! @}
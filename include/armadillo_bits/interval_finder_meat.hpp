@@ -0,0 +1,204 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+//! \addtogroup interval_finder
+//! @{
+
+
+
+template<typename eT>
+inline
+interval_finder<eT>::interval_finder()
+  : mem       (NULL )
+  , N         (0    )
+  , is_uniform(false)
+  , origin    (0.0  )
+  , inv_step  (0.0  )
+  {
+  arma_extra_debug_sigprint();
+  }
+
+
+
+//! the points in in_mem must be sorted (see is_sorted()) and must remain valid during the lifetime of the object
+template<typename eT>
+inline
+interval_finder<eT>::interval_finder(const eT* in_mem, const uword in_N)
+  : mem       (NULL )
+  , N         (0    )
+  , is_uniform(false)
+  , origin    (0.0  )
+  , inv_step  (0.0  )
+  {
+  arma_extra_debug_sigprint();
+  
+  set(in_mem, in_N);
+  }
+
+
+
+//! the points in in_mem must be sorted (see is_sorted()) and must remain valid while the object is used
+template<typename eT>
+inline
+void
+interval_finder<eT>::set(const eT* in_mem, const uword in_N)
+  {
+  arma_extra_debug_sigprint();
+  
+  mem        = in_mem;
+  N          = in_N;
+  is_uniform = false;
+  origin     = 0.0;
+  inv_step   = 0.0;
+  
+  lookup.reset();
+  
+  if(N < 3)  { return; }
+  
+  const double first = double(mem[0]  );
+  const double last  = double(mem[N-1]);
+  
+  const double step = (last - first) / double(N-1);
+  
+  if( (arma_isfinite(step) == false) || (step <= 0.0) )  { return; }
+  
+  origin   = first;
+  inv_step = 1.0 / step;
+  
+  // each point must be within one step of its position on a uniform grid,
+  // so that correcting the estimated position takes at most a few comparisons
+  
+  is_uniform = true;
+  
+  for(uword i=1; i < (N-1); ++i)
+    {
+    const double deviation = double(mem[i]) - (first + double(i)*step);
+    
+    if( ((deviation >= 0.0) ? deviation : -deviation) > step )  { is_uniform = false; break; }
+    }
+  
+  if(is_uniform)  { return; }
+  
+  const uword n_buckets = N-1;
+  
+  lookup.set_size(n_buckets + 1);
+  
+  uword k = 0;
+  
+  for(uword b=0; b < n_buckets; ++b)
+    {
+    const double bucket_start = first + double(b)*step;
+    
+    while( (k < (N-2)) && (double(mem[k+1]) <= bucket_start) )  { ++k; }
+    
+    lookup[b] = k;
+    }
+  
+  lookup[n_buckets] = N-2;
+  }
+
+
+
+//! true if the points are monotonically non-decreasing and don't contain NaN
+template<typename eT>
+inline
+bool
+interval_finder<eT>::is_sorted(const eT* mem, const uword N)
+  {
+  arma_extra_debug_sigprint();
+  
+  for(uword i=0; i < N; ++i)
+    {
+    if(arma_isnan(mem[i]))  { return false; }
+    }
+  
+  for(uword i=1; i < N; ++i)
+    {
+    if(mem[i] < mem[i-1])  { return false; }
+    }
+  
+  return true;
+  }
+
+
+
+//! index of the last point which is <= val;
+//! returns N if val is less than the first point, or if val is NaN
+template<typename eT>
+arma_inline
+uword
+interval_finder<eT>::find(const eT val) const
+  {
+  if( (N == 0) || (arma_isnan(val)) || (val < mem[0]) )  { return N; }
+  
+  if(val >= mem[N-1])  { return N-1; }
+  
+  const double pos = (double(val) - origin) * inv_step;
+  
+  if(is_uniform)
+    {
+    // mem[0] <= val < mem[N-1], so the estimate is within the [0, N-1] interval, give or take rounding
+    
+    uword k = (pos > 0.0) ? (std::min)( uword(pos), uword(N-2) ) : uword(0);
+    
+    while(mem[k] > val)                         { --k; }
+    while( ((k+2) < N) && (mem[k+1] <= val) )   { ++k; }
+    
+    return k;
+    }
+  
+  if(lookup.n_elem > 0)
+    {
+    const uword b = (pos > 0.0) ? (std::min)( uword(pos), uword(N-2) ) : uword(0);
+    
+    const uword k_start = lookup[b  ];
+    const uword k_end   = lookup[b+1];
+    
+    // many points within the bucket
+    uword k = ( (k_end - k_start) > 8 ) ? search(k_start, k_end - k_start + 1, val) : k_start;
+    
+    // the estimated bucket can be off by one due to rounding
+    while(mem[k] > val)                         { --k; }
+    while( ((k+2) < N) && (mem[k+1] <= val) )   { ++k; }
+    
+    return k;
+    }
+  
+  return search(0, N, val);
+  }
+
+
+
+//! index of the last point <= val among the n points starting at mem[start], assuming mem[start] <= val;
+//! binary search, written so that the compiler can use conditional moves instead of branches
+template<typename eT>
+arma_inline
+uword
+interval_finder<eT>::search(const uword start, const uword n_points, const eT val) const
+  {
+  const eT* base = mem + start;
+  
+  uword n = n_points;
+  
+  while(n > 1)
+    {
+    const uword half = n / 2;
+    
+    base = (base[half] <= val) ? (base + half) : base;
+    
+    n -= half;
+    }
+  
+  return uword(base - mem);
+  }
+
+
+
+//! @}
@@ -0,0 +1,91 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+//! \addtogroup lapack_work
+//! @{
+
+
+
+//! identifiers for LAPACK call sites whose workspace queries are remembered by lapack_work
+struct lapack_work_id
+  {
+  static const blas_int getri         = 1;
+  static const blas_int geqrf         = 2;
+  static const blas_int gesvd_s       = 3;
+  static const blas_int gesvd_usv     = 4;
+  static const blas_int gesvd_econ    = 5;
+  static const blas_int cx_gesvd_s    = 6;
+  static const blas_int cx_gesvd_usv  = 7;
+  static const blas_int cx_gesvd_econ = 8;
+  static const blas_int gelsd         = 9;
+  static const blas_int cx_gelsd      = 10;
+  static const blas_int ormqr         = 11;
+  static const blas_int unmqr         = 12;
+  };
+
+
+
+//! per-thread state used by lapack_work
+template<typename eT>
+struct lapack_work_state
+  {
+  static const uword n_entries = 16;
+  
+  podarray<eT> buffer;         //!< reusable workspace
+  bool         buffer_in_use;  //!< true if the buffer is currently held by an instance of lapack_work
+  uword        next_entry;     //!< entry to be overwritten by the next stored workspace query
+  blas_int     entries[n_entries][5];  //!< each entry holds routine, m, n, k, lwork
+  
+  inline lapack_work_state();
+  };
+
+
+
+//! Workspace for LAPACK functions. For internal use only!
+//! Memory is taken from a per-thread buffer which is kept across calls,
+//! so that repeated decompositions of the same size don't allocate memory.
+//! Workspaces larger than ARMA_LAPACK_WORK_CACHE_MAX elements are allocated and released as normal.
+template<typename eT>
+class lapack_work
+  {
+  public:
+  
+  inline ~lapack_work();
+  inline explicit lapack_work(const uword in_n_elem);
+  
+  inline void set_min_size(const uword min_n_elem);
+  
+  arma_inline eT& operator[] (const uword i);
+  arma_inline eT  operator[] (const uword i) const;
+  
+  arma_inline       eT* memptr();
+  arma_inline const eT* memptr() const;
+  
+  inline static bool get_lwork(blas_int& lwork, const blas_int routine, const blas_int m, const blas_int n, const blas_int k = 0);
+  inline static void set_lwork(const blas_int lwork, const blas_int routine, const blas_int m, const blas_int n, const blas_int k = 0);
+  
+  
+  private:
+  
+  arma_aligned podarray<eT>              local;
+  arma_aligned lapack_work_state<eT>*    state;
+  arma_aligned eT*                       mem;
+  
+  inline void acquire(const uword in_n_elem);
+  
+  inline static lapack_work_state<eT>* get_state();
+  
+  inline                    lapack_work(const lapack_work&);  //!< not implemented
+  inline const lapack_work& operator=  (const lapack_work&);  //!< not implemented
+  };
+
+
+
+//! @}
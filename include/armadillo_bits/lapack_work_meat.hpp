@@ -0,0 +1,225 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+//! \addtogroup lapack_work
+//! @{
+
+
+
+template<typename eT>
+inline
+lapack_work_state<eT>::lapack_work_state()
+  : buffer_in_use(false)
+  , next_entry(0)
+  {
+  for(uword i=0; i < n_entries; ++i)
+    {
+    for(uword j=0; j < 5; ++j)  { entries[i][j] = blas_int(0); }
+    }
+  }
+
+
+
+template<typename eT>
+inline
+lapack_work<eT>::~lapack_work()
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  if(state != 0)  { state->buffer_in_use = false; }
+  }
+
+
+
+template<typename eT>
+inline
+lapack_work<eT>::lapack_work(const uword in_n_elem)
+  : state(0)
+  , mem  (0)
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  acquire(in_n_elem);
+  }
+
+
+
+template<typename eT>
+inline
+void
+lapack_work<eT>::set_min_size(const uword min_n_elem)
+  {
+  arma_extra_debug_sigprint();
+  
+  if(state != 0)
+    {
+    if(min_n_elem > state->buffer.n_elem)
+      {
+      state->buffer_in_use = false;
+      state                = 0;
+      
+      acquire(min_n_elem);
+      }
+    }
+  else
+    {
+    local.set_min_size(min_n_elem);
+    
+    mem = local.memptr();
+    }
+  }
+
+
+
+template<typename eT>
+arma_inline
+eT&
+lapack_work<eT>::operator[] (const uword i)
+  {
+  return mem[i];
+  }
+
+
+
+template<typename eT>
+arma_inline
+eT
+lapack_work<eT>::operator[] (const uword i) const
+  {
+  return mem[i];
+  }
+
+
+
+template<typename eT>
+arma_inline
+eT*
+lapack_work<eT>::memptr()
+  {
+  return mem;
+  }
+
+
+
+template<typename eT>
+arma_inline
+const eT*
+lapack_work<eT>::memptr() const
+  {
+  return mem;
+  }
+
+
+
+//! get the workspace size previously obtained via a workspace query (lwork = -1) for the given routine and problem size
+template<typename eT>
+inline
+bool
+lapack_work<eT>::get_lwork(blas_int& lwork, const blas_int routine, const blas_int m, const blas_int n, const blas_int k)
+  {
+  arma_extra_debug_sigprint();
+  
+  lapack_work_state<eT>* local_state = get_state();
+  
+  if(local_state == 0)  { return false; }
+  
+  for(uword i=0; i < lapack_work_state<eT>::n_entries; ++i)
+    {
+    const blas_int* entry = local_state->entries[i];
+    
+    if( (entry[0] == routine) && (entry[1] == m) && (entry[2] == n) && (entry[3] == k) )
+      {
+      lwork = entry[4];
+      
+      return true;
+      }
+    }
+  
+  return false;
+  }
+
+
+
+//! store the result of a workspace query, overwriting the oldest entry if required
+template<typename eT>
+inline
+void
+lapack_work<eT>::set_lwork(const blas_int lwork, const blas_int routine, const blas_int m, const blas_int n, const blas_int k)
+  {
+  arma_extra_debug_sigprint();
+  
+  lapack_work_state<eT>* local_state = get_state();
+  
+  if(local_state == 0)  { return; }
+  
+  blas_int* entry = local_state->entries[local_state->next_entry];
+  
+  entry[0] = routine;
+  entry[1] = m;
+  entry[2] = n;
+  entry[3] = k;
+  entry[4] = lwork;
+  
+  local_state->next_entry = (local_state->next_entry + 1) % lapack_work_state<eT>::n_entries;
+  }
+
+
+
+template<typename eT>
+inline
+void
+lapack_work<eT>::acquire(const uword in_n_elem)
+  {
+  arma_extra_debug_sigprint();
+  
+  lapack_work_state<eT>* local_state = (in_n_elem <= uword(ARMA_LAPACK_WORK_CACHE_MAX)) ? get_state() : 0;
+  
+  if( (local_state != 0) && (local_state->buffer_in_use == false) )
+    {
+    local_state->buffer.set_min_size(in_n_elem);
+    local_state->buffer_in_use = true;
+    
+    state = local_state;
+    mem   = local_state->buffer.memptr();
+    }
+  else
+    {
+    // the per-thread buffer is already in use (eg. more than one workspace is required),
+    // or the workspace is too large to be kept around
+    
+    local.set_min_size(in_n_elem);
+    
+    mem = local.memptr();
+    }
+  }
+
+
+
+template<typename eT>
+inline
+lapack_work_state<eT>*
+lapack_work<eT>::get_state()
+  {
+  #if defined(ARMA_HAVE_THREAD_LOCAL) && (ARMA_LAPACK_WORK_CACHE_MAX > 0)
+    {
+    thread_local lapack_work_state<eT> thread_state;
+    
+    return &thread_state;
+    }
+  #else
+    {
+    return 0;
+    }
+  #endif
+  }
+
+
+
+//! @}
@@ -0,0 +1,50 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+//! \addtogroup lu_factor
+//! @{
+
+
+
+//! LU factorisation of a square matrix, kept for solving several systems with the same matrix.
+//! The factorisation is done once; each call to solve() only requires forward and back substitution.
+template<typename eT>
+class lu_factor
+  {
+  public:
+  
+  typedef eT                                elem_type;
+  typedef typename get_pod_type<eT>::result pod_type;
+  
+  inline ~lu_factor();
+  inline  lu_factor();
+  
+  template<typename T1> inline explicit lu_factor(const Base<eT,T1>& X);
+  
+  template<typename T1> inline bool factorise(const Base<eT,T1>& X);
+  
+  template<typename T1> inline bool    solve(Mat<eT>& out, const Base<eT,T1>& B) const;
+  template<typename T1> inline Mat<eT> solve(              const Base<eT,T1>& B) const;
+  
+  inline void reset();
+  
+  arma_inline bool  is_empty() const;
+  arma_inline uword n_rows()   const;
+  
+  
+  private:
+  
+  arma_aligned Mat<eT>            LU;
+  arma_aligned podarray<blas_int> ipiv;
+  };
+
+
+
+//! @}
@@ -0,0 +1,153 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+//! \addtogroup lu_factor
+//! @{
+
+
+
+template<typename eT>
+inline
+lu_factor<eT>::~lu_factor()
+  {
+  arma_extra_debug_sigprint_this(this);
+  }
+
+
+
+template<typename eT>
+inline
+lu_factor<eT>::lu_factor()
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  arma_type_check(( is_supported_blas_type<eT>::value == false ));
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+lu_factor<eT>::lu_factor(const Base<eT,T1>& X)
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  arma_type_check(( is_supported_blas_type<eT>::value == false ));
+  
+  const bool status = factorise(X);
+  
+  if(status == false)
+    {
+    arma_stop_runtime_error("lu_factor(): decomposition failed");
+    }
+  }
+
+
+
+//! returns false if the given matrix is singular
+template<typename eT>
+template<typename T1>
+inline
+bool
+lu_factor<eT>::factorise(const Base<eT,T1>& X)
+  {
+  arma_extra_debug_sigprint();
+  
+  LU = X.get_ref();
+  
+  arma_debug_check( (LU.is_square() == false), "lu_factor::factorise(): given matrix must be square sized" );
+  
+  const bool status = auxlib::lu_fact(LU, ipiv);
+  
+  if(status == false)  { reset(); }
+  
+  return status;
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+bool
+lu_factor<eT>::solve(Mat<eT>& out, const Base<eT,T1>& B) const
+  {
+  arma_extra_debug_sigprint();
+  
+  out = B.get_ref();
+  
+  arma_debug_check( (LU.n_rows != out.n_rows), "lu_factor::solve(): number of rows in given matrix must match the factorised matrix" );
+  
+  const bool status = auxlib::lu_fact_solve(out, LU, ipiv);
+  
+  if(status == false)  { out.reset(); }
+  
+  return status;
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+Mat<eT>
+lu_factor<eT>::solve(const Base<eT,T1>& B) const
+  {
+  arma_extra_debug_sigprint();
+  
+  Mat<eT> out;
+  
+  const bool status = solve(out, B);
+  
+  if(status == false)
+    {
+    arma_stop_runtime_error("lu_factor::solve(): solution not found");
+    }
+  
+  return out;
+  }
+
+
+
+template<typename eT>
+inline
+void
+lu_factor<eT>::reset()
+  {
+  arma_extra_debug_sigprint();
+  
+  LU.reset();
+  ipiv.reset();
+  }
+
+
+
+template<typename eT>
+arma_inline
+bool
+lu_factor<eT>::is_empty() const
+  {
+  return LU.is_empty();
+  }
+
+
+
+template<typename eT>
+arma_inline
+uword
+lu_factor<eT>::n_rows() const
+  {
+  return LU.n_rows;
+  }
+
+
+
+//! @}
@@ -0,0 +1,364 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+//! \addtogroup lz_codec
+//! @{
+
+
+
+//! Self-contained block compression used by the arma_compressed file format. For internal use only!
+//! The bytes of the elements are first shuffled (all first bytes, then all second bytes, etc),
+//! which groups similar bytes together (eg. exponents and sign bits of floating point numbers),
+//! followed by LZ77 style compression with a 64 KB window.
+//!
+//! Each compressed sequence consists of:
+//! a token (upper 4 bits: number of literals; lower 4 bits: match length minus 4),
+//! extra bytes for the number of literals (if the upper 4 bits are 15),
+//! the literals,
+//! a 2 byte little endian match offset,
+//! and extra bytes for the match length (if the lower 4 bits are 15).
+//! The last sequence contains only a token and literals.
+class lz_codec
+  {
+  public:
+  
+  static const uword block_n_bytes = 262144;  //!< approximate size of the uncompressed data in each block
+  
+  template<typename eT> inline static uword n_elem_per_block();
+  
+  template<typename eT> inline static uword encode(podarray<u8>& out, const eT* mem, const uword n_elem);
+  template<typename eT> inline static bool  decode(eT* mem, const uword n_elem, const u8* in, const uword in_n_bytes);
+  
+  inline static uword compress  (u8* out, const u8* in, const uword in_n_bytes);
+  inline static bool  decompress(u8* out, const uword out_n_bytes, const u8* in, const uword in_n_bytes);
+  
+  inline static void   shuffle(u8* out, const u8* in, const uword n_elem, const uword elem_size);
+  inline static void unshuffle(u8* out, const u8* in, const uword n_elem, const uword elem_size);
+  
+  
+  private:
+  
+  arma_inline static u32  read_u32(const u8* mem);
+  arma_inline static void write_length(u8* out, uword& out_pos, uword len);
+  };
+
+
+
+template<typename eT>
+inline
+uword
+lz_codec::n_elem_per_block()
+  {
+  return (std::max)( uword(1), uword(block_n_bytes / sizeof(eT)) );
+  }
+
+
+
+//! compress the given elements into out;
+//! returns the number of bytes used in out
+template<typename eT>
+inline
+uword
+lz_codec::encode(podarray<u8>& out, const eT* mem, const uword n_elem)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword n_bytes = n_elem * uword(sizeof(eT));
+  
+  podarray<u8> tmp(n_bytes);
+  
+  lz_codec::shuffle(tmp.memptr(), reinterpret_cast<const u8*>(mem), n_elem, uword(sizeof(eT)));
+  
+  out.set_min_size(n_bytes + 1);
+  
+  const uword n_used = lz_codec::compress(out.memptr() + 1, tmp.memptr(), n_bytes);
+  
+  if(n_used < n_bytes)
+    {
+    out[0] = u8(1);
+    
+    return n_used + 1;
+    }
+  
+  // incompressible data is stored as is
+  
+  out[0] = u8(0);
+  
+  arrayops::copy( out.memptr() + 1, reinterpret_cast<const u8*>(mem), n_bytes );
+  
+  return n_bytes + 1;
+  }
+
+
+
+//! decompress data produced by encode();
+//! returns false if the data is corrupt
+template<typename eT>
+inline
+bool
+lz_codec::decode(eT* mem, const uword n_elem, const u8* in, const uword in_n_bytes)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword n_bytes = n_elem * uword(sizeof(eT));
+  
+  if(in_n_bytes == 0)  { return false; }
+  
+  if(in[0] == u8(0))
+    {
+    if(in_n_bytes != (n_bytes + 1))  { return false; }
+    
+    arrayops::copy( reinterpret_cast<u8*>(mem), in + 1, n_bytes );
+    
+    return true;
+    }
+  
+  if(in[0] != u8(1))  { return false; }
+  
+  podarray<u8> tmp(n_bytes);
+  
+  if(lz_codec::decompress(tmp.memptr(), n_bytes, in + 1, in_n_bytes - 1) == false)  { return false; }
+  
+  lz_codec::unshuffle(reinterpret_cast<u8*>(mem), tmp.memptr(), n_elem, uword(sizeof(eT)));
+  
+  return true;
+  }
+
+
+
+//! compress in_n_bytes of data from in;
+//! out must have room for at least in_n_bytes;
+//! returns the compressed size, or in_n_bytes if the data can't be made smaller
+inline
+uword
+lz_codec::compress(u8* out, const u8* in, const uword in_n_bytes)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword hash_log    = 14;
+  const uword max_offset  = 65535;
+  const uword n_end       = in_n_bytes;
+  
+  podarray<uword> table(uword(1) << hash_log);
+  
+  table.zeros();
+  
+  uword in_pos   = 0;
+  uword anchor   = 0;
+  uword out_pos  = 0;
+  uword n_misses = 0;
+  
+  while( (in_pos + 4) <= n_end )
+    {
+    const u32   seq = read_u32(in + in_pos);
+    const uword h   = uword( u32(seq * u32(2654435761U)) >> (32 - hash_log) );
+    const uword ref = table[h];
+    
+    table[h] = in_pos;
+    
+    if( (ref < in_pos) && ((in_pos - ref) <= max_offset) && (read_u32(in + ref) == seq) )
+      {
+      uword match_len = 4;
+      
+      while( ((in_pos + match_len) < n_end) && (in[ref + match_len] == in[in_pos + match_len]) )  { ++match_len; }
+      
+      const uword n_lit = in_pos - anchor;
+      
+      // worst case size of the sequence
+      if( (out_pos + n_lit + (n_lit/255) + (match_len/255) + 8) >= in_n_bytes )  { return in_n_bytes; }
+      
+      u8* token = out + out_pos;  ++out_pos;
+      
+      const uword lit_code   = (std::min)(n_lit,         uword(15));
+      const uword match_code = (std::min)(match_len - 4, uword(15));
+      
+      *token = u8( (lit_code << 4) | match_code );
+      
+      if(lit_code == 15)  { write_length(out, out_pos, n_lit - 15); }
+      
+      arrayops::copy( out + out_pos, in + anchor, n_lit );  out_pos += n_lit;
+      
+      const uword offset = in_pos - ref;
+      
+      out[out_pos] = u8(offset & 0xFF);  ++out_pos;
+      out[out_pos] = u8(offset >> 8  );  ++out_pos;
+      
+      if(match_code == 15)  { write_length(out, out_pos, match_len - 4 - 15); }
+      
+      in_pos  += match_len;
+      anchor   = in_pos;
+      n_misses = 0;
+      }
+    else
+      {
+      // skip faster through data which doesn't compress
+      ++n_misses;
+      
+      in_pos += uword(1) + (n_misses >> 6);
+      }
+    }
+  
+  // last sequence: literals only
+  
+  const uword n_lit = n_end - anchor;
+  
+  if( (out_pos + n_lit + (n_lit/255) + 2) >= in_n_bytes )  { return in_n_bytes; }
+  
+  const uword lit_code = (std::min)(n_lit, uword(15));
+  
+  out[out_pos] = u8(lit_code << 4);  ++out_pos;
+  
+  if(lit_code == 15)  { write_length(out, out_pos, n_lit - 15); }
+  
+  arrayops::copy( out + out_pos, in + anchor, n_lit );  out_pos += n_lit;
+  
+  return out_pos;
+  }
+
+
+
+inline
+bool
+lz_codec::decompress(u8* out, const uword out_n_bytes, const u8* in, const uword in_n_bytes)
+  {
+  arma_extra_debug_sigprint();
+  
+  uword in_pos  = 0;
+  uword out_pos = 0;
+  
+  while(in_pos < in_n_bytes)
+    {
+    const uword token = uword(in[in_pos]);  ++in_pos;
+    
+    uword n_lit = token >> 4;
+    
+    if(n_lit == 15)
+      {
+      uword val;
+      
+      do
+        {
+        if(in_pos >= in_n_bytes)  { return false; }
+        
+        val = uword(in[in_pos]);  ++in_pos;
+        
+        n_lit += val;
+        }
+      while(val == 255);
+      }
+    
+    if( (n_lit > (in_n_bytes - in_pos)) || (n_lit > (out_n_bytes - out_pos)) )  { return false; }
+    
+    arrayops::copy( out + out_pos, in + in_pos, n_lit );
+    
+    in_pos  += n_lit;
+    out_pos += n_lit;
+    
+    if(in_pos == in_n_bytes)  { break; }  // last sequence
+    
+    if( (in_pos + 2) > in_n_bytes )  { return false; }
+    
+    const uword offset = uword(in[in_pos]) | (uword(in[in_pos+1]) << 8);  in_pos += 2;
+    
+    if( (offset == 0) || (offset > out_pos) )  { return false; }
+    
+    uword match_len = (token & 15) + 4;
+    
+    if(match_len == 19)
+      {
+      uword val;
+      
+      do
+        {
+        if(in_pos >= in_n_bytes)  { return false; }
+        
+        val = uword(in[in_pos]);  ++in_pos;
+        
+        match_len += val;
+        }
+      while(val == 255);
+      }
+    
+    if(match_len > (out_n_bytes - out_pos))  { return false; }
+    
+    const u8* src = out + (out_pos - offset);
+          u8* dst = out + out_pos;
+    
+    if(offset >= match_len)
+      {
+      arrayops::copy( dst, src, match_len );
+      }
+    else
+      {
+      // overlapping match (repeated pattern)
+      for(uword i=0; i < match_len; ++i)  { dst[i] = src[i]; }
+      }
+    
+    out_pos += match_len;
+    }
+  
+  return (out_pos == out_n_bytes);
+  }
+
+
+
+inline
+void
+lz_codec::shuffle(u8* out, const u8* in, const uword n_elem, const uword elem_size)
+  {
+  for(uword b=0; b < elem_size; ++b)
+    {
+    u8* out_b = out + b*n_elem;
+    
+    for(uword i=0; i < n_elem; ++i)  { out_b[i] = in[i*elem_size + b]; }
+    }
+  }
+
+
+
+inline
+void
+lz_codec::unshuffle(u8* out, const u8* in, const uword n_elem, const uword elem_size)
+  {
+  for(uword b=0; b < elem_size; ++b)
+    {
+    const u8* in_b = in + b*n_elem;
+    
+    for(uword i=0; i < n_elem; ++i)  { out[i*elem_size + b] = in_b[i]; }
+    }
+  }
+
+
+
+arma_inline
+u32
+lz_codec::read_u32(const u8* mem)
+  {
+  u32 val;
+  
+  std::memcpy(&val, mem, sizeof(u32));
+  
+  return val;
+  }
+
+
+
+arma_inline
+void
+lz_codec::write_length(u8* out, uword& out_pos, uword len)
+  {
+  while(len >= 255)  { out[out_pos] = u8(255);  ++out_pos;  len -= 255; }
+  
+  out[out_pos] = u8(len);  ++out_pos;
+  }
+
+
+
+//! @}
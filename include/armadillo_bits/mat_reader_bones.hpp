@@ -0,0 +1,66 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+//! \addtogroup mat_reader
+//! @{
+
+
+
+//! Read a matrix from a file as a sequence of blocks, without loading the entire matrix into memory.
+//! For arma_binary files each block holds consecutive columns;
+//! for raw_binary, raw_ascii and csv_ascii files each block holds consecutive rows.
+//! When using C++11, the next block is read on a background thread while the current block is being processed.
+template<typename eT>
+class mat_reader
+  {
+  public:
+  
+  inline ~mat_reader();
+  inline  mat_reader();
+  
+  inline explicit mat_reader(const std::string name, const file_type type = auto_detect, const uword block_size = 1024);
+  
+  inline bool open(const std::string name, const file_type type = auto_detect, const uword block_size = 1024);
+  inline void close();
+  
+  inline bool is_open() const;
+  
+  inline bool next(Mat<eT>& X);
+  
+  
+  private:
+  
+  arma_aligned std::ifstream f;
+  arma_aligned std::string   f_name;
+  arma_aligned file_type     f_type;
+  arma_aligned bool          f_good;      //!< false after the end of the data or an error has been encountered
+  arma_aligned uword         f_n_rows;    //!< arma_binary: number of rows in each column
+  arma_aligned uword         f_n_cols;    //!< text formats: number of columns in each row, as determined by the first block
+  arma_aligned uword         f_n_left;    //!< arma_binary: number of columns not yet read; raw_binary: number of elements not yet read
+  arma_aligned uword         block_size;
+  arma_aligned std::string   err_msg;
+  arma_aligned Mat<eT>       buffer;      //!< block read ahead of time
+  
+  #if defined(ARMA_USE_CXX11)
+    std::future<bool> pending;
+  #endif
+  
+  inline bool read_block(Mat<eT>& X);
+  inline bool read_ahead();
+  
+  inline file_type guess_type();
+  
+  inline                   mat_reader(const mat_reader&);  //!< not implemented
+  inline const mat_reader& operator=(const mat_reader&);   //!< not implemented
+  };
+
+
+
+//! @}
@@ -0,0 +1,355 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+//! \addtogroup mat_reader
+//! @{
+
+
+
+template<typename eT>
+inline
+mat_reader<eT>::~mat_reader()
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  close();
+  }
+
+
+
+template<typename eT>
+inline
+mat_reader<eT>::mat_reader()
+  : f_type    (file_type_unknown)
+  , f_good    (false)
+  , f_n_rows  (0)
+  , f_n_cols  (0)
+  , f_n_left  (0)
+  , block_size(0)
+  {
+  arma_extra_debug_sigprint_this(this);
+  }
+
+
+
+template<typename eT>
+inline
+mat_reader<eT>::mat_reader(const std::string name, const file_type type, const uword in_block_size)
+  : f_type    (file_type_unknown)
+  , f_good    (false)
+  , f_n_rows  (0)
+  , f_n_cols  (0)
+  , f_n_left  (0)
+  , block_size(0)
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  const bool status = open(name, type, in_block_size);
+  
+  if(status == false)
+    {
+    arma_stop_runtime_error("mat_reader(): couldn't open " + name);
+    }
+  }
+
+
+
+//! open the given file for reading;
+//! block_size is the maximum number of columns (arma_binary) or rows (other formats) in each block
+template<typename eT>
+inline
+bool
+mat_reader<eT>::open(const std::string name, const file_type type, const uword in_block_size)
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_check( (in_block_size == 0), "mat_reader::open(): block_size must be greater than zero" );
+  
+  close();
+  
+  f.clear();
+  f.open(name.c_str(), std::fstream::binary);
+  
+  if(f.is_open() == false)  { return false; }
+  
+  f_name     = name;
+  f_type     = (type == auto_detect) ? guess_type() : type;
+  f_good     = true;
+  f_n_rows   = 0;
+  f_n_cols   = 0;
+  f_n_left   = 0;
+  block_size = in_block_size;
+  
+  err_msg.clear();
+  
+  bool status = true;
+  
+  switch(f_type)
+    {
+    case arma_binary:
+      {
+      std::string f_header;
+      uword       f_n_cols_total = 0;
+      
+      f >> f_header;
+      f >> f_n_rows;
+      f >> f_n_cols_total;
+      f.get();
+      
+      status = f.good() && (f_header == diskio::gen_bin_header(buffer));
+      
+      f_n_left = f_n_cols_total;
+      }
+      break;
+    
+    case raw_binary:
+      {
+      const std::streampos pos1 = f.tellg();
+      f.seekg(0, ios::end);
+      const std::streampos pos2 = f.tellg();
+      f.seekg(pos1);
+      
+      status = f.good() && (pos1 >= 0) && (pos2 >= pos1);
+      
+      if(status)  { f_n_left = uword(pos2 - pos1) / uword(sizeof(eT)); }
+      }
+      break;
+    
+    case raw_ascii:
+    case csv_ascii:
+      break;
+    
+    default:
+      status = false;
+    }
+  
+  if(status == false)
+    {
+    arma_debug_warn("mat_reader::open(): unsupported file type or incorrect header in ", name);
+    
+    close();
+    }
+  
+  return status;
+  }
+
+
+
+template<typename eT>
+inline
+void
+mat_reader<eT>::close()
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_CXX11)
+    {
+    if(pending.valid())  { pending.wait(); pending = std::future<bool>(); }
+    }
+  #endif
+  
+  if(f.is_open())  { f.close(); }
+  
+  f_good = false;
+  
+  buffer.reset();
+  }
+
+
+
+template<typename eT>
+inline
+bool
+mat_reader<eT>::is_open() const
+  {
+  return f.is_open();
+  }
+
+
+
+//! get the next block;
+//! returns false (and X is reset) once all blocks have been read, or if there was an error reading the file
+template<typename eT>
+inline
+bool
+mat_reader<eT>::next(Mat<eT>& X)
+  {
+  arma_extra_debug_sigprint();
+  
+  if(f.is_open() == false)  { X.reset(); return false; }
+  
+  bool status = false;
+  
+  #if defined(ARMA_USE_CXX11)
+    {
+    if(pending.valid())
+      {
+      status = pending.get();
+      
+      if(status)  { X.swap(buffer); }
+      }
+    else
+      {
+      status = read_block(X);
+      }
+    
+    if(status && f_good)
+      {
+      // read the next block while the caller processes the current block;
+      // if a thread can't be started, the next block is read on demand
+      
+      try
+        {
+        pending = std::async(std::launch::async, &mat_reader<eT>::read_ahead, this);
+        }
+      catch(...)
+        {
+        pending = std::future<bool>();
+        }
+      }
+    }
+  #else
+    {
+    status = read_block(X);
+    }
+  #endif
+  
+  if(status == false)
+    {
+    X.reset();
+    
+    if(err_msg.length() > 0)  { arma_debug_warn("mat_reader::next(): ", err_msg, f_name); err_msg.clear(); }
+    }
+  
+  return status;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+mat_reader<eT>::read_ahead()
+  {
+  return read_block(buffer);
+  }
+
+
+
+//! read the next block from the file;
+//! f_good is set to false once there is no more data
+template<typename eT>
+inline
+bool
+mat_reader<eT>::read_block(Mat<eT>& X)
+  {
+  arma_extra_debug_sigprint();
+  
+  if(f_good == false)  { return false; }
+  
+  if( (f_type == arma_binary) || (f_type == raw_binary) )
+    {
+    const uword n = (std::min)(f_n_left, block_size);
+    
+    if(n == 0)  { f_good = false; return false; }
+    
+    if(f_type == arma_binary)  { X.set_size(f_n_rows, n); }  else  { X.set_size(n, 1); }
+    
+    f.read( reinterpret_cast<char*>(X.memptr()), std::streamsize(X.n_elem*uword(sizeof(eT))) );
+    
+    f_n_left -= n;
+    
+    if(f.good() == false)  { f_good = false; err_msg = "couldn't read block from "; return false; }
+    
+    if(f_n_left == 0)  { f_good = false; }
+    
+    return true;
+    }
+  
+  // text formats: gather the lines of the block, then convert them as per Mat::load()
+  
+  std::string line;
+  std::string lines;
+  
+  uword n_lines = 0;
+  
+  while( (n_lines < block_size) && std::getline(f, line) )
+    {
+    // as per Mat::load(), an empty line indicates the end of the matrix
+    if(line.empty())  { f_good = false; break; }
+    
+    lines += line;
+    lines += '\n';
+    
+    ++n_lines;
+    }
+  
+  if(f.good() == false)  { f_good = false; }
+  
+  if(n_lines == 0)  { return false; }
+  
+  std::istringstream ss(lines);
+  
+  const bool load_okay = (f_type == csv_ascii) ? diskio::load_csv_ascii(X, ss, err_msg) : diskio::load_raw_ascii(X, ss, err_msg);
+  
+  if(load_okay == false)  { f_good = false; err_msg += "block in "; return false; }
+  
+  if(f_n_cols == 0)  { f_n_cols = X.n_cols; }
+  
+  if( (f_type == csv_ascii) && (X.n_cols < f_n_cols) )  { X.resize(X.n_rows, f_n_cols); }
+  
+  if(X.n_cols != f_n_cols)  { f_good = false; err_msg = "inconsistent number of columns in "; return false; }
+  
+  return true;
+  }
+
+
+
+//! detect the file type, without reading the entire file (unlike diskio::guess_file_type())
+template<typename eT>
+inline
+file_type
+mat_reader<eT>::guess_type()
+  {
+  arma_extra_debug_sigprint();
+  
+  const std::streampos pos = f.tellg();
+  
+  podarray<char> data(4096);
+  
+  f.read( data.memptr(), std::streamsize(data.n_elem) );
+  
+  const uword N = uword(f.gcount());
+  
+  f.clear();
+  f.seekg(pos);
+  
+  const std::string header = std::string(data.memptr(), (std::min)(N, uword(12)));
+  
+  if(header == "ARMA_MAT_BIN")  { return arma_binary; }
+  if(header == "ARMA_MAT_TXT")  { return arma_ascii;  }
+  
+  bool has_comma = false;
+  
+  for(uword i=0; i < N; ++i)
+    {
+    const unsigned char val = static_cast<unsigned char>(data[i]);
+    
+    if( (val <= 8) || (val >= 123) )  { return raw_binary; }
+    
+    if(val == ',')  { has_comma = true; }
+    }
+  
+  return (has_comma) ? csv_ascii : raw_ascii;
+  }
+
+
+
+//! @}
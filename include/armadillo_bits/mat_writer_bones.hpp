@@ -0,0 +1,56 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+//! \addtogroup mat_writer
+//! @{
+
+
+
+//! Write a matrix to a file as a sequence of blocks, without holding the entire matrix in memory.
+//! For arma_binary files each block is appended as consecutive columns;
+//! for raw_binary, raw_ascii and csv_ascii files each block is appended as consecutive rows.
+//! The file is complete once close() has been called.
+template<typename eT>
+class mat_writer
+  {
+  public:
+  
+  inline ~mat_writer();
+  inline  mat_writer();
+  
+  inline explicit mat_writer(const std::string name, const file_type type = arma_binary);
+  
+  inline bool open(const std::string name, const file_type type = arma_binary);
+  inline bool close();
+  
+  inline bool is_open() const;
+  
+  template<typename T1> inline bool write(const Base<eT,T1>& X);
+  
+  
+  private:
+  
+  arma_aligned std::ofstream f;
+  arma_aligned std::string   final_name;
+  arma_aligned std::string   tmp_name;
+  arma_aligned file_type     f_type;
+  arma_aligned bool          f_good;
+  arma_aligned uword         f_n_rows;    //!< arma_binary: number of rows in each column
+  arma_aligned uword         f_n_cols;    //!< arma_binary: number of columns written so far; text formats: number of columns in each row
+  arma_aligned uword         dims_pos;    //!< arma_binary: position of the space reserved for the dimensions
+  arma_aligned uword         dims_len;    //!< arma_binary: length of the space reserved for the dimensions
+  
+  inline                   mat_writer(const mat_writer&);  //!< not implemented
+  inline const mat_writer& operator=(const mat_writer&);   //!< not implemented
+  };
+
+
+
+//! @}
@@ -0,0 +1,236 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+//! \addtogroup mat_writer
+//! @{
+
+
+
+template<typename eT>
+inline
+mat_writer<eT>::~mat_writer()
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  if(f.is_open())  { close(); }
+  }
+
+
+
+template<typename eT>
+inline
+mat_writer<eT>::mat_writer()
+  : f_type  (file_type_unknown)
+  , f_good  (false)
+  , f_n_rows(0)
+  , f_n_cols(0)
+  , dims_pos(0)
+  , dims_len(0)
+  {
+  arma_extra_debug_sigprint_this(this);
+  }
+
+
+
+template<typename eT>
+inline
+mat_writer<eT>::mat_writer(const std::string name, const file_type type)
+  : f_type  (file_type_unknown)
+  , f_good  (false)
+  , f_n_rows(0)
+  , f_n_cols(0)
+  , dims_pos(0)
+  , dims_len(0)
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  const bool status = open(name, type);
+  
+  if(status == false)
+    {
+    arma_stop_runtime_error("mat_writer(): couldn't open " + name);
+    }
+  }
+
+
+
+//! open the given file for writing;
+//! the data is written to a temporary file, which is renamed by close()
+template<typename eT>
+inline
+bool
+mat_writer<eT>::open(const std::string name, const file_type type)
+  {
+  arma_extra_debug_sigprint();
+  
+  if(f.is_open())  { close(); }
+  
+  if( (type != arma_binary) && (type != raw_binary) && (type != raw_ascii) && (type != csv_ascii) )
+    {
+    arma_debug_warn("mat_writer::open(): unsupported file type");
+    return false;
+    }
+  
+  final_name = name;
+  tmp_name   = diskio::gen_tmp_name(name);
+  
+  f.clear();
+  f.open(tmp_name.c_str(), std::fstream::binary);
+  
+  if(f.is_open() == false)  { return false; }
+  
+  f_type   = type;
+  f_good   = true;
+  f_n_rows = 0;
+  f_n_cols = 0;
+  dims_pos = 0;
+  dims_len = 0;
+  
+  if(f_type == arma_binary)
+    {
+    // the dimensions are not known until close() is called,
+    // so reserve enough space for them; as per diskio::save_arma_binary(),
+    // the start of the data is aligned to 16 bytes
+    
+    const std::string header = diskio::gen_bin_header(Mat<eT>());
+    
+    f << header << '\n';
+    
+    dims_pos = uword(header.length()) + 1;
+    dims_len = 2*uword(std::numeric_limits<uword>::digits10 + 1) + 2;
+    
+    const uword n_extra = (dims_pos + dims_len) % uword(16);
+    
+    if(n_extra > 0)  { dims_len += uword(16) - n_extra; }
+    
+    f << std::string(dims_len, ' ');
+    
+    f_good = f.good();
+    }
+  
+  return f_good;
+  }
+
+
+
+//! finish writing the file; returns false if any of the writes failed
+template<typename eT>
+inline
+bool
+mat_writer<eT>::close()
+  {
+  arma_extra_debug_sigprint();
+  
+  if(f.is_open() == false)  { return false; }
+  
+  if( f_good && (f_type == arma_binary) )
+    {
+    std::ostringstream dims;
+    
+    dims << f_n_rows << ' ' << f_n_cols << '\n';
+    
+    f.seekp( std::streamoff(dims_pos) );
+    
+    f << std::string(dims_len - uword(dims.str().length()), ' ') << dims.str();
+    
+    f_good = f.good();
+    }
+  
+  f.flush();
+  f.close();
+  
+  bool save_okay = f_good;
+  
+  if(save_okay)
+    {
+    save_okay = diskio::safe_rename(tmp_name, final_name);
+    }
+  else
+    {
+    std::remove(tmp_name.c_str());
+    }
+  
+  f_good = false;
+  
+  return save_okay;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+mat_writer<eT>::is_open() const
+  {
+  return f.is_open();
+  }
+
+
+
+//! append the given block to the file;
+//! all blocks must have the same number of rows (arma_binary) or columns (raw_ascii and csv_ascii)
+template<typename eT>
+template<typename T1>
+inline
+bool
+mat_writer<eT>::write(const Base<eT,T1>& X)
+  {
+  arma_extra_debug_sigprint();
+  
+  if(f_good == false)  { return false; }
+  
+  const quasi_unwrap<T1> U(X.get_ref());
+  const Mat<eT>&         A = U.M;
+  
+  if(A.n_elem == 0)  { return true; }
+  
+  const uword A_n_dim = (f_type == arma_binary) ? A.n_rows : A.n_cols;
+  
+  uword& f_n_dim = (f_type == arma_binary) ? f_n_rows : f_n_cols;
+  
+  if( (f_type != raw_binary) && (f_n_dim != 0) && (f_n_dim != A_n_dim) )
+    {
+    arma_debug_warn("mat_writer::write(): block size is inconsistent with previous blocks");
+    return false;
+    }
+  
+  f_n_dim = A_n_dim;
+  
+  switch(f_type)
+    {
+    case arma_binary:
+      f.write( reinterpret_cast<const char*>(A.memptr()), std::streamsize(A.n_elem*uword(sizeof(eT))) );
+      f_n_cols += A.n_cols;
+      break;
+    
+    case raw_binary:
+      diskio::save_raw_binary(A, f);
+      break;
+    
+    case raw_ascii:
+      diskio::save_raw_ascii(A, f);
+      break;
+    
+    case csv_ascii:
+      diskio::save_csv_ascii(A, f);
+      break;
+    
+    default:
+      ;
+    }
+  
+  f_good = f.good();
+  
+  return f_good;
+  }
+
+
+
+//! @}
@@ -0,0 +1,54 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+//! \addtogroup mmap_mat
+//! @{
+
+
+
+//! Read-only matrix loaded from a file in arma_binary or raw_binary format via memory mapping.
+//! The matrix uses the mapped pages directly (no copy is made),
+//! so that several processes loading the same file share memory via the page cache.
+//! Files which can't be mapped are loaded into memory as per Mat::load().
+template<typename eT>
+class mmap_mat
+  {
+  public:
+  
+  arma_aligned const Mat<eT> M;
+  
+  inline ~mmap_mat();
+  inline  mmap_mat();
+  
+  inline explicit mmap_mat(const std::string name, const file_type type = auto_detect);
+  
+  inline bool load(const std::string name, const file_type type = auto_detect, const bool print_status = true);
+  
+  inline void reset();
+  
+  inline bool is_mapped() const;
+  
+  
+  private:
+  
+  arma_aligned void* map_mem;
+  arma_aligned uword map_size;
+  
+  inline bool get_layout(uword& offset, uword& n_rows, uword& n_cols, const std::string& name, const file_type type) const;
+  
+  inline bool map(const std::string& name, const uword offset, const uword n_rows, const uword n_cols);
+  
+  inline                 mmap_mat(const mmap_mat&);  //!< not implemented
+  inline const mmap_mat& operator=(const mmap_mat&);  //!< not implemented
+  };
+
+
+
+//! @}
@@ -0,0 +1,286 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+//! \addtogroup mmap_mat
+//! @{
+
+
+
+template<typename eT>
+inline
+mmap_mat<eT>::~mmap_mat()
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  reset();
+  }
+
+
+
+template<typename eT>
+inline
+mmap_mat<eT>::mmap_mat()
+  : map_mem (0)
+  , map_size(0)
+  {
+  arma_extra_debug_sigprint_this(this);
+  }
+
+
+
+template<typename eT>
+inline
+mmap_mat<eT>::mmap_mat(const std::string name, const file_type type)
+  : map_mem (0)
+  , map_size(0)
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  const bool status = load(name, type, false);
+  
+  if(status == false)
+    {
+    arma_stop_runtime_error("mmap_mat(): couldn't load " + name);
+    }
+  }
+
+
+
+//! load a matrix from the given file;
+//! arma_binary, npy_binary and raw_binary files are memory mapped if possible,
+//! while all other files are read into memory as per Mat::load()
+template<typename eT>
+inline
+bool
+mmap_mat<eT>::load(const std::string name, const file_type type, const bool print_status)
+  {
+  arma_extra_debug_sigprint();
+  
+  reset();
+  
+  uword offset   = 0;
+  uword f_n_rows = 0;
+  uword f_n_cols = 0;
+  
+  if( get_layout(offset, f_n_rows, f_n_cols, name, type) )
+    {
+    if( map(name, offset, f_n_rows, f_n_cols) )  { return true; }
+    }
+  
+  return access::rw(M).load(name, type, print_status);
+  }
+
+
+
+//! release the memory mapping (if any) and set the size of M to zero
+template<typename eT>
+inline
+void
+mmap_mat<eT>::reset()
+  {
+  arma_extra_debug_sigprint();
+  
+  if(map_mem != 0)
+    {
+    Mat<eT>& X = access::rw(M);
+    
+    access::rw(X.n_rows)    = 0;
+    access::rw(X.n_cols)    = 0;
+    access::rw(X.n_elem)    = 0;
+    access::rw(X.mem_state) = 0;
+    access::rw(X.mem)       = 0;
+    
+    #if defined(ARMA_HAVE_POSIX_MMAP)
+      {
+      ::munmap(map_mem, size_t(map_size));
+      }
+    #endif
+    
+    map_mem  = 0;
+    map_size = 0;
+    }
+  else
+    {
+    access::rw(M).reset();
+    }
+  }
+
+
+
+//! true if M refers to memory mapped pages of a file, rather than a copy of the file contents
+template<typename eT>
+inline
+bool
+mmap_mat<eT>::is_mapped() const
+  {
+  return (map_mem != 0);
+  }
+
+
+
+//! determine the position and dimensions of the matrix data within the file;
+//! false is returned if the file can't be used directly via memory mapping
+template<typename eT>
+inline
+bool
+mmap_mat<eT>::get_layout(uword& offset, uword& n_rows, uword& n_cols, const std::string& name, const file_type type) const
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_HAVE_POSIX_MMAP)
+    {
+    if( (type != auto_detect) && (type != arma_binary) && (type != raw_binary) && (type != npy_binary) )  { return false; }
+    
+    std::ifstream f;
+    f.open(name.c_str(), std::fstream::binary);
+    
+    if(f.is_open() == false)  { return false; }
+    
+    if(type == raw_binary)
+      {
+      f.seekg(0, ios::end);
+      
+      const std::streampos pos = f.tellg();
+      
+      if(pos < 0)  { return false; }
+      
+      offset = 0;
+      n_rows = uword(pos) / uword(sizeof(eT));
+      n_cols = 1;
+      }
+    else
+    if( (type == npy_binary) || ((type == auto_detect) && (f.peek() == 0x93)) )
+      {
+      std::string     descr;
+      bool            fortran_order = true;
+      podarray<uword> shape;
+      
+      if(diskio::read_npy_header(f, descr, fortran_order, shape) == false)  { return false; }
+      
+      if( (descr != diskio::gen_npy_descr<eT>()) || (shape.n_elem > 2) )  { return false; }
+      
+      n_rows = (shape.n_elem >= 1) ? shape[0] : uword(1);
+      n_cols = (shape.n_elem == 2) ? shape[1] : uword(1);
+      
+      // row-major data with more than one row and column would need to be transposed
+      if( (fortran_order == false) && (n_rows > 1) && (n_cols > 1) )  { return false; }
+      
+      const std::streampos pos = f.tellg();
+      
+      if(pos < 0)  { return false; }
+      
+      offset = uword(pos);
+      }
+    else
+      {
+      std::string f_header;
+      
+      f >> f_header;
+      
+      // let Mat::load() deal with other file types, as well as conversions between element types
+      if(f_header != diskio::gen_bin_header(M))  { return false; }
+      
+      f >> n_rows;
+      f >> n_cols;
+      f.get();
+      
+      if(f.good() == false)  { return false; }
+      
+      const std::streampos pos = f.tellg();
+      
+      if(pos < 0)  { return false; }
+      
+      offset = uword(pos);
+      }
+    
+    typedef typename get_pod_type<eT>::result T;
+    
+    // misaligned elements would need to be copied anyway
+    if( ((offset % uword(sizeof(T))) != 0) || ((n_rows*n_cols) == 0) )  { return false; }
+    
+    return true;
+    }
+  #else
+    {
+    arma_ignore(offset);
+    arma_ignore(n_rows);
+    arma_ignore(n_cols);
+    arma_ignore(name);
+    arma_ignore(type);
+    
+    return false;
+    }
+  #endif
+  }
+
+
+
+template<typename eT>
+inline
+bool
+mmap_mat<eT>::map(const std::string& name, const uword offset, const uword n_rows, const uword n_cols)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_HAVE_POSIX_MMAP)
+    {
+    const int fd = ::open(name.c_str(), O_RDONLY);
+    
+    if(fd < 0)  { return false; }
+    
+    struct stat file_info;
+    
+    const uword n_bytes = offset + n_rows*n_cols*uword(sizeof(eT));
+    
+    if( (::fstat(fd, &file_info) != 0) || (uword(file_info.st_size) < n_bytes) )
+      {
+      ::close(fd);
+      return false;
+      }
+    
+    // the mapping remains valid after the file descriptor is closed
+    void* mem = ::mmap(0, size_t(n_bytes), PROT_READ, MAP_SHARED, fd, 0);
+    
+    ::close(fd);
+    
+    if(mem == MAP_FAILED)  { return false; }
+    
+    map_mem  = mem;
+    map_size = n_bytes;
+    
+    eT* data = reinterpret_cast<eT*>( static_cast<char*>(mem) + offset );
+    
+    // same state as Mat(data, n_rows, n_cols, false, true), ie. strict auxiliary memory
+    
+    Mat<eT>& X = access::rw(M);
+    
+    access::rw(X.n_rows)    = n_rows;
+    access::rw(X.n_cols)    = n_cols;
+    access::rw(X.n_elem)    = n_rows*n_cols;
+    access::rw(X.mem_state) = 2;
+    access::rw(X.mem)       = data;
+    
+    return true;
+    }
+  #else
+    {
+    arma_ignore(name);
+    arma_ignore(offset);
+    arma_ignore(n_rows);
+    arma_ignore(n_cols);
+    
+    return false;
+    }
+  #endif
+  }
+
+
+
+//! @}
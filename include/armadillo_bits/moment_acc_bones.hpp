@@ -0,0 +1,67 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+
+//! \addtogroup moment_acc
+//! @{
+
+
+
+//! Accumulator for the number of elements, mean, extremes and 2nd to 4th central moments
+//! of a set of real values. For internal use only!
+//! Blocks of elements are summarised via two passes over data that is still in cache,
+//! and the summaries are combined via the pairwise update formulae of Chan et al and Pebay.
+//! This is as accurate as Welford's algorithm, while reading the data from memory only once;
+//! accumulators of separate parts of the data (eg. processed by separate threads) can be merged.
+//! The 'order' argument (1 to 4) sets the highest central moment which is kept.
+//! The extremes are only kept when requested.
+template<typename eT>
+class moment_acc
+  {
+  public:
+  
+  static const uword block_n_elem    = 256;     //!< number of elements summarised at once
+  static const uword parallel_n_elem = 262144;  //!< minimum number of elements for processing in parallel
+  
+  inline moment_acc();
+  
+  inline void reset();
+  
+  inline void add  (const eT val,                const uword order, const bool extremes);
+  inline void add  (const eT* X, const uword N, const uword order, const bool extremes);
+  inline void merge(const moment_acc<eT>& B,     const uword order);
+  
+  inline static void apply(std::vector< moment_acc<eT> >& out, const Mat<eT>& X, const uword dim, const uword order, const bool extremes);
+  
+  inline eT sum()                           const;
+  inline eT var     (const uword norm_type) const;
+  inline eT skewness(const uword norm_type) const;
+  inline eT kurtosis(const uword norm_type) const;
+  
+  uword count;
+  eT    mean;
+  eT    M2;
+  eT    M3;
+  eT    M4;
+  eT    min_val;
+  eT    max_val;
+  
+  
+  private:
+  
+  inline void add_block(const eT* X, const uword N, const uword order, const bool extremes);
+  inline void add_range(const eT* X, const uword N, const uword order, const bool extremes);
+  
+  inline static void add_col(moment_acc<eT>* acc, const eT* X, const uword N, const uword order, const bool extremes);
+  };
+
+
+
+//! @}
@@ -0,0 +1,539 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+
+//! \addtogroup moment_acc
+//! @{
+
+
+
+template<typename eT>
+inline
+moment_acc<eT>::moment_acc()
+  {
+  arma_extra_debug_sigprint();
+  
+  reset();
+  }
+
+
+
+template<typename eT>
+inline
+void
+moment_acc<eT>::reset()
+  {
+  count   = 0;
+  mean    = eT(0);
+  M2      = eT(0);
+  M3      = eT(0);
+  M4      = eT(0);
+  min_val = eT(0);
+  max_val = eT(0);
+  }
+
+
+
+//! Welford style update with one element
+template<typename eT>
+inline
+void
+moment_acc<eT>::add(const eT val, const uword order, const bool extremes)
+  {
+  if(extremes)
+    {
+    if( (count == 0) || (val < min_val) )  { min_val = val; }
+    if( (count == 0) || (val > max_val) )  { max_val = val; }
+    }
+  
+  const eT n1 = eT(count);
+  
+  ++count;
+  
+  const eT n = eT(count);
+  
+  const eT delta    = val - mean;
+  const eT delta_n  = delta / n;
+  const eT delta_n2 = delta_n * delta_n;
+  const eT term1    = delta * delta_n * n1;
+  
+  mean += delta_n;
+  
+  if(order >= 4)  { M4 += term1*delta_n2*(n*n - eT(3)*n + eT(3)) + eT(6)*delta_n2*M2 - eT(4)*delta_n*M3; }
+  if(order >= 3)  { M3 += term1*delta_n*(n - eT(2)) - eT(3)*delta_n*M2; }
+  if(order >= 2)  { M2 += term1; }
+  }
+
+
+
+//! add the elements X[0] ... X[N-1];
+//! large arrays are split into parts which are processed in parallel (when OpenMP is enabled)
+template<typename eT>
+inline
+void
+moment_acc<eT>::add(const eT* X, const uword N, const uword order, const bool extremes)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(_OPENMP)
+    {
+    const uword n_threads = uword( (std::max)(int(1), omp_get_max_threads()) );
+    
+    if( (N >= moment_acc<eT>::parallel_n_elem) && (n_threads > 1) && (omp_in_parallel() == 0) )
+      {
+      arma_extra_debug_print("moment_acc::add(): parallel");
+      
+      std::vector< moment_acc<eT> > parts(n_threads);
+      
+      // parts consist of whole blocks, so that the blocks are the same as when processing serially
+      const uword n_blocks    = (N + block_n_elem - 1) / block_n_elem;
+      const uword part_n_elem = ((n_blocks + n_threads - 1) / n_threads) * block_n_elem;
+      
+      #pragma omp parallel for schedule(static,1)
+      for(uword t=0; t < n_threads; ++t)
+        {
+        const uword start = (std::min)(t * part_n_elem, N);
+        const uword end   = (std::min)(start + part_n_elem, N);
+        
+        parts[t].add_range(&(X[start]), end - start, order, extremes);
+        }
+      
+      for(uword t=0; t < n_threads; ++t)  { merge(parts[t], order); }
+      
+      return;
+      }
+    }
+  #endif
+  
+  add_range(X, N, order, extremes);
+  }
+
+
+
+//! combine with the accumulator of another set of elements
+template<typename eT>
+inline
+void
+moment_acc<eT>::merge(const moment_acc<eT>& B, const uword order)
+  {
+  if(B.count == 0)  { return; }
+  
+  if(count == 0)  { (*this) = B; return; }
+  
+  if(B.min_val < min_val)  { min_val = B.min_val; }
+  if(B.max_val > max_val)  { max_val = B.max_val; }
+  
+  const eT nA = eT(count);
+  const eT nB = eT(B.count);
+  
+  count += B.count;
+  
+  const eT n = eT(count);
+  
+  const eT delta   = B.mean - mean;
+  const eT delta_n = delta / n;
+  const eT term1   = delta * delta_n * nA * nB;  // delta^2 nA nB / n
+  
+  if(order >= 4)
+    {
+    M4 += B.M4 + term1*delta_n*delta_n*(nA*nA - nA*nB + nB*nB)
+               + eT(6)*delta_n*delta_n*(nA*nA*B.M2 + nB*nB*M2)
+               + eT(4)*delta_n*(nA*B.M3 - nB*M3);
+    }
+  
+  if(order >= 3)
+    {
+    M3 += B.M3 + term1*delta_n*(nA - nB) + eT(3)*delta_n*(nA*B.M2 - nB*M2);
+    }
+  
+  if(order >= 2)
+    {
+    M2 += B.M2 + term1;
+    }
+  
+  mean += delta_n * nB;
+  }
+
+
+
+//! accumulate the statistics of each column (dim=0) or each row (dim=1) of X
+template<typename eT>
+inline
+void
+moment_acc<eT>::apply(std::vector< moment_acc<eT> >& out, const Mat<eT>& X, const uword dim, const uword order, const bool extremes)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword X_n_rows = X.n_rows;
+  const uword X_n_cols = X.n_cols;
+  
+  out.clear();
+  out.resize( (dim == 0) ? X_n_cols : X_n_rows );
+  
+  if(X.n_elem == 0)  { return; }
+  
+  #if defined(_OPENMP)
+    {
+    const uword n_threads = uword( (std::max)(int(1), omp_get_max_threads()) );
+    
+    const bool use_parallel = (X.n_elem >= moment_acc<eT>::parallel_n_elem) && (n_threads > 1) && (omp_in_parallel() == 0);
+    
+    if( use_parallel && (dim == 0) && (X_n_cols >= n_threads) )
+      {
+      arma_extra_debug_print("moment_acc::apply(): parallel over columns");
+      
+      #pragma omp parallel for schedule(static)
+      for(uword col=0; col < X_n_cols; ++col)
+        {
+        out[col].add_range(X.colptr(col), X_n_rows, order, extremes);
+        }
+      
+      return;
+      }
+    
+    if( use_parallel && (dim == 1) && (X_n_rows >= n_threads) )
+      {
+      arma_extra_debug_print("moment_acc::apply(): parallel over rows");
+      
+      // each thread handles a contiguous range of rows
+      const uword part_n_rows = (X_n_rows + n_threads - 1) / n_threads;
+      
+      #pragma omp parallel for schedule(static,1)
+      for(uword t=0; t < n_threads; ++t)
+        {
+        const uword start = (std::min)(t * part_n_rows, X_n_rows);
+        const uword end   = (std::min)(start + part_n_rows, X_n_rows);
+        
+        if(start >= end)  { continue; }
+        
+        for(uword col=0; col < X_n_cols; ++col)
+          {
+          moment_acc<eT>::add_col(&(out[start]), &(X.colptr(col)[start]), end - start, order, extremes);
+          }
+        }
+      
+      return;
+      }
+    
+    if( use_parallel && (dim == 1) )
+      {
+      arma_extra_debug_print("moment_acc::apply(): parallel over parts of rows");
+      
+      // few rows: each thread handles a contiguous range of columns, followed by merging
+      const uword part_n_cols = (X_n_cols + n_threads - 1) / n_threads;
+      
+      std::vector< std::vector< moment_acc<eT> > > parts(n_threads);
+      
+      #pragma omp parallel for schedule(static,1)
+      for(uword t=0; t < n_threads; ++t)
+        {
+        const uword start = (std::min)(t * part_n_cols, X_n_cols);
+        const uword end   = (std::min)(start + part_n_cols, X_n_cols);
+        
+        parts[t].resize(X_n_rows);
+        
+        for(uword col=start; col < end; ++col)
+          {
+          moment_acc<eT>::add_col(&(parts[t][0]), X.colptr(col), X_n_rows, order, extremes);
+          }
+        }
+      
+      for(uword t=0; t < n_threads; ++t)
+        {
+        for(uword row=0; row < X_n_rows; ++row)  { out[row].merge(parts[t][row], order); }
+        }
+      
+      return;
+      }
+    }
+  #endif
+  
+  if(dim == 0)
+    {
+    for(uword col=0; col < X_n_cols; ++col)
+      {
+      out[col].add(X.colptr(col), X_n_rows, order, extremes);
+      }
+    }
+  else
+    {
+    for(uword col=0; col < X_n_cols; ++col)
+      {
+      moment_acc<eT>::add_col(&(out[0]), X.colptr(col), X_n_rows, order, extremes);
+      }
+    }
+  }
+
+
+
+template<typename eT>
+inline
+eT
+moment_acc<eT>::sum() const
+  {
+  return mean * eT(count);
+  }
+
+
+
+//! norm_type = 0: normalisation using N-1;
+//! norm_type = 1: normalisation using N
+template<typename eT>
+inline
+eT
+moment_acc<eT>::var(const uword norm_type) const
+  {
+  if(count < 2)  { return eT(0); }
+  
+  const eT n = eT(count);
+  
+  return (norm_type == 0) ? (M2 / (n - eT(1))) : (M2 / n);
+  }
+
+
+
+//! norm_type = 0: correction for bias;
+//! norm_type = 1: no correction (ie. the standardised third central moment)
+template<typename eT>
+inline
+eT
+moment_acc<eT>::skewness(const uword norm_type) const
+  {
+  const eT n = eT(count);
+  
+  if( (count == 0) || ((norm_type == 0) && (count < 3)) )  { return Datum<eT>::nan; }
+  
+  const eT m2 = M2 / n;
+  const eT m3 = M3 / n;
+  
+  const eT g1 = m3 / (m2 * std::sqrt(m2));
+  
+  return (norm_type == 0) ? (g1 * std::sqrt(n * (n - eT(1))) / (n - eT(2))) : g1;
+  }
+
+
+
+//! norm_type = 0: correction for bias;
+//! norm_type = 1: no correction (ie. the standardised fourth central moment);
+//! the kurtosis of the normal distribution is 3
+template<typename eT>
+inline
+eT
+moment_acc<eT>::kurtosis(const uword norm_type) const
+  {
+  const eT n = eT(count);
+  
+  if( (count == 0) || ((norm_type == 0) && (count < 4)) )  { return Datum<eT>::nan; }
+  
+  const eT m2 = M2 / n;
+  const eT m4 = M4 / n;
+  
+  const eT g2 = m4 / (m2 * m2);
+  
+  return (norm_type == 0) ? (eT(3) + (n - eT(1)) / ((n - eT(2)) * (n - eT(3))) * ((n + eT(1)) * g2 - eT(3) * (n - eT(1)))) : g2;
+  }
+
+
+
+//! summarise a block of up to block_n_elem elements via two passes,
+//! and merge the summary into the accumulator
+template<typename eT>
+inline
+void
+moment_acc<eT>::add_block(const eT* X, const uword N, const uword order, const bool extremes)
+  {
+  moment_acc<eT> B;
+  
+  B.count = N;
+  
+  eT acc1 = eT(0);
+  eT acc2 = eT(0);
+  
+  uword i,j;
+  
+  for(i=0, j=1; j < N; i+=2, j+=2)
+    {
+    acc1 += X[i];
+    acc2 += X[j];
+    }
+  
+  if(i < N)  { acc1 += X[i]; }
+  
+  if(extremes)
+    {
+    eT min_v = X[0];
+    eT max_v = X[0];
+    
+    for(uword k=1; k < N; ++k)
+      {
+      const eT val = X[k];
+      
+      if(val < min_v)  { min_v = val; }
+      if(val > max_v)  { max_v = val; }
+      }
+    
+    B.min_val = min_v;
+    B.max_val = max_v;
+    }
+  
+  const eT n      = eT(N);
+  const eT mean_0 = (acc1 + acc2) / n;
+  
+  if(order >= 3)
+    {
+    eT s1 = eT(0);
+    eT s2 = eT(0);
+    eT s3 = eT(0);
+    eT s4 = eT(0);
+    
+    for(uword k=0; k < N; ++k)
+      {
+      const eT d  = X[k] - mean_0;
+      const eT d2 = d*d;
+      
+      s1 += d;
+      s2 += d2;
+      s3 += d2*d;
+      s4 += d2*d2;
+      }
+    
+    // correct for the rounding error in mean_0
+    const eT c = s1 / n;
+    
+    B.mean = mean_0 + c;
+    B.M2   = s2 - s1*c;
+    B.M3   = s3 - eT(3)*c*s2 + eT(2)*c*c*s1;
+    B.M4   = s4 - eT(4)*c*s3 + eT(6)*c*c*s2 - eT(3)*c*c*c*s1;
+    }
+  else
+  if(order == 2)
+    {
+    eT s1a = eT(0);
+    eT s1b = eT(0);
+    eT s2a = eT(0);
+    eT s2b = eT(0);
+    
+    for(i=0, j=1; j < N; i+=2, j+=2)
+      {
+      const eT di = X[i] - mean_0;
+      const eT dj = X[j] - mean_0;
+      
+      s1a += di;
+      s1b += dj;
+      s2a += di*di;
+      s2b += dj*dj;
+      }
+    
+    if(i < N)
+      {
+      const eT di = X[i] - mean_0;
+      
+      s1a += di;
+      s2a += di*di;
+      }
+    
+    const eT s1 = s1a + s1b;
+    
+    B.mean = mean_0 + s1/n;
+    B.M2   = (s2a + s2b) - s1*s1/n;
+    }
+  else
+    {
+    B.mean = mean_0;
+    }
+  
+  merge(B, order);
+  }
+
+
+
+template<typename eT>
+inline
+void
+moment_acc<eT>::add_range(const eT* X, const uword N, const uword order, const bool extremes)
+  {
+  for(uword start=0; start < N; start += block_n_elem)
+    {
+    add_block( &(X[start]), (std::min)(uword(block_n_elem), N - start), order, extremes );
+    }
+  }
+
+
+
+//! add X[r] to the accumulator acc[r], for r = 0 ... N-1;
+//! all the accumulators have the same number of elements
+template<typename eT>
+inline
+void
+moment_acc<eT>::add_col(moment_acc<eT>* acc, const eT* X, const uword N, const uword order, const bool extremes)
+  {
+  if(N == 0)  { return; }
+  
+  const uword count_new = acc[0].count + 1;
+  
+  const eT n1    = eT(count_new - 1);
+  const eT n     = eT(count_new);
+  const eT inv_n = eT(1) / n;
+  
+  if(extremes)
+    {
+    for(uword r=0; r < N; ++r)
+      {
+      moment_acc<eT>& A = acc[r];
+      
+      const eT val = X[r];
+      
+      A.min_val = ( (count_new == 1) || (val < A.min_val) ) ? val : A.min_val;
+      A.max_val = ( (count_new == 1) || (val > A.max_val) ) ? val : A.max_val;
+      }
+    }
+  
+  if(order <= 2)
+    {
+    const eT scale = (order == 2) ? n1 : eT(0);
+    
+    for(uword r=0; r < N; ++r)
+      {
+      moment_acc<eT>& A = acc[r];
+      
+      const eT delta   = X[r] - A.mean;
+      const eT delta_n = delta * inv_n;
+      
+      A.mean  += delta_n;
+      A.M2    += delta * delta_n * scale;
+      A.count  = count_new;
+      }
+    
+    return;
+    }
+  
+  for(uword r=0; r < N; ++r)
+    {
+    moment_acc<eT>& A = acc[r];
+    
+    const eT delta    = X[r] - A.mean;
+    const eT delta_n  = delta * inv_n;
+    const eT delta_n2 = delta_n * delta_n;
+    const eT term1    = delta * delta_n * n1;
+    
+    A.mean += delta_n;
+    
+    if(order >= 4)  { A.M4 += term1*delta_n2*(n*n - eT(3)*n + eT(3)) + eT(6)*delta_n2*A.M2 - eT(4)*delta_n*A.M3; }
+    
+    A.M3 += term1*delta_n*(n - eT(2)) - eT(3)*delta_n*A.M2;
+    A.M2 += term1;
+    
+    A.count = count_new;
+    }
+  }
+
+
+
+//! @}
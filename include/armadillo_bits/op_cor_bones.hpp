@@ -22,6 +22,8 @@ class op_cor
   template<typename eT> inline static void direct_cor(Mat<eT>&                out, const Mat<eT>& X,                const uword norm_type);
   template<typename  T> inline static void direct_cor(Mat< std::complex<T> >& out, const Mat< std::complex<T> >& X, const uword norm_type);
   
+  template<typename eT> inline static void normalise_by_diag(Mat<eT>& C);
+  
   template<typename T1> inline static void apply(Mat<typename T1::elem_type>& out, const Op<T1,op_cor>& in);
   };
 
@@ -35,16 +35,11 @@ op_cor::direct_cor(Mat<eT>& out, const Mat<eT>& A, const uword norm_type)
     }
   else
     {
-    const uword N = A.n_rows;
-    const eT norm_val = (norm_type == 0) ? ( (N > 1) ? eT(N-1) : eT(1) ) : eT(N);
-
-    const Row<eT> acc = sum(A);
-    const Row<eT> sd  = stddev(A);
-
-    out = (trans(A) * A);
-    out -= (trans(acc) * acc)/eT(N);
-    out /= norm_val;
-    out /= trans(sd) * sd;
+    arma_ignore(norm_type);  // the normalisation cancels out
+    
+    op_cov::centred_gram(out, A);
+    
+    op_cor::normalise_by_diag(out);
     }
   }
 
@@ -72,18 +67,39 @@ op_cor::direct_cor(Mat< std::complex<T> >& out, const Mat< std::complex<T> >& A,
     }
   else
     {
-    const uword N = A.n_rows;
-    const eT norm_val = (norm_type == 0) ? ( (N > 1) ? eT(N-1) : eT(1) ) : eT(N);
+    arma_ignore(norm_type);  // the normalisation cancels out
+    
+    op_cov::centred_gram(out, A);
+    
+    op_cor::normalise_by_diag(out);
+    }
+  }
 
-    const Row<eT> acc = sum(A);
-    const Row<T>  sd  = stddev(A);
 
-    out = trans(A) * A;               // out = strans(conj(A)) * A;
-    out -= (trans(acc) * acc)/eT(N);  // out -= (strans(conj(acc)) * acc)/eT(N);
-    out /= norm_val;
 
-    //out = out / (trans(sd) * sd);
-    out /= conv_to< Mat<eT> >::from(trans(sd) * sd);
+//! divide each element of the covariance matrix C by the standard deviations given by its diagonal
+template<typename eT>
+inline
+void
+op_cor::normalise_by_diag(Mat<eT>& C)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  const uword N = C.n_rows;
+  
+  podarray<T> sd(N);
+  
+  for(uword i=0; i < N; ++i)  { sd[i] = eop_aux::sqrt( access::tmp_real(C.at(i,i)) ); }
+  
+  for(uword col=0; col < N; ++col)
+    {
+    eT* C_col = C.colptr(col);
+    
+    const T sd_col = sd[col];
+    
+    for(uword row=0; row < N; ++row)  { C_col[row] /= eT(sd[row] * sd_col); }
     }
   }
 
@@ -102,8 +118,22 @@ op_cor::apply(Mat<typename T1::elem_type>& out, const Op<T1,op_cor>& in)
   const Mat<eT>& A     = tmp.M;
   
   const uword norm_type = in.aux_uword_a;
+  const bool  pairwise  = (in.aux_uword_b == 1);
   
-  op_cor::direct_cor(out, A, norm_type);
+  if(pairwise)
+    {
+    // a row vector is treated as one variable
+    const uword n_rows = (A.n_rows == 1) ? A.n_cols : A.n_rows;
+    const uword n_cols = (A.n_rows == 1) ? uword(1) : A.n_cols;
+    
+    const Mat<eT> A_alias(const_cast<eT*>(A.memptr()), n_rows, n_cols, false);
+    
+    op_cov::direct_cov_pairwise(out, A_alias, norm_type, true);
+    }
+  else
+    {
+    op_cor::direct_cor(out, A, norm_type);
+    }
   }
 
 
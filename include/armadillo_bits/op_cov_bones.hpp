@@ -19,9 +19,20 @@ class op_cov
   {
   public:
   
+  static const uword block_n_elem = 262144;  //!< approximate number of elements in each block of centred rows
+  
   template<typename eT> inline static void direct_cov(Mat<eT>&                out, const Mat<eT>& X,                const uword norm_type);
   template<typename  T> inline static void direct_cov(Mat< std::complex<T> >& out, const Mat< std::complex<T> >& X, const uword norm_type);
   
+  template<typename eT> inline static void direct_cov_pairwise(Mat<eT>& out, const Mat<eT>& X, const uword norm_type, const bool calc_cor);
+  
+  inline static uword block_n_rows(const uword n_rows, const uword n_cols);
+  
+  template<typename eT> inline static void gram(Mat<eT>& out, const Mat<eT>& X);
+  
+  template<typename eT> inline static void centred_gram (Mat<eT>& out, const Mat<eT>& X);
+  template<typename eT> inline static void centred_cross(Mat<eT>& out, const Mat<eT>& A, const Mat<eT>& B);
+  
   template<typename T1> inline static void apply(Mat<typename T1::elem_type>& out, const Op<T1,op_cov>& in);
   };
 
@@ -38,10 +38,8 @@ op_cov::direct_cov(Mat<eT>& out, const Mat<eT>& A, const uword norm_type)
     const uword N = A.n_rows;
     const eT norm_val = (norm_type == 0) ? ( (N > 1) ? eT(N-1) : eT(1) ) : eT(N);
 
-    const Row<eT> acc = sum(A);
-
-    out = trans(A) * A;
-    out -= (trans(acc) * acc)/eT(N);
+    op_cov::centred_gram(out, A);
+    
     out /= norm_val;
     }
   }
@@ -77,16 +75,288 @@ op_cov::direct_cov(Mat< std::complex<T> >& out, const Mat< std::complex<T> >& A,
     const uword N = A.n_rows;
     const eT norm_val = (norm_type == 0) ? ( (N > 1) ? eT(N-1) : eT(1) ) : eT(N);
     
-    const Row<eT> acc = sum(A);
+    op_cov::centred_gram(out, A);  // out = strans(conj(A - mean(A))) * (A - mean(A))
     
-    out = trans(A) * A;               // out = strans(conj(A)) * A;
-    out -= (trans(acc) * acc)/eT(N);  // out -= (strans(conj(acc)) * acc)/eT(N);
     out /= norm_val;
     }
   }
 
 
 
+//! covariance (or correlation) of each pair of columns, using only the rows where both columns are not NaN
+template<typename eT>
+inline
+void
+op_cov::direct_cov_pairwise(Mat<eT>& out, const Mat<eT>& X, const uword norm_type, const bool calc_cor)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  const uword X_n_rows = X.n_rows;
+  const uword X_n_cols = X.n_cols;
+  
+  // the data is shifted by the mean of the available values in each column,
+  // which doesn't change the results but reduces the cancellation in the sums of products
+  
+  podarray<eT> shift(X_n_cols);
+  
+  for(uword col=0; col < X_n_cols; ++col)
+    {
+    const eT* X_col = X.colptr(col);
+    
+    eT    acc   = eT(0);
+    uword count = 0;
+    
+    for(uword row=0; row < X_n_rows; ++row)
+      {
+      const eT val = X_col[row];
+      
+      if(arma_isnan(val) == false)  { acc += val;  ++count; }
+      }
+    
+    shift[col] = (count > 0) ? eT(acc / eT(count)) : eT(0);
+    }
+  
+  // for each block of rows:
+  // Xb holds the shifted values (NaN replaced by zero) and Mb indicates the available values;
+  // P = Xb'*Xb, C = Mb'*Mb (the number of rows used for each pair of columns), S = Xb'*Mb, Q = abs(Xb)^2'*Mb
+  
+  Mat<eT> P(X_n_cols, X_n_cols, fill::zeros);
+  Mat<eT> C(X_n_cols, X_n_cols, fill::zeros);
+  Mat<eT> S(X_n_cols, X_n_cols, fill::zeros);
+  Mat<eT> Q;
+  
+  if(calc_cor)  { Q.zeros(X_n_cols, X_n_cols); }
+  
+  Mat<eT> Xb;
+  Mat<eT> Mb;
+  Mat<eT> Yb;
+  Mat<eT> D;
+  
+  const uword B_n_rows = op_cov::block_n_rows(X_n_rows, 2*X_n_cols);
+  
+  for(uword row_start=0; row_start < X_n_rows; row_start += B_n_rows)
+    {
+    const uword n_rows = (std::min)(B_n_rows, X_n_rows - row_start);
+    
+    Xb.set_size(n_rows, X_n_cols);
+    Mb.set_size(n_rows, X_n_cols);
+    
+    for(uword col=0; col < X_n_cols; ++col)
+      {
+      const eT* X_col = X.colptr(col) + row_start;
+            eT* Xb_col = Xb.colptr(col);
+            eT* Mb_col = Mb.colptr(col);
+      
+      const eT shift_val = shift[col];
+      
+      for(uword row=0; row < n_rows; ++row)
+        {
+        const eT val = X_col[row];
+        
+        const bool ok = (arma_isnan(val) == false);
+        
+        Xb_col[row] = (ok) ? eT(val - shift_val) : eT(0);
+        Mb_col[row] = (ok) ? eT(1)               : eT(0);
+        }
+      }
+    
+    op_cov::gram(D, Xb);  arrayops::inplace_plus(P.memptr(), D.memptr(), P.n_elem);
+    op_cov::gram(D, Mb);  arrayops::inplace_plus(C.memptr(), D.memptr(), C.n_elem);
+    
+    S += trans(Xb) * Mb;
+    
+    if(calc_cor)
+      {
+      Yb.set_size(n_rows, X_n_cols);
+      
+      const eT* Xb_mem = Xb.memptr();
+            eT* Yb_mem = Yb.memptr();
+      
+      const uword Yb_n_elem = Yb.n_elem;
+      
+      for(uword i=0; i < Yb_n_elem; ++i)  { const eT val = Xb_mem[i];  Yb_mem[i] = access::alt_conj(val) * val; }
+      
+      Q += strans(Yb) * Mb;
+      }
+    }
+  
+  out.set_size(X_n_cols, X_n_cols);
+  
+  for(uword col=0; col < X_n_cols; ++col)
+  for(uword row=0; row < X_n_cols; ++row)
+    {
+    const T N = access::tmp_real( C.at(row,col) );
+    
+    if(N <= T(0))  { out.at(row,col) = Datum<eT>::nan;  continue; }
+    
+    // S.at(row,col) is the conjugated sum of column 'row' across the rows used for the pair;
+    // conj(S.at(col,row)) is the corresponding sum of column 'col'
+    
+    const eT S_row = S.at(row,col);
+    const eT S_col = access::alt_conj( S.at(col,row) );
+    
+    const eT acc = P.at(row,col) - (S_row * S_col) / eT(N);
+    
+    if(calc_cor)
+      {
+      const T var_row = access::tmp_real( Q.at(row,col) - (access::alt_conj(S_row) * S_row) / eT(N) );
+      const T var_col = access::tmp_real( Q.at(col,row) - (access::alt_conj(S_col) * S_col) / eT(N) );
+      
+      out.at(row,col) = acc / eT( eop_aux::sqrt(var_row * var_col) );
+      }
+    else
+      {
+      const T norm_val = (norm_type == 0) ? ( (N > T(1)) ? T(N - T(1)) : T(1) ) : N;
+      
+      out.at(row,col) = acc / eT(norm_val);
+      }
+    }
+  }
+
+
+
+inline
+uword
+op_cov::block_n_rows(const uword n_rows, const uword n_cols)
+  {
+  const uword B_n_rows = (std::max)( uword(16), uword(op_cov::block_n_elem / (std::max)(uword(1), n_cols)) );
+  
+  return (std::min)(B_n_rows, n_rows);
+  }
+
+
+
+//! out = trans(X) * X, using syrk() or herk() to calculate only one triangle
+template<typename eT>
+inline
+void
+op_cov::gram(Mat<eT>& out, const Mat<eT>& X)
+  {
+  arma_extra_debug_sigprint();
+  
+  out.set_size(X.n_cols, X.n_cols);
+  
+  if(is_cx<eT>::no)
+    {
+    syrk<true, false, false>::apply(out, X);
+    }
+  else
+    {
+    herk<true, false, false>::apply(out, X);
+    }
+  }
+
+
+
+//! out = trans(X - mean(X)) * (X - mean(X)),
+//! where the rows are centred and accumulated in blocks, avoiding a centred copy of the whole matrix
+template<typename eT>
+inline
+void
+op_cov::centred_gram(Mat<eT>& out, const Mat<eT>& X)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword X_n_rows = X.n_rows;
+  const uword X_n_cols = X.n_cols;
+  
+  if(X_n_rows == 0)  { out.zeros(X_n_cols, X_n_cols);  return; }
+  
+  const Row<eT> mu = mean(X);
+  
+  const uword B_n_rows = op_cov::block_n_rows(X_n_rows, X_n_cols);
+  
+  Mat<eT> B;
+  Mat<eT> D;
+  
+  for(uword row_start=0; row_start < X_n_rows; row_start += B_n_rows)
+    {
+    const uword n_rows = (std::min)(B_n_rows, X_n_rows - row_start);
+    
+    B.set_size(n_rows, X_n_cols);
+    
+    for(uword col=0; col < X_n_cols; ++col)
+      {
+      const eT* X_col = X.colptr(col) + row_start;
+            eT* B_col = B.colptr(col);
+      
+      const eT mu_val = mu[col];
+      
+      for(uword row=0; row < n_rows; ++row)  { B_col[row] = X_col[row] - mu_val; }
+      }
+    
+    if(row_start == 0)
+      {
+      op_cov::gram(out, B);
+      }
+    else
+      {
+      op_cov::gram(D, B);
+      
+      arrayops::inplace_plus(out.memptr(), D.memptr(), out.n_elem);
+      }
+    }
+  }
+
+
+
+//! out = trans(A - mean(A)) * (B - mean(B)), with the rows centred in blocks
+template<typename eT>
+inline
+void
+op_cov::centred_cross(Mat<eT>& out, const Mat<eT>& A, const Mat<eT>& B)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword N = A.n_rows;
+  
+  out.zeros(A.n_cols, B.n_cols);
+  
+  if(N == 0)  { return; }
+  
+  const Row<eT> A_mu = mean(A);
+  const Row<eT> B_mu = mean(B);
+  
+  const uword B_n_rows = op_cov::block_n_rows(N, A.n_cols + B.n_cols);
+  
+  Mat<eT> Ab;
+  Mat<eT> Bb;
+  
+  for(uword row_start=0; row_start < N; row_start += B_n_rows)
+    {
+    const uword n_rows = (std::min)(B_n_rows, N - row_start);
+    
+    Ab.set_size(n_rows, A.n_cols);
+    Bb.set_size(n_rows, B.n_cols);
+    
+    for(uword col=0; col < A.n_cols; ++col)
+      {
+      const eT* A_col  = A.colptr(col) + row_start;
+            eT* Ab_col = Ab.colptr(col);
+      
+      const eT mu_val = A_mu[col];
+      
+      for(uword row=0; row < n_rows; ++row)  { Ab_col[row] = A_col[row] - mu_val; }
+      }
+    
+    for(uword col=0; col < B.n_cols; ++col)
+      {
+      const eT* B_col  = B.colptr(col) + row_start;
+            eT* Bb_col = Bb.colptr(col);
+      
+      const eT mu_val = B_mu[col];
+      
+      for(uword row=0; row < n_rows; ++row)  { Bb_col[row] = B_col[row] - mu_val; }
+      }
+    
+    out += trans(Ab) * Bb;
+    }
+  }
+
+
+
 template<typename T1>
 inline
 void
@@ -100,8 +370,22 @@ op_cov::apply(Mat<typename T1::elem_type>& out, const Op<T1,op_cov>& in)
   const Mat<eT>& A     = tmp.M;
   
   const uword norm_type = in.aux_uword_a;
+  const bool  pairwise  = (in.aux_uword_b == 1);
   
-  op_cov::direct_cov(out, A, norm_type);
+  if(pairwise)
+    {
+    // a row vector is treated as one variable
+    const uword n_rows = (A.n_rows == 1) ? A.n_cols : A.n_rows;
+    const uword n_cols = (A.n_rows == 1) ? uword(1) : A.n_cols;
+    
+    const Mat<eT> A_alias(const_cast<eT*>(A.memptr()), n_rows, n_cols, false);
+    
+    op_cov::direct_cov_pairwise(out, A_alias, norm_type, false);
+    }
+  else
+    {
+    op_cov::direct_cov(out, A, norm_type);
+    }
   }
 
 
@@ -27,6 +27,50 @@ op_find_unique::apply_helper(Mat<uword>& out, const Proxy<T1>& P, const bool asc
   if(n_elem == 0)  { out.set_size(0,1);             return true; }
   if(n_elem == 1)  { out.set_size(1,1); out[0] = 0; return true; }
   
+  if( (n_elem >= hash_unique::min_n_elem) && (Proxy<T1>::use_at == false) )
+    {
+    podarray<eT>    vals;
+    podarray<uword> first_indices;
+    
+    if(hash_unique::find(vals, first_indices, P.get_ea(), n_elem))
+      {
+      arma_extra_debug_print("op_find_unique::apply_helper(): hash table");
+      
+      const uword N_unique = vals.n_elem;
+      
+      out.set_size(N_unique, 1);
+      
+      uword* out_mem = out.memptr();
+      
+      if(ascending_indices)
+        {
+        arrayops::copy( out_mem, first_indices.memptr(), N_unique );
+        
+        std::sort( out_mem, out_mem + N_unique );
+        }
+      else
+        {
+        // the indices are in the order of the sorted unique values
+        
+        std::vector< arma_find_unique_packet<eT> > packet_vec(N_unique);
+        
+        for(uword i=0; i < N_unique; ++i)
+          {
+          packet_vec[i].val   = vals[i];
+          packet_vec[i].index = first_indices[i];
+          }
+        
+        arma_find_unique_comparator<eT> comparator;
+        
+        std::sort( packet_vec.begin(), packet_vec.end(), comparator );
+        
+        for(uword i=0; i < N_unique; ++i)  { out_mem[i] = packet_vec[i].index; }
+        }
+      
+      return true;
+      }
+    }
+  
   uvec indices(n_elem);
   
   std::vector< arma_find_unique_packet<eT> > packet_vec(n_elem);
@@ -0,0 +1,30 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+//! \addtogroup op_kurtosis
+//! @{
+
+
+
+//! Class for finding kurtosis values of a matrix
+class op_kurtosis
+  {
+  public:
+  
+  template<typename T1>
+  inline static void apply(Mat<typename T1::pod_type>& out, const mtOp<typename T1::pod_type, T1, op_kurtosis>& in);
+  
+  template<typename T1>
+  inline static typename T1::pod_type kurtosis_vec(const Base<typename T1::elem_type, T1>& X, const uword norm_type = 0);
+  };
+
+
+
+//! @}
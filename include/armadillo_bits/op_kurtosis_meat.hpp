@@ -0,0 +1,88 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+//! \addtogroup op_kurtosis
+//! @{
+
+
+
+//! \brief
+//! For each row or for each column, find the kurtosis.
+//! The result is stored in a dense matrix that has either one column or one row.
+//! The dimension for which the kurtosis values are found is set via the kurtosis() function.
+template<typename T1>
+inline
+void
+op_kurtosis::apply(Mat<typename T1::pod_type>& out, const mtOp<typename T1::pod_type, T1, op_kurtosis>& in)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  const unwrap_check<T1> tmp(in.m, out);
+  const Mat<eT>&     X = tmp.M;
+  
+  const uword norm_type = in.aux_uword_a;
+  const uword dim       = in.aux_uword_b;
+  
+  arma_debug_check( (norm_type > 1), "kurtosis(): parameter 'norm_type' must be 0 or 1" );
+  arma_debug_check( (dim > 1),       "kurtosis(): parameter 'dim' must be 0 or 1"       );
+  
+  const uword X_n_rows = X.n_rows;
+  const uword X_n_cols = X.n_cols;
+  
+  if(dim == 0)
+    {
+    out.set_size((X_n_rows > 0) ? 1 : 0, X_n_cols);
+    }
+  else
+    {
+    out.set_size(X_n_rows, (X_n_cols > 0) ? 1 : 0);
+    }
+  
+  if(out.n_elem == 0)  { return; }
+  
+  std::vector< moment_acc<eT> > acc;
+  
+  moment_acc<eT>::apply(acc, X, dim, 4, false);
+  
+  eT* out_mem = out.memptr();
+  
+  for(uword i=0; i < out.n_elem; ++i)
+    {
+    out_mem[i] = acc[i].kurtosis(norm_type);
+    }
+  }
+
+
+
+template<typename T1>
+inline
+typename T1::pod_type
+op_kurtosis::kurtosis_vec(const Base<typename T1::elem_type, T1>& X, const uword norm_type)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  arma_debug_check( (norm_type > 1), "kurtosis(): parameter 'norm_type' must be 0 or 1" );
+  
+  const quasi_unwrap<T1> tmp(X.get_ref());
+  
+  moment_acc<eT> acc;
+  
+  acc.add(tmp.M.memptr(), tmp.M.n_elem, 4, false);
+  
+  return acc.kurtosis(norm_type);
+  }
+
+
+
+//! @}
@@ -50,7 +50,10 @@ class op_mean
   //
   
   template<typename eT>
-  inline static eT direct_mean(const eT* const X, const uword N);
+  inline static eT direct_mean(const eT* const X, const uword N, const typename enable_if2< is_real<eT>::value, eT>::result* junk = 0);
+  
+  template<typename eT>
+  inline static eT direct_mean(const eT* const X, const uword N, const typename enable_if2< (is_real<eT>::value == false), eT>::result* junk = 0);
   
   template<typename eT>
   inline static eT direct_mean_robust(const eT* const X, const uword N);
@@ -376,12 +376,32 @@ op_mean::apply_noalias_proxy(Cube<typename T1::elem_type>& out, const ProxyCube<
 
 
 
+//! the mean of real numbers is found via blocks which are summed separately,
+//! limiting the accumulation of rounding errors
 template<typename eT>
 inline
 eT
-op_mean::direct_mean(const eT* const X, const uword n_elem)
+op_mean::direct_mean(const eT* const X, const uword n_elem, const typename enable_if2< is_real<eT>::value, eT>::result* junk)
   {
   arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  moment_acc<eT> acc;
+  
+  acc.add(X, n_elem, 1, false);
+  
+  return arma_isfinite(acc.mean) ? acc.mean : op_mean::direct_mean_robust(X, n_elem);
+  }
+
+
+
+template<typename eT>
+inline
+eT
+op_mean::direct_mean(const eT* const X, const uword n_elem, const typename enable_if2< (is_real<eT>::value == false), eT>::result* junk)
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
   
   typedef typename get_pod_type<eT>::result T;
   
@@ -31,14 +31,36 @@ operator< (const arma_cx_median_packet<T>& A, const arma_cx_median_packet<T>& B)
 
 
 
+//! stores the median of each vector in out_mem; used with op_median::apply_to_vecs()
+template<typename eT>
+struct arma_median_worker
+  {
+  eT* out_mem;
+  
+  inline void operator() (const uword i, eT* mem, const uword n_elem) const;
+  };
+
+
+
 //! Class for finding median values of a matrix
 class op_median
   {
   public:
   
+  static const uword parallel_n_elem = 65536;  //!< minimum number of elements for processing columns or rows in parallel
+  
   template<typename T1>
   inline static void apply(Mat<typename T1::elem_type>& out, const Op<T1,op_median>& in);
   
+  template<typename eT>
+  inline static void apply_noalias(Mat<eT>& out, const Mat<eT>& X, const uword dim);
+  
+  template<typename eT, typename functor>
+  inline static void apply_to_vecs(const Mat<eT>& X, const uword dim, const functor& f);
+  
+  template<typename eT, typename functor>
+  inline static void apply_to_vecs(Mat<eT>& X, const uword dim, const functor& f);
+  
   template<typename T, typename T1>
   inline static void apply(Mat< std::complex<T> >& out, const Op<T1,op_median>& in);
   
@@ -57,8 +79,20 @@ class op_median
   template<typename eT>
   inline static eT direct_median(std::vector<eT>& X);
   
+  template<typename eT>
+  inline static eT direct_median(eT* X, const uword n_elem);
+  
   template<typename T>
   inline static void direct_cx_median_index(uword& out_index1, uword& out_index2, std::vector< arma_cx_median_packet<T> >& X);
+  
+  
+  private:
+  
+  template<typename eT, typename functor>
+  inline static void apply_to_vecs_helper(const Mat<eT>& X, eT* X_mem, const uword dim, const functor& f);
+  
+  template<typename eT>
+  arma_inline static eT* get_vec(eT* buffer, const Mat<eT>& X, eT* X_mem, const uword dim, const uword i);
   };
 
 
@@ -39,47 +39,7 @@ op_median::apply(Mat<typename T1::elem_type>& out, const Op<T1,op_median>& in)
     {
     const unwrap_check<P_stored_type> tmp(P.Q, is_alias);
     
-    const typename unwrap_check<P_stored_type>::stored_type& X = tmp.M;
-    
-    const uword X_n_rows = X.n_rows;
-    const uword X_n_cols = X.n_cols;
-    
-    if(dim == 0)  // in each column
-      {
-      arma_extra_debug_print("op_median::apply(): dim = 0");
-      
-      out.set_size((X_n_rows > 0) ? 1 : 0, X_n_cols);
-      
-      if(X_n_rows > 0)
-        {
-        std::vector<eT> tmp_vec(X_n_rows);
-        
-        for(uword col=0; col < X_n_cols; ++col)
-          {
-          arrayops::copy( &(tmp_vec[0]), X.colptr(col), X_n_rows );
-          
-          out[col] = op_median::direct_median(tmp_vec);
-          }
-        }
-      }
-    else  // in each row
-      {
-      arma_extra_debug_print("op_median::apply(): dim = 1");
-      
-      out.set_size(X_n_rows, (X_n_cols > 0) ? 1 : 0);
-      
-      if(X_n_cols > 0)
-        {
-        std::vector<eT> tmp_vec(X_n_cols);
-          
-        for(uword row=0; row < X_n_rows; ++row)
-          {
-          for(uword col=0; col < X_n_cols; ++col)  { tmp_vec[col] = X.at(row,col); }
-          
-          out[row] = op_median::direct_median(tmp_vec);
-          }
-        }
-      }
+    op_median::apply_noalias(out, tmp.M, dim);
     }
   else
     {
@@ -127,6 +87,149 @@ op_median::apply(Mat<typename T1::elem_type>& out, const Op<T1,op_median>& in)
 
 
 
+template<typename eT>
+inline
+void
+arma_median_worker<eT>::operator() (const uword i, eT* mem, const uword n_elem) const
+  {
+  out_mem[i] = op_median::direct_median(mem, n_elem);
+  }
+
+
+
+template<typename eT>
+inline
+void
+op_median::apply_noalias(Mat<eT>& out, const Mat<eT>& X, const uword dim)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword X_n_rows = X.n_rows;
+  const uword X_n_cols = X.n_cols;
+  
+  if(dim == 0)  // in each column
+    {
+    arma_extra_debug_print("op_median::apply(): dim = 0");
+    
+    out.set_size((X_n_rows > 0) ? 1 : 0, X_n_cols);
+    }
+  else  // in each row
+    {
+    arma_extra_debug_print("op_median::apply(): dim = 1");
+    
+    out.set_size(X_n_rows, (X_n_cols > 0) ? 1 : 0);
+    }
+  
+  arma_median_worker<eT> worker;
+  
+  worker.out_mem = out.memptr();
+  
+  op_median::apply_to_vecs(X, dim, worker);
+  }
+
+
+
+//! call f(i, mem, n_elem) for each column (dim = 0) or row (dim = 1) of X,
+//! where mem is a modifiable copy of the i-th column or row
+template<typename eT, typename functor>
+inline
+void
+op_median::apply_to_vecs(const Mat<eT>& X, const uword dim, const functor& f)
+  {
+  arma_extra_debug_sigprint();
+  
+  op_median::apply_to_vecs_helper(X, (eT*) NULL, dim, f);
+  }
+
+
+
+//! as per apply_to_vecs(const Mat<eT>&, ...), but the columns of X are passed directly instead of being copied,
+//! so that f can reorder them in place; rows are still copied
+template<typename eT, typename functor>
+inline
+void
+op_median::apply_to_vecs(Mat<eT>& X, const uword dim, const functor& f)
+  {
+  arma_extra_debug_sigprint();
+  
+  op_median::apply_to_vecs_helper(X, X.memptr(), dim, f);
+  }
+
+
+
+//! X_mem is either NULL or the modifiable memory of X.
+//! when OpenMP is enabled, the columns or rows of large matrices are processed in parallel
+template<typename eT, typename functor>
+inline
+void
+op_median::apply_to_vecs_helper(const Mat<eT>& X, eT* X_mem, const uword dim, const functor& f)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword n_vecs = (dim == 0) ? X.n_cols : X.n_rows;
+  const uword n_elem = (dim == 0) ? X.n_rows : X.n_cols;
+  
+  if( (n_vecs == 0) || (n_elem == 0) )  { return; }
+  
+  if(dim == 1)  { X_mem = NULL; }
+  
+  const bool use_buffer = (X_mem == NULL);
+  
+  #if defined(_OPENMP)
+    {
+    const uword n_threads = (std::min)( n_vecs, uword( (std::max)(int(1), omp_get_max_threads()) ) );
+    
+    if( (X.n_elem >= op_median::parallel_n_elem) && (n_threads > 1) && (omp_in_parallel() == 0) )
+      {
+      podarray<eT> buffers( (use_buffer) ? (n_threads * n_elem) : uword(0) );
+      
+      #pragma omp parallel for schedule(static) num_threads(int(n_threads))
+      for(uword i=0; i < n_vecs; ++i)
+        {
+        eT* buffer = buffers.memptr() + ( (use_buffer) ? (uword(omp_get_thread_num()) * n_elem) : uword(0) );
+        
+        f( i, op_median::get_vec(buffer, X, X_mem, dim, i), n_elem );
+        }
+      
+      return;
+      }
+    }
+  #endif
+  
+  podarray<eT> buffer( (use_buffer) ? n_elem : uword(0) );
+  
+  for(uword i=0; i < n_vecs; ++i)
+    {
+    f( i, op_median::get_vec(buffer.memptr(), X, X_mem, dim, i), n_elem );
+    }
+  }
+
+
+
+//! the i-th column of X_mem if X_mem is not NULL (dim = 0 only); otherwise a copy of the i-th column or row of X in buffer
+template<typename eT>
+arma_inline
+eT*
+op_median::get_vec(eT* buffer, const Mat<eT>& X, eT* X_mem, const uword dim, const uword i)
+  {
+  if(X_mem != NULL)  { return X_mem + i*X.n_rows; }
+  
+  if(dim == 0)
+    {
+    arrayops::copy( buffer, X.colptr(i), X.n_rows );
+    }
+  else
+    {
+    const uword X_n_cols = X.n_cols;
+    
+    for(uword col=0; col < X_n_cols; ++col)  { buffer[col] = X.at(i,col); }
+    }
+  
+  return buffer;
+  }
+
+
+
 //! Implementation for complex numbers
 template<typename T, typename T1>
 inline
@@ -379,22 +482,29 @@ op_median::direct_median(std::vector<eT>& X)
   {
   arma_extra_debug_sigprint();
   
-  const uword n_elem = uword(X.size());
-  const uword half   = n_elem/2;
+  return op_median::direct_median( &(X[0]), uword(X.size()) );
+  }
+
+
+
+//! find the median value of an array (contents is modified)
+template<typename eT>
+inline 
+eT
+op_median::direct_median(eT* X, const uword n_elem)
+  {
+  arma_extra_debug_sigprint();
   
-  typename std::vector<eT>::iterator first    = X.begin();
-  typename std::vector<eT>::iterator nth      = first + half;
-  typename std::vector<eT>::iterator pastlast = X.end();
+  const uword half = n_elem/2;
   
-  std::nth_element(first, nth, pastlast);
+  eT* nth = X + half;
+  
+  std::nth_element(X, nth, X + n_elem);
   
   if((n_elem % 2) == 0)  // even number of elements
     {
-    typename std::vector<eT>::iterator start   = X.begin();
-    typename std::vector<eT>::iterator pastend = start + half;
-    
     const eT val1 = (*nth);
-    const eT val2 = (*(std::max_element(start, pastend)));
+    const eT val2 = (*(std::max_element(X, nth)));
     
     return op_mean::robust_mean(val1, val2);
     }
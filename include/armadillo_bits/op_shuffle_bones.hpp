@@ -15,13 +15,72 @@
 
 
 
+//! uniformly distributed random indices, obtained from arma_rng::randi();
+//! rejection sampling is used to avoid the bias of taking the modulus of a random number
+class op_shuffle_rng
+  {
+  public:
+  
+  inline op_shuffle_rng();
+  
+  inline uword rand_index(const uword n);  //!< random index in the [0, n-1] interval
+  
+  inline static uword bit_mask(uword x);   //!< smallest value of the form 2^k - 1 which is >= x
+  
+  
+  private:
+  
+  inline uword rand_bits();
+  
+  uword n_draw_bits;  //!< number of random bits provided by each call to arma_rng::randi()
+  uword draw_mask;
+  };
+
+
+
+#if defined(ARMA_USE_CXX11)
+
+//! random indices from a generator owned by one thread, for use in parallel regions
+class op_shuffle_rng_local
+  {
+  public:
+  
+  inline explicit op_shuffle_rng_local(const std::mt19937_64::result_type seed);
+  
+  inline uword rand_index(const uword n);
+  
+  
+  private:
+  
+  std::mt19937_64 engine;
+  };
+
+#endif
+
+
+
 class op_shuffle
   {
   public:
   
+  static const uword parallel_n_elem = 262144;  //!< minimum number of elements for the parallel shuffle
+  
   template<typename eT> inline static void apply_direct(Mat<eT>& out, const Mat<eT>& X, const uword dim);
   
   template<typename T1> inline static void apply(Mat<typename T1::elem_type>& out, const Op<T1,op_shuffle>& in);
+  
+  template<typename eT> inline static void shuffle_mem(eT* mem, const uword N);
+  
+  inline static void gen_perm(uword* out, const uword N, const uword M);
+  
+  
+  private:
+  
+  template<typename eT, typename rng_type> inline static void fisher_yates(eT* mem, const uword N, const uword M, rng_type& rng);
+  
+  #if defined(ARMA_USE_CXX11) && defined(_OPENMP)
+    template<typename eT> inline static void parallel_shuffle(eT* mem, const uword N, const uword n_threads);
+  #endif
   };
 
 
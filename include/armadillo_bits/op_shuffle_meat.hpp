@@ -15,175 +15,402 @@
 
 
 
+inline
+op_shuffle_rng::op_shuffle_rng()
+  {
+  const uword max_val = uword( arma_rng::randi<int>::max_val() );
+  
+  n_draw_bits = 0;
+  
+  while( (n_draw_bits < 31) && (((uword(1) << (n_draw_bits+1)) - 1) <= max_val) )  { ++n_draw_bits; }
+  
+  draw_mask = (uword(1) << n_draw_bits) - 1;
+  }
+
+
+
+inline
+uword
+op_shuffle_rng::bit_mask(uword x)
+  {
+  x |= x >> 1;
+  x |= x >> 2;
+  x |= x >> 4;
+  x |= x >> 8;
+  x |= x >> 16;
+  x |= (x >> 16) >> 16;  // no-op for 32 bit uword
+  
+  return x;
+  }
+
+
+
+inline
+uword
+op_shuffle_rng::rand_bits()
+  {
+  // values above draw_mask are only possible if the maximum of randi() is not of the form 2^k - 1
+  
+  uword val;
+  
+  do  { val = uword( arma_rng::randi<int>() ); }  while(val > draw_mask);
+  
+  return val;
+  }
+
+
+
+inline
+uword
+op_shuffle_rng::rand_index(const uword n)
+  {
+  if(n <= 1)  { return 0; }
+  
+  const uword max_index = n - 1;
+  const uword mask      = op_shuffle_rng::bit_mask(max_index);
+  
+  uword val;
+  
+  do
+    {
+    val = rand_bits();
+    
+    // more than one call to randi() is needed for large n
+    for(uword covered = draw_mask; covered < mask; covered = (covered << n_draw_bits) | draw_mask)
+      {
+      val = (val << n_draw_bits) | rand_bits();
+      }
+    
+    val &= mask;
+    }
+  while(val > max_index);
+  
+  return val;
+  }
+
+
+
+#if defined(ARMA_USE_CXX11)
+
+inline
+op_shuffle_rng_local::op_shuffle_rng_local(const std::mt19937_64::result_type seed)
+  : engine(seed)
+  {
+  }
+
+
+
+inline
+uword
+op_shuffle_rng_local::rand_index(const uword n)
+  {
+  if(n <= 1)  { return 0; }
+  
+  const uword max_index = n - 1;
+  const uword mask      = op_shuffle_rng::bit_mask(max_index);
+  
+  uword val;
+  
+  do  { val = uword(engine()) & mask; }  while(val > max_index);
+  
+  return val;
+  }
+
+#endif
+
+
+
+//! Fisher-Yates shuffle, stopped after the first M positions;
+//! the first M elements are then a uniformly chosen sample of the N elements, in random order
+template<typename eT, typename rng_type>
+inline
+void
+op_shuffle::fisher_yates(eT* mem, const uword N, const uword M, rng_type& rng)
+  {
+  const uword n_steps = (std::min)(M, (N > 0) ? (N-1) : uword(0));
+  
+  for(uword i=0; i < n_steps; ++i)
+    {
+    const uword j = i + rng.rand_index(N - i);
+    
+    std::swap( mem[i], mem[j] );
+    }
+  }
+
+
+
+#if defined(ARMA_USE_CXX11) && defined(_OPENMP)
+
+//! each thread sends the elements of its block to randomly chosen buckets (one bucket per thread),
+//! followed by shuffling each bucket; this results in a uniformly distributed permutation.
+//! the generators of the threads are seeded via arma_rng, so arma_rng::set_seed() still gives repeatable results
+//! for a given number of threads
 template<typename eT>
 inline
 void
-op_shuffle::apply_direct(Mat<eT>& out, const Mat<eT>& X, const uword dim)
+op_shuffle::parallel_shuffle(eT* mem, const uword N, const uword n_threads)
   {
   arma_extra_debug_sigprint();
   
-  if(X.is_empty()) { out.copy_size(X); return; }
+  op_shuffle_rng seed_rng;
+  
+  std::vector<op_shuffle_rng_local> rngs;
   
-  const uword N = (dim == 0) ? X.n_rows : X.n_cols;
+  rngs.reserve(n_threads);
   
+  for(uword t=0; t < n_threads; ++t)
+    {
+    const std::mt19937_64::result_type seed_a = seed_rng.rand_index(uword(0xFFFFFFFFU));
+    const std::mt19937_64::result_type seed_b = seed_rng.rand_index(uword(0xFFFFFFFFU));
+    
+    rngs.push_back( op_shuffle_rng_local( (seed_a << 32) | seed_b ) );
+    }
+  
+  const uword block_size = (N + n_threads - 1) / n_threads;
+  
+  podarray<uword> counts(n_threads * n_threads);
+  
+  counts.zeros();
+  
+  #pragma omp parallel for schedule(static,1)
+  for(uword t=0; t < n_threads; ++t)
+    {
+    const uword start = (std::min)(t * block_size, N);
+    const uword end   = (std::min)(start + block_size, N);
+    
+    // use a copy of the generator, so that the same buckets are chosen again below
+    op_shuffle_rng_local rng = rngs[t];
+    
+    uword* count = counts.memptr() + t*n_threads;
+    
+    for(uword i=start; i < end; ++i)  { ++count[ rng.rand_index(n_threads) ]; }
+    }
+  
+  // the buckets are stored one after another; within each bucket, the elements from thread t follow those from thread t-1
+  
+  podarray<uword> offsets(n_threads * n_threads);
+  podarray<uword> bucket_start(n_threads + 1);
+  
+  uword pos = 0;
+  
+  for(uword b=0; b < n_threads; ++b)
+    {
+    bucket_start[b] = pos;
+    
+    for(uword t=0; t < n_threads; ++t)
+      {
+      offsets[t*n_threads + b] = pos;
+      
+      pos += counts[t*n_threads + b];
+      }
+    }
+  
+  bucket_start[n_threads] = N;
+  
+  podarray<eT> tmp(N);
+  
+  eT* tmp_mem = tmp.memptr();
+  
+  #pragma omp parallel for schedule(static,1)
+  for(uword t=0; t < n_threads; ++t)
+    {
+    const uword start = (std::min)(t * block_size, N);
+    const uword end   = (std::min)(start + block_size, N);
+    
+    op_shuffle_rng_local& rng = rngs[t];
+    
+    uword* offset = offsets.memptr() + t*n_threads;
+    
+    for(uword i=start; i < end; ++i)
+      {
+      uword& dest = offset[ rng.rand_index(n_threads) ];
+      
+      tmp_mem[dest] = mem[i];  ++dest;
+      }
+    }
   
-  // see op_sort_index_bones.hpp for the definition of arma_sort_index_packet
-  // and the associated comparison functor
-  std::vector< arma_sort_index_packet<int> > packet_vec(N);
+  #pragma omp parallel for schedule(static,1)
+  for(uword b=0; b < n_threads; ++b)
+    {
+    const uword start = bucket_start[b];
+    const uword len   = bucket_start[b+1] - start;
+    
+    op_shuffle::fisher_yates(tmp_mem + start, len, len, rngs[b]);
+    
+    arrayops::copy( mem + start, tmp_mem + start, len );
+    }
+  }
+
+#endif
+
+
+
+//! randomly permute N elements in place
+template<typename eT>
+inline
+void
+op_shuffle::shuffle_mem(eT* mem, const uword N)
+  {
+  arma_extra_debug_sigprint();
   
-  for(uword i=0; i<N; ++i)
+  #if defined(ARMA_USE_CXX11) && defined(_OPENMP)
     {
-    packet_vec[i].val   = int(arma_rng::randi<int>());
-    packet_vec[i].index = i;
+    const uword n_threads = uword( (std::max)(int(1), omp_get_max_threads()) );
+    
+    if( (N >= op_shuffle::parallel_n_elem) && (n_threads > 1) && (omp_in_parallel() == 0) )
+      {
+      op_shuffle::parallel_shuffle(mem, N, n_threads);
+      
+      return;
+      }
     }
+  #endif
   
-  arma_sort_index_helper_ascend<int> comparator;
+  op_shuffle_rng rng;
   
-  std::sort( packet_vec.begin(), packet_vec.end(), comparator );
+  op_shuffle::fisher_yates(mem, N, N, rng);
+  }
+
+
+
+//! the first M elements of a random permutation of 0, 1, ..., N-1;
+//! out must have room for N elements
+inline
+void
+op_shuffle::gen_perm(uword* out, const uword N, const uword M)
+  {
+  arma_extra_debug_sigprint();
+  
+  for(uword i=0; i < N; ++i)  { out[i] = i; }
+  
+  if(M >= N)
+    {
+    op_shuffle::shuffle_mem(out, N);
+    }
+  else
+    {
+    op_shuffle_rng rng;
+    
+    op_shuffle::fisher_yates(out, N, M, rng);
+    }
+  }
+
+
+
+template<typename eT>
+inline
+void
+op_shuffle::apply_direct(Mat<eT>& out, const Mat<eT>& X, const uword dim)
+  {
+  arma_extra_debug_sigprint();
+  
+  if(X.is_empty()) { out.copy_size(X); return; }
   
   const bool is_alias = (&out == &X);
   
-  if(X.is_vec() == false)
+  if(X.is_vec())
     {
-    if(is_alias == false)
+    if(is_alias == false)  { out = X; }
+    
+    // shuffling a column vector along the columns (or a row vector along the rows) doesn't change it
+    
+    if( ((dim == 0) && (X.n_rows > 1)) || ((dim == 1) && (X.n_cols > 1)) )
       {
-      arma_extra_debug_print("op_shuffle::apply(): matrix");
+      arma_extra_debug_print("op_shuffle::apply(): vector");
       
-      out.copy_size(X);
+      op_shuffle::shuffle_mem(out.memptr(), out.n_elem);
+      }
+    
+    return;
+    }
+  
+  const uword X_n_rows = X.n_rows;
+  const uword X_n_cols = X.n_cols;
+  
+  const uword N = (dim == 0) ? X_n_rows : X_n_cols;
+  
+  podarray<uword> perm(N);
+  
+  op_shuffle::gen_perm(perm.memptr(), N, N);
+  
+  const uword* perm_mem = perm.memptr();
+  
+  if(dim == 0)
+    {
+    arma_extra_debug_print("op_shuffle::apply(): matrix rows");
+    
+    // gather each column separately, rather than copying strided rows
+    
+    if(is_alias == false)
+      {
+      out.set_size(X_n_rows, X_n_cols);
       
-      if(dim == 0)
-        {
-        for(uword i=0; i<N; ++i) { out.row(i) = X.row(packet_vec[i].index); }
-        }
-      else
+      for(uword col=0; col < X_n_cols; ++col)
         {
-        for(uword i=0; i<N; ++i) { out.col(i) = X.col(packet_vec[i].index); }
+        const eT*   X_col = X.colptr(col);
+              eT* out_col = out.colptr(col);
+        
+        for(uword i=0; i < X_n_rows; ++i)  { out_col[i] = X_col[ perm_mem[i] ]; }
         }
       }
-    else  // in-place shuffle
+    else
       {
-      arma_extra_debug_print("op_shuffle::apply(): in-place matrix");
+      podarray<eT> tmp(X_n_rows);
       
-      // reuse the val member variable of packet_vec
-      // to indicate whether a particular row or column
-      // has already been shuffled
+      eT* tmp_mem = tmp.memptr();
       
-      for(uword i=0; i<N; ++i)
+      for(uword col=0; col < X_n_cols; ++col)
         {
-        packet_vec[i].val = 0;
-        }
+        eT* out_col = out.colptr(col);
         
-      if(dim == 0)
-        {
-        for(uword i=0; i<N; ++i)
-          {
-          if(packet_vec[i].val == 0)
-            {
-            const uword j = packet_vec[i].index;
-            
-            out.swap_rows(i, j);
-            
-            packet_vec[j].val = 1;
-            }
-          }
-        }
-      else
-        {
-        for(uword i=0; i<N; ++i)
-          {
-          if(packet_vec[i].val == 0)
-            {
-            const uword j = packet_vec[i].index;
-            
-            out.swap_cols(i, j);
-            
-            packet_vec[j].val = 1;
-            }
-          }
+        for(uword i=0; i < X_n_rows; ++i)  { tmp_mem[i] = out_col[ perm_mem[i] ]; }
+        
+        arrayops::copy( out_col, tmp_mem, X_n_rows );
         }
       }
     }
-  else  // we're dealing with a vector
+  else
     {
+    arma_extra_debug_print("op_shuffle::apply(): matrix columns");
+    
     if(is_alias == false)
       {
-      arma_extra_debug_print("op_shuffle::apply(): vector");
-      
-      out.copy_size(X);
+      out.set_size(X_n_rows, X_n_cols);
       
-      if(dim == 0)
-        {
-        if(X.n_rows > 1)  // i.e. column vector
-          {
-          for(uword i=0; i<N; ++i) { out[i] = X[ packet_vec[i].index ]; }
-          }
-        else
-          {
-          out = X;
-          }
-        }
-      else
-        {
-        if(X.n_cols > 1)  // i.e. row vector
-          {
-          for(uword i=0; i<N; ++i) { out[i] = X[ packet_vec[i].index ]; }
-          }
-        else
-          {
-          out = X;
-          }
-        }
+      for(uword i=0; i < X_n_cols; ++i)  { arrayops::copy( out.colptr(i), X.colptr(perm_mem[i]), X_n_rows ); }
       }
-    else  // in-place shuffle
+    else
       {
-      arma_extra_debug_print("op_shuffle::apply(): in-place vector");
+      // follow the cycles of the permutation, so that each column is moved only once;
+      // perm[i] is set to i once column i has its final content
       
-      // reuse the val member variable of packet_vec
-      // to indicate whether a particular row or column
-      // has already been shuffled
+      podarray<eT> tmp(X_n_rows);
       
-      for(uword i=0; i<N; ++i)
+      for(uword start=0; start < X_n_cols; ++start)
         {
-        packet_vec[i].val = 0;
-        }
+        if(perm[start] == start)  { continue; }
         
-      if(dim == 0)
-        {
-        if(X.n_rows > 1)  // i.e. column vector
-          {
-          for(uword i=0; i<N; ++i)
-            {
-            if(packet_vec[i].val == 0)
-              {
-              const uword j = packet_vec[i].index;
-              
-              std::swap(out[i], out[j]);
-              
-              packet_vec[j].val = 1;
-              }
-            }
-          }
-        }
-      else
-        {
-        if(X.n_cols > 1)  // i.e. row vector
+        arrayops::copy( tmp.memptr(), out.colptr(start), X_n_rows );
+        
+        uword i = start;
+        
+        while(perm[i] != start)
           {
-          for(uword i=0; i<N; ++i)
-            {
-            if(packet_vec[i].val == 0)
-              {
-              const uword j = packet_vec[i].index;
-              
-              std::swap(out[i], out[j]);
-              
-              packet_vec[j].val = 1;
-              }
-            }
+          const uword j = perm[i];
+          
+          arrayops::copy( out.colptr(i), out.colptr(j), X_n_rows );
+          
+          perm[i] = i;
+          
+          i = j;
           }
+        
+        arrayops::copy( out.colptr(i), tmp.memptr(), X_n_rows );
+        
+        perm[i] = i;
         }
       }
     }
-  
   }
 
 
@@ -24,6 +24,12 @@ arma_sort_index_helper(Mat<uword>& out, const Proxy<T1>& P, const uword sort_typ
   
   const uword n_elem = P.get_n_elem();
   
+  if( (radix_sort_key<eT>::value) && (n_elem >= radix_sort::min_n_elem) )
+    {
+    // radix_sort is stable, so it's also used when sort_stable is false
+    return radix_sort::sort_index(out, P, (sort_type != 0));
+    }
+  
   out.set_size(n_elem, 1);
   
   std::vector< arma_sort_index_packet<eT> > packet_vec(n_elem);
@@ -20,6 +20,8 @@ op_sort::direct_sort(eT* X, const uword n_elem, const uword sort_type)
   {
   arma_extra_debug_sigprint();
   
+  if( (n_elem >= radix_sort::min_n_elem) && radix_sort::sort(X, n_elem, (sort_type != 0)) )  { return; }
+  
   if(sort_type == 0)
     {
     arma_ascend_sort_helper<eT> comparator;
@@ -43,6 +45,8 @@ op_sort::direct_sort_ascending(eT* X, const uword n_elem)
   {
   arma_extra_debug_sigprint();
   
+  if( (n_elem >= radix_sort::min_n_elem) && radix_sort::sort(X, n_elem, false) )  { return; }
+  
   arma_ascend_sort_helper<eT> comparator;
     
   std::sort(&X[0], &X[n_elem], comparator);
@@ -120,7 +124,27 @@ op_sort::apply_noalias(Mat<eT>& out, const Mat<eT>& X, const uword sort_type, co
     
     const uword n_rows = out.n_rows;
     const uword n_cols = out.n_cols;
+    
+    #if defined(_OPENMP)
+      {
+      // each column is sorted by one thread; when there are fewer columns than threads,
+      // the columns are instead sorted one after another, with each sort using all threads
       
+      const uword n_threads = uword( (std::max)(int(1), omp_get_max_threads()) );
+      
+      if( (n_threads > 1) && (n_cols >= n_threads) && (out.n_elem >= radix_sort::parallel_n_elem) && (omp_in_parallel() == 0) )
+        {
+        #pragma omp parallel for schedule(dynamic)
+        for(uword col=0; col < n_cols; ++col)
+          {
+          op_sort::direct_sort( out.colptr(col), n_rows, sort_type );
+          }
+        
+        return;
+        }
+      }
+    #endif
+    
     for(uword col=0; col < n_cols; ++col)
       {
       op_sort::direct_sort( out.colptr(col), n_rows, sort_type );
@@ -145,6 +169,39 @@ op_sort::apply_noalias(Mat<eT>& out, const Mat<eT>& X, const uword sort_type, co
       const uword n_rows = out.n_rows;
       const uword n_cols = out.n_cols;
       
+      #if defined(_OPENMP)
+        {
+        const uword n_threads = (std::min)( n_rows, uword( (std::max)(int(1), omp_get_max_threads()) ) );
+        
+        if( (n_threads > 1) && (out.n_elem >= radix_sort::parallel_n_elem) && (omp_in_parallel() == 0) )
+          {
+          // each thread sorts a contiguous block of rows
+          
+          const uword block_n_rows = (n_rows + n_threads - 1) / n_threads;
+          
+          #pragma omp parallel for schedule(static,1)
+          for(uword t=0; t < n_threads; ++t)
+            {
+            const uword row_start = (std::min)(n_rows, t * block_n_rows);
+            const uword row_end   = (std::min)(n_rows, row_start + block_n_rows);
+            
+            podarray<eT> tmp_array(n_cols);
+            
+            for(uword row=row_start; row < row_end; ++row)
+              {
+              op_sort::copy_row(tmp_array.memptr(), X, row);
+              
+              op_sort::direct_sort( tmp_array.memptr(), n_cols, sort_type );
+              
+              op_sort::copy_row(out, tmp_array.memptr(), row);
+              }
+            }
+          
+          return;
+          }
+        }
+      #endif
+      
       podarray<eT> tmp_array(n_cols);
       
       for(uword row=0; row < n_rows; ++row)
@@ -35,46 +35,15 @@ op_stddev::apply(Mat<typename T1::pod_type>& out, const mtOp<typename T1::pod_ty
   arma_debug_check( (norm_type > 1), "stddev(): parameter 'norm_type' must be 0 or 1" );
   arma_debug_check( (dim > 1),       "stddev(): parameter 'dim' must be 0 or 1"       );
   
-  const uword X_n_rows = X.n_rows;
-  const uword X_n_cols = X.n_cols;
+  op_var::apply_noalias(out, X, norm_type, dim);
   
-  if(dim == 0)
-    {
-    arma_extra_debug_print("op_stddev::apply(): dim = 0");
-    
-    out.set_size((X_n_rows > 0) ? 1 : 0, X_n_cols);
-    
-    if(X_n_rows > 0)
-      {
-      out_eT* out_mem = out.memptr();
-      
-      for(uword col=0; col<X_n_cols; ++col)
-        {
-        out_mem[col] = std::sqrt( op_var::direct_var( X.colptr(col), X_n_rows, norm_type ) );
-        }
-      }
-    }
-  else
-  if(dim == 1)
+  out_eT* out_mem = out.memptr();
+  
+  const uword N = out.n_elem;
+  
+  for(uword i=0; i<N; ++i)
     {
-    arma_extra_debug_print("op_stddev::apply(): dim = 1");
-    
-    out.set_size(X_n_rows, (X_n_cols > 0) ? 1 : 0);
-    
-    if(X_n_cols > 0)
-      {
-      podarray<in_eT> dat(X_n_cols);
-      
-      in_eT*  dat_mem = dat.memptr();
-      out_eT* out_mem = out.memptr();
-      
-      for(uword row=0; row<X_n_rows; ++row)
-        {
-        dat.copy_row(X, row);
-        
-        out_mem[row] = std::sqrt( op_var::direct_var( dat_mem, X_n_cols, norm_type) );
-        }
-      }
+    out_mem[i] = std::sqrt(out_mem[i]);
     }
   }
 
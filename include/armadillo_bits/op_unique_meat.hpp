@@ -41,6 +41,36 @@ op_unique::apply_helper(Mat<typename T1::elem_type>& out, const Proxy<T1>& P)
     return true;
     }
   
+  if( (n_elem >= hash_unique::min_n_elem) && (Proxy<T1>::use_at == false) )
+    {
+    podarray<eT>    vals;
+    podarray<uword> indices;
+    
+    if(hash_unique::find(vals, indices, P.get_ea(), n_elem))
+      {
+      arma_extra_debug_print("op_unique::apply_helper(): hash table");
+      
+      // only the unique values need sorting
+      
+      const uword N_unique = vals.n_elem;
+      
+      eT* vals_mem = vals.memptr();
+      
+      if( (N_unique < radix_sort::min_n_elem) || (radix_sort::sort(vals_mem, N_unique, false) == false) )
+        {
+        arma_unique_comparator<eT> comparator;
+        
+        std::sort( vals_mem, vals_mem + N_unique, comparator );
+        }
+      
+      if(n_rows == 1)  { out.set_size(1, N_unique); }  else  { out.set_size(N_unique, 1); }
+      
+      arrayops::copy( out.memptr(), vals_mem, N_unique );
+      
+      return true;
+      }
+    }
+  
   Mat<eT> X(n_elem,1);
   
   eT* X_mem = X.memptr();
@@ -21,6 +21,12 @@ class op_var
   template<typename T1>
   inline static void apply(Mat<typename T1::pod_type>& out, const mtOp<typename T1::pod_type, T1, op_var>& in);
   
+  template<typename eT>
+  inline static void apply_noalias(Mat<eT>& out, const Mat<eT>& X, const uword norm_type, const uword dim, const typename enable_if2< is_real<eT>::value, eT>::result* junk = 0);
+  
+  template<typename in_eT>
+  inline static void apply_noalias(Mat<typename get_pod_type<in_eT>::result>& out, const Mat<in_eT>& X, const uword norm_type, const uword dim, const typename enable_if2< (is_real<in_eT>::value == false), in_eT>::result* junk = 0);
+  
   
   //
   
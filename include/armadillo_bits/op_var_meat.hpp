@@ -24,7 +24,6 @@ op_var::apply(Mat<typename T1::pod_type>& out, const mtOp<typename T1::pod_type,
   arma_extra_debug_sigprint();
   
   typedef typename T1::elem_type  in_eT;
-  typedef typename T1::pod_type  out_eT;
   
   const unwrap_check_mixed<T1> tmp(in.m, out);
   const Mat<in_eT>&        X = tmp.M;
@@ -35,12 +34,84 @@ op_var::apply(Mat<typename T1::pod_type>& out, const mtOp<typename T1::pod_type,
   arma_debug_check( (norm_type > 1), "var(): parameter 'norm_type' must be 0 or 1" );
   arma_debug_check( (dim > 1),       "var(): parameter 'dim' must be 0 or 1"       );
   
+  op_var::apply_noalias(out, X, norm_type, dim);
+  }
+
+
+
+//! variances of real numbers, found in one pass over the data
+template<typename eT>
+inline
+void
+op_var::apply_noalias(Mat<eT>& out, const Mat<eT>& X, const uword norm_type, const uword dim, const typename enable_if2< is_real<eT>::value, eT>::result* junk)
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  const uword X_n_rows = X.n_rows;
+  const uword X_n_cols = X.n_cols;
+  
+  if(dim == 0)
+    {
+    out.set_size((X_n_rows > 0) ? 1 : 0, X_n_cols);
+    }
+  else
+    {
+    out.set_size(X_n_rows, (X_n_cols > 0) ? 1 : 0);
+    }
+  
+  if(out.n_elem == 0)  { return; }
+  
+  std::vector< moment_acc<eT> > acc;
+  
+  moment_acc<eT>::apply(acc, X, dim, 2, false);
+  
+  eT* out_mem = out.memptr();
+  
+  for(uword i=0; i < out.n_elem; ++i)
+    {
+    const eT var_val = acc[i].var(norm_type);
+    
+    if(arma_isfinite(var_val))
+      {
+      out_mem[i] = var_val;
+      }
+    else
+      {
+      if(dim == 0)
+        {
+        out_mem[i] = op_var::direct_var_robust( X.colptr(i), X_n_rows, norm_type );
+        }
+      else
+        {
+        podarray<eT> dat(X_n_cols);
+        
+        dat.copy_row(X, i);
+        
+        out_mem[i] = op_var::direct_var_robust( dat.memptr(), X_n_cols, norm_type );
+        }
+      }
+    }
+  }
+
+
+
+template<typename in_eT>
+inline
+void
+op_var::apply_noalias(Mat<typename get_pod_type<in_eT>::result>& out, const Mat<in_eT>& X, const uword norm_type, const uword dim, const typename enable_if2< (is_real<in_eT>::value == false), in_eT>::result* junk)
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename get_pod_type<in_eT>::result out_eT;
+  
   const uword X_n_rows = X.n_rows;
   const uword X_n_cols = X.n_cols;
   
   if(dim == 0)
     {
-    arma_extra_debug_print("op_var::apply(): dim = 0");
+    arma_extra_debug_print("op_var::apply_noalias(): dim = 0");
     
     out.set_size((X_n_rows > 0) ? 1 : 0, X_n_cols);
     
@@ -57,7 +128,7 @@ op_var::apply(Mat<typename T1::pod_type>& out, const mtOp<typename T1::pod_type,
   else
   if(dim == 1)
     {
-    arma_extra_debug_print("op_var::apply(): dim = 1");
+    arma_extra_debug_print("op_var::apply_noalias(): dim = 1");
     
     out.set_size(X_n_rows, (X_n_cols > 0) ? 1 : 0);
     
@@ -87,15 +158,11 @@ op_var::var_vec(const Base<typename T1::elem_type, T1>& X, const uword norm_type
   {
   arma_extra_debug_sigprint();
   
-  typedef typename T1::elem_type eT;
-  
   arma_debug_check( (norm_type > 1), "var(): parameter 'norm_type' must be 0 or 1" );
   
-  const Proxy<T1> P(X.get_ref());
-  
-  const podarray<eT> tmp(P);
+  const quasi_unwrap<T1> tmp(X.get_ref());
   
-  return op_var::direct_var(tmp.memptr(), tmp.n_elem, norm_type);
+  return op_var::direct_var(tmp.M.memptr(), tmp.M.n_elem, norm_type);
   }
 
 
@@ -154,6 +221,17 @@ op_var::direct_var(const eT* const X, const uword n_elem, const uword norm_type)
   
   if(n_elem >= 2)
     {
+    if(is_real<eT>::value)
+      {
+      moment_acc<eT> acc;
+      
+      acc.add(X, n_elem, 2, false);
+      
+      const eT var_val = acc.var(norm_type);
+      
+      return arma_isfinite(var_val) ? var_val : op_var::direct_var_robust(X, n_elem, norm_type);
+      }
+    
     const eT acc1 = op_mean::direct_mean(X, n_elem);
     
     eT acc2 = eT(0);
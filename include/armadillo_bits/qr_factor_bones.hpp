@@ -0,0 +1,52 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+//! \addtogroup qr_factor
+//! @{
+
+
+
+//! QR factorisation of a matrix with at least as many rows as columns,
+//! kept for solving several (least-squares) systems with the same matrix.
+//! Q is kept in compact form and is never explicitly generated.
+template<typename eT>
+class qr_factor
+  {
+  public:
+  
+  typedef eT                                elem_type;
+  typedef typename get_pod_type<eT>::result pod_type;
+  
+  inline ~qr_factor();
+  inline  qr_factor();
+  
+  template<typename T1> inline explicit qr_factor(const Base<eT,T1>& X);
+  
+  template<typename T1> inline bool factorise(const Base<eT,T1>& X);
+  
+  template<typename T1> inline bool    solve(Mat<eT>& out, const Base<eT,T1>& B) const;
+  template<typename T1> inline Mat<eT> solve(              const Base<eT,T1>& B) const;
+  
+  inline void reset();
+  
+  arma_inline bool  is_empty() const;
+  arma_inline uword n_rows()   const;
+  arma_inline uword n_cols()   const;
+  
+  
+  private:
+  
+  arma_aligned Mat<eT>      QR;
+  arma_aligned podarray<eT> tau;
+  };
+
+
+
+//! @}
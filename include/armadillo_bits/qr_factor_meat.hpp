@@ -0,0 +1,163 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+//! \addtogroup qr_factor
+//! @{
+
+
+
+template<typename eT>
+inline
+qr_factor<eT>::~qr_factor()
+  {
+  arma_extra_debug_sigprint_this(this);
+  }
+
+
+
+template<typename eT>
+inline
+qr_factor<eT>::qr_factor()
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  arma_type_check(( is_supported_blas_type<eT>::value == false ));
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+qr_factor<eT>::qr_factor(const Base<eT,T1>& X)
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  arma_type_check(( is_supported_blas_type<eT>::value == false ));
+  
+  const bool status = factorise(X);
+  
+  if(status == false)
+    {
+    arma_stop_runtime_error("qr_factor(): decomposition failed");
+    }
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+bool
+qr_factor<eT>::factorise(const Base<eT,T1>& X)
+  {
+  arma_extra_debug_sigprint();
+  
+  QR = X.get_ref();
+  
+  arma_debug_check( (QR.n_rows < QR.n_cols), "qr_factor::factorise(): number of rows must be greater than or equal to number of columns" );
+  
+  const bool status = auxlib::qr_fact(QR, tau);
+  
+  if(status == false)  { reset(); }
+  
+  return status;
+  }
+
+
+
+//! returns false if the factorised matrix is rank deficient
+template<typename eT>
+template<typename T1>
+inline
+bool
+qr_factor<eT>::solve(Mat<eT>& out, const Base<eT,T1>& B) const
+  {
+  arma_extra_debug_sigprint();
+  
+  out = B.get_ref();
+  
+  arma_debug_check( (QR.n_rows != out.n_rows), "qr_factor::solve(): number of rows in given matrix must match the factorised matrix" );
+  
+  const bool status = auxlib::qr_fact_solve(out, QR, tau);
+  
+  if(status == false)  { out.reset(); }
+  
+  return status;
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+Mat<eT>
+qr_factor<eT>::solve(const Base<eT,T1>& B) const
+  {
+  arma_extra_debug_sigprint();
+  
+  Mat<eT> out;
+  
+  const bool status = solve(out, B);
+  
+  if(status == false)
+    {
+    arma_stop_runtime_error("qr_factor::solve(): solution not found");
+    }
+  
+  return out;
+  }
+
+
+
+template<typename eT>
+inline
+void
+qr_factor<eT>::reset()
+  {
+  arma_extra_debug_sigprint();
+  
+  QR.reset();
+  tau.reset();
+  }
+
+
+
+template<typename eT>
+arma_inline
+bool
+qr_factor<eT>::is_empty() const
+  {
+  return QR.is_empty();
+  }
+
+
+
+template<typename eT>
+arma_inline
+uword
+qr_factor<eT>::n_rows() const
+  {
+  return QR.n_rows;
+  }
+
+
+
+template<typename eT>
+arma_inline
+uword
+qr_factor<eT>::n_cols() const
+  {
+  return QR.n_cols;
+  }
+
+
+
+//! @}
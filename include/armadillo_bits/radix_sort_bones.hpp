@@ -0,0 +1,84 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+//! \addtogroup radix_sort
+//! @{
+
+
+
+//! unsigned integer type used as the sorting key for elements of type eT;
+//! value is false for element types which are not sorted via radix_sort (eg. complex numbers)
+template<typename eT, uword N = sizeof(eT)>
+struct radix_sort_key
+  {
+  static const bool value = false;
+  typedef u32 result;
+  };
+
+
+
+template<typename eT>
+struct radix_sort_key<eT,4>
+  {
+  static const bool value = is_cx<eT>::no;
+  typedef u32 result;
+  };
+
+
+
+#if defined(ARMA_USE_U64S64)
+  template<typename eT>
+  struct radix_sort_key<eT,8>
+    {
+    static const bool value = is_cx<eT>::no;
+    typedef u64 result;
+    };
+#endif
+
+
+
+//! LSD radix sort for integer and floating point elements. For internal use only!
+//! Each element is mapped to an unsigned integer key with the same ordering:
+//! the sign bit of signed integers is flipped, while for floating point numbers
+//! all bits of negative numbers are flipped and the sign bit of positive numbers is set.
+//! This places -0 just before +0, and NaN at either end (depending on its sign bit).
+//! Keys are sorted 11 bits at a time, skipping passes where all keys have the same 11 bits.
+//! The sort is stable, so that indices of equal elements remain in their original order.
+//! When OpenMP is enabled, large arrays are split into chunks which are sorted in parallel
+//! and then merged pairwise in parallel.
+class radix_sort
+  {
+  public:
+  
+  static const uword min_n_elem      = 4096;    //!< smaller arrays are sorted via std::sort
+  static const uword parallel_n_elem = 262144;  //!< minimum number of elements for sorting in parallel
+  
+  template<typename eT, typename KT> arma_inline static KT to_key  (const eT val, const bool descend);
+  template<typename eT, typename KT> arma_inline static eT from_key(const KT key, const bool descend);
+  
+  template<typename eT> inline static bool sort(eT* X, const uword n_elem, const bool descend, const typename enable_if2<         radix_sort_key<eT>::value, eT>::result* junk = 0);
+  template<typename eT> inline static bool sort(eT* X, const uword n_elem, const bool descend, const typename enable_if2<false == radix_sort_key<eT>::value, eT>::result* junk = 0);
+  
+  template<typename T1> inline static bool sort_index(Mat<uword>& out, const Proxy<T1>& P, const bool descend, const typename enable_if2<         radix_sort_key<typename T1::elem_type>::value, typename T1::elem_type>::result* junk = 0);
+  template<typename T1> inline static bool sort_index(Mat<uword>& out, const Proxy<T1>& P, const bool descend, const typename enable_if2<false == radix_sort_key<typename T1::elem_type>::value, typename T1::elem_type>::result* junk = 0);
+  
+  template<typename KT> inline static void sort_keys(KT* keys, uword* indices, const uword n_elem);
+  
+  
+  private:
+  
+  template<typename KT> inline static void sort_keys_serial(KT* keys, KT* tmp_keys, uword* indices, uword* tmp_indices, const uword n_elem);
+  
+  template<typename KT> inline static void merge(KT* out_keys, uword* out_indices, const KT* keys, const uword* indices, const uword start, const uword mid, const uword end);
+  };
+
+
+
+//! @}
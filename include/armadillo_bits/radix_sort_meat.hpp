@@ -0,0 +1,425 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+//! \addtogroup radix_sort
+//! @{
+
+
+
+template<typename eT, typename KT>
+arma_inline
+KT
+radix_sort::to_key(const eT val, const bool descend)
+  {
+  const KT sign_bit = KT(1) << (sizeof(KT)*8 - 1);
+  
+  KT bits;
+  
+  std::memcpy(&bits, &val, sizeof(KT));
+  
+  KT key;
+  
+  if(is_non_integral<eT>::value)
+    {
+    key = (bits & sign_bit) ? KT(~bits) : KT(bits | sign_bit);
+    }
+  else
+    {
+    key = (is_signed<eT>::value) ? KT(bits ^ sign_bit) : bits;
+    }
+  
+  return (descend) ? KT(~key) : key;
+  }
+
+
+
+template<typename eT, typename KT>
+arma_inline
+eT
+radix_sort::from_key(const KT in_key, const bool descend)
+  {
+  const KT sign_bit = KT(1) << (sizeof(KT)*8 - 1);
+  
+  const KT key = (descend) ? KT(~in_key) : in_key;
+  
+  KT bits;
+  
+  if(is_non_integral<eT>::value)
+    {
+    bits = (key & sign_bit) ? KT(key ^ sign_bit) : KT(~key);
+    }
+  else
+    {
+    bits = (is_signed<eT>::value) ? KT(key ^ sign_bit) : key;
+    }
+  
+  eT val;
+  
+  std::memcpy(&val, &bits, sizeof(KT));
+  
+  return val;
+  }
+
+
+
+//! sort the elements of X;
+//! NaN elements are not handled in the same manner as std::sort() and must be checked for beforehand
+template<typename eT>
+inline
+bool
+radix_sort::sort(eT* X, const uword n_elem, const bool descend, const typename enable_if2<radix_sort_key<eT>::value, eT>::result* junk)
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename radix_sort_key<eT>::result KT;
+  
+  podarray<KT> keys(n_elem);
+  
+  KT* keys_mem = keys.memptr();
+  
+  for(uword i=0; i < n_elem; ++i)  { keys_mem[i] = radix_sort::to_key<eT,KT>(X[i], descend); }
+  
+  radix_sort::sort_keys(keys_mem, 0, n_elem);
+  
+  for(uword i=0; i < n_elem; ++i)  { X[i] = radix_sort::from_key<eT,KT>(keys_mem[i], descend); }
+  
+  return true;
+  }
+
+
+
+//! element types without a radix_sort_key are not handled
+template<typename eT>
+inline
+bool
+radix_sort::sort(eT* X, const uword n_elem, const bool descend, const typename enable_if2<false == radix_sort_key<eT>::value, eT>::result* junk)
+  {
+  arma_ignore(X);
+  arma_ignore(n_elem);
+  arma_ignore(descend);
+  arma_ignore(junk);
+  
+  return false;
+  }
+
+
+
+//! store the indices of the sorted elements of P in out, without creating value/index pairs;
+//! -0 is treated as +0, so that the order of indices for equal elements is the same as for std::stable_sort();
+//! returns false if P has NaN elements
+template<typename T1>
+inline
+bool
+radix_sort::sort_index(Mat<uword>& out, const Proxy<T1>& P, const bool descend, const typename enable_if2<radix_sort_key<typename T1::elem_type>::value, typename T1::elem_type>::result* junk)
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename T1::elem_type             eT;
+  typedef typename radix_sort_key<eT>::result KT;
+  
+  const uword n_elem = P.get_n_elem();
+  
+  out.set_size(n_elem, 1);
+  
+  podarray<KT> keys(n_elem);
+  
+  KT*    keys_mem = keys.memptr();
+  uword* out_mem  = out.memptr();
+  
+  if(Proxy<T1>::use_at == false)
+    {
+    typename Proxy<T1>::ea_type Pea = P.get_ea();
+    
+    for(uword i=0; i < n_elem; ++i)
+      {
+      const eT val = Pea[i];
+      
+      if(arma_isnan(val))  { out.reset(); return false; }
+      
+      keys_mem[i] = radix_sort::to_key<eT,KT>( ((val != eT(0)) ? val : eT(0)), descend );
+      out_mem[i]  = i;
+      }
+    }
+  else
+    {
+    const uword n_rows = P.get_n_rows();
+    const uword n_cols = P.get_n_cols();
+    
+    uword i = 0;
+    
+    for(uword col=0; col < n_cols; ++col)
+    for(uword row=0; row < n_rows; ++row)
+      {
+      const eT val = P.at(row,col);
+      
+      if(arma_isnan(val))  { out.reset(); return false; }
+      
+      keys_mem[i] = radix_sort::to_key<eT,KT>( ((val != eT(0)) ? val : eT(0)), descend );
+      out_mem[i]  = i;
+      
+      ++i;
+      }
+    }
+  
+  radix_sort::sort_keys(keys_mem, out_mem, n_elem);
+  
+  return true;
+  }
+
+
+
+//! element types without a radix_sort_key are not handled
+template<typename T1>
+inline
+bool
+radix_sort::sort_index(Mat<uword>& out, const Proxy<T1>& P, const bool descend, const typename enable_if2<false == radix_sort_key<typename T1::elem_type>::value, typename T1::elem_type>::result* junk)
+  {
+  arma_ignore(out);
+  arma_ignore(P);
+  arma_ignore(descend);
+  arma_ignore(junk);
+  
+  return false;
+  }
+
+
+
+//! sort the keys in ascending order, while moving the corresponding indices (if indices is not null)
+template<typename KT>
+inline
+void
+radix_sort::sort_keys(KT* keys, uword* indices, const uword n_elem)
+  {
+  arma_extra_debug_sigprint();
+  
+  if(n_elem <= 1)  { return; }
+  
+  podarray<KT>    tmp_keys(n_elem);
+  podarray<uword> tmp_indices( (indices != 0) ? n_elem : uword(0) );
+  
+  uword* tmp_indices_mem = (indices != 0) ? tmp_indices.memptr() : 0;
+  
+  #if defined(_OPENMP)
+    const uword n_threads = ( (n_elem >= parallel_n_elem) && (omp_in_parallel() == 0) ) ? uword( (std::max)(int(1), omp_get_max_threads()) ) : uword(1);
+  #else
+    const uword n_threads = 1;
+  #endif
+  
+  if(n_threads == 1)
+    {
+    radix_sort::sort_keys_serial(keys, tmp_keys.memptr(), indices, tmp_indices_mem, n_elem);
+    
+    return;
+    }
+  
+  #if defined(_OPENMP)
+    {
+    // sort one chunk per thread, then repeatedly merge pairs of adjacent chunks
+    
+    podarray<uword> bounds(n_threads + 1);
+    
+    const uword chunk_size = n_elem / n_threads;
+    
+    for(uword t=0; t < n_threads; ++t)  { bounds[t] = t * chunk_size; }
+    
+    bounds[n_threads] = n_elem;
+    
+    #pragma omp parallel for schedule(static,1)
+    for(uword t=0; t < n_threads; ++t)
+      {
+      const uword start = bounds[t];
+      
+      radix_sort::sort_keys_serial
+        (
+        keys               + start,
+        tmp_keys.memptr()  + start,
+        (indices != 0) ? (indices         + start) : 0,
+        (indices != 0) ? (tmp_indices_mem + start) : 0,
+        bounds[t+1] - start
+        );
+      }
+    
+    KT*    src_keys    = keys;
+    KT*    dst_keys    = tmp_keys.memptr();
+    uword* src_indices = indices;
+    uword* dst_indices = tmp_indices_mem;
+    
+    uword n_chunks = n_threads;
+    
+    while(n_chunks > 1)
+      {
+      const uword n_merged = (n_chunks + 1) / 2;
+      
+      #pragma omp parallel for schedule(static,1)
+      for(uword m=0; m < n_merged; ++m)
+        {
+        const uword start = bounds[2*m];
+        const uword mid   = bounds[(std::min)(2*m + 1, n_chunks)];
+        const uword end   = bounds[(std::min)(2*m + 2, n_chunks)];
+        
+        radix_sort::merge(dst_keys, dst_indices, src_keys, src_indices, start, mid, end);
+        }
+      
+      for(uword m=0; m < n_merged; ++m)  { bounds[m] = bounds[2*m]; }
+      
+      bounds[n_merged] = n_elem;
+      
+      n_chunks = n_merged;
+      
+      std::swap(src_keys,    dst_keys   );
+      std::swap(src_indices, dst_indices);
+      }
+    
+    if(src_keys != keys)
+      {
+      arrayops::copy(keys, src_keys, n_elem);
+      
+      if(indices != 0)  { arrayops::copy(indices, src_indices, n_elem); }
+      }
+    }
+  #endif
+  }
+
+
+
+template<typename KT>
+inline
+void
+radix_sort::sort_keys_serial(KT* keys, KT* tmp_keys, uword* indices, uword* tmp_indices, const uword n_elem)
+  {
+  if(n_elem <= 1)  { return; }
+  
+  const uword n_bits   = 11;
+  const uword n_digits = uword(1) << n_bits;
+  const uword mask     = n_digits - 1;
+  const uword n_passes = (uword(sizeof(KT))*8 + n_bits - 1) / n_bits;
+  
+  // histograms of all passes are determined with one read of the keys
+  
+  podarray<uword> counts(n_passes * n_digits);
+  
+  counts.zeros();
+  
+  uword* counts_mem = counts.memptr();
+  
+  for(uword i=0; i < n_elem; ++i)
+    {
+    KT key = keys[i];
+    
+    for(uword pass=0; pass < n_passes; ++pass)  { ++(counts_mem[pass*n_digits + (key & mask)]);  key >>= n_bits; }
+    }
+  
+  KT*    src_keys    = keys;
+  KT*    dst_keys    = tmp_keys;
+  uword* src_indices = indices;
+  uword* dst_indices = tmp_indices;
+  
+  for(uword pass=0; pass < n_passes; ++pass)
+    {
+    uword*      count = counts_mem + pass*n_digits;
+    const uword shift = n_bits*pass;
+    
+    // skip passes which wouldn't change the order, ie. all keys have the same digit
+    if(count[(src_keys[0] >> shift) & mask] == n_elem)  { continue; }
+    
+    uword offset = 0;
+    
+    for(uword digit=0; digit < n_digits; ++digit)
+      {
+      const uword tmp = count[digit];
+      
+      count[digit] = offset;
+      
+      offset += tmp;
+      }
+    
+    if(src_indices != 0)
+      {
+      for(uword i=0; i < n_elem; ++i)
+        {
+        const KT    key = src_keys[i];
+        const uword pos = count[(key >> shift) & mask]++;
+        
+        dst_keys[pos]    = key;
+        dst_indices[pos] = src_indices[i];
+        }
+      }
+    else
+      {
+      for(uword i=0; i < n_elem; ++i)
+        {
+        const KT key = src_keys[i];
+        
+        dst_keys[ count[(key >> shift) & mask]++ ] = key;
+        }
+      }
+    
+    std::swap(src_keys,    dst_keys   );
+    std::swap(src_indices, dst_indices);
+    }
+  
+  if(src_keys != keys)
+    {
+    arrayops::copy(keys, src_keys, n_elem);
+    
+    if(indices != 0)  { arrayops::copy(indices, src_indices, n_elem); }
+    }
+  }
+
+
+
+//! merge the sorted ranges [start,mid) and [mid,end);
+//! for equal keys, the key from the first range is taken first, so that the merge is stable
+template<typename KT>
+inline
+void
+radix_sort::merge(KT* out_keys, uword* out_indices, const KT* keys, const uword* indices, const uword start, const uword mid, const uword end)
+  {
+  uword i = start;
+  uword j = mid;
+  uword k = start;
+  
+  while( (i < mid) && (j < end) )
+    {
+    const bool use_j = (keys[j] < keys[i]);
+    
+    const uword src = (use_j) ? j : i;
+    
+    out_keys[k] = keys[src];
+    
+    if(indices != 0)  { out_indices[k] = indices[src]; }
+    
+    if(use_j)  { ++j; }  else  { ++i; }
+    
+    ++k;
+    }
+  
+  if(i < mid)
+    {
+    arrayops::copy(out_keys + k, keys + i, mid - i);
+    
+    if(indices != 0)  { arrayops::copy(out_indices + k, indices + i, mid - i); }
+    
+    k += (mid - i);
+    }
+  
+  if(j < end)
+    {
+    arrayops::copy(out_keys + k, keys + j, end - j);
+    
+    if(indices != 0)  { arrayops::copy(out_indices + k, indices + j, end - j); }
+    }
+  }
+
+
+
+//! @}
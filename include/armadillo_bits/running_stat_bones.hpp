@@ -24,6 +24,9 @@ class arma_counter
   inline const arma_counter& operator++();
   inline void                operator++(int);
   
+  inline const arma_counter& operator+=(const arma_counter& in);
+  inline const arma_counter& operator+=(const uword n);
+  
   inline void reset();
   inline eT   value()         const;
   inline eT   value_plus_1()  const;
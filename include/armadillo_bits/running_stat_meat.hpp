@@ -63,6 +63,39 @@ arma_counter<eT>::operator++(int)
 
 
 
+//! add the count of another counter
+template<typename eT>
+inline
+const arma_counter<eT>&
+arma_counter<eT>::operator+=(const arma_counter<eT>& in)
+  {
+  d_count += in.d_count;
+  
+  return (*this) += in.i_count;
+  }
+
+
+
+template<typename eT>
+inline
+const arma_counter<eT>&
+arma_counter<eT>::operator+=(const uword n)
+  {
+  if(n <= (ARMA_MAX_UWORD - i_count))
+    {
+    i_count += n;
+    }
+  else
+    {
+    d_count += eT(i_count) + eT(n);
+    i_count  = 0;
+    }
+  
+  return *this;
+  }
+
+
+
 template<typename eT>
 inline
 void
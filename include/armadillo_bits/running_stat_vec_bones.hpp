@@ -21,6 +21,8 @@ template<typename obj_type>       struct rsv_get_elem_type<obj_type, true>  { ty
 //! Useful if the storage of individual samples is not necessary or desired.
 //! Also useful if the number of samples is not known beforehand or exceeds 
 //! available memory.
+//! Batches of samples can be added at once, and the statistics of separately
+//! accumulated streams (eg. one per thread) can be combined via merge().
 template<typename obj_type>
 class running_stat_vec
   {
@@ -41,6 +43,11 @@ class running_stat_vec
   template<typename T1> arma_hot inline void operator() (const Base<              T, T1>& X);
   template<typename T1> arma_hot inline void operator() (const Base<std::complex<T>, T1>& X);
   
+  template<typename T1> inline void add_samples(const Base<              T, T1>& X);
+  template<typename T1> inline void add_samples(const Base<std::complex<T>, T1>& X);
+  
+  inline void merge(const running_stat_vec& in_rsv);
+  
   inline void reset();
   
   inline const Mat<eT>&  mean() const;
@@ -123,6 +130,68 @@ class running_stat_vec_aux
     const                   Mat<typename running_stat_vec<obj_type>::eT>& sample,
     const typename arma_cx_only<typename running_stat_vec<obj_type>::eT>::result* junk = 0
     );
+  
+  template<typename obj_type>
+  inline static void
+  update_batch
+    (
+    running_stat_vec<obj_type>& x,
+    const                  Mat<typename running_stat_vec<obj_type>::eT>& samples
+    );
+  
+  template<typename obj_type>
+  inline static void
+  update_batch
+    (
+    running_stat_vec<obj_type>& x,
+    const          Mat<std::complex< typename running_stat_vec<obj_type>::T > >& samples,
+    const typename       arma_not_cx<typename running_stat_vec<obj_type>::eT>::result* junk = 0
+    );
+  
+  template<typename obj_type>
+  inline static void
+  update_batch
+    (
+    running_stat_vec<obj_type>& x,
+    const                  Mat< typename running_stat_vec<obj_type>::T >& samples,
+    const typename arma_cx_only<typename running_stat_vec<obj_type>::eT>::result* junk = 0
+    );
+  
+  template<typename obj_type>
+  inline static void
+  batch_stats
+    (
+    running_stat_vec<obj_type>& out,
+    const                  Mat<typename running_stat_vec<obj_type>::eT>& samples,
+    const typename arma_not_cx<typename running_stat_vec<obj_type>::eT>::result* junk = 0
+    );
+  
+  template<typename obj_type>
+  inline static void
+  batch_stats
+    (
+    running_stat_vec<obj_type>& out,
+    const                   Mat<typename running_stat_vec<obj_type>::eT>& samples,
+    const typename arma_cx_only<typename running_stat_vec<obj_type>::eT>::result* junk = 0
+    );
+  
+  template<typename obj_type>
+  inline static void
+  merge_extremes
+    (
+          running_stat_vec<obj_type>& x,
+    const running_stat_vec<obj_type>& y,
+    const typename arma_not_cx<typename running_stat_vec<obj_type>::eT>::result* junk = 0
+    );
+  
+  template<typename obj_type>
+  inline static void
+  merge_extremes
+    (
+          running_stat_vec<obj_type>& x,
+    const running_stat_vec<obj_type>& y,
+    const typename arma_cx_only<typename running_stat_vec<obj_type>::eT>::result* junk = 0
+    );
   };
 
 
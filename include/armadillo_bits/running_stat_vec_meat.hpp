@@ -131,6 +131,126 @@ running_stat_vec<obj_type>::operator() (const Base< std::complex<typename runnin
 
 
 
+//! update statistics to reflect new samples, where each column of X is a sample
+template<typename obj_type>
+template<typename T1>
+inline
+void
+running_stat_vec<obj_type>::add_samples(const Base<typename running_stat_vec<obj_type>::T, T1>& X)
+  {
+  arma_extra_debug_sigprint();
+  
+  const quasi_unwrap<T1> tmp(X.get_ref());
+  
+  if(tmp.M.n_cols == 0)  { return; }
+  
+  running_stat_vec_aux::update_batch(*this, tmp.M);
+  }
+
+
+
+template<typename obj_type>
+template<typename T1>
+inline
+void
+running_stat_vec<obj_type>::add_samples(const Base< std::complex<typename running_stat_vec<obj_type>::T>, T1>& X)
+  {
+  arma_extra_debug_sigprint();
+  
+  const quasi_unwrap<T1> tmp(X.get_ref());
+  
+  if(tmp.M.n_cols == 0)  { return; }
+  
+  running_stat_vec_aux::update_batch(*this, tmp.M);
+  }
+
+
+
+//! update statistics to also reflect the samples seen by another object,
+//! as if all the samples were given to this object;
+//! if this object keeps the covariance, the given object must also keep it
+template<typename obj_type>
+inline
+void
+running_stat_vec<obj_type>::merge(const running_stat_vec<obj_type>& in_rsv)
+  {
+  arma_extra_debug_sigprint();
+  
+  if(this == &in_rsv)
+    {
+    const running_stat_vec<obj_type> tmp(in_rsv);
+    
+    merge(tmp);
+    
+    return;
+    }
+  
+  const T N_B = in_rsv.counter.value();
+  
+  if(N_B == T(0))  { return; }
+  
+  arma_debug_check( ((calc_cov == true) && (in_rsv.calc_cov == false)), "running_stat_vec::merge(): given object doesn't keep covariance" );
+  
+  const T N_A = counter.value();
+  
+  if(N_A == T(0))
+    {
+    const bool keep_cov = calc_cov;
+    
+    (*this) = in_rsv;
+    
+    access::rw(calc_cov) = keep_cov;
+    
+    if(calc_cov == false)  { r_cov.reset(); }
+    
+    return;
+    }
+  
+  arma_debug_check( (r_mean.n_elem != in_rsv.r_mean.n_elem), "running_stat_vec::merge(): dimensionality mismatch" );
+  
+  const T N     = N_A + N_B;
+  const T scale = N_A * N_B / N;
+  
+  const uword n_elem = r_mean.n_elem;
+  
+  if(calc_cov == true)
+    {
+    tmp1.set_size(n_elem, 1);
+    
+    eT* delta_mem = tmp1.memptr();
+    
+    for(uword i=0; i<n_elem; ++i)  { delta_mem[i] = in_rsv.r_mean[i] - r_mean[i]; }
+    
+    // r_cov is normalised by N-1
+    r_cov *= eT(N_A - T(1));
+    r_cov += eT(N_B - T(1)) * in_rsv.r_cov;
+    r_cov += eT(scale) * (arma::conj(tmp1) * strans(tmp1));
+    r_cov /= eT(N - T(1));
+    }
+  
+  const eT* B_mean_mem = in_rsv.r_mean.memptr();
+  const  T* B_var_mem  = in_rsv.r_var.memptr();
+  
+  eT* r_mean_mem = r_mean.memptr();
+   T* r_var_mem  = r_var.memptr();
+  
+  for(uword i=0; i<n_elem; ++i)
+    {
+    const eT delta     = B_mean_mem[i] - r_mean_mem[i];
+    const  T delta_abs = std::abs(delta);
+    
+    r_var_mem[i] = ( (N_A - T(1))*r_var_mem[i] + (N_B - T(1))*B_var_mem[i] + scale*delta_abs*delta_abs ) / (N - T(1));
+    
+    r_mean_mem[i] += delta * (N_B / N);
+    }
+  
+  running_stat_vec_aux::merge_extremes(*this, in_rsv);
+  
+  counter += in_rsv.counter;
+  }
+
+
+
 //! set all statistics to zero
 template<typename obj_type>
 inline
@@ -612,4 +732,325 @@ running_stat_vec_aux::update_stats
 
 
 
+//! update statistics to reflect a batch of samples, where each column is a sample;
+//! the statistics of the batch are found separately and then merged
+template<typename obj_type>
+inline
+void
+running_stat_vec_aux::update_batch
+  (
+  running_stat_vec<obj_type>& x,
+  const                  Mat<typename running_stat_vec<obj_type>::eT>& samples
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename running_stat_vec<obj_type>::eT eT;
+  
+  running_stat_vec<obj_type> B(x.calc_cov);
+  
+  running_stat_vec_aux::batch_stats(B, samples);
+  
+  // non-finite elements propagate to the mean and variance,
+  // so the samples need to be checked only when the statistics aren't finite
+  
+  if( (B.r_mean.is_finite() == false) || (B.r_var.is_finite() == false) )
+    {
+    const uword n_rows = samples.n_rows;
+    const uword n_cols = samples.n_cols;
+    
+    uvec indices(n_cols);
+    
+    uword n_finite = 0;
+    
+    for(uword col=0; col < n_cols; ++col)
+      {
+      if(arrayops::is_finite(samples.colptr(col), n_rows))  { indices[n_finite] = col;  ++n_finite; }
+      }
+    
+    if(n_finite < n_cols)
+      {
+      arma_debug_warn("running_stat_vec: samples with non-finite elements ignored");
+      
+      if(n_finite == 0)  { return; }
+      
+      const Mat<eT> finite_samples = samples.cols( indices.head(n_finite) );
+      
+      B.reset();
+      
+      running_stat_vec_aux::batch_stats(B, finite_samples);
+      }
+    }
+  
+  x.merge(B);
+  }
+
+
+
+//! update statistics to reflect a batch of samples (version for non-complex numbers, complex samples)
+template<typename obj_type>
+inline
+void
+running_stat_vec_aux::update_batch
+  (
+  running_stat_vec<obj_type>& x,
+  const          Mat<std::complex< typename running_stat_vec<obj_type>::T > >& samples,
+  const typename       arma_not_cx<typename running_stat_vec<obj_type>::eT>::result* junk
+  )
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename running_stat_vec<obj_type>::eT eT;
+  
+  running_stat_vec_aux::update_batch(x, conv_to< Mat<eT> >::from(samples));
+  }
+
+
+
+//! update statistics to reflect a batch of samples (version for complex numbers, non-complex samples)
+template<typename obj_type>
+inline
+void
+running_stat_vec_aux::update_batch
+  (
+  running_stat_vec<obj_type>& x,
+  const                  Mat< typename running_stat_vec<obj_type>::T >& samples,
+  const typename arma_cx_only<typename running_stat_vec<obj_type>::eT>::result* junk
+  )
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename running_stat_vec<obj_type>::eT eT;
+  
+  running_stat_vec_aux::update_batch(x, conv_to< Mat<eT> >::from(samples));
+  }
+
+
+
+//! find the statistics of a batch of finite samples (version for non-complex numbers);
+//! the mean, variance and extremes are found in one pass via moment_acc,
+//! while the covariance is found via a rank-k update
+template<typename obj_type>
+inline
+void
+running_stat_vec_aux::batch_stats
+  (
+  running_stat_vec<obj_type>& out,
+  const                  Mat<typename running_stat_vec<obj_type>::eT>& samples,
+  const typename arma_not_cx<typename running_stat_vec<obj_type>::eT>::result* junk
+  )
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename running_stat_vec<obj_type>::eT eT;
+  
+  const uword n_dim     = samples.n_rows;
+  const uword n_samples = samples.n_cols;
+  
+  std::vector< moment_acc<eT> > acc;
+  
+  moment_acc<eT>::apply(acc, samples, 1, 2, true);
+  
+  out.r_mean.set_size(n_dim, 1);
+  out.r_var.set_size(n_dim, 1);
+  out.min_val.set_size(n_dim, 1);
+  out.max_val.set_size(n_dim, 1);
+  
+  for(uword i=0; i < n_dim; ++i)
+    {
+    out.r_mean[i]  = acc[i].mean;
+    out.r_var[i]   = acc[i].var(0);
+    out.min_val[i] = acc[i].min_val;
+    out.max_val[i] = acc[i].max_val;
+    }
+  
+  if(out.calc_cov == true)
+    {
+    if(n_samples > 1)
+      {
+      Mat<eT>& D = out.tmp1;
+      
+      D = samples;
+      
+      D.each_col() -= out.r_mean;
+      
+      out.r_cov = D * trans(D);
+      
+      out.r_cov /= eT(n_samples - 1);
+      }
+    else
+      {
+      out.r_cov.zeros(n_dim, n_dim);
+      }
+    }
+  
+  out.counter += n_samples;
+  }
+
+
+
+//! find the statistics of a batch of finite samples (version for complex numbers)
+template<typename obj_type>
+inline
+void
+running_stat_vec_aux::batch_stats
+  (
+  running_stat_vec<obj_type>& out,
+  const                   Mat<typename running_stat_vec<obj_type>::eT>& samples,
+  const typename arma_cx_only<typename running_stat_vec<obj_type>::eT>::result* junk
+  )
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename running_stat_vec<obj_type>::eT eT;
+  typedef typename running_stat_vec<obj_type>::T   T;
+  
+  const uword n_dim     = samples.n_rows;
+  const uword n_samples = samples.n_cols;
+  
+  out.r_mean = sum(samples, 1) / T(n_samples);
+  
+  out.r_var.zeros(n_dim, 1);
+  
+  out.min_val.set_size(n_dim, 1);
+  out.max_val.set_size(n_dim, 1);
+  
+  out.min_val_norm.set_size(n_dim, 1);
+  out.max_val_norm.set_size(n_dim, 1);
+  
+  Mat<eT>& D = out.tmp1;
+  
+  D = samples;
+  
+  D.each_col() -= out.r_mean;
+  
+  Col<eT> D_sum(n_dim, fill::zeros);
+  
+  for(uword col=0; col < n_samples; ++col)
+    {
+    const eT* sample_mem = samples.colptr(col);
+    const eT*      D_mem = D.colptr(col);
+    
+    for(uword i=0; i < n_dim; ++i)
+      {
+      const eT& val      = sample_mem[i];
+      const  T  val_norm = std::norm(val);
+      
+      if( (col == 0) || (val_norm < out.min_val_norm[i]) )  { out.min_val_norm[i] = val_norm;  out.min_val[i] = val; }
+      if( (col == 0) || (val_norm > out.max_val_norm[i]) )  { out.max_val_norm[i] = val_norm;  out.max_val[i] = val; }
+      
+      out.r_var[i] += std::norm(D_mem[i]);
+      D_sum[i]     += D_mem[i];
+      }
+    }
+  
+  if(n_samples > 1)
+    {
+    // remove the effect of rounding errors in the mean
+    for(uword i=0; i < n_dim; ++i)
+      {
+      out.r_var[i] = (out.r_var[i] - std::norm(D_sum[i]) / T(n_samples)) / T(n_samples - 1);
+      }
+    }
+  else
+    {
+    out.r_var.zeros();
+    }
+  
+  if(out.calc_cov == true)
+    {
+    if(n_samples > 1)
+      {
+      // conj(D*D^H) matches the covariance of individually added samples
+      out.r_cov = arma::conj(D * trans(D)) / eT(T(n_samples - 1));
+      }
+    else
+      {
+      out.r_cov.zeros(n_dim, n_dim);
+      }
+    }
+  
+  out.counter += n_samples;
+  }
+
+
+
+//! combine the extremes of two objects (version for non-complex numbers)
+template<typename obj_type>
+inline
+void
+running_stat_vec_aux::merge_extremes
+  (
+        running_stat_vec<obj_type>& x,
+  const running_stat_vec<obj_type>& y,
+  const typename arma_not_cx<typename running_stat_vec<obj_type>::eT>::result* junk
+  )
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename running_stat_vec<obj_type>::eT eT;
+  
+  const uword n_elem = x.r_mean.n_elem;
+  
+        eT* min_val_mem = x.min_val.memptr();
+        eT* max_val_mem = x.max_val.memptr();
+  const eT* y_min_mem   = y.min_val.memptr();
+  const eT* y_max_mem   = y.max_val.memptr();
+  
+  for(uword i=0; i<n_elem; ++i)
+    {
+    if(y_min_mem[i] < min_val_mem[i])  { min_val_mem[i] = y_min_mem[i]; }
+    if(y_max_mem[i] > max_val_mem[i])  { max_val_mem[i] = y_max_mem[i]; }
+    }
+  }
+
+
+
+//! combine the extremes of two objects (version for complex numbers)
+template<typename obj_type>
+inline
+void
+running_stat_vec_aux::merge_extremes
+  (
+        running_stat_vec<obj_type>& x,
+  const running_stat_vec<obj_type>& y,
+  const typename arma_cx_only<typename running_stat_vec<obj_type>::eT>::result* junk
+  )
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename running_stat_vec<obj_type>::eT eT;
+  typedef typename running_stat_vec<obj_type>::T   T;
+  
+  const uword n_elem = x.r_mean.n_elem;
+  
+        eT* min_val_mem      = x.min_val.memptr();
+        eT* max_val_mem      = x.max_val.memptr();
+         T* min_val_norm_mem = x.min_val_norm.memptr();
+         T* max_val_norm_mem = x.max_val_norm.memptr();
+  
+  for(uword i=0; i<n_elem; ++i)
+    {
+    if(y.min_val_norm[i] < min_val_norm_mem[i])
+      {
+      min_val_norm_mem[i] = y.min_val_norm[i];
+      min_val_mem[i]      = y.min_val[i];
+      }
+    
+    if(y.max_val_norm[i] > max_val_norm_mem[i])
+      {
+      max_val_norm_mem[i] = y.max_val_norm[i];
+      max_val_mem[i]      = y.max_val[i];
+      }
+    }
+  }
+
+
+
 //! @}
@@ -0,0 +1,78 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+//! \addtogroup sympd_helper
+//! @{
+
+
+namespace sympd_helper
+{
+
+
+
+//! cheap test of whether square matrix A is likely to be symmetric (or hermitian) positive definite.
+//! checks that the diagonal is real and positive, that A is symmetric to within a small tolerance,
+//! and that each off-diagonal element satisfies |A(i,j)|^2 < A(i,i)*A(j,j), which is necessary for positive definiteness.
+//! a positive result must be confirmed by attempting a Cholesky decomposition.
+template<typename eT>
+inline
+bool
+guess_sympd(const Mat<eT>& A)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  const uword N = A.n_rows;
+  
+  if(N < 2)  { return false; }
+  
+  const T tol = T(100) * std::numeric_limits<T>::epsilon();
+  
+  // quick check of the first off-diagonal pair, which rejects most non-symmetric matrices
+  
+  if( std::abs(A.at(1,0) - access::alt_conj(A.at(0,1))) > (tol * (std::max)(std::abs(A.at(1,0)), std::abs(A.at(0,1)))) )  { return false; }
+  
+  for(uword i=0; i < N; ++i)
+    {
+    const eT A_ii = A.at(i,i);
+    
+    const T A_ii_real = access::tmp_real(A_ii);
+    
+    if( (A_ii_real <= T(0)) || (std::abs(A_ii - eT(A_ii_real)) > (tol * A_ii_real)) )  { return false; }
+    }
+  
+  for(uword col=0; col < N; ++col)
+    {
+    const T A_cc = access::tmp_real(A.at(col,col));
+    
+    for(uword row=(col+1); row < N; ++row)
+      {
+      const eT A_rc = A.at(row,col);
+      const eT A_cr = A.at(col,row);
+      
+      const T abs_A_rc = std::abs(A_rc);
+      
+      if( std::abs(A_rc - access::alt_conj(A_cr)) > (tol * (std::max)(abs_A_rc, std::abs(A_cr))) )  { return false; }
+      
+      if( (abs_A_rc * abs_A_rc) >= (A_cc * access::tmp_real(A.at(row,row))) )  { return false; }
+      }
+    }
+  
+  return true;
+  }
+
+
+
+}  // namespace sympd_helper
+
+
+
+//! @}
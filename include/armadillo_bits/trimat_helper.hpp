@@ -0,0 +1,83 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+//! \addtogroup trimat_helper
+//! @{
+
+
+namespace trimat_helper
+{
+
+
+
+//! returns true if all elements below the main diagonal of square matrix A are zero;
+//! scans the bottom-left corner first, so that most non-triangular matrices are rejected after a few reads
+template<typename eT>
+inline
+bool
+is_triu(const Mat<eT>& A)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword N = A.n_rows;
+  
+  if(N < 2)  { return false; }
+  
+  if(A.at(N-1, 0) != eT(0))  { return false; }
+  
+  for(uword col=0; col < (N-1); ++col)
+    {
+    const eT* colmem = A.colptr(col);
+    
+    for(uword row=(col+1); row < N; ++row)
+      {
+      if(colmem[row] != eT(0))  { return false; }
+      }
+    }
+  
+  return true;
+  }
+
+
+
+//! returns true if all elements above the main diagonal of square matrix A are zero
+template<typename eT>
+inline
+bool
+is_tril(const Mat<eT>& A)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword N = A.n_rows;
+  
+  if(N < 2)  { return false; }
+  
+  if(A.at(0, N-1) != eT(0))  { return false; }
+  
+  for(uword col=1; col < N; ++col)
+    {
+    const eT* colmem = A.colptr(col);
+    
+    for(uword row=0; row < col; ++row)
+      {
+      if(colmem[row] != eT(0))  { return false; }
+      }
+    }
+  
+  return true;
+  }
+
+
+
+}  // namespace trimat_helper
+
+
+
+//! @}
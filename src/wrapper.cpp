@@ -868,6 +868,166 @@ extern "C"
       arma_fortran_noprefix(arma_dlarnv)(idist, iseed, n, x);
       }
     
+    void arma_fortran_prefix(arma_sgbsv)(blas_int* n, blas_int* kl, blas_int* ku, blas_int* nrhs, float*  ab, blas_int* ldab, blas_int* ipiv, float*  b, blas_int* ldb, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_sgbsv)(n, kl, ku, nrhs, ab, ldab, ipiv, b, ldb, info);
+      }
+    
+    void arma_fortran_prefix(arma_dgbsv)(blas_int* n, blas_int* kl, blas_int* ku, blas_int* nrhs, double* ab, blas_int* ldab, blas_int* ipiv, double* b, blas_int* ldb, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_dgbsv)(n, kl, ku, nrhs, ab, ldab, ipiv, b, ldb, info);
+      }
+    
+    void arma_fortran_prefix(arma_cgbsv)(blas_int* n, blas_int* kl, blas_int* ku, blas_int* nrhs, void*   ab, blas_int* ldab, blas_int* ipiv, void*   b, blas_int* ldb, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_cgbsv)(n, kl, ku, nrhs, ab, ldab, ipiv, b, ldb, info);
+      }
+    
+    void arma_fortran_prefix(arma_zgbsv)(blas_int* n, blas_int* kl, blas_int* ku, blas_int* nrhs, void*   ab, blas_int* ldab, blas_int* ipiv, void*   b, blas_int* ldb, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_zgbsv)(n, kl, ku, nrhs, ab, ldab, ipiv, b, ldb, info);
+      }
+    
+    void arma_fortran_prefix(arma_sgtsv)(blas_int* n, blas_int* nrhs, float*  dl, float*  d, float*  du, float*  b, blas_int* ldb, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_sgtsv)(n, nrhs, dl, d, du, b, ldb, info);
+      }
+    
+    void arma_fortran_prefix(arma_dgtsv)(blas_int* n, blas_int* nrhs, double* dl, double* d, double* du, double* b, blas_int* ldb, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_dgtsv)(n, nrhs, dl, d, du, b, ldb, info);
+      }
+    
+    void arma_fortran_prefix(arma_cgtsv)(blas_int* n, blas_int* nrhs, void*   dl, void*   d, void*   du, void*   b, blas_int* ldb, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_cgtsv)(n, nrhs, dl, d, du, b, ldb, info);
+      }
+    
+    void arma_fortran_prefix(arma_zgtsv)(blas_int* n, blas_int* nrhs, void*   dl, void*   d, void*   du, void*   b, blas_int* ldb, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_zgtsv)(n, nrhs, dl, d, du, b, ldb, info);
+      }
+    
+    void arma_fortran_prefix(arma_sposv)(char* uplo, blas_int* n, blas_int* nrhs, float*  a, blas_int* lda, float*  b, blas_int* ldb, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_sposv)(uplo, n, nrhs, a, lda, b, ldb, info);
+      }
+    
+    void arma_fortran_prefix(arma_dposv)(char* uplo, blas_int* n, blas_int* nrhs, double* a, blas_int* lda, double* b, blas_int* ldb, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_dposv)(uplo, n, nrhs, a, lda, b, ldb, info);
+      }
+    
+    void arma_fortran_prefix(arma_cposv)(char* uplo, blas_int* n, blas_int* nrhs, void*   a, blas_int* lda, void*   b, blas_int* ldb, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_cposv)(uplo, n, nrhs, a, lda, b, ldb, info);
+      }
+    
+    void arma_fortran_prefix(arma_zposv)(char* uplo, blas_int* n, blas_int* nrhs, void*   a, blas_int* lda, void*   b, blas_int* ldb, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_zposv)(uplo, n, nrhs, a, lda, b, ldb, info);
+      }
+    
+    void arma_fortran_prefix(arma_strcon)(char* norm, char* uplo, char* diag, blas_int* n, float*  a, blas_int* lda, float*  rcond, float*  work, blas_int* iwork, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_strcon)(norm, uplo, diag, n, a, lda, rcond, work, iwork, info);
+      }
+    
+    void arma_fortran_prefix(arma_dtrcon)(char* norm, char* uplo, char* diag, blas_int* n, double* a, blas_int* lda, double* rcond, double* work, blas_int* iwork, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_dtrcon)(norm, uplo, diag, n, a, lda, rcond, work, iwork, info);
+      }
+    
+    void arma_fortran_prefix(arma_ctrcon)(char* norm, char* uplo, char* diag, blas_int* n, void* a, blas_int* lda, float*  rcond, void* work, float*  rwork, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_ctrcon)(norm, uplo, diag, n, a, lda, rcond, work, rwork, info);
+      }
+    
+    void arma_fortran_prefix(arma_ztrcon)(char* norm, char* uplo, char* diag, blas_int* n, void* a, blas_int* lda, double* rcond, void* work, double* rwork, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_ztrcon)(norm, uplo, diag, n, a, lda, rcond, work, rwork, info);
+      }
+    
+    void arma_fortran_prefix(arma_spocon)(char* uplo, blas_int* n, float*  a, blas_int* lda, float*  anorm, float*  rcond, float*  work, blas_int* iwork, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_spocon)(uplo, n, a, lda, anorm, rcond, work, iwork, info);
+      }
+    
+    void arma_fortran_prefix(arma_dpocon)(char* uplo, blas_int* n, double* a, blas_int* lda, double* anorm, double* rcond, double* work, blas_int* iwork, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_dpocon)(uplo, n, a, lda, anorm, rcond, work, iwork, info);
+      }
+    
+    void arma_fortran_prefix(arma_cpocon)(char* uplo, blas_int* n, void* a, blas_int* lda, float*  anorm, float*  rcond, void* work, float*  rwork, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_cpocon)(uplo, n, a, lda, anorm, rcond, work, rwork, info);
+      }
+    
+    void arma_fortran_prefix(arma_zpocon)(char* uplo, blas_int* n, void* a, blas_int* lda, double* anorm, double* rcond, void* work, double* rwork, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_zpocon)(uplo, n, a, lda, anorm, rcond, work, rwork, info);
+      }
+    
+    void arma_fortran_prefix(arma_sgbcon)(char* norm, blas_int* n, blas_int* kl, blas_int* ku, float*  ab, blas_int* ldab, blas_int* ipiv, float*  anorm, float*  rcond, float*  work, blas_int* iwork, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_sgbcon)(norm, n, kl, ku, ab, ldab, ipiv, anorm, rcond, work, iwork, info);
+      }
+    
+    void arma_fortran_prefix(arma_dgbcon)(char* norm, blas_int* n, blas_int* kl, blas_int* ku, double* ab, blas_int* ldab, blas_int* ipiv, double* anorm, double* rcond, double* work, blas_int* iwork, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_dgbcon)(norm, n, kl, ku, ab, ldab, ipiv, anorm, rcond, work, iwork, info);
+      }
+    
+    void arma_fortran_prefix(arma_cgbcon)(char* norm, blas_int* n, blas_int* kl, blas_int* ku, void* ab, blas_int* ldab, blas_int* ipiv, float*  anorm, float*  rcond, void* work, float*  rwork, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_cgbcon)(norm, n, kl, ku, ab, ldab, ipiv, anorm, rcond, work, rwork, info);
+      }
+    
+    void arma_fortran_prefix(arma_zgbcon)(char* norm, blas_int* n, blas_int* kl, blas_int* ku, void* ab, blas_int* ldab, blas_int* ipiv, double* anorm, double* rcond, void* work, double* rwork, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_zgbcon)(norm, n, kl, ku, ab, ldab, ipiv, anorm, rcond, work, rwork, info);
+      }
+    
+    void arma_fortran_prefix(arma_spotrs)(char* uplo, blas_int* n, blas_int* nrhs, float*  a, blas_int* lda, float*  b, blas_int* ldb, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_spotrs)(uplo, n, nrhs, a, lda, b, ldb, info);
+      }
+    
+    void arma_fortran_prefix(arma_dpotrs)(char* uplo, blas_int* n, blas_int* nrhs, double* a, blas_int* lda, double* b, blas_int* ldb, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_dpotrs)(uplo, n, nrhs, a, lda, b, ldb, info);
+      }
+    
+    void arma_fortran_prefix(arma_cpotrs)(char* uplo, blas_int* n, blas_int* nrhs, void*   a, blas_int* lda, void*   b, blas_int* ldb, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_cpotrs)(uplo, n, nrhs, a, lda, b, ldb, info);
+      }
+    
+    void arma_fortran_prefix(arma_zpotrs)(char* uplo, blas_int* n, blas_int* nrhs, void*   a, blas_int* lda, void*   b, blas_int* ldb, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_zpotrs)(uplo, n, nrhs, a, lda, b, ldb, info);
+      }
+    
+    void arma_fortran_prefix(arma_sormqr)(char* side, char* trans, blas_int* m, blas_int* n, blas_int* k, float*  a, blas_int* lda, float*  tau, float*  c, blas_int* ldc, float*  work, blas_int* lwork, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_sormqr)(side, trans, m, n, k, a, lda, tau, c, ldc, work, lwork, info);
+      }
+    
+    void arma_fortran_prefix(arma_dormqr)(char* side, char* trans, blas_int* m, blas_int* n, blas_int* k, double* a, blas_int* lda, double* tau, double* c, blas_int* ldc, double* work, blas_int* lwork, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_dormqr)(side, trans, m, n, k, a, lda, tau, c, ldc, work, lwork, info);
+      }
+    
+    void arma_fortran_prefix(arma_cunmqr)(char* side, char* trans, blas_int* m, blas_int* n, blas_int* k, void* a, blas_int* lda, void* tau, void* c, blas_int* ldc, void* work, blas_int* lwork, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_cunmqr)(side, trans, m, n, k, a, lda, tau, c, ldc, work, lwork, info);
+      }
+    
+    void arma_fortran_prefix(arma_zunmqr)(char* side, char* trans, blas_int* m, blas_int* n, blas_int* k, void* a, blas_int* lda, void* tau, void* c, blas_int* ldc, void* work, blas_int* lwork, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_zunmqr)(side, trans, m, n, k, a, lda, tau, c, ldc, work, lwork, info);
+      }
+    
   #endif
   
   
@@ -1354,6 +1514,41 @@ extern "C"
       return H5Fis_hdf5(name);
       }
     
+    herr_t arma_H5Sselect_hyperslab(hid_t space_id, H5S_seloper_t op, const hsize_t* start, const hsize_t* stride, const hsize_t* count, const hsize_t* block)
+      {
+      return H5Sselect_hyperslab(space_id, op, start, stride, count, block);
+      }
+    
+    hid_t arma_H5Pcreate(hid_t cls_id)
+      {
+      return H5Pcreate(cls_id);
+      }
+    
+    herr_t arma_H5Pset_chunk(hid_t plist_id, int ndims, const hsize_t* dim)
+      {
+      return H5Pset_chunk(plist_id, ndims, dim);
+      }
+    
+    herr_t arma_H5Pset_shuffle(hid_t plist_id)
+      {
+      return H5Pset_shuffle(plist_id);
+      }
+    
+    herr_t arma_H5Pset_deflate(hid_t plist_id, unsigned level)
+      {
+      return H5Pset_deflate(plist_id, level);
+      }
+    
+    herr_t arma_H5Pclose(hid_t plist_id)
+      {
+      return H5Pclose(plist_id);
+      }
+    
+    htri_t arma_H5Zfilter_avail(H5Z_filter_t id)
+      {
+      return H5Zfilter_avail(id);
+      }
+    
     // H5T_NATIVE_* types.  The rhs here expands to some macros.
     hid_t arma_H5T_NATIVE_UCHAR  = H5T_NATIVE_UCHAR;
     hid_t arma_H5T_NATIVE_CHAR   = H5T_NATIVE_CHAR;
@@ -1367,6 +1562,8 @@ extern "C"
     hid_t arma_H5T_NATIVE_ULLONG = H5T_NATIVE_ULLONG;
     hid_t arma_H5T_NATIVE_FLOAT  = H5T_NATIVE_FLOAT;
     hid_t arma_H5T_NATIVE_DOUBLE = H5T_NATIVE_DOUBLE;
+    
+    hid_t arma_H5P_DATASET_CREATE = H5P_DATASET_CREATE;
 
   #endif
   
@@ -0,0 +1,166 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+TEST_CASE("arma_rng_1")
+  {
+  // known answers for Philox4x32-10
+  
+  u32 x0 = 0;
+  u32 x1 = 0;
+  u32 x2 = 0;
+  u32 x3 = 0;
+  
+  arma_rng_philox::rounds(&x0, &x1, &x2, &x3, 1, u32(0), u32(0));
+  
+  REQUIRE( x0 == u32(0x6627e8d5UL) );
+  REQUIRE( x1 == u32(0xe169c58dUL) );
+  REQUIRE( x2 == u32(0xbc57ac4cUL) );
+  REQUIRE( x3 == u32(0x9b00dbd8UL) );
+  
+  u32 y0 = u32(0x243f6a88UL);
+  u32 y1 = u32(0x85a308d3UL);
+  u32 y2 = u32(0x13198a2eUL);
+  u32 y3 = u32(0x03707344UL);
+  
+  arma_rng_philox::rounds(&y0, &y1, &y2, &y3, 1, u32(0xa4093822UL), u32(0x299f31d0UL));
+  
+  REQUIRE( y0 == u32(0xd16cfe09UL) );
+  REQUIRE( y1 == u32(0x94fdccebUL) );
+  REQUIRE( y2 == u32(0x5001e420UL) );
+  REQUIRE( y3 == u32(0x24126ea1UL) );
+  }
+
+
+
+TEST_CASE("arma_rng_2")
+  {
+  // the same seed must give the same values;
+  // the object is large enough to be filled in parallel when OpenMP is enabled
+  
+  arma_rng::set_seed(123);
+  
+  mat  A1 = randu<mat>(700,301);
+  mat  B1 = randn<mat>(700,301);
+  imat C1 = randi<imat>(700,301, distr_param(-5,5));
+  
+  arma_rng::set_seed(123);
+  
+  mat  A2 = randu<mat>(700,301);
+  mat  B2 = randn<mat>(700,301);
+  imat C2 = randi<imat>(700,301, distr_param(-5,5));
+  
+  REQUIRE( approx_equal(A1, A2, "absdiff", 0.0) );
+  REQUIRE( approx_equal(B1, B2, "absdiff", 0.0) );
+  REQUIRE( accu(C1 != C2) == 0 );
+  
+  REQUIRE( approx_equal(A1, randu<mat>(700,301), "absdiff", 0.0) == false );
+  }
+
+
+
+TEST_CASE("arma_rng_3")
+  {
+  mat A = randu<mat>(500,401);
+  
+  REQUIRE( A.min() >= 0.0 );
+  REQUIRE( A.max() <  1.0 );
+  
+  REQUIRE( mean(vectorise(A)) == Approx(0.5     ).epsilon(0.01) );
+  REQUIRE( var(vectorise(A))  == Approx(1.0/12.0).epsilon(0.02) );
+  
+  fmat F = randu<fmat>(301,300);
+  
+  REQUIRE( F.max() < 1.0f );
+  
+  mat B = randn<mat>(500,401);
+  
+  REQUIRE( std::abs(mean(vectorise(B))) < 0.01 );
+  REQUIRE( var(vectorise(B)) == Approx(1.0).epsilon(0.02) );
+  
+  cx_mat C = randn<cx_mat>(300,300);
+  
+  REQUIRE( var(real(vectorise(C))) == Approx(1.0).epsilon(0.03) );
+  REQUIRE( var(imag(vectorise(C))) == Approx(1.0).epsilon(0.03) );
+  
+  imat D = randi<imat>(500,401, distr_param(-3,7));
+  
+  REQUIRE( D.min() == -3 );
+  REQUIRE( D.max() ==  7 );
+  
+  REQUIRE( mean(conv_to<vec>::from(vectorise(D))) == Approx(2.0).epsilon(0.01) );
+  }
+
+
+
+TEST_CASE("arma_rng_4")
+  {
+  mat A = randg<mat>(500,401, distr_param(3.0,1.5));
+  mat B = randg<mat>(500,401, distr_param(0.5,2.0));
+  
+  REQUIRE( A.min() > 0.0 );
+  REQUIRE( B.min() > 0.0 );
+  
+  // mean is a*b; variance is a*b^2
+  
+  REQUIRE( mean(vectorise(A)) == Approx(4.5  ).epsilon(0.01) );
+  REQUIRE( var(vectorise(A))  == Approx(6.75 ).epsilon(0.03) );
+  REQUIRE( mean(vectorise(B)) == Approx(1.0  ).epsilon(0.02) );
+  REQUIRE( var(vectorise(B))  == Approx(2.0  ).epsilon(0.05) );
+  }
+
+
+
+#if defined(_OPENMP)
+
+TEST_CASE("arma_rng_5")
+  {
+  // the values must not depend on the number of threads used for filling
+  
+  const int orig_n_threads = omp_get_max_threads();
+  
+  omp_set_num_threads(1);
+  
+  arma_rng::set_seed(456);
+  
+  mat  A1 = randu<mat>(700,301);
+  mat  B1 = randn<mat>(700,301);
+  imat C1 = randi<imat>(700,301, distr_param(-5,5));
+  mat  D1 = randg<mat>(700,301, distr_param(2.0,1.0));
+  
+  const int n_threads[] = { 2, 3, 4, 7 };
+  
+  for(uword i=0; i < 4; ++i)
+    {
+    omp_set_num_threads(n_threads[i]);
+    
+    arma_rng::set_seed(456);
+    
+    mat  A2 = randu<mat>(700,301);
+    mat  B2 = randn<mat>(700,301);
+    imat C2 = randi<imat>(700,301, distr_param(-5,5));
+    mat  D2 = randg<mat>(700,301, distr_param(2.0,1.0));
+    
+    REQUIRE( approx_equal(A1, A2, "absdiff", 0.0) );
+    REQUIRE( approx_equal(B1, B2, "absdiff", 0.0) );
+    REQUIRE( accu(C1 != C2) == 0 );
+    REQUIRE( approx_equal(D1, D2, "absdiff", 0.0) );
+    }
+  
+  omp_set_num_threads(orig_n_threads);
+  }
+
+#endif
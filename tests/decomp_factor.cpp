@@ -0,0 +1,166 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+TEST_CASE("decomp_lu_factor_1")
+  {
+  mat A = 
+    "\
+     0.061198   0.201990   0.019678  -0.493936  -0.126745;\
+     0.437242   0.058956  -0.149362  -0.045465   0.296153;\
+    -0.492474  -0.031309   0.314156   0.419733   0.068317;\
+     0.336352   0.411541   0.458476  -0.393139  -0.135040;\
+     0.239585  -0.428913  -0.406953  -0.291020  -0.353768;\
+    ";
+  
+  mat B = 
+    "\
+     0.1  0.2;\
+    -0.3  0.4;\
+     0.5 -0.6;\
+     0.7  0.8;\
+    -0.9  1.0;\
+    ";
+  
+  lu_factor<double> F(A);
+  
+  mat X1 = F.solve(B);
+  mat X2 = solve(A, B);
+  
+  vec x3;
+  bool status = F.solve(x3, B.col(1));
+  
+  REQUIRE( status == true );
+  REQUIRE( accu(abs(X1 - X2))        == Approx(0.0) );
+  REQUIRE( accu(abs(x3 - X2.col(1))) == Approx(0.0) );
+  REQUIRE( accu(abs(A*X1 - B))       == Approx(0.0) );
+  }
+
+
+
+TEST_CASE("decomp_lu_factor_2")
+  {
+  mat A(4, 4, fill::zeros);
+  
+  lu_factor<double> F;
+  
+  REQUIRE( F.factorise(A) == false );
+  REQUIRE( F.is_empty()   == true  );
+  }
+
+
+
+TEST_CASE("decomp_chol_factor_1")
+  {
+  mat A = 
+    "\
+     0.061198   0.201990   0.019678  -0.493936  -0.126745;\
+     0.437242   0.058956  -0.149362  -0.045465   0.296153;\
+    -0.492474  -0.031309   0.314156   0.419733   0.068317;\
+     0.336352   0.411541   0.458476  -0.393139  -0.135040;\
+     0.239585  -0.428913  -0.406953  -0.291020  -0.353768;\
+    ";
+  
+  A = A*A.t();
+  
+  vec b = linspace<vec>(-1.0, 1.0, 5);
+  vec x = linspace<vec>( 0.2, 0.6, 5);
+  
+  chol_factor<double> F(A);
+  
+  REQUIRE( accu(abs(F.R - chol(A)))        == Approx(0.0) );
+  REQUIRE( accu(abs(F.solve(b) - solve(A,b))) == Approx(0.0) );
+  
+  REQUIRE( F.update(x) == true );
+  
+  REQUIRE( accu(abs(F.R - chol(A + x*x.t()))) == Approx(0.0) );
+  
+  REQUIRE( F.downdate(x) == true );
+  
+  REQUIRE( accu(abs(F.R - chol(A))) == Approx(0.0) );
+  
+  // downdating by a large vector results in a matrix which is not positive definite
+  
+  mat R_orig = F.R;
+  
+  REQUIRE( F.downdate(10.0*x) == false );
+  REQUIRE( accu(abs(F.R - R_orig)) == Approx(0.0) );
+  }
+
+
+
+TEST_CASE("decomp_chol_factor_2")
+  {
+  cx_mat A = 
+    { 
+    { cx_double( 0.111205, +0.074101), cx_double(-0.225872, -0.068474), cx_double(-0.192660, +0.236887), cx_double( 0.355204, -0.355735) },
+    { cx_double( 0.119869, +0.217667), cx_double(-0.412722, +0.366157), cx_double( 0.069916, -0.222238), cx_double( 0.234987, -0.072355) },
+    { cx_double( 0.003791, +0.183253), cx_double(-0.212887, -0.172758), cx_double( 0.168689, -0.393418), cx_double( 0.008795, -0.289654) },
+    { cx_double(-0.331639, -0.166660), cx_double( 0.436969, -0.313498), cx_double(-0.431574, +0.017421), cx_double(-0.104165, +0.145246) }
+    };
+  
+  A = A*A.t();
+  
+  cx_vec x = { cx_double(0.1, 0.2), cx_double(-0.3, 0.1), cx_double(0.2, -0.2), cx_double(0.05, 0.3) };
+  
+  chol_factor<cx_double> F(A);
+  
+  REQUIRE( F.update(x) == true );
+  
+  REQUIRE( accu(abs(F.R - chol(A + x*x.t()))) == Approx(0.0) );
+  
+  REQUIRE( F.downdate(x) == true );
+  
+  REQUIRE( accu(abs(F.R - chol(A))) == Approx(0.0) );
+  }
+
+
+
+TEST_CASE("decomp_qr_factor_1")
+  {
+  mat A = 
+    "\
+     0.061198   0.201990   0.019678;\
+     0.437242   0.058956  -0.149362;\
+    -0.492474  -0.031309   0.314156;\
+     0.336352   0.411541   0.458476;\
+     0.239585  -0.428913  -0.406953;\
+    ";
+  
+  mat B = 
+    "\
+     0.1  0.2;\
+    -0.3  0.4;\
+     0.5 -0.6;\
+     0.7  0.8;\
+    -0.9  1.0;\
+    ";
+  
+  qr_factor<double> F(A);
+  
+  mat X1 = F.solve(B);
+  mat X2 = solve(A, B);
+  
+  REQUIRE( X1.n_rows == 3 );
+  REQUIRE( X1.n_cols == 2 );
+  REQUIRE( accu(abs(X1 - X2)) == Approx(0.0) );
+  
+  cx_mat C = cx_mat(A, 0.5*A);
+  cx_mat D = cx_mat(B, B);
+  
+  qr_factor<cx_double> G(C);
+  
+  REQUIRE( accu(abs(G.solve(D) - solve(C, D))) == Approx(0.0) );
+  }
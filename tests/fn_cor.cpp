@@ -67,3 +67,53 @@ TEST_CASE("fn_cor_2")
   REQUIRE( accu(abs(cor(A,B) - AA)) == Approx(0.0).epsilon(0.0001) );
   REQUIRE( accu(abs(cor(A,C) - AC)) == Approx(0.0).epsilon(0.0001) );
   }
+
+
+
+TEST_CASE("fn_cor_3")
+  {
+  mat A = randn<mat>(1000,6);
+  mat B = randn<mat>(1000,3);
+  
+  const mat C  = cov(A);
+  const vec sd = sqrt(C.diag());
+  
+  const mat R = C / (sd * trans(sd));
+  
+  REQUIRE( approx_equal(cor(A),   R, "absdiff", 1e-12) );
+  REQUIRE( approx_equal(cor(A,1), R, "absdiff", 1e-12) );
+  
+  const mat RAB = cov(A,B) / (trans(stddev(A)) * stddev(B));
+  
+  REQUIRE( approx_equal(cor(A,B),   RAB, "absdiff", 1e-12) );
+  REQUIRE( approx_equal(cor(A,B,1), RAB, "absdiff", 1e-12) );
+  }
+
+
+
+TEST_CASE("fn_cor_4")
+  {
+  mat A = randn<mat>(80,3);
+  
+  A(2,0) = datum::nan;
+  A(5,2) = datum::nan;
+  
+  const mat R = cor(A, 0, "pairwise");
+  
+  bool ok = true;
+  
+  for(uword i=0; i < A.n_cols; ++i)
+  for(uword j=0; j < A.n_cols; ++j)
+    {
+    const uvec rows = find_finite(A.col(i) % A.col(j));
+    
+    const vec a = A.col(i);
+    const vec b = A.col(j);
+    
+    const mat ref = cor( vec(a.elem(rows)), vec(b.elem(rows)) );
+    
+    if(std::abs(R(i,j) - ref(0,0)) > 1e-12)  { ok = false; }
+    }
+  
+  REQUIRE( ok );
+  }
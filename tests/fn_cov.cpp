@@ -67,3 +67,65 @@ TEST_CASE("fn_cov_2")
   REQUIRE( accu(abs(cov(A,B) - AB)) == Approx(0.0) );
   REQUIRE( accu(abs(cov(A,C) - AC)) == Approx(0.0) );
   }
+
+
+
+TEST_CASE("fn_cov_3")
+  {
+  mat A = randn<mat>(3000,12);
+  mat B = randn<mat>(3000,5);
+  
+  A += 1e4;
+  
+  const mat Ac = A.each_row() - mean(A);
+  const mat Bc = B.each_row() - mean(B);
+  
+  const mat AA = (trans(Ac) * Ac) / 2999.0;
+  const mat AB = (trans(Ac) * Bc) / 2999.0;
+  
+  REQUIRE( approx_equal(cov(A),   AA,                   "absdiff", 1e-10) );
+  REQUIRE( approx_equal(cov(A,1), AA * (2999.0/3000.0), "absdiff", 1e-10) );
+  REQUIRE( approx_equal(cov(A,B), AB,                   "absdiff", 1e-10) );
+  
+  cx_mat C = randn<cx_mat>(200,4);
+  
+  const cx_mat Cc = C.each_row() - mean(C);
+  
+  REQUIRE( approx_equal(cov(C), cx_mat(trans(Cc) * Cc / 199.0), "absdiff", 1e-10) );
+  }
+
+
+
+TEST_CASE("fn_cov_4")
+  {
+  mat A = randn<mat>(100,4);
+  
+  A(3,1) = datum::nan;
+  A(7,2) = datum::nan;
+  A(8,2) = datum::nan;
+  
+  REQUIRE( mat(cov(A)).has_nan() );
+  
+  const mat C = cov(A, 0, "pairwise");
+  
+  REQUIRE( C.is_finite() );
+  
+  bool ok = true;
+  
+  for(uword i=0; i < A.n_cols; ++i)
+  for(uword j=0; j < A.n_cols; ++j)
+    {
+    const uvec rows = find_finite(A.col(i) % A.col(j));
+    
+    const vec a = A.col(i);
+    const vec b = A.col(j);
+    
+    const mat ref = cov( vec(a.elem(rows)), vec(b.elem(rows)) );
+    
+    if(std::abs(C(i,j) - ref(0,0)) > 1e-12)  { ok = false; }
+    }
+  
+  REQUIRE( ok );
+  
+  REQUIRE( approx_equal(cov(A.cols(0,0), 0, "pairwise"), cov(A.cols(0,0)), "absdiff", 1e-12) );
+  }
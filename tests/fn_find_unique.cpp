@@ -90,3 +90,47 @@ TEST_CASE("fn_find_unique_2")
   
   // REQUIRE_THROWS(  );
   }
+
+
+
+TEST_CASE("fn_find_unique_3")
+  {
+  // large inputs with few distinct values
+  
+  ivec A = randi<ivec>(100000, distr_param(-200, 200));
+  
+  A(10) = 1000;
+  A(99999) = -1000;
+  
+  mat B = round(10.0 * randn<mat>(500, 200));
+  
+  B(0) = -0.0;
+  B(1) =  0.0;
+  
+  const ivec A_sorted = sort(A);
+  const vec  B_sorted = sort(vectorise(B));
+  
+  const ivec A_unique = unique(A);
+  const vec  B_unique = unique(B);
+  
+  const uvec A_indices = find_unique(A);
+  const uvec B_indices = find_unique(B, false);
+  
+  REQUIRE( A_unique.n_elem == (accu(diff(A_sorted) != 0) + 1) );
+  REQUIRE( B_unique.n_elem == (accu(diff(B_sorted) != 0) + 1) );
+  
+  REQUIRE( A_unique(0) == -1000 );
+  REQUIRE( A_unique(A_unique.n_elem-1) == 1000 );
+  
+  REQUIRE( all(diff(A_unique) > 0) );
+  REQUIRE( all(diff(B_unique) > 0) );
+  
+  REQUIRE( A_indices.n_elem == A_unique.n_elem );
+  REQUIRE( B_indices.n_elem == B_unique.n_elem );
+  
+  REQUIRE( all(diff(A_indices) > 0) );
+  
+  REQUIRE( all(sort(A.elem(A_indices)) == A_unique) );
+  
+  REQUIRE( approx_equal(vec(B.elem(B_indices)), B_unique, "absdiff", 0.0) );
+  }
@@ -0,0 +1,93 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+TEST_CASE("fn_histc_1")
+  {
+  const vec x = { -1.0, 0.0, 0.5, 1.0, 1.5, 2.0, 2.5, 3.0, 3.5, 10.0, Datum<double>::nan, -Datum<double>::inf };
+  
+  const vec edges = { 0.0, 1.0, 2.0, 3.0 };
+  
+  const uvec h = histc(x, edges);
+  
+  REQUIRE( h.n_elem == 4 );
+  
+  REQUIRE( h(0) == 2 );
+  REQUIRE( h(1) == 2 );
+  REQUIRE( h(2) == 2 );
+  REQUIRE( h(3) == 1 );  // only values equal to the last edge
+  
+  // edges which are not evenly spaced, including an empty bin
+  
+  const vec edges2 = { -1.0, 0.25, 0.25, 1.75, 3.0 };
+  
+  const uvec h2 = histc(x, edges2);
+  
+  REQUIRE( h2(0) == 2 );
+  REQUIRE( h2(1) == 0 );
+  REQUIRE( h2(2) == 3 );
+  REQUIRE( h2(3) == 2 );
+  REQUIRE( h2(4) == 1 );
+  }
+
+
+
+TEST_CASE("fn_histc_2")
+  {
+  // compare against counting via find()
+  
+  const vec x = 3.0 * randn<vec>(100000);
+  
+  const vec edges_a = linspace<vec>(-4.0, 4.0, 33);
+  const vec edges_b = sort(2.0 * randn<vec>(50));
+  
+  const uvec h_a = histc(x, edges_a);
+  const uvec h_b = histc(x, edges_b);
+  
+  bool ok = true;
+  
+  for(uword i=0; i < edges_a.n_elem-1; ++i)
+    {
+    ok = ok && ( h_a(i) == uvec(find( (x >= edges_a(i)) && (x < edges_a(i+1)) )).n_elem );
+    }
+  
+  for(uword i=0; i < edges_b.n_elem-1; ++i)
+    {
+    ok = ok && ( h_b(i) == uvec(find( (x >= edges_b(i)) && (x < edges_b(i+1)) )).n_elem );
+    }
+  
+  REQUIRE( ok );
+  
+  // hist(): nearest center
+  
+  const vec centers = sort(randn<vec>(20));
+  
+  const uvec g = hist(x, centers);
+  
+  uvec g_ref(centers.n_elem, fill::zeros);
+  
+  for(uword i=0; i < x.n_elem; ++i)
+    {
+    const vec dist = abs(centers - x(i));
+    
+    uword j;
+    
+    dist.min(j);
+    
+    g_ref(j)++;
+    }
+  
+  REQUIRE( all(g == g_ref) );
+  }
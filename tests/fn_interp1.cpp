@@ -45,3 +45,160 @@ TEST_CASE("fn_interp1_1")
   
   // REQUIRE_THROWS(  );
   }
+
+
+
+TEST_CASE("fn_interp1_2")
+  {
+  // strongly non-uniform grid and unsorted query points
+  
+  vec x = exp( linspace<vec>(0, 8, 200) );
+  vec y = randn<vec>(200);
+  
+  vec xi = 3000.0 * randu<vec>(1000) - 10.0;
+  
+  vec yi_linear;
+  vec yi_nearest;
+  
+  interp1(x, y, xi, yi_linear,  "linear" );
+  interp1(x, y, xi, yi_nearest, "nearest");
+  
+  bool ok = true;
+  
+  for(uword i=0; i < xi.n_elem; ++i)
+    {
+    const double val = xi(i);
+    
+    if( (val < x(0)) || (val > x(x.n_elem-1)) )
+      {
+      if( (arma_isnan(yi_linear(i)) == false) || (arma_isnan(yi_nearest(i)) == false) )  { ok = false; }
+      
+      continue;
+      }
+    
+    uword k = 0;
+    
+    while( ((k+2) < x.n_elem) && (val > x(k+1)) )  { ++k; }
+    
+    const double w = (val - x(k)) / (x(k+1) - x(k));
+    
+    const double linear_gt  = (1.0 - w)*y(k) + w*y(k+1);
+    const double nearest_gt = ( (val - x(k)) <= (x(k+1) - val) ) ? y(k) : y(k+1);
+    
+    if( std::abs(yi_linear(i) - linear_gt) > 1e-10 )  { ok = false; }
+    if( yi_nearest(i) != nearest_gt )                  { ok = false; }
+    }
+  
+  REQUIRE( ok );
+  }
+
+
+
+TEST_CASE("fn_interp1_3")
+  {
+  // a cubic spline with not-a-knot end conditions reproduces a cubic polynomial
+  
+  vec x = { 0.0, 0.7, 1.1, 2.5, 3.0, 4.2, 5.0 };
+  vec y = 1.0 + x % (0.5 - x % (0.3 - 0.05*x));
+  
+  vec xi = linspace<vec>(0, 5, 37);
+  vec yi;
+  
+  interp1(x, y, xi, yi, "spline");
+  
+  vec yi_gt = 1.0 + xi % (0.5 - xi % (0.3 - 0.05*xi));
+  
+  REQUIRE( approx_equal(yi, yi_gt, "absdiff", 1e-12) );
+  
+  // pchip preserves monotonicity
+  
+  vec xm = linspace<vec>(0, 10, 11);
+  vec ym = { 0, 0, 0, 1, 1, 1, 5, 5, 5, 6, 6 };
+  
+  interp1(xm, ym, linspace<vec>(0, 10, 501), yi, "pchip");
+  
+  REQUIRE( all(diff(yi) >= -1e-12) );
+  REQUIRE( yi.min() >= -1e-12 );
+  REQUIRE( yi.max() <=  6.0 + 1e-12 );
+  
+  interp1(linspace<vec>(1,4,4), vec({1, 4, 2, 3}), vec({1.5, 2.5, 3.5}), yi, "pchip");
+  
+  REQUIRE( yi(0) == Approx(3.1875) );
+  REQUIRE( yi(1) == Approx(3.0   ) );
+  REQUIRE( yi(2) == Approx(2.1875) );
+  }
+
+
+
+TEST_CASE("fn_interp1_4")
+  {
+  vec x = linspace<vec>(-3, 7, 101);
+  vec y = sin(x);
+  
+  vec xi = 12.0 * randu<vec>(100000) - 4.0;
+  
+  interp1_grid<double> G(x, y, "spline");
+  
+  REQUIRE( G.n_knots() == 101 );
+  
+  vec yi_a;
+  vec yi_b;
+  
+  G.eval(xi, yi_a, 0.0);
+  
+  interp1(x, y, xi, yi_b, "spline", 0.0);
+  
+  REQUIRE( approx_equal(yi_a, yi_b, "absdiff", 0.0) );
+  
+  REQUIRE( approx_equal(yi_a(find(abs(xi - 2.0) <= 5.0)), sin(xi(find(abs(xi - 2.0) <= 5.0))), "absdiff", 1e-5) );
+  
+  mat XI = reshape(xi.head(60), 6, 10);
+  mat YI;
+  
+  G.eval(XI, YI, 0.0);
+  
+  REQUIRE( YI.n_rows ==  6 );
+  REQUIRE( YI.n_cols == 10 );
+  
+  REQUIRE( approx_equal(vectorise(YI), yi_a.head(60), "absdiff", 0.0) );
+  
+  G.eval(XI, XI, 0.0);
+  
+  REQUIRE( approx_equal(XI, YI, "absdiff", 0.0) );
+  }
+
+
+
+TEST_CASE("fn_interp1_5")
+  {
+  // non-uniform grid; a copy of the grid must not depend on the original
+  
+  vec x = exp( linspace<vec>(0.0, 3.0, 50) );
+  vec y = log(x);
+  
+  vec xi = linspace<vec>(1.0, x.max(), 1000);
+  
+  vec yi_a;
+  vec yi_b;
+  
+  interp1(x, y, xi, yi_a, "linear");
+  
+  interp1_grid<double>* G = new interp1_grid<double>(x, y, "linear");
+  
+  interp1_grid<double> H(*G);
+  interp1_grid<double> K;
+  
+  K = *G;
+  
+  delete G;
+  
+  H.eval(xi, yi_b);
+  
+  REQUIRE( approx_equal(yi_a, yi_b, "absdiff", 0.0) );
+  
+  K.eval(xi, yi_b);
+  
+  REQUIRE( approx_equal(yi_a, yi_b, "absdiff", 0.0) );
+  
+  REQUIRE( approx_equal(yi_a, log(xi), "absdiff", 1e-2) );
+  }
@@ -0,0 +1,126 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+namespace
+  {
+  // three well separated clusters, 200 vectors each
+  
+  mat
+  gen_clusters(const mat& centres)
+    {
+    arma_rng::set_seed(123);
+    
+    mat X(centres.n_rows, 3*200);
+    
+    for(uword g=0; g < 3; ++g)
+      {
+      X.cols(g*200, g*200 + 199) = 0.5 * randn<mat>(centres.n_rows, 200);
+      
+      X.cols(g*200, g*200 + 199).each_col() += centres.col(g);
+      }
+    
+    return X;
+    }
+  
+  
+  // maximum distance between each true centre and the nearest found mean
+  
+  double
+  max_centre_error(const mat& means, const mat& centres)
+    {
+    double max_err = 0.0;
+    
+    for(uword g=0; g < centres.n_cols; ++g)
+      {
+      const rowvec dists = sqrt( sum( square(means.each_col() - centres.col(g)), 0 ) );
+      
+      max_err = (std::max)( max_err, dists.min() );
+      }
+    
+    return max_err;
+    }
+  }
+
+
+
+TEST_CASE("fn_kmeans_1")
+  {
+  const mat centres = { { 0.0, 10.0,  0.0 },
+                        { 0.0,  0.0, 10.0 } };
+  
+  const mat X = gen_clusters(centres);
+  
+  mat means;
+  
+  REQUIRE( kmeans(means, X, 3, static_spread, 20, false) );
+  REQUIRE( means.n_cols == 3 );
+  REQUIRE( max_centre_error(means, centres) < 0.2 );
+  
+  REQUIRE( kmeans(means, X, 3, random_pp, 20, false) );
+  REQUIRE( means.n_cols == 3 );
+  REQUIRE( max_centre_error(means, centres) < 0.2 );
+  }
+
+
+
+TEST_CASE("fn_kmeans_2")
+  {
+  // on convergence, each mean must be the mean of the vectors closest to it
+  
+  const mat centres = { { 0.0, 3.0, 1.5 },
+                        { 0.0, 0.0, 2.0 } };
+  
+  const mat X = gen_clusters(centres);
+  
+  mat means;
+  
+  REQUIRE( kmeans(means, X, 5, static_subset, 200, false) );
+  
+  mat ref_means(means.n_rows, means.n_cols, fill::zeros);
+  vec counts(means.n_cols, fill::zeros);
+  
+  for(uword i=0; i < X.n_cols; ++i)
+    {
+    uword g;
+    
+    sum( square(means.each_col() - X.col(i)), 0 ).min(g);
+    
+    ref_means.col(g) += X.col(i);
+    counts(g)++;
+    }
+  
+  ref_means.each_row() /= counts.t();
+  
+  REQUIRE( accu(abs(means - ref_means)) == Approx(0.0).epsilon(1e-8) );
+  }
+
+
+
+TEST_CASE("fn_kmeans_3")
+  {
+  // mini-batch mode
+  
+  const mat centres = { { 0.0, 10.0,  0.0 },
+                        { 0.0,  0.0, 10.0 } };
+  
+  const mat X = gen_clusters(centres);
+  
+  mat means;
+  
+  REQUIRE( kmeans(means, X, 3, random_pp, 50, false, 64) );
+  REQUIRE( means.n_cols == 3 );
+  REQUIRE( max_centre_error(means, centres) < 0.3 );
+  }
@@ -0,0 +1,79 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+TEST_CASE("fn_quantile_1")
+  {
+  const vec V = { 10.0, 2.0, 8.0, 4.0, 6.0 };
+  const vec P = { 0.0, 0.1, 0.25, 0.5, 0.75, 0.9, 1.0 };
+  
+  const vec Q = quantile(V, P);
+  
+  REQUIRE( Q.n_elem == P.n_elem );
+  
+  REQUIRE( Q(0) == Approx( 2.0) );
+  REQUIRE( Q(1) == Approx( 2.0) );
+  REQUIRE( Q(2) == Approx( 3.5) );
+  REQUIRE( Q(3) == Approx( 6.0) );
+  REQUIRE( Q(4) == Approx( 8.5) );
+  REQUIRE( Q(5) == Approx(10.0) );
+  REQUIRE( Q(6) == Approx(10.0) );
+  
+  const rowvec R = quantile(rowvec(V.t()), P);
+  
+  REQUIRE( R.n_elem == P.n_elem );
+  
+  REQUIRE( approx_equal(R, Q.t(), "absdiff", 1e-12) );
+  }
+
+
+
+TEST_CASE("fn_quantile_2")
+  {
+  // compare against interpolation between sorted elements
+  
+  const mat X = randn<mat>(101, 40);
+  const vec P = { 0.02, 0.5, 0.5, 0.97 };
+  
+  const mat Q  = quantile(X, P);
+  const mat Q2 = quantile(2.0 * X, P);
+  const mat Q3 = quantile(X.t(), P, 1);
+  
+  REQUIRE( Q.n_rows  == P.n_elem );
+  REQUIRE( Q.n_cols  == X.n_cols );
+  REQUIRE( Q3.n_rows == X.n_cols );
+  REQUIRE( Q3.n_cols == P.n_elem );
+  
+  const mat S = sort(X);
+  
+  mat Q_ref(P.n_elem, X.n_cols);
+  
+  for(uword j=0; j < P.n_elem; ++j)
+    {
+    const double h       = 101.0 * P(j) + 0.5;
+    const uword  h_floor = uword(std::floor(h));
+    const double w       = h - double(h_floor);
+    
+    Q_ref.row(j) = S.row(h_floor-1) + w * (S.row(h_floor) - S.row(h_floor-1));
+    }
+  
+  REQUIRE( approx_equal(Q,  Q_ref,       "absdiff", 1e-12) );
+  REQUIRE( approx_equal(Q2, 2.0 * Q_ref, "absdiff", 1e-12) );
+  REQUIRE( approx_equal(Q3, Q_ref.t(),   "absdiff", 1e-12) );
+  
+  REQUIRE( approx_equal(Q.row(1), median(X), "absdiff", 1e-12) );
+  
+  REQUIRE( approx_equal(vec(median(X.t(), 1)), Q.row(1).t(), "absdiff", 1e-12) );
+  }
@@ -0,0 +1,94 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+TEST_CASE("fn_shuffle_1")
+  {
+  const uword sizes[] = { 1, 2, 7, 1000, 300000 };
+  
+  bool ok = true;
+  
+  for(uword k=0; k < sizeof(sizes)/sizeof(uword); ++k)
+    {
+    const uword N = sizes[k];
+    
+    const vec A = linspace<vec>(0, double(N-1), N);
+    
+    vec B = shuffle(A);
+    
+    rowvec C = A.t();
+    
+    C = shuffle(C);
+    
+    const uvec P = randperm(N);
+    
+    ok = ok && (B.n_elem == N) && approx_equal(sort(B), A, "absdiff", 0.0);
+    ok = ok && (C.n_elem == N) && approx_equal(sort(C).t(), A, "absdiff", 0.0);
+    ok = ok && (P.n_elem == N) && all(sort(P) == regspace<uvec>(0, N-1));
+    }
+  
+  REQUIRE( ok );
+  
+  const uvec Q = randperm(1000, 10);
+  
+  REQUIRE( Q.n_elem == 10 );
+  REQUIRE( max(Q) < 1000 );
+  REQUIRE( uvec(unique(Q)).n_elem == 10 );
+  
+  REQUIRE_THROWS( randperm(5, 6) );
+  }
+
+
+
+TEST_CASE("fn_shuffle_2")
+  {
+  // element (i,j) is i + 1000*j, so that each row and column can be identified
+  
+  const vec row_ids = regspace<vec>(0, 29);
+  const vec col_ids = regspace<vec>(0, 19);
+  
+  const mat A = repmat(row_ids, 1, 20) + 1000.0 * repmat(col_ids.t(), 30, 1);
+  
+  mat B = shuffle(A, 0);
+  mat C = A;
+  
+  C = shuffle(C, 0);
+  
+  mat D = shuffle(A, 1);
+  mat E = A;
+  
+  E = shuffle(E, 1);
+  
+  // rows (or columns) are moved as a whole
+  
+  const mat row_offsets = A - repmat(A.col(0), 1, A.n_cols);
+  const mat col_offsets = A - repmat(A.row(0), A.n_rows, 1);
+  
+  REQUIRE( approx_equal(B - repmat(B.col(0), 1, B.n_cols), row_offsets, "absdiff", 0.0) );
+  REQUIRE( approx_equal(C - repmat(C.col(0), 1, C.n_cols), row_offsets, "absdiff", 0.0) );
+  REQUIRE( approx_equal(D - repmat(D.row(0), D.n_rows, 1), col_offsets, "absdiff", 0.0) );
+  REQUIRE( approx_equal(E - repmat(E.row(0), E.n_rows, 1), col_offsets, "absdiff", 0.0) );
+  
+  REQUIRE( approx_equal(sort(B.col(0)), row_ids, "absdiff", 0.0) );
+  REQUIRE( approx_equal(sort(C.col(0)), row_ids, "absdiff", 0.0) );
+  REQUIRE( approx_equal(sort(D.row(0)).t(), 1000.0 * col_ids, "absdiff", 0.0) );
+  REQUIRE( approx_equal(sort(E.row(0)).t(), 1000.0 * col_ids, "absdiff", 0.0) );
+  
+  // shuffling a column vector along the columns has no effect
+  
+  const vec v = randu<vec>(10);
+  
+  REQUIRE( approx_equal(vec(shuffle(v, 1)), v, "absdiff", 0.0) );
+  }
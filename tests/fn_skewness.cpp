@@ -0,0 +1,89 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+
+TEST_CASE("fn_skewness_1")
+  {
+  const vec V = { 1.0, 2.0, 3.0, 4.0, 10.0 };
+  
+  REQUIRE( skewness(V)   == Approx(1.697056274847714) );
+  REQUIRE( skewness(V,1) == Approx(1.138419957660617) );
+  REQUIRE( skewness(-V)  == Approx(-1.697056274847714) );
+  
+  REQUIRE( skewness(V.t(), 1) == Approx(1.138419957660617) );
+  
+  REQUIRE( arma_isnan( skewness(vec({ 1.0, 1.0 })) ) );
+  }
+
+
+
+TEST_CASE("fn_skewness_2")
+  {
+  const mat X = randu<mat>(60, 80);
+  
+  const rowvec S0 = skewness(X);
+  const colvec S1 = skewness(X, 1, 1);
+  
+  REQUIRE( S0.n_elem == X.n_cols );
+  REQUIRE( S1.n_elem == X.n_rows );
+  
+  bool ok = true;
+  
+  for(uword col=0; col < X.n_cols; ++col)
+    {
+    if(std::abs(S0(col) - skewness(vec(X.col(col)))) > 1e-10)  { ok = false; }
+    }
+  
+  for(uword row=0; row < X.n_rows; ++row)
+    {
+    const rowvec r  = X.row(row);
+    const rowvec d  = r - mean(r);
+    const double m2 = accu(square(d)) / double(r.n_elem);
+    const double m3 = accu(pow(d,3)) / double(r.n_elem);
+    
+    if(std::abs(S1(row) - m3 / std::pow(m2, 1.5)) > 1e-10)  { ok = false; }
+    }
+  
+  REQUIRE( ok );
+  }
+
+
+
+TEST_CASE("fn_kurtosis_1")
+  {
+  const vec V = { 1.0, 2.0, 3.0, 4.0, 10.0 };
+  
+  REQUIRE( kurtosis(V)   == Approx(6.152) );
+  REQUIRE( kurtosis(V,1) == Approx(2.788) );
+  
+  const mat X = repmat(V, 1, 3);
+  
+  const rowvec K0 = kurtosis(X);
+  const colvec K1 = kurtosis(X.t(), 1, 1);
+  
+  REQUIRE( K0.n_elem == 3 );
+  REQUIRE( K1.n_elem == 3 );
+  
+  REQUIRE( K0(2) == Approx(6.152) );
+  REQUIRE( K1(1) == Approx(2.788) );
+  
+  // large normally distributed sample
+  
+  const vec N = randn<vec>(400000);
+  
+  REQUIRE( std::abs(kurtosis(N,1) - 3.0) < 0.1 );
+  REQUIRE( std::abs(skewness(N))      < 0.05 );
+  }
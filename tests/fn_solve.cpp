@@ -0,0 +1,131 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+// solutions found via the structured solvers are compared against the dense solver,
+// which is used when equilibration is requested
+
+TEST_CASE("fn_solve_band_1")
+  {
+  const uword N = 40;
+  
+  mat A(N, N, fill::zeros);
+  
+  A.diag( 0).fill( 4.0);
+  A.diag(-1) = linspace<vec>(-1.0, -0.5, N-1);
+  A.diag(-2).fill(0.25);
+  A.diag( 1) = linspace<vec>( 0.5,  1.0, N-1);
+  
+  mat B = reshape( linspace<vec>(-1.0, 1.0, 2*N), N, 2 );
+  
+  mat X0 = solve(A, B, solve_opts::equilibrate);
+  mat X1 = solve(A, B);
+  mat X2 = solve(A, B, solve_opts::fast);
+  mat X3 = solve(A, B, solve_opts::band(2,1));
+  
+  REQUIRE( accu(abs(X1 - X0)) == Approx(0.0) );
+  REQUIRE( accu(abs(X2 - X0)) == Approx(0.0) );
+  REQUIRE( accu(abs(X3 - X0)) == Approx(0.0) );
+  
+  // elements outside of the given band are ignored
+  
+  mat AA = A;
+  AA(0, N-1) = 123.0;
+  
+  mat X4 = solve(AA, B, solve_opts::band(2,1));
+  
+  REQUIRE( accu(abs(X4 - X0)) == Approx(0.0) );
+  
+  // bandwidths too large to be stored are found in A
+  
+  mat X5 = solve(A, B, solve_opts::band(std::numeric_limits<uword>::max(), 1));
+  
+  REQUIRE( accu(abs(X5 - X0)) == Approx(0.0) );
+  
+  // two band() options can't be combined
+  
+  REQUIRE_THROWS( solve(A, B, solve_opts::band(2,1) + solve_opts::band(1,2)) );
+  }
+
+
+
+TEST_CASE("fn_solve_tridiag_1")
+  {
+  const uword N = 40;
+  
+  mat A(N, N, fill::zeros);
+  
+  A.diag( 0) = linspace<vec>(3.0, 5.0, N);
+  A.diag(-1).fill(-1.0);
+  A.diag( 1).fill( 0.5);
+  
+  vec b = linspace<vec>(-2.0, 2.0, N);
+  
+  vec x0 = solve(A, b, solve_opts::equilibrate);
+  vec x1 = solve(A, b, solve_opts::fast);
+  
+  REQUIRE( accu(abs(x1 - x0)) == Approx(0.0) );
+  }
+
+
+
+TEST_CASE("fn_solve_diag_1")
+  {
+  mat A = diagmat( linspace<vec>(1.0, 5.0, 40) );
+  
+  vec b = linspace<vec>(-2.0, 2.0, 40);
+  
+  vec x = solve(A, b);
+  
+  REQUIRE( accu(abs(x - (b / A.diag()))) == Approx(0.0) );
+  
+  A(5,5) = 0.0;
+  
+  vec y;
+  bool status = solve(y, A, b, solve_opts::no_approx);
+  
+  REQUIRE( status == false );
+  }
+
+
+
+TEST_CASE("fn_solve_trimat_sympd_1")
+  {
+  mat A = 
+    "\
+     0.061198   0.201990   0.019678  -0.493936  -0.126745;\
+     0.437242   0.058956  -0.149362  -0.045465   0.296153;\
+    -0.492474  -0.031309   0.314156   0.419733   0.068317;\
+     0.336352   0.411541   0.458476  -0.393139  -0.135040;\
+     0.239585  -0.428913  -0.406953  -0.291020  -0.353768;\
+    ";
+  
+  vec b = linspace<vec>(-1.0, 1.0, 5);
+  
+  mat U = trimatu(A);
+  mat L = trimatl(A);
+  mat S = A.t()*A;
+  
+  REQUIRE( accu(abs(solve(U, b) - solve(U, b, solve_opts::equilibrate))) == Approx(0.0) );
+  REQUIRE( accu(abs(solve(L, b) - solve(L, b, solve_opts::equilibrate))) == Approx(0.0) );
+  REQUIRE( accu(abs(solve(S, b) - solve(S, b, solve_opts::equilibrate))) == Approx(0.0) );
+  
+  REQUIRE( accu(abs(solve(S, b, solve_opts::fast) - solve(S, b, solve_opts::equilibrate))) == Approx(0.0) );
+  
+  cx_mat C = cx_mat(S, 0.1*(A - A.t()));  // hermitian
+  cx_vec c = cx_vec(b, b);
+  
+  REQUIRE( accu(abs(solve(C, c) - solve(C, c, solve_opts::equilibrate))) == Approx(0.0) );
+  }
@@ -0,0 +1,126 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+#include <algorithm>
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+TEST_CASE("fn_sort_1")
+  {
+  // large enough to use radix sorting
+  
+  vec a = randn<vec>(20000) * 1000.0;
+  
+  a(0) = -0.0;
+  a(1) = +0.0;
+  a(2) = Datum<double>::inf;
+  a(3) = -Datum<double>::inf;
+  
+  vec b = a;
+  
+  std::sort(b.begin(), b.end());
+  
+  vec c = sort(a);
+  vec d = sort(a, "descend");
+  
+  REQUIRE( all(c == b) );
+  REQUIRE( all(d == flipud(b)) );
+  
+  ivec x = randi<ivec>(30000, distr_param(-50, 50));
+  
+  ivec y = x;
+  
+  std::sort(y.begin(), y.end());
+  
+  REQUIRE( all(sort(x) == y) );
+  
+  fvec f = randu<fvec>(5000) - 0.5f;
+  
+  fvec g = sort(f, "descend");
+  
+  REQUIRE( all(g.head(4999) >= g.tail(4999)) );
+  }
+
+
+
+TEST_CASE("fn_sort_2")
+  {
+  // equal elements must keep their original order
+  
+  ivec x = randi<ivec>(10000, distr_param(0, 9));
+  
+  uvec asc  = stable_sort_index(x);
+  uvec desc = stable_sort_index(x, "descend");
+  
+  bool asc_okay  = true;
+  bool desc_okay = true;
+  
+  for(uword i=1; i < x.n_elem; ++i)
+    {
+    asc_okay  = asc_okay  && ( (x(asc(i-1))  < x(asc(i)))  || ((x(asc(i-1))  == x(asc(i)))  && (asc(i-1)  < asc(i)))  );
+    desc_okay = desc_okay && ( (x(desc(i-1)) > x(desc(i))) || ((x(desc(i-1)) == x(desc(i))) && (desc(i-1) < desc(i))) );
+    }
+  
+  REQUIRE( asc_okay  );
+  REQUIRE( desc_okay );
+  
+  vec z(8000, fill::zeros);
+  
+  z.tail(4000).fill(-0.0);
+  
+  uvec idx = stable_sort_index(z, "descend");
+  
+  REQUIRE( all(idx == regspace<uvec>(0, 7999)) );
+  
+  vec a = randn<vec>(6000);
+  
+  a(100) = Datum<double>::nan;
+  
+  uvec junk;
+  
+  REQUIRE_THROWS( junk = sort_index(a) );
+  }
+
+
+
+TEST_CASE("fn_sort_3")
+  {
+  mat A = randn<mat>(300, 900);
+  
+  mat B = sort(A);
+  mat C = sort(A, "descend", 1);
+  
+  bool col_okay = true;
+  bool row_okay = true;
+  
+  for(uword col=0; col < A.n_cols; ++col)
+    {
+    vec tmp = A.col(col);
+    
+    std::sort(tmp.begin(), tmp.end());
+    
+    col_okay = col_okay && all(B.col(col) == tmp);
+    }
+  
+  for(uword row=0; row < A.n_rows; ++row)
+    {
+    rowvec tmp = A.row(row);
+    
+    std::sort(tmp.begin(), tmp.end());
+    
+    row_okay = row_okay && all(C.row(row) == fliplr(tmp));
+    }
+  
+  REQUIRE( col_okay );
+  REQUIRE( row_okay );
+  }
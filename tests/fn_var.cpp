@@ -0,0 +1,92 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+
+TEST_CASE("fn_var_1")
+  {
+  const vec V = { 1.0, 2.0, 3.0, 4.0, 10.0 };
+  
+  REQUIRE( var(V)              == Approx(12.5) );
+  REQUIRE( var(V,1)            == Approx(10.0) );
+  REQUIRE( stddev(V)           == Approx(std::sqrt(12.5)) );
+  REQUIRE( var(V.t())          == Approx(12.5) );
+  REQUIRE( var(V.subvec(0,3))  == Approx(5.0/3.0) );
+  REQUIRE( var(2.0*V)          == Approx(50.0) );
+  
+  REQUIRE( var(vec({ 7.0 })) == Approx(0.0) );
+  }
+
+
+
+TEST_CASE("fn_var_2")
+  {
+  // large offsets must not cause loss of accuracy
+  
+  const vec A = randn<vec>(10000);
+  const vec B = A + 1e9;
+  
+  const double var_A = accu(square(A - mean(A))) / double(A.n_elem - 1);
+  
+  REQUIRE( var(B) == Approx(var_A).epsilon(1e-6) );
+  REQUIRE( mean(B) - 1e9 == Approx(mean(A)).epsilon(1e-6) );
+  }
+
+
+
+TEST_CASE("fn_var_3")
+  {
+  // statistics of each column and each row
+  
+  const mat X = randn<mat>(300, 500) * 4.0 + 2.0;
+  
+  const rowvec V0 = var(X);
+  const colvec V1 = var(X, 1, 1);
+  const colvec S1 = stddev(X, 0, 1);
+  
+  REQUIRE( V0.n_elem == X.n_cols );
+  REQUIRE( V1.n_elem == X.n_rows );
+  REQUIRE( S1.n_elem == X.n_rows );
+  
+  bool ok = true;
+  
+  for(uword col=0; col < X.n_cols; ++col)
+    {
+    const vec    c = X.col(col);
+    const double m = accu(c) / double(c.n_elem);
+    const double v = accu(square(c - m)) / double(c.n_elem - 1);
+    
+    if(std::abs(V0(col) - v) > 1e-10 * v)  { ok = false; }
+    }
+  
+  for(uword row=0; row < X.n_rows; ++row)
+    {
+    const rowvec r = X.row(row);
+    const double m = accu(r) / double(r.n_elem);
+    const double v = accu(square(r - m)) / double(r.n_elem);
+    const double s = std::sqrt(accu(square(r - m)) / double(r.n_elem - 1));
+    
+    if(std::abs(V1(row) - v) > 1e-10 * v)  { ok = false; }
+    if(std::abs(S1(row) - s) > 1e-10 * s)  { ok = false; }
+    }
+  
+  REQUIRE( ok );
+  
+  const mat E;
+  
+  const rowvec V2 = var(E);
+  
+  REQUIRE( V2.n_elem == 0 );
+  }
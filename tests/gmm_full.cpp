@@ -0,0 +1,138 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+TEST_CASE("gmm_full_1")
+  {
+  // two clusters with correlated dimensions
+  
+  arma_rng::set_seed(123);
+  
+  const mat C0 = { { 2.0,  0.9 }, {  0.9, 1.0 } };
+  const mat C1 = { { 1.0, -0.8 }, { -0.8, 1.0 } };
+  
+  mat X0 = trans(chol(C0)) * randn<mat>(2, 6000);
+  mat X1 = trans(chol(C1)) * randn<mat>(2, 4000);
+  
+  X1.each_col() += vec({ 6.0, 6.0 });
+  
+  const mat X = join_rows(X0, X1);
+  
+  gmm_full model;
+  
+  REQUIRE( model.learn(X, 2, maha_dist, static_spread, 10, 20, 1e-10, false) );
+  
+  const uword g0 = (model.means(0,0) < model.means(0,1)) ? 0 : 1;
+  const uword g1 = 1 - g0;
+  
+  REQUIRE( accu(abs(model.means.col(g0) - vec({0.0, 0.0}))) < 0.15 );
+  REQUIRE( accu(abs(model.means.col(g1) - vec({6.0, 6.0}))) < 0.15 );
+  
+  REQUIRE( accu(abs(model.fcovs.slice(g0) - C0)) < 0.3 );
+  REQUIRE( accu(abs(model.fcovs.slice(g1) - C1)) < 0.3 );
+  
+  REQUIRE( model.hefts(g0) == Approx(0.6).epsilon(0.02) );
+  
+  const urowvec labels = model.assign(X, prob_dist);
+  
+  REQUIRE( accu(labels.cols(0, 5999)     == g0) > 5950 );
+  REQUIRE( accu(labels.cols(6000, 9999)  == g1) > 3950 );
+  }
+
+
+
+TEST_CASE("gmm_full_2")
+  {
+  // log-likelihoods compared against direct evaluation of the density
+  
+  const mat means = { { 0.0, 1.0 }, { 0.0, -1.0 }, { 1.0, 2.0 } };
+  
+  cube fcovs(3, 3, 2);
+  
+  fcovs.slice(0) = { { 1.0, 0.3, 0.1 }, { 0.3, 2.0, 0.2 }, { 0.1, 0.2, 1.5 } };
+  fcovs.slice(1) = { { 0.5, 0.0, 0.1 }, { 0.0, 1.0, 0.4 }, { 0.1, 0.4, 3.0 } };
+  
+  const rowvec hefts = { 0.3, 0.7 };
+  
+  gmm_full model;
+  
+  model.set_params(means, fcovs, hefts);
+  
+  arma_rng::set_seed(123);
+  
+  const mat X = randn<mat>(3, 600);
+  
+  const rowvec log_p_all = model.log_p(X);
+  const rowvec log_p_one = model.log_p(X, 1);
+  
+  for(uword i=0; i < X.n_cols; i += 37)
+    {
+    const vec x = X.col(i);
+    
+    vec lhoods(2);
+    
+    for(uword g=0; g < 2; ++g)
+      {
+      const vec d = x - means.col(g);
+      
+      lhoods(g) = std::exp( -0.5 * as_scalar(d.t() * inv(fcovs.slice(g)) * d) ) / std::sqrt( det(2.0 * datum::pi * fcovs.slice(g)) );
+      }
+    
+    REQUIRE( log_p_all(i)    == Approx( std::log(dot(hefts, lhoods)) ) );
+    REQUIRE( log_p_one(i)    == Approx( std::log(lhoods(1))          ) );
+    REQUIRE( model.log_p(x)  == Approx( log_p_all(i)                 ) );
+    }
+  
+  REQUIRE( model.avg_log_p(X) == Approx( mean(log_p_all) ) );
+  }
+
+
+
+TEST_CASE("gmm_full_3")
+  {
+  // the parameters are unchanged by a save() and load() round trip
+  
+  const mat means = { { 0.0, 1.0 }, { 0.0, -1.0 }, { 1.0, 2.0 } };
+  
+  cube fcovs(3, 3, 2);
+  
+  fcovs.slice(0) = { { 1.0, 0.3, 0.1 }, { 0.3, 2.0, 0.2 }, { 0.1, 0.2, 1.5 } };
+  fcovs.slice(1) = { { 0.5, 0.0, 0.1 }, { 0.0, 1.0, 0.4 }, { 0.1, 0.4, 3.0 } };
+  
+  const rowvec hefts = { 0.3, 0.7 };
+  
+  gmm_full model_a;
+  
+  model_a.set_params(means, fcovs, hefts);
+  
+  const std::string name = "gmm_full_3.bin";
+  
+  REQUIRE( model_a.save(name) );
+  
+  gmm_full model_b;
+  
+  REQUIRE( model_b.load(name) );
+  
+  std::remove(name.c_str());
+  
+  REQUIRE( model_b.means.n_rows   == 3 );
+  REQUIRE( model_b.means.n_cols   == 2 );
+  REQUIRE( model_b.fcovs.n_slices == 2 );
+  REQUIRE( model_b.hefts.n_elem   == 2 );
+  
+  REQUIRE( accu(model_b.means != means) == 0 );
+  REQUIRE( accu(model_b.fcovs != fcovs) == 0 );
+  REQUIRE( accu(model_b.hefts != hefts) == 0 );
+  }
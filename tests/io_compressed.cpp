@@ -0,0 +1,140 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+#include <cstdio>
+#include <sstream>
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+TEST_CASE("io_compressed_1")
+  {
+  const std::string name = "io_compressed_1.bin";
+  
+  mat A = randn<mat>(300,250);
+  
+  A.cols(10,99).zeros();
+  A.col(5).fill(1.25);
+  
+  REQUIRE( A.save(name, arma_compressed) );
+  
+  mat B;
+  
+  REQUIRE( B.load(name) );
+  
+  REQUIRE( B.n_rows == A.n_rows );
+  REQUIRE( B.n_cols == A.n_cols );
+  
+  REQUIRE( approx_equal(A, B, "absdiff", 0.0) );
+  
+  // partial load spanning several compressed blocks
+  
+  mat C;
+  
+  REQUIRE( C.load(name, span(90,200)) );
+  
+  REQUIRE( C.n_cols == 111 );
+  
+  REQUIRE( approx_equal(C, A.cols(90,200), "absdiff", 0.0) );
+  
+  REQUIRE( C.load(name, span(90,250), arma_compressed, false) == false );
+  
+  REQUIRE( A.save(name, arma_binary) );
+  
+  REQUIRE( C.load(name, span(7,8)) );
+  
+  REQUIRE( approx_equal(C, A.cols(7,8), "absdiff", 0.0) );
+  
+  std::remove(name.c_str());
+  }
+
+
+
+TEST_CASE("io_compressed_2")
+  {
+  imat A = randi<imat>(100,80, distr_param(-5,5));
+  
+  std::stringstream ss;
+  
+  REQUIRE( A.save(ss, arma_compressed) );
+  
+  imat B;
+  
+  REQUIRE( B.load(ss) );
+  
+  REQUIRE( accu(A != B) == 0 );
+  
+  cube Q = randu<cube>(4,5,6);
+  
+  std::stringstream ss_cube;
+  
+  REQUIRE( Q.save(ss_cube, arma_compressed) );
+  
+  cube R;
+  
+  REQUIRE( R.load(ss_cube) );
+  
+  REQUIRE( approx_equal(Q, R, "absdiff", 0.0) );
+  
+  sp_mat S = sprandu<sp_mat>(50,40,0.1);
+  
+  std::stringstream ss_sp;
+  
+  REQUIRE( S.save(ss_sp, arma_compressed) );
+  
+  sp_mat T;
+  
+  REQUIRE( T.load(ss_sp, arma_compressed) );
+  
+  REQUIRE( T.n_nonzero == S.n_nonzero );
+  REQUIRE( approx_equal(mat(S), mat(T), "absdiff", 0.0) );
+  
+  field<vec> F(3);
+  
+  F(0) = randu<vec>(3);
+  F(1) = randu<vec>(0);
+  F(2) = randu<vec>(7);
+  
+  std::stringstream ss_field;
+  
+  REQUIRE( F.save(ss_field, arma_compressed) );
+  
+  field<vec> G;
+  
+  REQUIRE( G.load(ss_field) );
+  
+  REQUIRE( G.n_elem == 3 );
+  REQUIRE( G(1).n_elem == 0 );
+  REQUIRE( approx_equal(F(2), G(2), "absdiff", 0.0) );
+  }
+
+
+
+TEST_CASE("io_compressed_3")
+  {
+  std::stringstream ss;
+  
+  mat A = randu<mat>(10,10);
+  
+  REQUIRE( A.save(ss, arma_compressed) );
+  
+  std::string data = ss.str();
+  
+  data.resize(data.size() - 20);
+  
+  std::stringstream ss_short(data);
+  
+  mat B;
+  
+  REQUIRE( B.load(ss_short, auto_detect, false) == false );
+  REQUIRE( B.n_elem == 0 );
+  }
@@ -0,0 +1,92 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+#include <sstream>
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+TEST_CASE("io_mtx_1")
+  {
+  sp_mat A = sprandu<sp_mat>(60,40,0.1);
+  
+  std::stringstream ss;
+  
+  REQUIRE( A.save(ss, mtx_ascii) );
+  
+  sp_mat B;
+  
+  REQUIRE( B.load(ss, mtx_ascii) );
+  
+  REQUIRE( B.n_rows    == A.n_rows    );
+  REQUIRE( B.n_cols    == A.n_cols    );
+  REQUIRE( B.n_nonzero == A.n_nonzero );
+  
+  REQUIRE( approx_equal(mat(A), mat(B), "absdiff", 0.0) );
+  }
+
+
+
+TEST_CASE("io_mtx_2")
+  {
+  std::stringstream ss("%%MatrixMarket matrix coordinate real symmetric\n% comment\n4 4 4\n1 1 2.0\n3 1 -1.5\n4 2 1e1\n3 1 0.5\n");
+  
+  sp_mat A;
+  
+  REQUIRE( A.load(ss, mtx_ascii) );
+  
+  REQUIRE( A.n_rows    == 4 );
+  REQUIRE( A.n_cols    == 4 );
+  REQUIRE( A.n_nonzero == 5 );
+  
+  REQUIRE( A(0,0) == Approx( 2.0) );
+  REQUIRE( A(2,0) == Approx(-1.0) );
+  REQUIRE( A(0,2) == Approx(-1.0) );
+  REQUIRE( A(3,1) == Approx(10.0) );
+  REQUIRE( A(1,3) == Approx(10.0) );
+  
+  std::stringstream ss_cx("%%MatrixMarket matrix coordinate complex hermitian\n2 2 2\n1 1 1 0\n2 1 3 4\n");
+  
+  sp_cx_mat C;
+  
+  REQUIRE( C.load(ss_cx, mtx_ascii) );
+  
+  REQUIRE( C.n_nonzero == 3 );
+  
+  REQUIRE( std::complex<double>(C(1,0)) == std::complex<double>(3.0,  4.0) );
+  REQUIRE( std::complex<double>(C(0,1)) == std::complex<double>(3.0, -4.0) );
+  
+  std::stringstream ss_pattern("%%MatrixMarket matrix coordinate pattern general\n3 5 2\n3 5\n1 2\n");
+  
+  sp_umat P;
+  
+  REQUIRE( P.load(ss_pattern, mtx_ascii) );
+  
+  REQUIRE( P.n_nonzero == 2 );
+  REQUIRE( uword(P(2,4)) == 1 );
+  REQUIRE( uword(P(0,1)) == 1 );
+  }
+
+
+
+TEST_CASE("io_mtx_3")
+  {
+  std::stringstream ss1("%%MatrixMarket matrix coordinate real general\n3 5 2\n3 6 1\n1 2 1\n");
+  std::stringstream ss2("%%MatrixMarket matrix coordinate complex general\n2 2 1\n1 1 1 2\n");
+  std::stringstream ss3("%%MatrixMarket matrix array real general\n2 2\n1\n2\n3\n4\n");
+  
+  sp_mat A;
+  
+  REQUIRE( A.load(ss1, mtx_ascii, false) == false );
+  REQUIRE( A.load(ss2, mtx_ascii, false) == false );
+  REQUIRE( A.load(ss3, mtx_ascii, false) == false );
+  }
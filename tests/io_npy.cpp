@@ -0,0 +1,117 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+#include <cstdio>
+#include <sstream>
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+TEST_CASE("io_npy_1")
+  {
+  const std::string name = "io_npy_1.npy";
+  
+  mat A = randu<mat>(13,7);
+  
+  REQUIRE( A.save(name, npy_binary) );
+  
+  mat B;
+  
+  REQUIRE( B.load(name) );
+  
+  REQUIRE( approx_equal(A, B, "absdiff", 0.0) );
+  
+  mmap_mat<double> X(name);
+  
+  REQUIRE( X.is_mapped() );
+  
+  REQUIRE( approx_equal(A, X.M, "absdiff", 0.0) );
+  
+  X.reset();
+  
+  vec v = randu<vec>(10);
+  
+  REQUIRE( v.save(name, npy_binary) );
+  
+  rowvec r;
+  
+  REQUIRE( r.load(name, npy_binary) );
+  
+  REQUIRE( approx_equal(r, v.t(), "absdiff", 0.0) );
+  
+  cx_cube Q = randu<cx_cube>(4,3,5);
+  
+  REQUIRE( Q.save(name, npy_binary) );
+  
+  cx_cube R;
+  
+  REQUIRE( R.load(name) );
+  
+  REQUIRE( approx_equal(Q, R, "absdiff", 0.0) );
+  
+  REQUIRE( B.load(name, npy_binary, false) == false );
+  
+  std::remove(name.c_str());
+  }
+
+
+
+TEST_CASE("io_npy_2")
+  {
+  // hand written file with big endian 16 bit integers in row-major (C) order, as saved by numpy
+  
+  std::string dict = "{'descr': '>i2', 'fortran_order': False, 'shape': (2, 3), }";
+  
+  dict.append(128 - 10 - dict.length() - 1, ' ');
+  dict.push_back('\n');
+  
+  std::string file("\x93NUMPY\x01\x00", 8);
+  
+  file.push_back( char(dict.length()) );
+  file.push_back( char(0) );
+  
+  file += dict;
+  
+  const short vals[] = { 1, -2, 3, 400, 5, -600 };
+  
+  for(uword i=0; i < 6; ++i)
+    {
+    file.push_back( char((vals[i] >> 8) & 0xFF) );
+    file.push_back( char( vals[i]       & 0xFF) );
+    }
+  
+  std::stringstream ss(file);
+  
+  mat A;
+  
+  REQUIRE( A.load(ss) );
+  
+  REQUIRE( A.n_rows == 2 );
+  REQUIRE( A.n_cols == 3 );
+  
+  REQUIRE( A(0,0) ==    1.0 );
+  REQUIRE( A(0,1) ==   -2.0 );
+  REQUIRE( A(0,2) ==    3.0 );
+  REQUIRE( A(1,0) ==  400.0 );
+  REQUIRE( A(1,1) ==    5.0 );
+  REQUIRE( A(1,2) == -600.0 );
+  
+  std::stringstream ss_cube(file);
+  
+  icube Q;
+  
+  REQUIRE( Q.load(ss_cube, npy_binary) );
+  
+  REQUIRE( Q.n_slices == 1 );
+  
+  REQUIRE( Q(1,2,0) == -600 );
+  }
@@ -0,0 +1,129 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+#include <cstdio>
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+TEST_CASE("io_partial_1")
+  {
+  const std::string name = "io_partial_1.bin";
+
+  mat A = randu<mat>(40,30);
+
+  REQUIRE( A.save(name, arma_binary) );
+
+  mat B;
+
+  REQUIRE( B.load(name, span(5,9), span(10,19)) );
+
+  REQUIRE( B.n_rows == 5  );
+  REQUIRE( B.n_cols == 10 );
+
+  REQUIRE( approx_equal(B, A.submat(5,10,9,19), "absdiff", 0.0) );
+
+  REQUIRE( B.load(name, span(35,40), span::all, auto_detect, false) == false );
+
+  REQUIRE( A.save(name, arma_compressed) );
+
+  REQUIRE( B.load(name, span(0,0), span(29,29)) );
+
+  REQUIRE( B.n_elem == 1 );
+
+  REQUIRE( B(0,0) == A(0,29) );
+
+  std::remove(name.c_str());
+  }
+
+
+
+TEST_CASE("io_partial_2")
+  {
+  const std::string name = "io_partial_2.bin";
+
+  cube Q = randu<cube>(6,7,12);
+
+  REQUIRE( Q.save(name, arma_binary) );
+
+  cube R;
+
+  REQUIRE( R.load(name, span(3,5)) );
+
+  REQUIRE( R.n_rows   == 6 );
+  REQUIRE( R.n_cols   == 7 );
+  REQUIRE( R.n_slices == 3 );
+
+  REQUIRE( approx_equal(R, Q.slices(3,5), "absdiff", 0.0) );
+
+  REQUIRE( Q.save(name, arma_compressed) );
+
+  REQUIRE( R.load(name, span(11,11)) );
+
+  REQUIRE( approx_equal(R, Q.slices(11,11), "absdiff", 0.0) );
+
+  REQUIRE( R.load(name, span(10,12), auto_detect, false) == false );
+
+  std::remove(name.c_str());
+  }
+
+
+
+#if defined(ARMA_USE_HDF5)
+
+TEST_CASE("io_partial_3")
+  {
+  const std::string name = "io_partial_3.h5";
+
+  mat A = randu<mat>(200,150);
+
+  A.cols(0,99).zeros();
+
+  REQUIRE( A.save(name, hdf5_binary_compressed) );
+
+  mat B;
+
+  REQUIRE( B.load(name) );
+
+  REQUIRE( approx_equal(A, B, "absdiff", 0.0) );
+
+  REQUIRE( B.load(name, span(20,49), span(90,109)) );
+
+  REQUIRE( B.n_rows == 30 );
+  REQUIRE( B.n_cols == 20 );
+
+  REQUIRE( approx_equal(B, A.submat(20,90,49,109), "absdiff", 0.0) );
+
+  fmat C;
+
+  REQUIRE( C.load(name, span::all, span(140,149), hdf5_binary) );
+
+  REQUIRE( approx_equal(C, conv_to<fmat>::from(A.cols(140,149)), "absdiff", 0.0f) );
+
+  REQUIRE( B.load(name, span(0,200), span::all, hdf5_binary, false) == false );
+
+  cube Q = randu<cube>(5,4,8);
+
+  REQUIRE( Q.save(name, hdf5_binary_compressed) );
+
+  cube R;
+
+  REQUIRE( R.load(name, span(2,6)) );
+
+  REQUIRE( R.n_slices == 5 );
+
+  REQUIRE( approx_equal(R, Q.slices(2,6), "absdiff", 0.0) );
+
+  std::remove(name.c_str());
+  }
+
+#endif
@@ -0,0 +1,203 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+#include <sstream>
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+TEST_CASE("io_serialise_1")
+  {
+  mat A = randu<mat>(13,7);
+  
+  const uword n_bytes = A.serialised_size();
+  
+  podarray<double> buf_mem( (n_bytes + sizeof(double) - 1) / sizeof(double) );
+  
+  void* buf = buf_mem.memptr();
+  
+  REQUIRE( A.serialise(buf, n_bytes - 1) == 0 );
+  REQUIRE( A.serialise(buf, n_bytes)     == n_bytes );
+  
+  // same layout as save() into a stream
+  
+  std::stringstream ss;
+  
+  REQUIRE( A.save(ss, arma_binary) );
+  
+  REQUIRE( ss.str() == std::string(static_cast<const char*>(buf), n_bytes) );
+  
+  mat B;
+  
+  REQUIRE( B.deserialise(buf, n_bytes) );
+  
+  REQUIRE( approx_equal(A, B, "absdiff", 0.0) );
+  
+  // without copying
+  
+  mat C;
+  
+  REQUIRE( C.deserialise(buf, n_bytes, false) );
+  
+  REQUIRE( approx_equal(A, C, "absdiff", 0.0) );
+  
+  REQUIRE( C.memptr() == reinterpret_cast<const double*>(static_cast<const char*>(buf) + (n_bytes - A.n_elem*sizeof(double))) );
+  
+  // truncated or wrong data
+  
+  REQUIRE( B.deserialise(buf, n_bytes - 8) == false );
+  REQUIRE( B.n_elem == 0 );
+  
+  fmat D;
+  
+  REQUIRE( D.deserialise(buf, n_bytes) == false );
+  }
+
+
+
+TEST_CASE("io_serialise_2")
+  {
+  cube Q = randu<cube>(4,3,5);
+  
+  std::vector<char> buf_q(Q.serialised_size());
+  
+  REQUIRE( Q.serialise(&buf_q[0], buf_q.size()) == buf_q.size() );
+  
+  std::stringstream ss;
+  
+  REQUIRE( Q.save(ss, arma_binary) );
+  
+  REQUIRE( ss.str() == std::string(&buf_q[0], buf_q.size()) );
+  
+  cube R;
+  
+  REQUIRE( R.deserialise(&buf_q[0], buf_q.size()) );
+  
+  REQUIRE( approx_equal(Q, R, "absdiff", 0.0) );
+  
+  sp_mat S = sprandu<sp_mat>(50, 40, 0.1);
+  
+  std::vector<char> buf_s(S.serialised_size());
+  
+  REQUIRE( S.serialise(&buf_s[0], buf_s.size()) == buf_s.size() );
+  
+  sp_mat T;
+  
+  REQUIRE( T.deserialise(&buf_s[0], buf_s.size()) );
+  
+  REQUIRE( T.n_nonzero == S.n_nonzero );
+  
+  REQUIRE( approx_equal(mat(S), mat(T), "absdiff", 0.0) );
+  
+  // buffers can also be read via load()
+  
+  std::stringstream ss_s( std::string(&buf_s[0], buf_s.size()) );
+  
+  sp_mat U;
+  
+  REQUIRE( U.load(ss_s, arma_binary) );
+  
+  REQUIRE( approx_equal(mat(S), mat(U), "absdiff", 0.0) );
+  }
+
+
+
+TEST_CASE("io_serialise_3")
+  {
+  field<vec> F(2,3);
+  
+  for(uword i=0; i < F.n_elem; ++i)  { F[i] = randu<vec>(i+1); }
+  
+  std::vector<char> buf(F.serialised_size());
+  
+  REQUIRE( F.serialise(&buf[0], buf.size()) == buf.size() );
+  
+  field<vec> G;
+  
+  REQUIRE( G.deserialise(&buf[0], buf.size(), false) );
+  
+  REQUIRE( G.n_rows == 2 );
+  REQUIRE( G.n_cols == 3 );
+  
+  for(uword i=0; i < F.n_elem; ++i)
+    {
+    REQUIRE( approx_equal(F[i], G[i], "absdiff", 0.0) );
+    }
+  
+  REQUIRE( G.deserialise(&buf[0], buf.size() - 1) == false );
+  }
+
+
+
+TEST_CASE("io_serialise_4")
+  {
+  // read-only buffers are always copied
+  
+  mat A = randu<mat>(6,5);
+  
+  std::vector<char> buf(A.serialised_size());
+  
+  REQUIRE( A.serialise(&buf[0], buf.size()) == buf.size() );
+  
+  const char* buf_ro = &buf[0];
+  
+  mat B;
+  
+  REQUIRE( B.deserialise(buf_ro, buf.size()) );
+  
+  REQUIRE( approx_equal(A, B, "absdiff", 0.0) );
+  
+  const bool is_copy = (B.memptr() < reinterpret_cast<const double*>(buf_ro)) || (B.memptr() >= reinterpret_cast<const double*>(buf_ro + buf.size()));
+  
+  REQUIRE( is_copy );
+  }
+
+
+
+TEST_CASE("io_serialise_5")
+  {
+  // headers with dimensions whose size in bytes doesn't fit into a uword
+  
+  std::vector<char> buf(256, char(0));
+  
+  std::ostringstream huge;
+  
+  huge << (ARMA_MAX_UWORD / 2 + 1);
+  
+  const std::string h_mat  = "ARMA_MAT_BIN_FN008\n" + huge.str() + " 2\n";
+  const std::string h_cube = "ARMA_CUB_BIN_FN008\n" + huge.str() + " 1 2\n";
+  const std::string h_sp   = "ARMA_SPM_BIN_FN008\n2 2 " + huge.str() + "\n";
+  const std::string h_big  = "ARMA_MAT_BIN_FN008\n1 " + huge.str() + "0\n";
+  
+  mat    A;
+  cube   Q;
+  sp_mat S;
+  
+  std::copy(h_mat.begin(), h_mat.end(), buf.begin());
+  
+  REQUIRE( A.deserialise(&buf[0], buf.size(), false) == false );
+  REQUIRE( A.n_elem == 0 );
+  
+  std::copy(h_cube.begin(), h_cube.end(), buf.begin());
+  
+  REQUIRE( Q.deserialise(&buf[0], buf.size(), false) == false );
+  REQUIRE( Q.n_elem == 0 );
+  
+  std::copy(h_sp.begin(), h_sp.end(), buf.begin());
+  
+  REQUIRE( S.deserialise(&buf[0], buf.size()) == false );
+  REQUIRE( S.n_nonzero == 0 );
+  
+  std::copy(h_big.begin(), h_big.end(), buf.begin());
+  
+  REQUIRE( A.deserialise(&buf[0], buf.size()) == false );
+  }
@@ -0,0 +1,133 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+#include <sstream>
+#include <locale>
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+TEST_CASE("io_text_1")
+  {
+  mat A = randu<mat>(20,7) - 0.5;
+  
+  A(3,4) = 1e-300;
+  A(5,1) = 123456789.0;
+  
+  std::stringstream ss_csv;
+  std::stringstream ss_raw;
+  
+  REQUIRE( A.save(ss_csv, csv_ascii) );
+  REQUIRE( A.save(ss_raw, raw_ascii) );
+  
+  mat B;
+  mat C;
+  
+  REQUIRE( B.load(ss_csv, csv_ascii) );
+  REQUIRE( C.load(ss_raw, raw_ascii) );
+  
+  REQUIRE( B.n_rows == A.n_rows );
+  REQUIRE( B.n_cols == A.n_cols );
+  REQUIRE( C.n_rows == A.n_rows );
+  REQUIRE( C.n_cols == A.n_cols );
+  
+  REQUIRE( approx_equal(A, B, "reldiff", 1e-12) );
+  REQUIRE( approx_equal(A, C, "reldiff", 1e-12) );
+  }
+
+
+
+TEST_CASE("io_text_2")
+  {
+  std::stringstream ss("1,,3\r\nnan,-Inf,.5\r\n-2e3,1E-2,7\r\n");
+  
+  mat A;
+  
+  REQUIRE( A.load(ss, csv_ascii) );
+  
+  REQUIRE( A.n_rows == 3 );
+  REQUIRE( A.n_cols == 3 );
+  
+  REQUIRE( A(0,0) == Approx(1.0) );
+  REQUIRE( A(0,1) == Approx(0.0) );
+  REQUIRE( A(0,2) == Approx(3.0) );
+  REQUIRE( arma_isnan(A(1,0)) );
+  REQUIRE( A(1,1) == -Datum<double>::inf );
+  REQUIRE( A(1,2) == Approx(0.5) );
+  REQUIRE( A(2,0) == Approx(-2000.0) );
+  REQUIRE( A(2,1) == Approx(0.01) );
+  REQUIRE( A(2,2) == Approx(7.0) );
+  
+  std::stringstream ss_u("1 2 -3\n4 5 6\n");
+  
+  umat U;
+  
+  REQUIRE( U.load(ss_u, raw_ascii) );
+  REQUIRE( U(0,2) == 0 );
+  REQUIRE( U(1,2) == 6 );
+  }
+
+
+
+TEST_CASE("io_text_3")
+  {
+  std::stringstream ss("1 2 3\n4 5\n");
+  
+  mat A;
+  
+  REQUIRE( A.load(ss, raw_ascii) == false );
+  }
+
+
+
+TEST_CASE("io_text_4")
+  {
+  mat A = randn<mat>(70,9) * 1e3;
+  
+  A(0,0) = 0.0;
+  A(1,0) = -0.0;
+  A(2,0) = Datum<double>::nan;
+  A(3,0) = Datum<double>::inf;
+  A(4,0) = -Datum<double>::inf;
+  A(5,0) = 1e-310;
+  
+  imat B = randi<imat>(20,5, distr_param(-1000,1000));
+  
+  // a locale other than the classic one makes save() use the stream for formatting each element;
+  // the output must be the same as when the elements are formatted into blocks of text
+  
+  std::stringstream ss_blocks;
+  std::stringstream ss_stream;
+  
+  ss_stream.imbue( std::locale(std::locale::classic(), new std::numpunct<char>) );
+  
+  REQUIRE( A.save(ss_blocks, raw_ascii) );
+  REQUIRE( A.save(ss_stream, raw_ascii) );
+  REQUIRE( A.save(ss_blocks, csv_ascii) );
+  REQUIRE( A.save(ss_stream, csv_ascii) );
+  REQUIRE( B.save(ss_blocks, arma_ascii) );
+  REQUIRE( B.save(ss_stream, arma_ascii) );
+  
+  REQUIRE( ss_blocks.str() == ss_stream.str() );
+  
+  std::stringstream ss_small;
+  
+  mat C(1,3);
+  
+  C(0,0) = 1.5;
+  C(0,1) = -Datum<double>::inf;
+  C(0,2) = -0.0;
+  
+  REQUIRE( C.save(ss_small, csv_ascii) );
+  
+  REQUIRE( ss_small.str() == "1.50000000000000e+00,-inf,0.00000000000000e+00\n" );
+  }
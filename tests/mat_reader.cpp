@@ -0,0 +1,100 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+#include <cstdio>
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+TEST_CASE("mat_reader_1")
+  {
+  const std::string name = "mat_reader_1.bin";
+  
+  mat A = randu<mat>(7,250);
+  
+  mat_writer<double> W(name, arma_binary);
+  
+  for(uword col=0; col < A.n_cols; col += 60)
+    {
+    REQUIRE( W.write( A.cols(col, (std::min)(col+59, A.n_cols-1)) ) );
+    }
+  
+  REQUIRE( W.close() );
+  
+  mat B;
+  
+  REQUIRE( B.load(name) );
+  
+  REQUIRE( approx_equal(A, B, "absdiff", 0.0) );
+  
+  mat_reader<double> R(name, auto_detect, 100);
+  
+  running_stat_vec<vec> stats;
+  
+  mat   X;
+  mat   C;
+  uword n_blocks = 0;
+  
+  while(R.next(X))
+    {
+    REQUIRE( X.n_rows == A.n_rows );
+    REQUIRE( X.n_cols <= 100      );
+    
+    for(uword i=0; i < X.n_cols; ++i)  { stats(X.col(i)); }
+    
+    C = join_rows(C, X);
+    
+    ++n_blocks;
+    }
+  
+  REQUIRE( n_blocks == 3 );
+  
+  REQUIRE( approx_equal(A, C, "absdiff", 0.0) );
+  
+  REQUIRE( approx_equal(stats.mean(), mean(A,1), "absdiff", 1e-12) );
+  
+  std::remove(name.c_str());
+  }
+
+
+
+TEST_CASE("mat_reader_2")
+  {
+  const std::string name = "mat_reader_2.csv";
+  
+  mat A = randu<mat>(230,5);
+  
+  mat_writer<double> W(name, csv_ascii);
+  
+  REQUIRE( W.write( A.rows(  0, 99) ) );
+  REQUIRE( W.write( A.rows(100,229) ) );
+  
+  REQUIRE( W.write( randu<mat>(4,3) ) == false );
+  
+  REQUIRE( W.close() );
+  
+  mat_reader<double> R(name, csv_ascii, 64);
+  
+  mat X;
+  mat C;
+  
+  while(R.next(X))
+    {
+    REQUIRE( X.n_cols == A.n_cols );
+    
+    C = join_cols(C, X);
+    }
+  
+  REQUIRE( approx_equal(A, C, "reldiff", 1e-12) );
+  
+  std::remove(name.c_str());
+  }
@@ -0,0 +1,82 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+#include <cstdio>
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+TEST_CASE("mmap_mat_1")
+  {
+  const std::string name = "mmap_mat_1.bin";
+  
+  mat A = randu<mat>(37,11);
+  
+  REQUIRE( A.save(name, arma_binary) );
+  
+  mmap_mat<double> X;
+  
+  REQUIRE( X.load(name) );
+  
+  REQUIRE( X.M.n_rows == A.n_rows );
+  REQUIRE( X.M.n_cols == A.n_cols );
+  
+  REQUIRE( approx_equal(X.M, A, "absdiff", 0.0) );
+  
+  mat B;
+  
+  REQUIRE( B.load(name) );
+  
+  REQUIRE( approx_equal(B, A, "absdiff", 0.0) );
+  
+  #if defined(ARMA_HAVE_POSIX_MMAP)
+    {
+    REQUIRE( X.is_mapped() );
+    }
+  #endif
+  
+  X.reset();
+  
+  REQUIRE( X.M.n_elem == 0 );
+  REQUIRE( X.is_mapped() == false );
+  
+  std::remove(name.c_str());
+  }
+
+
+
+TEST_CASE("mmap_mat_2")
+  {
+  const std::string name = "mmap_mat_2.bin";
+  
+  fmat A = randu<fmat>(20,3);
+  
+  REQUIRE( A.save(name, raw_binary) );
+  
+  mmap_mat<float> X(name, raw_binary);
+  
+  REQUIRE( X.M.n_rows == A.n_elem );
+  REQUIRE( X.M.n_cols == 1        );
+  
+  REQUIRE( approx_equal(X.M, vectorise(A), "absdiff", 0.0f) );
+  
+  // element type mismatch: can't be mapped or loaded
+  
+  mmap_mat<double> Y;
+  
+  REQUIRE( Y.load(name, arma_binary, false) == false );
+  REQUIRE( Y.M.n_elem == 0 );
+  
+  REQUIRE_THROWS( mmap_mat<double> Z("mmap_mat_nonexistent.bin") );
+  
+  std::remove(name.c_str());
+  }
@@ -0,0 +1,122 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+
+TEST_CASE("running_stat_vec_1")
+  {
+  // batches of samples and merged objects must match samples given one at a time
+  
+  mat X = randn<mat>(6, 1000);
+  
+  X.row(2) += 1e6;
+  
+  running_stat_vec<vec> A(true);
+  running_stat_vec<vec> B(true);
+  running_stat_vec<vec> C(true);
+  running_stat_vec<vec> D(true);
+  
+  for(uword col=0; col < X.n_cols; ++col)  { A(X.col(col)); }
+  
+  B.add_samples(X);
+  
+  C.add_samples(X.cols(0, 399));
+  C(X.col(400));
+  
+  for(uword col=401; col < 700; ++col)  { D(X.col(col)); }
+  
+  D.add_samples(X.cols(700, 999));
+  
+  C.merge(D);
+  
+  REQUIRE( B.count() == Approx(1000.0) );
+  REQUIRE( C.count() == Approx(1000.0) );
+  
+  REQUIRE( approx_equal(B.mean(),  A.mean(),  "reldiff", 1e-10) );
+  REQUIRE( approx_equal(C.mean(),  A.mean(),  "reldiff", 1e-10) );
+  REQUIRE( approx_equal(B.var(),   A.var(),   "reldiff", 1e-8 ) );
+  REQUIRE( approx_equal(C.var(),   A.var(),   "reldiff", 1e-8 ) );
+  REQUIRE( approx_equal(C.var(1),  A.var(1),  "reldiff", 1e-8 ) );
+  REQUIRE( approx_equal(B.cov(),   A.cov(),   "absdiff", 1e-8 ) );
+  REQUIRE( approx_equal(C.cov(),   A.cov(),   "absdiff", 1e-8 ) );
+  REQUIRE( approx_equal(B.min(),   A.min(),   "absdiff", 0.0  ) );
+  REQUIRE( approx_equal(C.max(),   A.max(),   "absdiff", 0.0  ) );
+  
+  const vec col_var = var(X, 0, 1);
+  
+  REQUIRE( approx_equal(B.var(), col_var, "reldiff", 1e-8) );
+  }
+
+
+
+TEST_CASE("running_stat_vec_2")
+  {
+  cx_mat X = randu<cx_mat>(4, 300);
+  
+  running_stat_vec<cx_vec> A(true);
+  running_stat_vec<cx_vec> B(true);
+  running_stat_vec<cx_vec> C(true);
+  
+  for(uword col=0; col < X.n_cols; ++col)  { A(X.col(col)); }
+  
+  B.add_samples(X.cols(0, 99));
+  C.add_samples(X.cols(100, 299));
+  
+  B.merge(C);
+  
+  REQUIRE( B.count() == Approx(300.0) );
+  
+  REQUIRE( approx_equal(B.mean(), A.mean(), "absdiff", 1e-10) );
+  REQUIRE( approx_equal(B.var(),  A.var(),  "absdiff", 1e-10) );
+  REQUIRE( approx_equal(B.cov(),  A.cov(),  "absdiff", 1e-10) );
+  REQUIRE( approx_equal(B.min(),  A.min(),  "absdiff", 0.0  ) );
+  REQUIRE( approx_equal(B.max(),  A.max(),  "absdiff", 0.0  ) );
+  }
+
+
+
+TEST_CASE("running_stat_vec_3")
+  {
+  // samples with non-finite elements are ignored
+  
+  mat X = randu<mat>(3, 10);
+  
+  X(1,4) = Datum<double>::nan;
+  X(2,7) = Datum<double>::inf;
+  
+  running_stat_vec<vec> A;
+  
+  A.add_samples(X);
+  
+  REQUIRE( A.count() == Approx(8.0) );
+  
+  const uvec keep = { 0, 1, 2, 3, 5, 6, 8, 9 };
+  
+  const vec M = mean(X.cols(keep), 1);
+  
+  REQUIRE( approx_equal(A.mean(), M, "absdiff", 1e-12) );
+  
+  // merging with an empty object, and with itself
+  
+  running_stat_vec<vec> B;
+  
+  B.merge(A);
+  B.merge(B);
+  
+  REQUIRE( B.count() == Approx(16.0) );
+  
+  REQUIRE( approx_equal(B.mean(), M, "absdiff", 1e-12) );
+  REQUIRE( approx_equal(B.var(1), A.var(1), "absdiff", 1e-12) );
+  }
@@ -0,0 +1,79 @@
+// Copyright (C) 2026 agent
+// 
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// -------------------------------------------------------------------
+// 
+// Written by agent - agent@local
+
+
+#include <cstdio>
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+TEST_CASE("save_async_1")
+  {
+  const std::string name_A = "save_async_1_A.bin";
+  const std::string name_S = "save_async_1_S.bin";
+  const std::string name_F = "save_async_1_F.bin";
+  
+  mat A = randu<mat>(40,30);
+  
+  const mat A_orig = A;
+  
+  std::future<bool> result_A = A.save_async(name_A, arma_binary, true);
+  
+  A.zeros();  // must not affect the saved data
+  
+  sp_mat S = sprandu<sp_mat>(20,10,0.2);
+  
+  std::future<bool> result_S = S.save_async(name_S);
+  
+  field<vec> F(2);
+  
+  F(0) = randu<vec>(5);
+  F(1) = randu<vec>(6);
+  
+  std::future<bool> result_F = F.save_async(name_F);
+  
+  REQUIRE( result_A.get() );
+  REQUIRE( result_S.get() );
+  REQUIRE( result_F.get() );
+  
+  mat B;
+  
+  REQUIRE( B.load(name_A) );
+  
+  REQUIRE( approx_equal(A_orig, B, "absdiff", 0.0) );
+  
+  sp_mat T;
+  
+  REQUIRE( T.load(name_S) );
+  
+  REQUIRE( approx_equal(mat(S), mat(T), "absdiff", 0.0) );
+  
+  field<vec> G;
+  
+  REQUIRE( G.load(name_F) );
+  
+  REQUIRE( approx_equal(F(1), G(1), "absdiff", 0.0) );
+  
+  std::remove(name_A.c_str());
+  std::remove(name_S.c_str());
+  std::remove(name_F.c_str());
+  }
+
+
+
+TEST_CASE("save_async_2")
+  {
+  cube C = randu<cube>(2,3,4);
+  
+  std::future<bool> result = C.save_async("save_async_no_such_dir/C.bin");
+  
+  REQUIRE( result.get() == false );
+  }